@@ -33,7 +33,7 @@ U_NAMESPACE_BEGIN
 
 class LoadedNormalizer2Impl : public Normalizer2Impl {
 public:
-    LoadedNormalizer2Impl() : memory(NULL), ownedTrie(NULL) {}
+    LoadedNormalizer2Impl() : memory(NULL), ownedTrie(NULL), ownedCanonTrie(NULL) {}
     virtual ~LoadedNormalizer2Impl();
 
     void load(const char *packageName, const char *name, UErrorCode &errorCode);
@@ -44,11 +44,13 @@ class LoadedNormalizer2Impl : public Normalizer2Impl {
 
     UDataMemory *memory;
     UCPTrie *ownedTrie;
+    UCPTrie *ownedCanonTrie;
 };
 
 LoadedNormalizer2Impl::~LoadedNormalizer2Impl() {
     udata_close(memory);
     ucptrie_close(ownedTrie);
+    ucptrie_close(ownedCanonTrie);
 }
 
 UBool U_CALLCONV
@@ -108,6 +110,21 @@ LoadedNormalizer2Impl::load(const char *packageName, const char *name, UErrorCod
     const uint8_t *inSmallFCD=inBytes+offset;
 
     init(inIndexes, ownedTrie, inExtraData, inSmallFCD);
+
+    // Optional, precomputed CanonicalIterator data.
+    offset=inIndexes[IX_CANON_TRIE_OFFSET];
+    nextOffset=inIndexes[IX_CANON_START_SETS_OFFSET];
+    if(offset<nextOffset) {
+        ownedCanonTrie=ucptrie_openFromBinary(UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32,
+                                              inBytes+offset, nextOffset-offset, NULL,
+                                              &errorCode);
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        offset=nextOffset;
+        nextOffset=inIndexes[IX_RESERVED5_OFFSET];
+        setCanonIterData(ownedCanonTrie, (const uint16_t *)(inBytes+offset), (nextOffset-offset)/2);
+    }
 }
 
 // instance cache ---------------------------------------------------------- ***
@@ -140,8 +157,10 @@ static icu::UInitOnce nfcInitOnce = U_INITONCE_INITIALIZER;
 static Norm2AllModes *nfkcSingleton;
 static icu::UInitOnce nfkcInitOnce = U_INITONCE_INITIALIZER;
 
+#if !NORM2_HARDCODE_NFKC_CF_DATA
 static Norm2AllModes *nfkc_cfSingleton;
 static icu::UInitOnce nfkc_cfInitOnce = U_INITONCE_INITIALIZER;
+#endif
 
 static UHashtable    *cache=NULL;
 
@@ -154,9 +173,13 @@ static void U_CALLCONV initSingletons(const char *what, UErrorCode &errorCode) {
 #endif
     if (uprv_strcmp(what, "nfkc") == 0) {
         nfkcSingleton    = Norm2AllModes::createInstance(NULL, "nfkc", errorCode);
-    } else if (uprv_strcmp(what, "nfkc_cf") == 0) {
+    } else
+#if !NORM2_HARDCODE_NFKC_CF_DATA
+    if (uprv_strcmp(what, "nfkc_cf") == 0) {
         nfkc_cfSingleton = Norm2AllModes::createInstance(NULL, "nfkc_cf", errorCode);
-    } else {
+    } else
+#endif
+    {
         U_ASSERT(FALSE);   // Unknown singleton
     }
     ucln_common_registerCleanup(UCLN_COMMON_LOADED_NORMALIZER2, uprv_loaded_normalizer2_cleanup);
@@ -179,9 +202,11 @@ static UBool U_CALLCONV uprv_loaded_normalizer2_cleanup() {
     nfkcSingleton = NULL;
     nfkcInitOnce.reset();
 
+#if !NORM2_HARDCODE_NFKC_CF_DATA
     delete nfkc_cfSingleton;
     nfkc_cfSingleton = NULL;
     nfkc_cfInitOnce.reset();
+#endif
 
     uhash_close(cache);
     cache=NULL;
@@ -206,12 +231,14 @@ Norm2AllModes::getNFKCInstance(UErrorCode &errorCode) {
     return nfkcSingleton;
 }
 
+#if !NORM2_HARDCODE_NFKC_CF_DATA
 const Norm2AllModes *
 Norm2AllModes::getNFKC_CFInstance(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return NULL; }
     umtx_initOnce(nfkc_cfInitOnce, &initSingletons, "nfkc_cf", errorCode);
     return nfkc_cfSingleton;
 }
+#endif
 
 #if !NORM2_HARDCODE_NFC_DATA
 const Normalizer2 *
@@ -255,11 +282,13 @@ Normalizer2::getNFKDInstance(UErrorCode &errorCode) {
     return allModes!=NULL ? &allModes->decomp : NULL;
 }
 
+#if !NORM2_HARDCODE_NFKC_CF_DATA
 const Normalizer2 *
 Normalizer2::getNFKCCasefoldInstance(UErrorCode &errorCode) {
     const Norm2AllModes *allModes=Norm2AllModes::getNFKC_CFInstance(errorCode);
     return allModes!=NULL ? &allModes->comp : NULL;
 }
+#endif
 
 const Normalizer2 *
 Normalizer2::getInstance(const char *packageName,
@@ -366,11 +395,13 @@ Normalizer2Factory::getNFKCImpl(UErrorCode &errorCode) {
     return allModes!=NULL ? allModes->impl : NULL;
 }
 
+#if !NORM2_HARDCODE_NFKC_CF_DATA
 const Normalizer2Impl *
 Normalizer2Factory::getNFKC_CFImpl(UErrorCode &errorCode) {
     const Norm2AllModes *allModes=Norm2AllModes::getNFKC_CFInstance(errorCode);
     return allModes!=NULL ? allModes->impl : NULL;
 }
+#endif
 
 U_NAMESPACE_END
 
@@ -15,7 +15,7 @@ static const UVersionInfo norm2_nfc_data_formatVersion={4,0,0,0};
 static const UVersionInfo norm2_nfc_data_dataVersion={0xb,0,0,0};
 
 static const int32_t norm2_nfc_data_indexes[Normalizer2Impl::IX_COUNT]={
-0x50,0x4ab0,0x8708,0x8808,0x8808,0x8808,0x8808,0x8808,0xc0,0x300,0xadc,0x29d0,0x3c56,0xfc00,0x1282,0x3b8c,
+0x50,0x4ab0,0x8708,0x8808,0x15d80,0x16328,0x16328,0x16328,0xc0,0x300,0xadc,0x29d0,0x3c56,0xfc00,0x1282,0x3b8c,
 0x3c24,0x3c56,0x300,0
 };
 
@@ -1136,4 +1136,1071 @@ static const uint8_t norm2_nfc_data_smallFCD[256]={
 0,0,0,0,0,0,0,0,0,0,0,7,0,0,2,0
 };
 
+static const uint16_t norm2_nfc_data_canonIter_trieIndex[4696]={
+0,0x40,0x7b,0xb5,0xee,0xef,0xf7,0xee,0xee,0xee,0x11c,0xee,0x15c,0x18d,0x1bd,0x1fd,
+0x237,0x272,0x2af,0x2d7,0xee,0xee,0x306,0x344,0x377,0x3af,0xee,0x3ee,0x41d,0x452,0xee,0x467,
+0x4a5,0x4d3,0xee,0x500,0x540,0x57d,0x59c,0x5db,0x61a,0x657,0x665,0x657,0x6a2,0x6e1,0x70f,0x74e,
+0xee,0x788,0x79f,0x7df,0x7f6,0x74e,0xee,0x835,0x855,0x890,0x89c,0x890,0x8bc,0x8fc,0x93c,0x65e,
+0x112a,0x114a,0x116a,0x1180,0x11a0,0x11af,0x11c5,0x11e4,0x1204,0x1224,0x1244,0,0x10,0x20,0x30,0x40,
+0x50,0x60,0x70,0x7b,0x8b,0x9b,0xab,0xb5,0xc5,0xd5,0xe5,0xee,0xfe,0x10e,0x11e,0xef,
+0xff,0x10f,0x11f,0xf7,0x107,0x117,0x127,0xee,0xfe,0x10e,0x11e,0xee,0xfe,0x10e,0x11e,0x11c,
+0x12c,0x13c,0x14c,0xee,0xfe,0x10e,0x11e,0x15c,0x16c,0x17c,0x18c,0x18d,0x19d,0x1ad,0x1bd,0x1bd,
+0x1cd,0x1dd,0x1ed,0x1fd,0x20d,0x21d,0x22d,0x237,0x247,0x257,0x267,0x272,0x282,0x292,0x2a2,0x2af,
+0x2bf,0x2cf,0x2df,0x2d7,0x2e7,0x2f7,0x307,0xee,0xfe,0x10e,0x11e,0xee,0xfe,0x10e,0x11e,0x306,
+0x316,0x326,0x336,0x344,0x354,0x364,0x374,0x377,0x387,0x397,0x3a7,0x3af,0x3bf,0x3cf,0x3df,0xee,
+0xfe,0x10e,0x11e,0x3ee,0x3fe,0x40e,0x41e,0x41d,0x42d,0x43d,0x44d,0x452,0x462,0x472,0x482,0xee,
+0xfe,0x10e,0x11e,0x467,0x477,0x487,0x497,0x4a5,0x4b5,0x4c5,0x4d5,0x4d3,0x4e3,0x4f3,0x503,0xee,
+0xfe,0x10e,0x11e,0x500,0x510,0x520,0x530,0x540,0x550,0x560,0x570,0x57d,0x58d,0x59d,0x5ad,0x59c,
+0x5ac,0x5bc,0x5cc,0x5db,0x5eb,0x5fb,0x60b,0x61a,0x62a,0x63a,0x64a,0x657,0x667,0x677,0x687,0x665,
+0x675,0x685,0x695,0x657,0x667,0x677,0x687,0x6a2,0x6b2,0x6c2,0x6d2,0x6e1,0x6f1,0x701,0x711,0x70f,
+0x71f,0x72f,0x73f,0x74e,0x75e,0x76e,0x77e,0xee,0xfe,0x10e,0x11e,0x788,0x798,0x7a8,0x7b8,0x79f,
+0x7af,0x7bf,0x7cf,0x7df,0x7ef,0x7ff,0x80f,0x7f6,0x806,0x816,0x826,0x74e,0x75e,0x76e,0x77e,0xee,
+0xfe,0x10e,0x11e,0x835,0x845,0x855,0x865,0x875,0x885,0x890,0x8a0,0x8b0,0x8c0,0x89c,0x8ac,0x8bc,
+0x8cc,0x890,0x8a0,0x8b0,0x8c0,0x8bc,0x8cc,0x8dc,0x8ec,0x8fc,0x90c,0x91c,0x92c,0x93c,0x94c,0x95c,
+0x96c,0x65e,0x66e,0x67e,0x68e,0xee,0xee,0x977,0x97e,0xee,0xee,0xee,0xee,0x3d2,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x61,0x78,0xee,0xee,0xee,0xee,0x19c,0x1b7,0xee,0xee,0x30f,
+0x170,0x1ba,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x30a,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3db,0xee,0x3db,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x98c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3d6,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x4e3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x6f0,0xee,0xee,0xee,0xee,0x1bc,0x99a,0xee,0xee,0xee,0x1af,
+0xee,0xee,0xee,0xee,0x9aa,0xba,0xee,0x9b8,0x9c8,0xee,0x30c,0x1b9,0xee,0xee,0x8ca,0xee,
+0xee,0xee,0x3d9,0x6f5,0xee,0xee,0xee,0x3d8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x199,0x9d8,0x9e1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x170,0x170,0x170,0x192,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xbe,
+0xee,0xee,0xee,0xbf,0x9ef,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x1b0,0x9fe,0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xa0e,0xee,0xee,
+0xee,0xa0e,0xee,0xee,0xa1b,0xee,0xa28,0xc1,0xa35,0xee,0xa41,0xa4f,0xa5d,0x2ee,0xa6b,0xa79,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xa7f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x308,0x1bb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x308,0xee,0xee,0xee,0xee,0xee,0xee,0x170,0x170,0xa8d,0xee,0x30d,0xee,0xa97,0xaa1,0xaaf,
+0xabc,0xee,0xac8,0xa97,0xaa1,0xaaf,0xabc,0xbe,0xad8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xae6,0xee,0xaf5,0xee,0xb01,0xee,0xee,
+0xee,0xb11,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xb17,0xb26,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xb35,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xb37,0xee,0xee,0xee,0xb47,0xb4b,0xee,0xee,0xee,0xee,0xb58,0xee,0xb65,0xee,
+0xee,0xb69,0xee,0xb76,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xb81,0xee,0xee,0xee,0xb90,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xb9d,0xee,0xba5,0xbae,
+0xee,0xee,0xbb8,0xee,0xee,0xee,0xee,0xbc2,0xee,0xee,0xee,0xee,0xee,0xee,0xbd0,0xee,
+0xee,0xbd9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xbe8,0xee,0xee,0xee,0xee,0xee,0xbf2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xbf9,0xc06,0xee,0xee,0xee,0xee,0xee,0xc0f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xc1b,0xc28,0xc31,0xee,0xc3a,0xc44,0xee,0xee,0xee,0xee,
+0xc4e,0xee,0xee,0xee,0xee,0xc5b,0xee,0xee,0xee,0xc5f,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xc6f,0xee,0xc78,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xc88,0xee,0xee,0xee,0xee,0xee,0xc97,0xee,0xee,0xca3,0xee,0xcaa,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xcb5,0xee,0xee,0xcbf,0xee,0xee,0xee,0xee,0xee,0xccb,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xcd7,0xee,0xee,0xce3,0xcf2,0xee,0xee,
+0xee,0xee,0xee,0xee,0xcfe,0xee,0xd06,0xee,0xee,0xee,0xd11,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xd17,0xd26,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xd31,0xee,0xee,
+0xee,0xee,0xd3b,0xee,0xee,0xee,0xee,0xee,0xee,0xd42,0xd51,0xee,0xee,0xee,0xd5f,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xd6c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xd70,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xd7f,0xee,0xd8e,0xd9c,
+0xee,0xee,0xee,0xee,0xee,0xda6,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xdad,0xee,0xdbb,0xdc9,0xdd8,0xee,0xee,0xee,0xde6,0xee,0xded,0xee,0xdfd,0xee,0xe0a,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xe1a,0xee,0xe2a,0xee,0xe36,0xe45,0xee,0xee,0xee,0xee,
+0xe55,0xee,0xe5a,0xee,0xee,0xee,0xee,0xe66,0xee,0xe71,0xee,0xee,0xe7b,0xe8b,0xe96,0xee,
+0xee,0xee,0xee,0xee,0xea6,0xeb4,0xec0,0xece,0xede,0xeec,0xef8,0xf05,0xf0d,0xf1a,0xee,0xf29,
+0xf36,0xf3f,0xf47,0xf51,0xf5d,0xee,0xee,0xf6b,0xf73,0xf7d,0xf8a,0xf97,0xfa0,0xfae,0xfbd,0xfc8,
+0xfd3,0xfdc,0xee,0xfe4,0xff4,0x1003,0xee,0x1010,0xee,0xee,0xee,0xee,0x1020,0x102b,0x103b,0x104a,
+0x1054,0x1064,0xee,0x1072,0x1080,0xee,0x1089,0xee,0xee,0x1092,0x10a1,0x10a4,0xee,0xee,0xee,0x10b2,
+0xee,0x10c2,0xee,0xee,0xee,0x10cf,0x10dc,0xee,0x10e8,0x10f0,0x10fe,0x110b,0x111b,0xee,0x1129,0xee,
+0x1133,0xee,0xee,0xee,0xee,0x1142,0x114a,0x1156,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x115d,
+0xee,0x1167,0xee,0xee,0xee,0xee,0xee,0xee,0x116f,0xee,0xee,0xee,0x117b,0xee,0xee,0x118a,
+0x118f,0xee,0xee,0x119e,0x11ae,0x11b4,0xee,0xee,0xee,0xee,0x11c3,0x11d0,0xee,0x11d8,0x11e8,0x11f7,
+0x1201,0x1208,0x1216,0xee,0x1222,0x1231,0x123f,0x124c,0xee,0xee,0xee,0xee,0xee,0x1254,0x125d,0xee,
+0x126a,0x1276,0xee,0xee,0xee,0x1284,0xee,0xee,0xee,0xee,0x128f,0xee,0xee,0xee,0xee,0x1297,
+0xee,0x12a0,0x12a9,0xee,0xee,0xee,0xee,0x12b8,0xee,0xee,0xee,0x12c5,0x12cd,0x12d6,0x12e5,0x12f5,
+0xee,0x1303,0x1306,0xee,0xee,0x1316,0xee,0x1325,0xee,0xee,0xee,0x1335,0xee,0xee,0xee,0xee,
+0x133c,0xee,0xee,0x1349,0x1359,0x135e,0x136d,0xee,0xee,0xee,0x137b,0xee,0xee,0x138a,0x138d,0xee,
+0xee,0x139b,0x13a4,0xee,0xee,0x13b2,0x13be,0xee,0xee,0x13c8,0x13d8,0x13df,0x13ed,0x13f7,0x1404,0x1413,
+0xee,0x1421,0xee,0xee,0x142e,0x143c,0xee,0x1448,0x1454,0x145f,0xee,0x146d,0x147b,0xee,0x1486,0xee,
+0x1494,0xee,0xee,0xee,0xee,0xee,0x14a1,0x14b0,0x14bc,0xee,0xee,0x14c5,0x14cd,0x14dc,0xee,0x14e4,
+0xee,0xee,0xee,0x14f0,0xee,0x1500,0x1509,0x1514,0x1524,0x1530,0x1540,0xee,0x1543,0xee,0x1552,0x1562,
+0x1572,0x157e,0x158d,0xee,0x1592,0xee,0xee,0xee,0xee,0xee,0x15a1,0x15a8,0x15b8,0xee,0x15bd,0xee,
+0xee,0xee,0x15cc,0xee,0x15dc,0x15e4,0x15ed,0x15fa,0xee,0x160a,0xee,0x1616,0xee,0x1622,0xee,0x1627,
+0x1635,0xee,0xee,0x1643,0x164a,0x1654,0xee,0x1663,0xee,0xee,0x1671,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x1676,0x1686,0x168d,0x169a,0xee,0x16a3,0xee,0xee,0x16ae,0xee,0x16bc,0xee,0x16c9,0xee,
+0xee,0x16d0,0xee,0xee,0x16dc,0x16e4,0x16f3,0xee,0x1700,0x170a,0xee,0xee,0x1716,0x1726,0x172f,0x173e,
+0xee,0x1740,0x174f,0xee,0x175e,0x176a,0x1773,0xee,0xee,0xee,0xee,0xee,0x1780,0xee,0x178b,0xee,
+0xee,0xee,0x179b,0xee,0xee,0x17aa,0xee,0x17b9,0xee,0xee,0xee,0xee,0xee,0xee,0x17c5,0xee,
+0xee,0x17d3,0xee,0xee,0xee,0xee,0xee,0x17e0,0xee,0xee,0xee,0x17e6,0xee,0x17f4,0x1801,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1809,0xee,0xee,0x1816,0xee,0xee,0x1822,0xee,0x1831,
+0xee,0xee,0x183d,0xee,0x184b,0xee,0x1855,0x1865,0x1874,0xee,0xee,0xee,0xee,0x1880,0xee,0x188f,
+0xee,0x1897,0xee,0xee,0x18a0,0x18b0,0xee,0x18be,0xee,0xee,0x18c8,0xee,0x18d7,0x18e6,0xee,0x18ed,
+0x18f8,0x1903,0xee,0xee,0xee,0x1909,0x1915,0x1920,0x192b,0xee,0x1935,0x1940,0xee,0xee,0xee,0x1950,
+0xee,0xee,0x195f,0xee,0x196c,0x1977,0x1986,0xee,0xee,0x1992,0xee,0x19a2,0xee,0xee,0xee,0x19a6,
+0xee,0xee,0xee,0xee,0xee,0x19b5,0xee,0x19bc,0x19c8,0xee,0x19d7,0xee,0x19e6,0x19f0,0xee,0xee,
+0x1a00,0xee,0x1a0e,0x1a18,0xee,0x1a26,0x1a2f,0xee,0xee,0xee,0xee,0xee,0xee,0x1a3a,0xee,0x1a44,
+0xee,0xee,0x1a53,0xee,0xee,0x1a60,0x1a70,0xee,0xee,0x1a80,0x1a8c,0x1a98,0xee,0x1aa8,0x1ab6,0xee,
+0x1ac6,0x1ad1,0x1ad7,0xee,0x1ae7,0xee,0xee,0x1aeb,0xee,0xee,0x1af8,0xee,0xee,0xee,0xee,0x1b03,
+0x1b0e,0xee,0x1b1a,0x1b28,0xee,0x1b2b,0xee,0xee,0x1b3a,0xee,0x1b48,0xee,0x1b51,0x1b59,0x1b66,0x1b75,
+0x1b80,0x1b8a,0xee,0xee,0x1b93,0xee,0xee,0xee,0x1b9e,0xee,0x1baa,0x1baf,0xee,0x1bbe,0x1bc9,0x1bd9,
+0xee,0xee,0xee,0xee,0xee,0xee,0x1be7,0xee,0x1bf7,0xee,0xee,0x1c07,0xee,0x1c0e,0xee,0xee,
+0xee,0xee,0xee,0x1c18,0x1c23,0x1c2f,0x1c3b,0x1c4a,0x1c4c,0xee,0xee,0x1c5c,0xee,0xee,0xee,0x1c67,
+0xee,0x1c73,0xee,0xee,0xee,0xee,0xee,0x1c7b,0xee,0x1c8a,0xee,0x1c96,0x1ca5,0xee,0xee,0x1cab,
+0xee,0xee,0x1cb8,0xee,0xee,0x1cc4,0x1ccf,0x1cde,0x1cee,0x1cfd,0x1d03,0x1d13,0xee,0x1d23,0xee,0x1d32,
+0xee,0x1d3d,0xee,0x1d49,0xee,0xee,0x1d59,0xee,0xee,0xee,0x1d69,0xee,0xee,0x1d78,0x1d7d,0xee,
+0x1d89,0xee,0xee,0xee,0x1d99,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1da9,0xee,
+0xee,0xee,0x1db3,0xee,0xee,0x1dc3,0x1dc8,0xee,0x1dd6,0xee,0x1dd9,0xee,0x1de8,0x1df5,0xee,0x1e05,
+0x1e15,0x1e23,0xee,0xee,0x1e33,0x1e40,0xee,0xee,0xee,0x1e50,0x1e52,0x1e61,0xee,0xee,0x1e6d,0x1e7b,
+0xee,0xee,0x1e85,0x1e94,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x1e9a,0xee,0xee,0xee,0x1ea9,0x1eb4,0x1ebf,0xee,0x1eca,0xee,0xee,0xee,0x1ed8,0x1ee7,
+0xee,0xee,0xee,0x1ef1,0xee,0x1f01,0x1f11,0x1f20,0xee,0x1f2c,0x1f3a,0xee,0xee,0xee,0xee,0x1f47,
+0xee,0xee,0x1f4b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1f5a,0x1f63,0xee,0x1f72,
+0x1f7a,0xee,0xee,0xee,0xee,0x1f83,0x1f93,0x1f9d,0x1fac,0xee,0x1fbb,0xee,0xee,0x1fc9,0xee,0xee,
+0x1fd0,0x1fde,0x1fe8,0xee,0x1ff6,0x2003,0xee,0xee,0xee,0x2007,0x2015,0x2023,0x2030,0x203d,0x204d,0xee,
+0xee,0xee,0x2050,0x205e,0x2068,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2070,0x207f,0xee,
+0x208c,0xee,0xee,0xee,0xee,0x2098,0xee,0xee,0xee,0xee,0xee,0x209d,0xee,0xee,0x20ab,0x20b6,
+0x20c4,0x20c7,0x20d5,0xee,0x20e5,0x20f2,0xee,0x20fc,0xee,0x2105,0xee,0xee,0xee,0x2113,0xee,0x2116,
+0xee,0x2125,0xee,0xee,0xee,0x212e,0x213a,0x2144,0xee,0xee,0x214b,0xee,0xee,0x215a,0xee,0x2169,
+0x216b,0xee,0xee,0x217b,0xee,0x218b,0xee,0xee,0xee,0xee,0xee,0x2199,0x21a9,0x21b8,0x21c0,0xee,
+0x21d0,0xee,0xee,0x21df,0xee,0x21eb,0xee,0x21f5,0x2201,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2211,0x221c,0x222c,0x223a,0x2241,0x224f,0x225e,0xee,0xee,0x2265,0xee,0x226f,0xee,
+0xee,0x227f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x228a,0x2295,0xee,0xee,0xee,0xee,0x229b,
+0xee,0x22aa,0x22b7,0xee,0xee,0x22bf,0x22c8,0xee,0xee,0xee,0xee,0xee,0x22d4,0xee,0xee,0xee,
+0x22dc,0x22e9,0xee,0x22f5,0x2305,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x230b,0x2317,0xee,0xee,0xee,0xee,0x2321,0x232c,0xee,0xee,0x233a,0xee,0xee,0x233d,0xee,
+0x234d,0xee,0xee,0xee,0xee,0x235a,0x2362,0xee,0xee,0xee,0x2370,0x237d,0x238d,0xee,0xee,0x2392,
+0x23a1,0xee,0x23b0,0xee,0x23bf,0xee,0xee,0xee,0xee,0x23cb,0xee,0xee,0x23d6,0xee,0x23e2,0x23e7,
+0x23f7,0xee,0xee,0xee,0x2403,0xee,0xee,0xee,0x240d,0xee,0xee,0xee,0xee,0xee,0x241a,0xee,
+0xee,0x2426,0xee,0xee,0xee,0x242c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x2437,0xee,0x2442,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2448,0xee,0x2454,0x2462,0xee,0xee,0xee,
+0xee,0x246a,0xee,0x2479,0xee,0xee,0x2487,0x2494,0xee,0x24a1,0x24aa,0x24b7,0xee,0x24c5,0x24cf,0xee,
+0xee,0x24dc,0x24ea,0x24f2,0x24fc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2503,0x2513,0x2514,0x2524,
+0x2530,0x2539,0x2543,0xee,0x254f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x255e,0x256e,0xee,
+0xee,0x257b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2585,0xee,0x2593,0xee,0xee,0x25a2,0xee,
+0xee,0xee,0xee,0xee,0xee,0x25b1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x25bf,0xee,0xee,0xee,0xee,0x25c2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x25d2,
+0x25db,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x25e3,0xee,0xee,0xee,0xee,0xee,
+0xee,0x25f1,0xee,0xee,0xee,0xee,0x25fd,0xee,0xee,0xee,0x2603,0xee,0x260e,0xee,0xee,0xee,
+0xee,0xee,0x261d,0xee,0x262d,0xee,0x263d,0x2649,0xee,0xee,0x2658,0x2667,0x2677,0xee,0x267e,0x268b,
+0xee,0xee,0xee,0x268f,0x269e,0xee,0xee,0xee,0xee,0xee,0xee,0x308,0x26ab,0xee,0x309,0xee,
+0xee,0xee,0xee,0xee,0x1bb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x3d9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x3db,0xee,0x170,0x1bb,0xee,0xee,0x4e1,0xee,0xee,0x3dc,0xee,0xee,0xee,0xee,0xee,
+0x3dc,0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x26bb,0x3de,0xee,
+0xee,0x3d9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x3d2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x3d1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x170,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x3d2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2ac,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x6d1,0xee,0xee,0x26cb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x6f2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x894,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x311,0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x3d9,0xee,0xee,0x308,0xee,0x26db,0xb6,0x8cb,0xee,0xee,0xee,0xee,
+0x1ba,0xee,0x3d8,0x26ea,0xee,0xee,0xee,0x3dc,0xee,0xee,0xee,0xee,0x49a,0xee,0xee,0xee,
+0x6f2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x8cb,0xee,0xee,0xee,0xee,
+0x826,0x5db,0x3d8,0x26f4,0x1b8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2702,0x3d1,0xee,
+0xee,0xee,0xee,0xee,0x2712,0x6f5,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x308,0x2720,0x1bc,0xee,0xee,0xee,0x308,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x6f1,0xee,0xee,0xee,0xee,0xee,0xee,0x3d4,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x8cb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x3db,0x3d8,0xee,0xee,0xee,0xee,0x3d6,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x308,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x272d,0xee,0xee,0xee,0xee,0x3d8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x1b8,0xee,0xee,0xee,0x1b6,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3d1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2736,0x2741,
+0x274e,0x275b,0xee,0x2767,0x2775,0xee,0xee,0xee,0xee,0x4ea,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x195,0x2785,0x2793,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x1b6,0xee,0xee,0xee,0xee,0xee,0xee,0x279f,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x27ad,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x27b1,0x27be,0xee,0x27c4,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x27d0,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x27dc,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x27e1,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x27f0,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x27fd,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x2809,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2811,0xee,0xee,0xee,0x281a,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2825,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x282e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2837,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2843,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2850,0x2854,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2864,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x2870,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x287c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2887,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2896,0x289c,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28a7,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28b0,0xee,0xee,0xee,0x28c0,0xee,0xee,
+0x28cd,0x28d8,0xee,0xee,0xee,0xee,0xee,0xee,0x28de,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x28ec,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28f5,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28fd,0xee,
+0xee,0xee,0xee,0xee,0xee,0x290b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2916,0xee,0xee,0xee,0xee,0xee,0x2923,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2932,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2934,0xee,0xee,0x2943,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2952,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2956,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2965,0xee,0xee,0xee,0xee,0xee,0x2971,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x297c,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2988,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2992,0xee,0xee,0xee,0xee,0xee,0x29a0,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x29af,0x29b7,0xee,0xee,0xee,0xee,0x29c3,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x29d1,0xee,0x29d8,0xee,0x29e5,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x29ec,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x29f6,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2a04,0xee,0xee,0xee,0xee,0xee,0xee,0x2a0b,0xee,0xee,0x2a16,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a1c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2a29,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2a31,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a41,0xee,0xee,0xee,0xee,
+0x2a51,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a5b,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a62,0xee,0xee,0x2a6d,0xee,0x2a76,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2a7e,0xee,0xee,0xee,0xee,0xee,0x2a88,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a97,0xee,0xee,0xee,0xee,0x2aa4,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2aac,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2ab5,0x2ac0,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2ac6,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2ad3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2ade,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2ae4,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2af0,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2aff,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x2b0d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b13,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2b1e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b26,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b35,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2b3d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b4a,0xee,0xee,0xee,0xee,
+0x2b4e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b5e,0x2b61,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2b6f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2b7e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b89,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b94,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b9a,0xee,0xee,0x2baa,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2bb5,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2bc0,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2bca,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2bda,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2bdc,0xee,0xee,0xee,0x2beb,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2bf1,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2c00,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2c0e,0xee,0xee,0xee,0xee,0xee,0xee,0x2c1e,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x4b,0x67,0x87,0xa7,0xc7,0xe7,
+0x107,0x125,0x145,0x162,0x178,0x187,0x1a5,0x1c4,0x1e4,0x204,0x224,0x244,0x178,0x178,0x178,0x257,
+0x269,0x178,0x289,0x178,0x2a0,0x2b2,0x2d0,0x2ee,0x30d,0x327,0x347,0x367,0x387,0x3a7,0x3b4,0x3d3,
+0x3f0,0x410,0x430,0x450,0x470,0x490,0x4b0,0x4cf,0x4ef,0x50f,0x52f,0x54f,0x56e,0x58d,0x5ad,0x5cd,
+0x5e9,0x609,0x629,0x648,0x668,0x687,0x6a3,0x6c2,0x6df,0x6ff,0x71f,0x73f,0x75f,0x77f,0x79f,0x7b9,
+0x7d5,0x7f5,0x813,0x831,0x851,0x86f,0x88f,0x8af,0x8cb,0x8eb,0x178,0x178,0x178,0x905,0x925,0x942,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x961,0x178,0x97f,
+0x982,0x9a2,0x178,0x178,0x178,0x9c2,0x9d1,0x9e4,0xa00,0xa1d,0xa39,0xa56,0xa73,0xa90,0xaad,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0xac7,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0xade,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0xae9,0xb05,0x178,0x178,
+0x178,0x178,0x178,0x178,0xb25,0x178,0x178,0x178,0xb38,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0xb4d,0x178,0xb60,0xb7d,0xb9d,0xbbb,0x178,0x178,0x178,0x178,0xbd2,0xbe8,
+0xbf7,0xc14,0xc26,0x178,0xc45,0xc5f,0x178,0xc73,0xc8f,0xc9f,0x178,0x178,0xcbf,0xcd4,0xcf2,0xd08,
+0xd1e,0xd36,0xd4b,0xd5e,0x178,0xd78,0x178,0xd98,0xdb7,0x178,0xdd4,0xdde,0xdfa,0xe16,0xe35,0xe53,
+0xe60,0xe78,0xe93,0xea1,0xeba,0xed8,0xeec,0xf07,0x178,0xf23,0xf40,0xf57,0xf73,0xf81,0x178,0xf9e,
+0xfb4,0x178,0xfcb,0xfde,0x178,0x178,0xff1,0x1010,0x178,0x1023,0x1043,0x178,0x105b,0x107a,0x109a,0x178,
+0x178,0x10b6,0x178,0x178,0x10ca,0x10ea,0x178,0x110a
+};
+
+static const uint32_t norm2_nfc_data_canonIter_trieData[11310]={
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x37e,0x40000000,0x40000000,0x40000000,0,
+0,0x4000212b,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x4000212a,0x40000000,0x40000000,0x40000000,0x40000000,
+0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0,0,0,
+0x1fef,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,
+0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x40001fee,0,0,0,0,0,0,0,0,0,0,0,0x1ffd,
+0,0,0x387,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x374,0,0,0,0,0,0,0x80000340,0x80000341,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000344,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000343,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40001fbb,0,
+0,0,0x40001fc9,0,0x40001fcb,0,0x40001fdb,0,0,0,0,0,0x40001ff9,0,0x40000000,0,
+0,0,0x40001feb,0,0,0,0x40200013,0,0,0,0,0,0,0,0x40001f71,0,
+0,0,0x40001f73,0,0x40001f75,0,0x40200007,0,0,0,0,0,0x40001f79,0,0x40000000,0,
+0,0,0x4020000e,0,0,0,0x40001f7d,0,0,0,0,0,0,0,0,0x40000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0x40000000,0,0,0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,
+0,0x40000000,0,0,0,0x40000000,0,0,0,0,0x40000000,0,0,0,0x40000000,0,
+0,0,0x40000000,0,0x40000000,0,0,0x40000000,0,0,0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,
+0,0x40000000,0,0,0,0x40000000,0,0,0,0x40000000,0,0,0,0x40000000,0,0x40000000,
+0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x40000000,0x40000000,0,0,0,0,0,0,0,0,
+0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0,0x80000000,0x80000000,0,0x80000000,0,0,0,0,
+0,0,0,0,0x2000e2,0x2000ef,0xfb32,0xfb33,0xfb34,0x2000ea,0xfb36,0,0xfb38,0x2000e5,0xfb3a,0x2000f4,
+0xfb3c,0,0xfb3e,0,0xfb40,0xfb41,0,0xfb43,0x2000f9,0,0xfb46,0xfb47,0xfb48,0x2000dd,0xfb4a,0,
+0,0,0,0,0,0,0xfb1f,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x40000000,0,0x40000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x40000000,0,0,0x40000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0,0,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,
+0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x958,0x959,0x95a,0,0,0,0,0x95b,0,0,0,
+0,0x95c,0x95d,0,0,0,0,0,0x40000000,0,0,0x95e,0,0,0,0x95f,
+0x40000000,0,0,0x40000000,0,0,0,0,0,0,0,0,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,0,0x80000000,0x80000000,
+0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x9dc,0x9dd,0,
+0,0,0,0,0,0,0,0,0,0,0,0x9df,0,0,0,0,
+0,0,0,0,0,0,0,0,0x80000000,0,0x80000000,0,0,0,0,0,
+0,0,0x40000000,0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,
+0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x80000000,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xa59,0xa5a,0,0,0,0,0xa5b,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xa5e,0,0,0,0,0,0,0xa33,0,0,0,
+0,0,0xa36,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xb5c,0xb5d,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,
+0x80000000,0,0,0,0,0,0,0,0x40000000,0,0,0,0,0,0x80000000,0,
+0,0,0,0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,
+0,0,0,0,0x40000000,0x40000000,0,0,0,0,0,0x80000000,0,0,0,0,
+0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0x80000000,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,0x40000000,0,
+0,0x80000000,0,0,0,0x40000000,0,0,0,0,0,0,0x80000000,0,0,0,
+0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x80000000,0x80000000,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0x80000000,
+0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,
+0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x80000000,0,0x80000000,0,0x80000000,0,0,0,0,0,0,0xf69,0,0xf43,0,
+0,0,0,0,0,0,0,0,0xf4d,0,0,0,0,0xf52,0,0,
+0,0,0xf57,0,0,0,0,0xf5c,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x80200000,0x80000000,0,
+0x80000000,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0,0x80000000,0x80000000,
+0x80000000,0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0xfb9,0,0xf93,0,
+0,0,0,0,0,0,0,0,0xf9d,0,0,0,0,0xfa2,0,0,
+0,0,0xfa7,0,0,0,0,0xfac,0,0,0,0,0,0,0xf76,0xf78,
+0,0x80000000,0,0x80000000,0,0,0,0,0,0,0,0,0x40000000,0,0,0,
+0,0,0,0,0,0x80000000,0,0x80000000,0x80000000,0,0,0,0,0,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0x80000000,0,0,0,0,0,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0,0,0,0,0,0x40000000,
+0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0,0,0,0x80000000,0x80000000,0,0,
+0,0,0x40000000,0,0x40000000,0,0x40000000,0x40000000,0,0,0x40000000,0,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0,0,0,0,0x80000000,0,0,0,0x80000000,0x80000000,0,0,0,0,0,
+0,0x2000,0x2001,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,
+0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x40000000,0,
+0x40000000,0,0x40000000,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0x40000000,0,0,0x40000000,0,0,0,0,0x40000000,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0,0x40000000,0,0x40000000,0,0,0x40000000,0,0,
+0,0,0x40000000,0,0,0x40000000,0x40000000,0,0,0,0,0,0,0,0,0,
+0,0x40000000,0x40000000,0,0,0x40000000,0x40000000,0,0,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0x40000000,
+0x40000000,0,0,0x40000000,0x40000000,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0x40000000,0x40000000,0,0x40000000,0,0,0,0,0x40000000,0x40000000,0x40000000,0x40000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2adc,0,0,0,
+0,0,0,0,0,0x2329,0x232a,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,
+0x40000000,0,0,0x40000000,0,0x40000000,0,0x40000000,0,0,0,0,0,0,0x40000000,0,
+0,0x40000000,0,0,0x40000000,0,0,0x40000000,0,0,0,0,0,0,0,0,
+0,0x80000000,0x80000000,0,0,0x40000000,0,0,0x40000000,0x40000000,0x40000000,0,0,0,0,0,
+0,0,0,0,0,0x40000000,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f80c,0,0,0,0,0,0,0,0,0,0x2f813,0,
+0x2f9ca,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f81f,0,0,0,0,0,0x2f824,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f867,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f868,0,0,0,0x2f876,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f883,0,0,0x2f888,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f88a,0,0,0,0,0,0,0,0x2f896,
+0,0,0,0,0,0,0,0,0x2f89b,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f8a2,0,0,0,0,0,0,0,0,0,0,
+0x2f8a1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8c2,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f8c7,0,0,0,
+0,0x2f8d1,0,0,0,0,0,0,0,0,0,0,0,0x2f8d0,0,0,
+0,0,0,0,0,0,0,0x2f8ce,0,0,0,0,0,0,0,0,
+0,0x2f8de,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2001f8,
+0,0,0,0,0,0,0,0,0x2f8ee,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f8f2,0,0,0,0x2f90a,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f916,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f92a,0,0,0,0,0,0,0,0,0x200220,0,
+0,0,0,0,0,0,0,0,0,0,0x2f933,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f93e,0,0,0,0,0,0,0,0,
+0x2f93f,0,0,0,0,0,0,0,0,0xfad3,0,0,0,0,0,0,
+0,0,0,0x20024c,0,0,0,0,0,0,0x2f94b,0,0,0,0,0,
+0,0,0,0,0x2f94c,0,0,0,0,0,0,0,0,0,0x2f951,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f958,0,
+0,0x2f960,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f964,
+0,0,0,0,0,0,0,0,0x2f967,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f96d,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f971,0,0,0,0,0,0,0,0,
+0,0,0,0x2f974,0,0,0,0,0,0,0x2f981,0,0,0,0x2f8d7,0,
+0,0,0,0,0,0,0,0,0,0,0x2f984,0,0,0,0,0,
+0,0,0,0,0,0,0x2f98e,0,0,0,0,0,0,0,0,0,
+0,0,0x2f9a7,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f9ae,0,0,0x2f9af,0,0,0,0,0,0,0,0,0,0x2f9b2,0,0,
+0,0,0,0,0,0x2f9bf,0,0,0,0,0,0,0,0,0,0x2f9c2,
+0,0,0,0,0,0,0x2f9c8,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f9cd,0,0,0,0,0,0,0,0x2f9ce,0,0,
+0,0,0,0,0,0,0x2f9ef,0,0,0,0,0,0,0,0,0,
+0,0x2f9f2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f9f8,0,0,0,0,0,0,0x2f9f9,0,0,0,0,0,0,0,0,
+0,0x2f9fc,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa03,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa08,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa0d,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2fa0e,0,0,0,0,
+0,0,0,0,0x2fa11,0,0,0,0,0,0,0,0x2fa16,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf967,0,0,0,0,0,
+0,0xfa70,0,0,0,0,0,0,0,0,0,0xf905,0,0,0,0,
+0,0x2f801,0xf95e,0,0,0,0x2f800,0,0,0x2f802,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf91b,0,0,0,0xf9ba,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf977,0,0xf9fd,0,0,
+0,0,0,0,0,0,0,0,0,0x2f819,0,0,0,0,0xf9a8,0,
+0,0,0,0,0,0,0,0,0,0,0x2f804,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xfa73,0,0,0,0,0,
+0xf92d,0,0,0,0,0xf9b5,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x200120,0,0,0,0,0,0,0,0,0,0,0,
+0x2f806,0,0,0,0xf965,0,0,0x2f807,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9d4,0,0,0,0,0,0,0,0,0,0,
+0x2f808,0,0,0,0,0,0,0,0,0,0x2f809,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f80b,0,0,0,0,0,
+0,0,0,0,0,0xf9bb,0,0,0,0,0,0,0,0x200128,0,0,
+0,0,0,0,0,0,0xfa0c,0,0,0,0,0xfa74,0,0,0,0,
+0,0,0,0x200130,0,0,0,0,0x2f80f,0,0,0,0,0,0,0,
+0,0,0,0,0x2f810,0,0,0x2f814,0xfa72,0xf978,0,0,0,0xf9d1,0,0,
+0,0,0,0,0,0x2f811,0,0,0,0,0,0,0,0,0xfa75,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f815,0,0,0x2f8d2,0,
+0,0x2f8d3,0,0x2f817,0,0,0,0,0,0,0,0,0x2f818,0,0,0,
+0,0,0,0,0x2f81a,0,0,0,0,0,0x200138,0,0xf92e,0,0,0,
+0,0,0,0,0,0,0xf979,0,0,0xf955,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf954,0,0xfa15,0,0,0,0,0,0x2f81d,0,
+0,0,0,0,0,0,0,0,0,0x2f81e,0,0,0,0x20018c,0,0,
+0,0,0,0,0,0,0xf99c,0,0,0,0,0,0,0,0,0,
+0xf9dd,0,0,0,0,0,0,0,0,0,0,0xf9ff,0x2f820,0,0,0,
+0,0,0,0x2f821,0,0,0,0,0,0,0,0,0,0x2f822,0,0,
+0,0,0x2f823,0,0,0,0,0,0,0,0,0,0xf9c7,0,0,0,
+0,0,0,0,0,0,0,0,0xf98a,0,0,0,0,0xf99d,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f992,0,0,0,0,0,
+0,0,0,0,0,0,0,0x200140,0,0x200148,0,0,0,0,0,0,
+0xf952,0,0,0,0,0,0,0,0,0,0,0,0xf92f,0,0,0,
+0,0x200150,0,0,0,0,0,0,0,0,0,0,0,0xf97f,0,0,
+0,0,0x200158,0,0,0,0,0,0x2f829,0x2f82a,0,0,0,0,0,0,
+0,0,0,0x200160,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf9eb,0,0,0,0,0,0,0,0,0,0x2f82c,0,0,
+0,0,0,0,0x200168,0,0,0,0,0,0,0,0,0x2f82e,0,0,
+0,0,0,0x2f82f,0,0xf91c,0,0,0,0,0,0,0,0x2f830,0,0x200170,
+0,0,0,0xf96b,0,0,0,0,0,0,0x2f836,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f837,0,0,0,0,0,
+0xf906,0,0,0,0,0,0x2f839,0,0,0,0,0x2f83a,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f83b,0,0,0,0,0,
+0,0,0,0xf9de,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf9ed,0,0,0,0,0,0,0,0,0x2f83d,0,0,0,0,0,
+0,0,0xf980,0,0,0,0,0,0x2f83e,0,0,0,0,0,0,0,
+0,0x2f83f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f83c,0,0,0x2f840,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf99e,0,0,0,0,0,0,0x2f841,0,0,0,0,0,0,0,
+0,0,0x2f842,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f843,0,0xfa79,0,0,0,0,0,0,0,0,0,0,0x2f844,
+0,0,0,0,0,0,0,0,0,0,0,0,0x200176,0,0,0xf90b,
+0,0,0,0,0,0,0,0,0,0x20017c,0,0,0,0x200047,0,0,
+0,0,0,0,0,0,0,0,0,0x2f848,0,0,0,0,0x2f849,0,
+0,0,0,0,0,0,0,0,0,0,0,0xfa0d,0,0x2f84a,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xfa7b,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x200184,0,0,0,0,0,0,
+0,0,0,0x2f84e,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xfa38,0,0,0,0,0,0,0,0x2f84f,0,0,0,0,0,
+0,0,0,0,0,0,0xf9a9,0,0,0,0,0,0,0x2f84b,0x2f84d,0,
+0,0,0,0,0,0,0,0,0,0,0x2f855,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f852,0,0,0,0,0x2f853,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f854,0,0,0x2f857,
+0x2f856,0,0,0,0,0,0,0,0,0,0,0,0,0,0xfa39,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x20004c,0,
+0,0,0xf96c,0,0,0,0,0,0,0,0,0xfa3a,0,0,0,0x2f858,
+0,0,0,0xfa7d,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf94a,0,0,0,0,0,0,0xf942,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f851,0,0,0x2f85a,0,0,0,0,0x2f85b,0,
+0,0,0,0,0,0,0,0x2f85c,0,0,0,0,0,0,0,0,
+0,0,0x2f85d,0,0,0,0,0,0x2f85e,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xfa7e,0,0,0,0xf90c,0,0,0,0,0,
+0,0,0xf909,0,0,0xfa7f,0,0,0,0,0,0,0,0,0,0,
+0,0x2f85f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf981,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f865,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f862,0,0,0,0,0,0,
+0,0,0,0,0,0x2f863,0,0,0,0,0,0,0,0x2f864,0,0,
+0,0,0,0,0,0,0xfa80,0,0,0,0x2f866,0,0,0,0,0,
+0,0,0,0,0x2f986,0,0,0,0,0,0,0,0,0,0,0x2f869,
+0,0,0,0,0,0,0,0,0xfa81,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x200194,0,0,0,0,0,0xfa04,0,0,
+0,0,0,0,0,0,0,0,0x2f86d,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f86e,0,0,0,0,0,0,0,0x200029,0,0,
+0,0,0,0,0xf9bc,0,0,0,0x2f870,0,0,0,0,0,0,0,
+0,0,0,0,0x2f872,0,0,0,0,0,0,0x2f873,0,0,0,0,
+0,0,0,0,0,0x2f875,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9bd,0x2f877,0,0xf94b,0,0xfa3b,0xf9df,0,0,0,0,
+0,0,0,0,0x20019a,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f87a,0,0,0x2f879,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9d5,0,0,0,0,0,0,0x2f87c,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf921,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f87f,0,0,0x2f87e,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f880,0,0,0,0x2f9f4,0,0,
+0,0,0,0,0,0xf9ab,0,0,0,0,0,0x2f881,0x2f882,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f884,0,0,0,0,0,
+0,0,0,0x2f885,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f886,0,0,0,0,0,0,0,0,0,0x2f887,0,0,0,0,
+0,0,0xf98e,0,0,0,0,0,0,0,0,0,0,0,0xfa01,0,
+0,0,0,0,0,0,0,0,0x2f88b,0,0,0x2f88c,0,0,0x2f88d,0,
+0,0,0,0,0,0,0,0,0xf9a2,0x2001a2,0,0,0,0,0,0xfa82,
+0xfa0b,0,0,0,0,0,0xfa83,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf982,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f890,0,0,0,0,0xf943,0,0,0,0,0,0,0,0,
+0,0,0,0x2001b0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f874,0,0,0,0,0,0,0,0,0,0,0,0,0x2f899,0,
+0,0,0,0,0,0xfa84,0,0x2f89a,0,0,0,0,0,0,0,0,
+0,0,0,0xf9d8,0,0,0,0,0,0,0,0,0,0,0x2f89c,0,
+0,0,0,0,0,0,0,0,0xf966,0,0,0,0xfa85,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f89d,0,0,0,0,0,
+0,0,0x2f89e,0,0,0,0,0,0,0,0,0xf9a3,0,0,0,0x2f89f,
+0,0,0,0,0,0,0xf960,0,0,0,0,0,0,0,0,0,
+0xf9ac,0,0,0,0,0,0xfa6b,0,0,0,0,0,0,0,0,0,
+0,0x2f8a0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2001b6,0,0,0,0,0,0,0,0,0,0,0,0x2f8a5,0,0,0,
+0,0,0,0,0,0xfa86,0,0,0,0,0,0,0,0xf9b9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xfa88,0,0,0,
+0,0,0,0,0xf9d9,0,0,0,0x2f8a6,0,0,0,0x2001c6,0,0x2001be,0,
+0xfa8a,0,0,0,0,0,0,0,0xfa3e,0,0,0,0,0,0,0,
+0,0,0,0x2f8aa,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x200051,0,0xf98f,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f8ad,0,0,0,0,0,0,0,0,0,0,0x2f8ae,
+0,0,0x2f8ac,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f8af,0,0,0x20005b,0,0,0,0x2001d0,0,0,0,0,0,0,0,
+0,0,0xf990,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f8b2,0,0,0,0,0,0,0,0,0,0,0x2f8b3,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf9d2,0,0,0,
+0,0xfa8c,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8b4,
+0,0,0x2f8b5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf925,0,0,0,0,0,0xf95b,0,0,0,0xfa02,0x2f8b6,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8ba,0,0xf973,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8b9,0,0,0x2f8b7,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f8bb,0,0,0,
+0,0,0,0,0,0,0,0,0xf9a4,0,0,0,0,0x2f8bc,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf975,0,0,0,0,0,
+0,0,0,0x2f8c1,0,0,0,0,0,0,0xfa8d,0x2f8c0,0,0,0,0,
+0,0,0,0,0,0,0x2f8bd,0,0,0,0,0,0,0,0,0,
+0,0,0,0xfa8e,0,0,0,0x2f8bf,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xfa8f,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f8c3,0,0,0,0,0,0,0,0x2f8c6,0,0,0,0,
+0,0,0x2f8c4,0,0,0,0,0,0,0,0,0,0,0xf991,0,0,
+0x2f8c5,0,0,0,0,0xf930,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2001d8,0,0,0,0,0,0,0xfa90,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8c9,0,0,0,0,0,0,
+0,0,0xf969,0,0,0,0,0,0,0,0,0,0xf9be,0,0,0,
+0,0,0,0xf983,0,0,0,0,0,0,0,0,0,0,0xfa42,0x2f8cb,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf9e0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8cd,0,0,0,0,0,0,
+0x200065,0,0,0,0,0,0,0,0,0,0,0,0xf9c5,0,0,0,
+0,0,0,0,0x2001e0,0,0,0,0,0,0,0,0,0,0,0x2f8d5,
+0,0,0,0,0xfa06,0,0,0,0,0,0,0,0,0,0,0,
+0xf98b,0,0,0,0,0,0,0,0,0,0xf901,0,0,0,0x2f8cc,0,
+0,0,0,0,0,0,0x2f8d4,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x20006a,0,0,0,0x2001e8,0,0,0,0,0x2f8da,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9e1,0,
+0,0,0x2f8dc,0,0,0xfa94,0,0,0,0,0,0,0,0x2f8db,0,0,
+0,0,0,0,0,0,0,0,0,0xf9c8,0,0,0,0,0,0x2f8e0,
+0,0,0,0,0,0,0,0,0,0,0xf9f4,0,0,0,0,0,
+0,0,0,0xf9c9,0,0,0,0,0,0,0x2f8df,0,0,0,0,0,
+0,0,0xf9da,0,0,0,0,0,0,0,0x2f8e5,0,0,0x2f8e1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf97a,0,0,0,0x2001f0,
+0,0,0,0,0,0,0,0,0x2f8e4,0,0,0,0,0,0,0,
+0,0xf9e2,0,0,0,0,0,0,0,0x2f8e6,0,0,0,0,0,0,
+0,0,0,0,0,0x2f8e8,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f8e9,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f8ea,0,0,0,0,0,0x20001d,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf94c,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f8eb,0,0,0,0,0,0,0,0xf931,0,0,0,0,0,0,
+0,0x2f8ed,0,0,0,0,0xf91d,0,0,0,0,0,0,0,0,0,
+0,0,0x2f8ef,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f8f1,0,0,0,0,0,0,0,0,0,0,0,0x2f8f3,0,0,
+0,0,0xf98c,0,0xfa95,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f8f4,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf9a5,0,0,0,0,0,0,0,0,0,0,0x200074,0x2f8f6,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8fa,0,
+0,0,0,0,0,0,0x2f8fe,0,0,0,0,0,0,0,0,0xf972,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8fc,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf968,0x2f8fd,0,0,
+0,0,0,0xf9e3,0,0,0,0,0,0,0,0,0,0,0x2f8ff,0,
+0,0,0,0xf915,0,0,0xfa05,0,0,0,0,0x2f907,0,0,0,0,
+0,0,0,0,0,0x2f900,0,0x20007e,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f903,0xf92a,0,0,0,0,0,0,0,0x200200,
+0x2f904,0,0,0,0,0,0,0,0x2f905,0,0,0,0,0,0,0,
+0,0,0,0,0xf9f5,0,0,0,0,0,0,0,0,0,0,0xf94d,
+0,0,0,0,0,0,0,0,0,0,0xf9d6,0,0,0,0,0,
+0,0,0,0,0x2f90e,0,0,0,0,0,0,0,0,0,0,0xfa46,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f908,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f909,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf9cb,0,0,0,0,
+0,0,0,0,0,0,0xf9ec,0,0,0,0,0,0,0,0x2f90c,0,
+0,0,0x200208,0,0,0,0,0xf904,0,0,0,0,0,0,0,0,
+0,0xfa98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf94e,0,0,0x200088,0xf992,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f90f,0,0,0,0,0,0,0x2f912,0,0,0,0,
+0,0,0,0,0,0,0,0xf922,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf984,0,0,0,0,0,0,0,0,0,
+0,0,0x2f915,0,0,0x200210,0,0,0,0,0,0,0,0,0,0x2f913,
+0,0,0,0,0,0,0,0,0,0,0x2f917,0,0,0,0,0,
+0x2f835,0,0,0,0,0,0,0x2f919,0,0,0,0,0,0x2f918,0,0,
+0,0,0,0,0,0,0,0xf9fb,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f91a,0,0,0,0,0,0,0,0,0xf99f,0,
+0,0,0,0,0,0,0,0,0xf916,0,0,0,0,0,0,0x2f91c,
+0,0,0,0xf993,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x20008d,0,0,0,0,0,0,0,0,0,0,0,0,0x2f91e,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9c0,0,
+0xf9ee,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf932,0,0,0,0,0,0,0,0,0,0,0xf91e,0,0,0,0,
+0,0,0,0,0x2f920,0,0,0xfa49,0,0,0,0,0,0x200218,0,0,
+0,0,0,0,0,0,0,0,0x2f922,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf946,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f924,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f925,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xfa9f,0xf9fa,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf92b,0,0,0,0,0,0,0,0,
+0,0,0x200092,0,0,0,0,0,0xf9a7,0,0,0,0,0x2f928,0,0,
+0,0,0,0,0,0x200033,0,0,0,0x2f929,0,0,0,0,0,0x2f92b,
+0,0,0,0,0,0,0,0,0,0,0xf9ad,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf917,0,0,0,0,0,0,
+0xf9e4,0,0,0xf9cc,0,0,0,0,0,0,0xfa4a,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f92e,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f92f,0,0,0,0,0,0,0,0,0,0xf9ae,
+0,0,0,0,0,0,0x200226,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f931,0,0,0,0xf994,0,0,0,0,0,0,
+0,0,0xf9ef,0,0,0,0,0,0,0,0,0,0,0x2f932,0,0,
+0,0,0,0,0xfaa2,0,0,0,0,0,0,0,0,0,0x2f934,0,
+0,0,0,0,0,0,0,0,0,0,0xfaa3,0,0,0x2f936,0,0,
+0,0,0,0,0,0,0,0xf9cd,0,0,0,0,0,0,0xf976,0,
+0,0,0,0,0,0,0,0,0,0x20022e,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf9e5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f93a,0,0,0,0,0,0,0,0,
+0,0,0,0,0xfaa4,0,0xfaa5,0,0,0xf9c1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf90e,0,0,0,0,0,0,0,0,
+0,0,0x200097,0,0,0,0,0,0,0,0,0,0,0,0xfaa7,0,
+0,0,0,0,0,0,0xf933,0,0,0,0,0,0,0,0,0x200236,
+0,0,0,0,0,0,0,0,0,0,0,0xf96d,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f945,0x20023e,0xfaaa,0,0,0,
+0,0,0,0,0,0,0x200244,0,0,0,0,0,0,0,0,0,
+0,0,0x2f94a,0,0,0,0,0,0,0,0xfa9d,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f94e,0,0,0,0,0,0,
+0,0,0,0,0,0xf9ce,0,0,0,0,0,0,0,0,0,0,
+0,0,0x200254,0,0,0,0xfa4b,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf947,0,0x20025c,0,0,0,0,0,0,0,0,
+0,0,0,0xf964,0,0,0,0,0,0,0,0,0,0,0xf985,0,
+0,0,0,0,0,0,0,0,0,0,0,0xfa18,0,0xfa4c,0,0,
+0,0,0,0,0,0,0xfa4e,0xfa4d,0,0,0,0,0,0,0xfa4f,0,
+0,0,0,0,0x200264,0,0,0,0,0,0,0xfa51,0xfa19,0,0,0,
+0,0,0xfa1a,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf93c,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xfa52,0xfa53,0x20026c,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf9b6,0,0,0,0,0,0,0,0,0,0,0xf995,0,0,0,
+0,0,0,0,0,0,0,0,0x2f957,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf956,0,0,0,0x200274,0,0,0,0,0,0,
+0,0,0,0x2f95a,0,0,0,0,0x2f95b,0,0xfa55,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xfaac,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf9f7,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f95f,0,0xf9f8,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x20009c,0,0,0,0,0,0x2f962,
+0,0,0x2f963,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf9a6,0,0xf944,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xfaae,0,0,0,0,0xf9f9,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xfa1d,0,0,0x2f966,0,0,0,0xfa03,0,
+0,0,0,0,0,0,0,0,0x2f969,0,0,0,0xf97b,0x2f968,0,0,
+0,0,0,0,0,0x2f96a,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9cf,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf96a,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf94f,0,0,0,0,0,0,0,0,0,0,0,0xfaaf,0,
+0,0,0,0x2f96c,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf93d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf957,0,0,0,0,0,0,0,0x2f96e,0,0,0,0,0,0,0,
+0,0x200038,0,0,0,0,0,0,0,0,0,0,0,0x2f96f,0,0,
+0,0,0,0,0xfa58,0,0,0,0,0,0,0,0xf950,0,0,0,
+0,0,0,0,0,0xfa59,0,0,0,0x2f970,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xfab1,0,0,0xfa5a,0,0,0,0,
+0,0,0xf9e6,0x2f976,0,0,0,0,0,0xf90f,0,0,0,0,0,0,
+0,0,0,0,0x2f978,0,0,0,0,0xf9af,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xfa1e,0,0,0,0,0,0,0,0,
+0,0,0x2f979,0,0,0,0,0,0xf934,0,0,0,0x2000a1,0,0,0,
+0,0,0,0,0,0,0,0xf9b0,0,0,0,0,0,0,0,0,
+0,0x2f97d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf997,0x2f97f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf945,
+0,0,0,0,0,0,0,0,0,0,0,0xf953,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8d6,0,0,0x2f982,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f983,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f985,0,0,0,0,0,0,
+0,0,0xf926,0,0,0,0,0,0,0,0,0xf9f6,0,0,0,0,
+0xfa5c,0,0,0x200282,0,0,0x2f98c,0,0,0,0,0,0,0,0,0,
+0,0,0xfa6d,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf97c,0,0,0,0,0,0,0,0,0,0x20003f,0,0,0,
+0,0,0,0,0,0,0,0,0x2f990,0,0,0,0,0x2f98f,0,0,
+0,0,0,0,0,0,0,0,0,0x2f991,0,0,0x2f993,0,0x2f994,0,
+0,0,0,0,0,0,0,0,0x2f995,0,0,0,0,0,0x20028c,0x2f996,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f999,0,0,
+0,0x2f99c,0,0,0,0,0,0,0,0,0,0,0,0,0xf9fe,0,
+0,0,0,0,0,0,0,0,0xfab3,0x2f9a0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f99a,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f99b,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f99d,0,0,0,0,0,0,0,0,0,0xf93e,0x2f9a1,0,0x2f9a2,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f9a3,0,0,0,
+0,0,0,0,0x2f99e,0,0,0,0,0,0,0,0xfab4,0,0xf958,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf918,0,0,
+0,0,0,0,0,0,0,0xf96e,0,0,0,0,0,0,0,0x200294,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf999,0,
+0x2f9a8,0,0x2f9a9,0,0,0,0,0,0,0,0,0xf9c2,0,0,0,0,
+0,0,0x2f9aa,0,0,0,0,0,0,0,0,0,0x2f9ac,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf923,0,0,0,0,0,
+0,0,0,0,0,0xf9f0,0,0,0,0,0,0,0xf935,0,0,0,
+0,0,0,0,0,0,0xfa20,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf91f,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf910,0x2f9b3,0,0,0,0,0,0,0,0,0,0,
+0,0x20029c,0,0,0,0,0,0,0,0x2f9b5,0,0x2f9b6,0,0,0,0,
+0,0,0,0,0x2f9b8,0,0,0,0,0,0,0,0,0,0x2f9b7,0,
+0,0,0,0,0,0x2f9ba,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f9b9,0,0,0,0,0,0,0,0,0x2f9bc,0,0,
+0,0,0,0,0,0,0,0,0,0x2f9bd,0,0,0,0,0,0,
+0,0,0,0x2002a4,0,0,0,0,0,0,0x2f9be,0,0,0,0,0,
+0,0,0,0,0,0xf911,0,0,0,0,0,0x2f9c0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f9c1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf927,0,0,0,0,0,
+0,0,0,0,0,0,0,0xfa08,0,0,0,0x2f9c3,0,0,0x2f9c4,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf9a0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf9e7,0,0,0,0,0,0,0,
+0x2f9c6,0,0,0,0,0,0,0x2f9c7,0,0xf9e8,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf912,0,0x2f9c9,0,0,0,0,0,
+0xfa60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xfab6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf924,
+0,0,0,0,0,0,0,0,0,0,0,0xfab7,0,0,0,0,
+0xfa0a,0,0,0,0,0,0,0x2000ab,0,0,0,0,0,0,0,0,
+0,0x2f9cf,0,0,0,0,0,0,0,0,0,0x200024,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xfab9,0,0,0,0,
+0,0,0,0,0,0,0,0xfabb,0,0,0,0,0xf97d,0,0,0,
+0xf941,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2002ac,0,
+0,0,0,0,0,0,0,0x2000b0,0,0,0,0,0,0x2000ba,0,0x2000b5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2000bf,0,
+0,0,0,0,0,0,0,0xf9fc,0,0,0,0,0,0,0,0xf95a,
+0,0,0,0,0,0,0,0,0,0x2002b4,0,0,0,0,0,0,
+0,0,0xf900,0,0,0,0,0,0,0,0x2f9d2,0,0,0,0,0,
+0,0,0,0,0,0,0x2f9d4,0,0,0,0,0x2f9d5,0xf948,0,0,0,
+0,0,0xf903,0,0,0,0,0,0,0,0xfa64,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2000c4,0,0,0,0,0,0,0,0,
+0,0,0,0x2f9d6,0,0,0,0,0,0,0,0x2f9d7,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f9db,0,0,0,0,0,0,0,
+0,0,0,0,0x2f9da,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf937,0x2f9dc,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf902,0,0,0,0,0,0x2f9de,0,0,0,0,
+0,0,0,0,0,0,0,0xf998,0,0,0,0xf9d7,0,0,0,0,
+0,0,0,0,0x2002bc,0,0,0xfa07,0,0,0,0,0xf98d,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f98d,0,0xf971,0,0,
+0,0,0,0xfa66,0,0,0,0,0,0,0,0,0,0xf99a,0,0,
+0,0,0,0,0,0,0,0,0,0,0x200042,0,0,0,0,0,
+0,0,0xfac3,0,0,0,0,0,0,0,0,0,0xf9c3,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf913,0,0,0,
+0,0x2f9e2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf92c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xfa2e,
+0,0x2f9e3,0,0,0,0,0,0,0,0,0,0,0,0xfa26,0,0,
+0x2f9e4,0,0,0,0,0,0,0,0,0,0x2f9e6,0,0,0,0,0,
+0,0,0,0,0,0xf919,0,0,0,0,0,0,0,0,0,0xfac4,
+0,0,0,0,0,0,0xf9b7,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf9e9,0,0,0xf97e,0,0xf90a,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf9b1,0,0,0,0x2f9e7,0,0,0,0,
+0,0,0,0xfac5,0,0,0,0,0,0x2f9ea,0,0,0,0,0,0,
+0,0x2f9e8,0x2f9e9,0,0,0,0,0,0,0,0xf93f,0,0,0,0,0,
+0,0,0,0,0,0,0xf99b,0,0,0,0,0,0,0,0,0,
+0x2f9eb,0,0,0,0,0,0,0x2f9ec,0,0,0,0,0,0,0,0,
+0,0,0,0x2f9ee,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf986,0,0,0,0,0,0,0,0x2f9f0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf9c6,0,0,0,0,0,0,0,
+0,0,0,0,0xf951,0,0xfa09,0,0,0,0,0,0xf959,0,0,0xf9d3,
+0,0,0,0xfac6,0,0,0,0,0,0,0xf9dc,0,0,0,0,0,
+0,0,0,0,0xf9f1,0,0,0,0,0,0,0,0,0,0,0,
+0,0xfa2f,0xf9b8,0,0,0,0,0,0,0,0x2f9f3,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf9ea,0x2000c9,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9b2,0xf949,0,0,0,0,0,0,0,0,0x2f9f5,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf938,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf9b3,0,0,0,0,0,
+0,0,0x2000ce,0,0,0,0,0,0,0,0,0,0,0,0xfac9,0,
+0,0,0,0x2f9fa,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2000d3,0,0,0,0,0,0,0,0,0,0,0,0x2002c4,
+0,0,0,0,0,0,0,0,0xf9b4,0,0,0,0,0,0,0,
+0,0,0x2fa00,0,0,0,0,0,0,0,0,0,0,0,0x2000d8,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9d0,0,0,
+0x2fa02,0,0,0,0,0,0,0,0,0,0,0,0,0xfa2a,0,0,
+0,0,0,0,0,0,0,0,0,0,0xfa2b,0,0,0,0,0,
+0,0,0,0xfa2c,0x2fa04,0,0,0,0,0,0,0,0x2fa05,0,0,0,
+0,0,0,0,0,0x2fa06,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf91a,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2fa07,0,0,0,0,0,0,0,0,0,0,0xf987,0,0,0,0,
+0,0x2002cc,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf939,0x2fa0b,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf9f2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2fa0c,0,0,0,0,0,0,0,0x2fa0f,0,0,0,0,0,0,0,
+0,0xfa2d,0,0,0,0,0,0,0,0,0,0,0,0xf93a,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf920,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf940,0,0,0,
+0,0,0,0,0xf988,0,0,0,0,0,0,0,0xf9f3,0,0,0,
+0,0,0,0,0,0,0,0,0x2fa15,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf989,0,0,0,0,0,0,0,0,
+0,0x2fa17,0,0,0,0,0x2fa18,0,0,0,0,0,0x2fa19,0,0,0,
+0,0,0,0,0,0,0x2fa1a,0,0,0,0,0,0,0x2fa1b,0,0,
+0,0,0,0,0,0,0,0,0,0x2fa1c,0,0,0,0,0xfad8,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf9c4,0xfad9,0,0,
+0,0,0,0,0,0,0,0,0,0,0x200018,0,0,0,0,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0,0x80000000,0x80000000,0x80000000,
+0,0,0x80000000,0x80000000,0,0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,
+0,0,0,0x80000000,0x80000000,0x80000000,0,0,0,0,0x80000000,0,0,0,0,0,
+0,0,0,0,0x40000000,0,0x40000000,0,0,0,0,0x40000000,0x40000000,0x80000000,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0,0,0,0x80000000,0,0,0,0x80000000,0,0,0,0,0,0,0,
+0,0,0x80000000,0,0,0,0,0,0,0,0,0x40000000,0x80000000,0,0,0x80000000,
+0,0,0,0,0,0,0,0,0x40000000,0x40000000,0,0,0,0,0,0x80000000,
+0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0x1d15e,0x2000fe,0,
+0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0x80000000,0x80000000,
+0x80000000,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,
+0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0x200104,0x200112,
+0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,
+0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0x2f803,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f812,0,0,
+0,0,0,0x2f91b,0,0,0,0,0,0,0,0,0,0,0,0x2f816,
+0,0,0,0,0,0,0,0,0,0,0x2f80d,0,0,0,0,0,
+0x2f9d9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9dd,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f834,0,0,0,
+0x2f838,0,0,0,0,0,0,0,0,0,0,0,0,0x2f859,0,0,
+0,0,0,0,0,0,0,0,0,0x2f860,0,0,0,0,0,0,
+0,0,0,0,0x2f861,0,0,0,0,0,0,0,0,0x2f86c,0,0,
+0,0,0,0,0,0,0x2f871,0,0,0,0,0,0,0,0,0,
+0,0,0x2f8f8,0,0,0,0,0x2f87b,0,0x2f87d,0,0,0,0,0,0,
+0,0,0,0x2f889,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f939,0,0x2001aa,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f8a4,0,0,0,0,0,0,0,0,0,0,0,
+0xfad0,0,0,0,0,0,0xfacf,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f8b8,0,0,0,0x2f8be,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f8ca,0,0,0,0,0,0,0,0,0x2f897,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f980,
+0,0,0,0x2f989,0,0,0,0,0,0,0,0,0x2f98a,0,0,0,
+0x2f8dd,0,0,0,0,0,0,0,0,0,0,0,0,0xfad1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f8e3,0,0,0,0x2f8ec,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f8f0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f8f7,0,0,0,0,0,
+0,0,0,0,0,0x2f8f9,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f8fb,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f906,0,0x2f90d,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f910,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f911,0,0,0,0x2f91d,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xfa6c,0,0,0,0,0,0,0,0,0,0,0,
+0x2f91f,0,0,0,0,0,0,0,0,0x2f923,0,0,0,0,0,0,
+0,0x2f926,0,0,0,0,0,0,0,0,0,0,0x2f927,0,0,0,
+0,0,0,0,0,0,0,0,0x2f935,0,0,0,0,0,0,0,
+0,0,0x2f937,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f93b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f93c,
+0,0,0,0,0,0,0,0x2f93d,0,0,0,0,0,0,0,0,
+0,0,0,0x2f942,0x2f941,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f943,0,0,0,0,0,0,0x2f944,0,0,0,0,0,0,0,
+0,0,0,0,0,0xfad5,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f94d,0,0,0,0,0,0,0x2f952,0,0,0,0,0,
+0,0,0,0,0,0x2f954,0,0,0,0,0,0x2f955,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f95c,0,0,0,0,0,0,0,
+0x20027c,0,0,0,0,0,0,0,0,0,0,0,0x2f961,0,0,0,
+0,0x2f965,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xfad6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f96b,0,0,0,0,0,0,0,0,0,0,0x2f898,0,0,0,
+0,0,0,0,0,0x2f972,0,0,0,0,0,0,0,0x2f973,0,0,
+0,0,0,0,0,0,0,0x2f975,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f977,0,0,0,0,0,0,0,0,0,
+0,0x2f97b,0,0,0,0,0,0x2f97c,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f97e,0,0,0,0,0,0,0,0x2f987,0,0,0,
+0,0,0,0,0,0x2f988,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f997,0,0,0,0,0,0,0x2f9a4,0,0,0,0,0,0,
+0,0,0,0x2f9a6,0,0,0,0,0,0,0,0,0,0,0,0x2f9a5,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f9ad,0,0,0,
+0x2f9b0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9b1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9ab,0,0,
+0,0,0,0,0,0x2f9c5,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f9cb,0,0,0,0,0,0,0x2f9cc,0,0,0,0,
+0,0,0,0,0,0x2f9d3,0,0,0,0,0,0,0,0xfad7,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9d8,0,0,
+0x2f9e0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9e1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9e5,0,0,
+0,0,0,0,0,0,0,0,0x2f9ed,0,0,0,0,0,0,0,
+0x2f9f1,0,0,0,0,0,0,0,0,0x2f9f6,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f81c,0,0,0,0,0,0,
+0,0,0,0,0x2f9f7,0,0,0,0,0,0,0,0,0,0,0x2f9fb,
+0,0,0,0,0,0,0x2f9fd,0,0,0,0,0,0,0,0,0,
+0x2fa01,0,0,0,0,0,0,0,0,0,0x2fa09,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2fa10,0,0,0,0,0,
+0x2fa12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa13,
+0,0x2fa14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f88f,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa1d,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const UCPTrie norm2_nfc_data_canonIter_trie={
+    norm2_nfc_data_canonIter_trieIndex,
+    { norm2_nfc_data_canonIter_trieData },
+    4696, 11310,
+    0x2a800, 0x2b,
+    1, 1,
+    0, 0,
+    0x178, 0xee,
+    0x0,
+};
+
+static const uint16_t norm2_nfc_data_canonStartSets[724]={
+6,0xf73,0xf74,0xf75,0xf76,0xf81,0xf82,6,0x1f77,0x1f78,0x1fbe,0x1fbf,0x1fd3,0x1fd4,4,0x1f7b,
+0x1f7c,0x1fe3,0x1fe4,4,0x1ffb,0x1ffc,0x2126,0x2127,4,0xf907,0xf909,0xface,0xfacf,6,0xf914,0xf915,
+0xf95c,0xf95d,0xf9bf,0xf9c0,4,0xf96f,0xf970,0xf9a1,0xf9a2,0x8008,4,0xf95f,0xf960,0xf9aa,0xf9ab,2,
+0xf86f,2,0xf870,4,0xf961,0xf962,0xf9db,0xf9dc,6,0xf996,0xf997,0xfa57,0xfa58,0xfab0,0xfab1,2,
+0xfa5d,0xfa5f,4,0xfa25,0xfa26,0xfa67,0xfa68,4,0xfa36,0xfa37,0xfa78,0xfa79,4,0xfa10,0xfa11,0xfa7c,
+0xfa7d,0x8008,4,0xfa3f,0xfa40,0xfa89,0xfa8a,2,0xf8ab,2,0xf8ac,0x8008,4,0xfa40,0xfa41,0xfa8b,
+0xfa8c,2,0xf8b0,2,0xf8b1,4,0xfa12,0xfa13,0xfa91,0xfa92,0x8008,4,0xf929,0xf92a,0xfa92,0xfa93,
+2,0xf8d8,2,0xf8d9,0x8008,4,0xf970,0xf971,0xfa96,0xfa97,2,0xf8f5,2,0xf8f6,0x8008,4,
+0xf9ca,0xf9cb,0xfa97,0xfa98,2,0xf902,2,0xf903,4,0xfa47,0xfa48,0xfa9a,0xfa9b,4,0xfa48,0xfa49,
+0xfa9c,0xfa9d,4,0xfa16,0xfa17,0xfaa0,0xfaa1,4,0xfa17,0xfa18,0xfaa6,0xfaa7,4,0xfa56,0xfa57,0xfaad,
+0xfaae,0x8008,4,0xfa5b,0xfa5c,0xfab2,0xfab3,2,0xf97a,2,0xf97b,4,0xfa61,0xfa62,0xfab8,0xfab9,
+4,0xfa22,0xfa23,0xfaba,0xfabb,4,0xfa62,0xfa63,0xfabc,0xfabd,4,0xf95d,0xf95e,0xfabd,0xfabe,4,
+0xfa63,0xfa64,0xfabf,0xfac0,4,0xfa65,0xfa66,0xfac1,0xfac2,4,0xfa68,0xfa69,0xfac7,0xfac8,4,0xfa1c,
+0xfa1d,0xfac8,0xfac9,4,0xfa69,0xfa6a,0xfaca,0xfacb,4,0xfa6a,0xfa6b,0xfacc,0xfacd,4,0xfb2a,0xfb2e,
+0xfb49,0xfb4a,2,0xfb2e,0xfb31,4,0xfb1d,0xfb1e,0xfb39,0xfb3a,4,0xfb35,0xfb36,0xfb4b,0xfb4c,4,
+0xfb31,0xfb32,0xfb4c,0xfb4d,4,0xfb3b,0xfb3c,0xfb4d,0xfb4e,4,0xfb44,0xfb45,0xfb4e,0xfb4f,0x8004,0,
+1,0xd15f,1,0xd165,0x800c,0,1,0xd1bb,1,0xd1bc,1,0xd1bd,1,0xd1be,1,0xd1bf,
+1,0xd1c0,0x800c,0,1,0xd1bc,1,0xd1bd,1,0xd1be,1,0xd1bf,1,0xd1c0,1,0xd1c1,
+0x8006,2,0xfa30,0xfa31,2,0xf805,2,0xf806,0x8006,2,0xfa31,0xfa32,2,0xf80a,2,0xf80b,
+0x8006,2,0xfa32,0xfa33,2,0xf80e,2,0xf80f,0x8006,2,0xfa71,0xfa72,2,0xf81b,2,0xf81c,
+0x8006,2,0xfa76,0xfa77,2,0xf825,2,0xf826,0x8006,2,0xfa33,0xfa34,2,0xf826,2,0xf827,
+0x8006,2,0xfa34,0xfa35,2,0xf827,2,0xf828,0x8006,2,0xfa77,0xfa78,2,0xf828,2,0xf829,
+0x8006,2,0xf963,0xf964,2,0xf82b,2,0xf82c,0x8006,2,0xfa35,0xfa36,2,0xf82d,2,0xf82e,
+0x8004,0,2,0xf831,2,0xf834,0x8004,0,2,0xf845,2,0xf847,0x8006,2,0xfa7a,0xfa7b,
+2,0xf847,2,0xf848,0x8006,2,0xfa37,0xfa38,2,0xf84c,2,0xf84d,0x8006,2,0xfa00,0xfa01,
+2,0xf850,2,0xf851,0x8004,0,2,0xf86a,2,0xf86c,0x8006,2,0xfa3c,0xfa3d,2,0xf878,
+2,0xf879,0x8006,2,0xf928,0xf929,2,0xf88e,2,0xf88f,0x8004,0,2,0xf891,2,0xf893,
+0x8004,0,2,0xf894,2,0xf896,0x8006,2,0xfa3d,0xfa3e,2,0xf8a3,2,0xf8a4,0x8006,2,
+0xfa87,0xfa88,2,0xf8a8,2,0xf8a9,0x8008,0,2,0xf8a7,2,0xf8a8,2,0xf8a9,2,0xf8aa,
+0x8006,2,0xf90d,0xf90e,2,0xf8b1,2,0xf8b2,0x8006,2,0xfa41,0xfa42,2,0xf8c8,2,0xf8c9,
+0x8006,2,0xfa43,0xfa44,2,0xf8cf,2,0xf8d0,0x8006,2,0xfa93,0xfa94,2,0xf8d9,2,0xf8da,
+0x8006,2,0xfa44,0xfa45,2,0xf8e2,2,0xf8e3,0x8006,2,0xfad2,0xfad3,2,0xf8e7,2,0xf8e8,
+0x8006,2,0xfa45,0xfa46,2,0xf901,2,0xf902,0x8006,2,0xfa99,0xfa9a,2,0xf90b,2,0xf90c,
+0x8006,2,0xfa9b,0xfa9c,2,0xf914,2,0xf915,0x8006,2,0xfa9e,0xfa9f,2,0xf921,2,0xf922,
+0x8004,0,2,0xf92c,2,0xf92e,0x8006,2,0xfaa1,0xfaa2,2,0xf930,2,0xf931,0x8006,2,
+0xf962,0xf963,2,0xf938,2,0xf939,0x8006,2,0xfaa8,0xfaa9,2,0xf940,2,0xf941,0x8004,0,
+2,0xf946,2,0xf948,0x8006,2,0xfaa9,0xfaaa,2,0xf948,2,0xf949,0x8006,2,0xfad4,0xfad5,
+2,0xf949,2,0xf94a,0x8006,2,0xf93b,0xf93c,2,0xf94f,2,0xf950,0x8006,2,0xfaab,0xfaac,
+2,0xf950,2,0xf951,0x8006,2,0xfa50,0xfa51,2,0xf953,2,0xf954,0x8006,2,0xfa1b,0xfa1c,
+2,0xf956,2,0xf957,0x8006,2,0xfa54,0xfa55,2,0xf959,2,0xf95a,0x8004,0,2,0xf95d,
+2,0xf95f,0x8008,0,2,0xf893,2,0xf894,2,0xf98b,2,0xf98c,0x8006,2,0xf974,0xf975,
+2,0xf998,2,0xf999,0x8006,2,0xfa5f,0xfa60,2,0xf99f,2,0xf9a0,0x8006,2,0xf936,0xf937,
+2,0xf9b4,2,0xf9b5,0x8006,2,0xfab5,0xfab6,2,0xf9bb,2,0xf9bc,0x8006,2,0xfabe,0xfabf,
+2,0xf9d0,2,0xf9d1,0x8006,2,0xfac0,0xfac1,2,0xf9d1,2,0xf9d2,0x8006,2,0xfac2,0xfac3,
+2,0xf9df,2,0xf9e0,0x8006,2,0xfacb,0xfacc,2,0xf9fe,2,0xfa00,0x8006,2,0xfacd,0xface,
+2,0xfa0a,2,0xfa0b
+};
+
 #endif  // INCLUDED_FROM_NORMALIZER2_CPP
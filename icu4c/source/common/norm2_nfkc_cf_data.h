@@ -0,0 +1,1649 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// Copyright (C) 1999-2016, International Business Machines
+// Corporation and others.  All Rights Reserved.
+//
+// file name: norm2_nfkc_cf_data.h
+//
+// machine-generated by: icu/source/tools/gennorm2/n2builder.cpp
+
+
+#ifdef INCLUDED_FROM_NORMALIZER2_CPP
+
+static const UVersionInfo norm2_nfkc_cf_data_formatVersion={4,0,0,0};
+static const UVersionInfo norm2_nfkc_cf_data_dataVersion={0xb,0,0,0};
+
+static const int32_t norm2_nfkc_cf_data_indexes[Normalizer2Impl::IX_COUNT]={
+0x50,0x71e0,0xc6b8,0xc7b8,0xc7b8,0xc7b8,0xc7b8,0xc7b8,0x41,0x41,0x6a8,0x1650,0x54d8,0xfc00,0x960,0x4bd6,
+0x541e,0x54d4,0xad,0
+};
+
+static const uint16_t norm2_nfkc_cf_data_trieIndex[1997]={
+0,0x40,0x7b,0xbb,0xfb,0x13a,0x17a,0x1b7,0x1f7,0x236,0x264,0x29d,0x2dd,0x31d,0x35d,0x39d,
+0x3dd,0x41c,0x45a,0x49a,0x4d4,0x505,0x53e,0x57e,0x5ae,0x5e6,0x61f,0x65f,0x68e,0x6cd,0x61f,0x6e2,
+0x720,0x74e,0x61f,0x77b,0x7bb,0x7f8,0x818,0x857,0x896,0x8d3,0x8f2,0x92f,0x818,0x968,0x996,0x9d5,
+0x61f,0xa0f,0xa26,0xa66,0xa7d,0xabc,0x61f,0xaf2,0xb12,0xb4d,0xb5a,0xb94,0xbc8,0xc05,0xc45,0xc7f,
+0xc9a,0x61f,0xcd5,0xd15,0xd55,0xd76,0xdac,0xde9,0x61f,0x61f,0x61f,0x61f,0x61f,0xe0c,0x61f,0xe2c,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0xe6a,0x61f,0xe9f,0xed5,
+0xf0a,0x61f,0xf21,0x61f,0xf4b,0x61f,0x61f,0x61f,0xf87,0xfa7,0xfe7,0x61f,0x1025,0x1065,0x1099,0x10c5,
+0x8f7,0x61f,0x1105,0x1145,0x117f,0x11bf,0x11f8,0x1238,0x1278,0x12b8,0x12f8,0x1338,0x1378,0x13b8,0x13f8,0x1438,
+0x1478,0x14b7,0x14f7,0x1527,0x1567,0x15a7,0x15e7,0x161a,0x1657,0x1696,0x16d6,0x170c,0x173a,0x61f,0x61f,0x61f,
+0x61f,0x1765,0x17a5,0x17e5,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x1819,0x1826,0x61f,0x185d,0x61f,0x61f,0x61f,0x61f,
+0x189d,0x18cc,0x190c,0x1928,0x61f,0x195b,0x61f,0x199b,0x61f,0x61f,0x19db,0x19fb,0x1a3b,0x1a7b,0x1abb,0x1afb,
+0x1b3b,0x1b76,0x1bb4,0x1bf4,0x1c34,0x1c74,0x1cb4,0x61f,0x1cf4,0x1d34,0x1d74,0x1db4,0x1df4,0x1e34,0x1e74,0x1eb4,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x1ef4,0x1f34,0x1f54,0x1f86,0x1fb8,0x1ff6,0x202f,
+0x2069,0x61f,0x61f,0x20a5,0x20d7,0xe8b,0x8fb,0x2117,0x61f,0x61f,0x2127,0x2167,0x61f,0x219e,0x21de,0x207c,
+0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,
+0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,
+0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,
+0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,
+0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,
+0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,
+0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,
+0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,
+0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,
+0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,
+0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x2232,0x221e,0x2226,0x222e,0x2236,0x2222,0x222a,0x226a,0x61f,
+0x22aa,0x22e7,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2327,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x2367,0x23a7,0x23e7,0x2427,0x2467,0x24a7,0x24e7,0x2527,0x2567,0x25a7,0x25e5,0x2617,
+0x2657,0x2697,0x26d7,0x2717,0x2757,0x2795,0x27d5,0x2815,0x2855,0x2895,0x28d5,0x2914,0x2954,0x2994,0x29d4,0x2a13,
+0x741,0x750,0x768,0x787,0x7a1,0x7a1,0x7a1,0x7a5,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,
+0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,
+0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,
+0x7a1,0x7a1,0x7a1,0x7a1,0x7c5,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0xcd5,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x605,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2a4d,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x2a5d,0x2a5d,0x2a65,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x2a5d,0x2a5d,0x2a69,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x2a6d,0x61f,0x61f,0x2a7d,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0xf99,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x2a8d,0x2a8d,0x2a8d,0x2a9a,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2aa6,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x2ab0,0x605,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x8da,0x61f,0x61f,0xaa9,0x61f,0x2ac0,0x2acd,0x2ad9,0x61f,0x61f,0x61f,0x61f,0x74b,0x61f,0x2ae4,0x2af4,
+0x61f,0x61f,0x61f,0x8cf,0x61f,0x61f,0x61f,0x61f,0x2b04,0x61f,0x61f,0x61f,0x2b0f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2b16,0x61f,0x61f,0x61f,0x61f,0x2b21,0x2b30,0x9e5,0x2b3e,
+0x749,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2b4c,0x887,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x2b5c,0x2b6b,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x9c5,
+0x2b73,0x2b83,0x61f,0x61f,0x61f,0xaa9,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2b8d,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x8d5,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x2b8a,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2b9d,0x2b9d,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x8dc,
+0x8d9,0x61f,0x61f,0x61f,0x61f,0x8d7,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0xaa9,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0xccf,0x61f,0x61f,
+0x61f,0x61f,0x8d9,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x2bad,0x61f,0x61f,0x61f,0x1092,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x2b9d,0x2b9d,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2bb2,
+0xf15,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2bc1,0x2bd1,0x2bdf,0x2bec,0x61f,0x2aa0,0x2bf8,0x2c08,0x61f,0x61f,
+0x61f,0x61f,0xe27,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x17db,0x17eb,
+0x17e1,0x17f1,0x17e7,0x2c18,0x17ed,0x17e3,0x17f3,0x2c24,0x2c34,0x2c44,0x2c54,0x17db,0x17eb,0x17e1,0x2c60,0x2c70,
+0x17dd,0x2c5c,0x2c80,0x2c90,0x17e9,0x17df,0x17ef,0x17e5,0x17db,0x17eb,0x17e1,0x17f1,0x17e7,0x17dd,0x17ed,0x17e3,
+0x17f3,0x17e9,0x17df,0x17ef,0x17e5,0x17db,0x17eb,0x17e1,0x2ca0,0x2cb0,0x2cc0,0x2cd0,0x2ce0,0x2cb6,0x2cc6,0x2cd6,
+0x2cac,0x2cbc,0x2ccc,0x2cdc,0x2cb2,0x2ca8,0x2cd2,0x2ca8,0x2cb8,0x2cc8,0x2cf0,0x2d00,0x2d06,0x2d02,0x2d16,0x2d1e,
+0x2d2c,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x2d3c,0x61f,
+0x61f,0x2d4c,0x2d4c,0x2d5a,0x61f,0x2d66,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x2d76,0x2d86,0x2d96,0x2da6,0x2db4,0x2dc4,0x2dd4,0x2de4,0x2df4,0x2e04,0x2e13,0x2e04,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x2e23,0x17c1,0x2e33,0x17db,0x2e43,0x61f,0x2e53,0x61f,0x61f,0x2e63,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x2e73,0x2e83,0x2e93,0x2ea3,0x2eb3,0x2ec3,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x2ed3,0x2ee3,0x2ef3,0x2f03,0x2f13,0x2f23,0x2f33,0x2f43,0x2f53,0x2f63,0x2f73,0x2f83,0x2f93,0x2fa3,0x2fb3,
+0x2fc3,0x2fd3,0x2fe3,0x2ff3,0x3003,0x3013,0x3023,0x3033,0x3043,0x3053,0x3063,0x3073,0x3083,0x3093,0x30a3,0x30b3,
+0x30c3,0x30d3,0x30e3,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,0x61f,
+0x61f,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,
+0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,0x14d7,
+0x14d7,0x435,0x455,0x475,0xd0,0xd0,0x495,0x4ad,0x4c0,0x4dc,0x4f9,0x515,0x532,0x54f,0x56c,0x589,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0x5a3,0xd0,0x5bf,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x5d6,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x5e1,
+0x5fe,0x61e,0x63e,0xd0,0xd0,0xd0,0xd0,0x65e,0xd0,0xd0,0xd0,0x671,0xd0,0xd0,0x691,0x6a1,
+0x6c1,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0x6e1,0x701,0xd0,0xd0,0x721,0x721,0x721,0x721,0x721,0x721,0x721,0x721
+};
+
+static const uint16_t norm2_nfkc_cf_data_trieData[12531]={
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,4,8,0xc,1,
+1,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,
+0xfaf8,0xfaf9,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfaf8,1,1,1,1,1,
+1,0x10,0x50,0x5c,0x70,0x88,0xcc,0xd0,0xec,0x10c,0x144,0x14c,0x160,0x178,0x184,0x1a8,
+0x1e8,1,0x1f0,0x210,0x22c,0x24c,0x298,0x2a0,0x2bc,0x2c4,0x2ec,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0x1651,1,1,1,1,
+1,1,1,0x1654,1,0x165a,1,1,0x54d6,1,0x165e,1,1,0x1665,0x1669,0x166c,
+0x1673,1,1,0x1676,0x167d,0x1680,1,0x1685,0x168d,0x1695,1,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,
+0xfafc,0xfaf8,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,0xfaf9,0xfafc,0xfafc,0xfafc,0xfafc,
+0xfafc,0xfafc,1,0xfaf8,0xfafc,0xfafc,0xfafc,0xfafc,0xfafc,0xfaf9,0x169c,0x962,0x968,0x6aa,0x96e,0x6c0,
+0x6ca,0x304,0x6d4,0x974,0x97a,0x6de,0x980,0x986,0x98c,0x992,0x6f4,1,0x998,0x99e,0x9a4,0x6fe,
+0x714,0x726,1,0x30c,0x9aa,0x9b0,0x9b6,0x730,0x9bc,1,0x9c2,0xfa04,0x9c8,0xfa04,0x746,0xfa04,
+0x9cf,0xfa04,0x9d4,0xfa04,0x9da,0xfa04,0x9e0,0xfa04,0x9e6,0xfa04,0x9ec,0xfa01,1,0xfa04,0x75c,0xfa04,
+0x9f2,0xfa04,0x9f8,0xfa04,0x9ff,0xfa04,0xa04,0xfa04,0xa0a,0xfa04,0xa10,0xfa04,0xa16,0xfa04,0xa1d,0xfa04,
+0xa22,0xfa01,1,0xfa04,0xa28,0xfa04,0xa2e,0xfa04,0xa34,0xfa04,0xa3b,0x16a2,1,0x16a8,0x16a8,0xfa04,
+0xa41,0xfa04,0xa47,1,0xfa04,0xa4c,0xfa04,0xa53,0xfa04,0xa58,0x16af,0xfa01,1,0xfa04,0xa5e,0xfa04,
+0xa65,0xfa04,0xa6a,0x16b4,0xfa01,1,0xfa04,0x76a,0xfa04,0xa70,0xfa04,0xa76,0xfa01,1,0xfa04,0xa7c,
+0xfa04,0xa83,0xfa04,0xa88,0xfa04,0x778,0xfa04,0xa8e,0xfa04,0xa95,0xfa04,0x782,0xfa04,0xa9b,0xfa04,0xaa0,
+0xfa01,1,0xfa04,0x78c,0xfa04,0x796,0xfa04,0xaa6,0xfa04,0xaac,0xfa04,0xab2,0xfa04,0xab9,0xfa04,0xabe,
+0xfa04,0xac4,0x4bd8,0xfa04,0xaca,0xfa04,0xad0,0xfa04,0xad6,0x16ba,1,0x16bf,0xfa01,1,0xfa01,1,
+0x16c3,0xfa01,1,0x16c7,0x16cb,0xfa01,1,1,0x16cf,0x16d3,0x16d7,0xfa01,1,0x16db,0x16df,1,
+0x16e3,0x16e7,0xfa01,1,1,1,0x16eb,0x16ef,1,0x16f3,0xfa04,0x7a0,0xfa01,1,0xfa01,1,
+0x16f7,0xfa01,1,0x16fb,1,1,0xfa01,1,0x16ff,0xfa04,0x7ba,0x1703,0x1707,0xfa01,1,0xfa01,
+1,0x170a,0xfa01,1,1,1,0xfa01,1,1,1,1,0x4be4,0x4be4,0x4be4,0x170e,0x170e,
+0x170e,0x1714,0x1714,0x1714,0xfa04,0xadc,0xfa04,0xae2,0xfa04,0xae8,0xfa04,0xaee,0xfa04,0xaf6,0xfa04,0xb00,
+0xfa04,0xb0a,0xfa04,0xb14,1,0xfa04,0xb1e,0xfa04,0xb28,0xfa04,0xb31,0xfa01,1,0xfa04,0xb36,0xfa04,
+0xb3c,0xfa04,0x7d4,0xfa04,0xb45,0xfa04,0xb4d,0xb53,0x171a,0x171a,0x171a,0xfa04,0xb58,0x1721,0xf839,0xfa04,
+0xb5e,0xfa04,0xb66,0xfa04,0xb6f,0xfa04,0xb75,0xfa04,0xb7a,0xfa04,0xb80,0xfa04,0xb86,0xfa04,0xb8c,0xfa04,
+0xb92,0xfa04,0xb98,0xfa04,0xb9e,0xfa04,0xba4,0xfa04,0xbaa,0xfa04,0xbb0,0xfa04,0xbb6,0xfa04,0xbbc,0xfa04,
+0xbc2,0xfa04,0xbc8,0xfa01,1,0xfa04,0xbce,0x1725,1,0xfa01,1,0xfa01,1,0xfa04,0x7de,0xfa04,
+0x7e8,0xfa04,0xbd6,0xfa04,0xbe0,0xfa04,0x7f2,0xfa04,0xbea,0xfa04,0xbf2,1,1,1,1,1,
+1,0x1729,0xfa01,1,0x172d,0x1731,1,0xfa01,1,0x1735,0x1739,0x173d,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0x310,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0x1740,0x1745,0x1748,0x174c,0xf821,0xf829,0xf851,0x1750,0x1754,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x1758,0x175e,0x1764,0x176a,0x1770,0x1776,1,1,0x16df,0x177c,0x16ba,
+0x1780,0x1785,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0xfdcc,0xfdcc,0xfdcc,
+0xfdcc,0xfdcc,0xffcc,0xfdcc,0xfdcc,0xfdcc,0xfdcc,0xfdcc,0xfdcc,0xfdcc,0xffcc,0xffcc,0xfdcc,0xffcc,0xfdcc,0xffcc,
+0xfdcc,0xfdcc,0xffd0,0xffb8,0xffb8,0xffb8,0xffb8,0xffd0,0xfdb0,0xffb8,0xffb8,0xffb8,0xffb8,0xffb8,0xff94,0xff94,
+0xfdb8,0xfdb8,0xfdb8,0xfdb8,0xfd94,0xfd94,0xffb8,0xffb8,0xffb8,0xffb8,0xfdb8,0xfdb8,0xffb8,0xfdb8,0xfdb8,0xffb8,
+0xffb8,0xfe02,0xfe02,0xfe02,0xfe02,0xfc02,0xffb8,0xffb8,0xffb8,0xffb8,0xffcc,0xffcc,0xffcc,0x5420,0x5426,0xfdcc,
+0x542c,0x5432,0x178a,0xffcc,0xffb8,0xffb8,0xffb8,0xffcc,0xffcc,0xffcc,0xffb8,0xffb8,0x54d6,0xffcc,0xffcc,0xffcc,
+0xffb8,0xffb8,0xffb8,0xffb8,0xffcc,0xffd0,0xffb8,0xffb8,0xffcc,0xffd2,0xffd4,0xffd4,0xffd2,0xffd4,0xffd4,0xffd2,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xfa01,1,0xfa01,
+1,0x178f,1,0xfa01,1,1,1,0x1792,1,1,1,0x1799,0x179d,1,1,1,
+1,0x166c,0x17a0,0xfb2c,0x17a9,0xfb24,0xfb24,0xfb24,1,0xfbfc,1,0xfbf4,0xfbf4,0xbfb,0xfaf8,0xfaf9,
+0xfaf9,0xfaf9,0xfaf8,0xfaf9,0xfaf8,0xfaf9,0xfaf8,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf8,0xfaf9,0xfaf8,1,
+0xfaf9,0xfaf9,0xfaf8,0xfaf9,0xfaf9,0xfaf9,0xfaf8,0xfafc,0xfafc,0xc03,0xc09,0xc0f,0xc15,0xc1d,0x314,1,
+1,1,0x330,1,0x340,1,0x354,1,1,1,1,1,0x374,1,0x384,0xfa01,
+1,1,0x38c,1,1,1,0x3ac,0x7fc,0x80e,0xc25,0xc2b,0xc31,0xfa39,0xf909,0xf931,0xf990,
+0xf9cc,0xf9b4,0xf981,0xf949,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,
+1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xf849,0xf878,0xf881,
+1,0xf819,0xf7f8,1,0xfa01,1,0xf849,0xfa01,1,1,0x17ad,0x17b1,0x17b5,0x4bee,0x4bf6,0x17b9,
+0x4bfe,0x17bd,0x17c1,0x17c4,0x4c06,0x17c9,0x17cd,0x17d1,0x17d5,0x4c0e,0x4c16,0x4c1e,0x17d9,0xfaf8,0xfaf9,0xfaf9,
+0xfaf8,0xfaf9,0xfaf8,0xfaf8,0xfaf8,0xfaf8,0xfafc,0xfaf8,0xfaf9,0xfaf9,0xfaf9,0xfaf8,0xfaf9,0xfaf9,0xfaf9,0xfaf9,
+0xfaf8,0xfaf9,0xfaf9,0xfaf9,0xfaf8,0xfaf9,0xfaf9,0xfaf9,0xfaf8,0xfaf9,0xfaf8,0xfaf9,0xfaf9,0x3c0,1,1,
+0x3c8,1,0x3cc,0x3d8,0x3e0,0x3e4,0xc37,0x3f4,1,1,1,0x3f8,1,1,1,0x3fc,
+1,1,1,0x40c,1,1,1,0x410,1,0x414,1,1,0xc3d,0xc43,1,0xc49,
+1,1,0x418,0xc4f,1,1,1,1,0xc55,0xc5b,0xc61,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa00,0x41c,0xfa04,0xc67,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,1,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,1,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa71,0xfa04,0xc6d,0xfa01,1,0xfa01,
+1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,1,0xfa04,0xc73,0xfa04,0xc79,0xfa01,1,
+0xfa04,0xc7f,0xfa00,0x420,0xfa04,0xc85,0xfa04,0xc8b,0xfa04,0xc91,0xfa01,1,0xfa04,0xc97,0xfa04,0xc9d,
+0xfa04,0xca3,0xfa00,0x424,0xfa04,0xca9,0xfa04,0xcaf,0xfa04,0xcb5,0xfa04,0xcbb,0xfa04,0xcc1,0xfa04,0xcc7,
+0xfa01,1,0xfa04,0xccd,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,1,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,
+0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x17dd,1,1,1,1,1,1,1,1,1,0xffb8,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffcc,0xffbc,0xffb8,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffb8,0xffb8,0xffb8,0xffb8,0xffb8,0xffb8,0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffbc,0xffc8,0xffcc,0xfe14,0xfe16,
+0xfe18,0xfe1a,0xfe1c,0xfe1e,0xfe20,0xfe22,0xfe24,0xfe26,0xfe26,0xfe28,0xfe2a,0xfe2c,1,0xfe2e,1,0xfe30,
+0xfe32,1,0xffcc,0xffb8,1,0xfe24,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xfe3c,0xfe3e,0xfe40,1,0x54d6,1,1,1,1,1,
+0xcd2,0xcd8,0xcdf,0xce5,0xceb,0x428,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x434,1,
+0x438,0xfe36,0xfe38,0xfe3a,0xfe3c,0xfe3e,0xfe40,0xfe42,0xfe44,0xfdcc,0xfdcc,0xfdb8,0xffb8,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffb8,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0xfe46,1,1,1,1,0x17e3,0x17e9,0x17ef,0x17f5,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xcf1,
+0x43c,0xcf7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0x440,0xcfd,1,0x444,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffb8,0xffcc,1,1,0xffcc,0xffcc,1,0xffb8,0xffcc,0xffcc,0xffb8,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xfe48,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xffcc,0xffb8,
+0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffb8,0xffb8,0xffb8,0xffcc,0xffb8,0xffb8,0xffcc,0xffb8,0xffcc,0xffcc,0xffb8,
+0xffcc,0xffb8,0xffcc,0xffb8,0xffcc,0xffb8,0xffcc,0xffcc,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffb8,0xffcc,1,1,1,1,1,1,1,1,1,0xffb8,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,1,0xffcc,0xffcc,0xffcc,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xffb8,0xffb8,0xffb8,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xffb8,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,0xffb8,0xffcc,
+0xffcc,0xffb8,0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffcc,0xffb8,0xffb8,0xffb8,0xfe36,0xfe38,0xfe3a,0xffcc,0xffcc,
+0xffcc,0xffb8,0xffcc,0xffcc,0xffb8,0xffb8,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x448,0xd03,1,1,1,1,1,1,0x44c,0xd09,1,0x450,0xd0f,
+1,1,1,1,1,1,1,0xfc0e,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0xfe12,1,1,1,0xffcc,0xffb8,0xffcc,0xffcc,1,1,1,
+0x17fa,0x1800,0x1806,0x180c,0x1812,0x1818,0x181e,0x1824,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xfe0e,1,0xfc00,1,1,1,1,1,1,1,0x454,1,
+1,1,0xd15,0xd1b,0xfe12,1,1,1,1,1,1,1,1,1,0xfc00,1,
+1,1,1,0x182a,0x1830,1,0x1836,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0xffcc,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0x183c,1,1,0x1842,1,1,1,
+1,1,0xfe0e,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0xfe12,1,1,1,1,1,1,1,1,1,1,1,0x1848,0x184e,0x1854,1,
+1,0x185a,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xfe0e,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0xfe12,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x45c,
+0xd21,1,1,0xd27,0xd2d,0xfe12,1,1,1,1,1,1,1,1,0xfc00,0xfc00,
+1,1,1,1,0x1860,0x1866,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0x468,1,0xd33,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xfc00,1,1,1,1,1,1,0x46c,0x474,1,1,0xd39,
+0xd3f,0xd45,0xfe12,1,1,1,1,1,1,1,1,1,0xfc00,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x478,1,0xd4b,1,1,1,1,0xfe12,1,1,1,
+1,1,1,1,0xfea8,0xfcb6,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0xfe0e,1,1,0x47c,0xd51,1,0xfc00,1,1,1,0x480,0xd57,0xd5d,1,
+0x820,0xd65,1,0xfe12,1,1,1,1,1,1,1,0xfc00,0xfc00,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0xfe12,0xfe12,1,0xfc00,1,1,1,1,
+1,1,0x48c,0x494,1,1,0xd6d,0xd73,0xd79,0xfe12,1,1,1,1,1,1,
+1,1,1,0xfc00,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0xfc12,1,1,1,
+1,0xfc00,1,1,1,1,1,1,1,1,1,0x498,0xd7f,1,0x82a,0xd87,
+0xd8f,0xfc00,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x186d,1,1,1,1,0xfece,0xfece,0xfe12,1,1,1,
+1,1,1,1,1,0xfed6,0xfed6,0xfed6,0xfed6,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0x1873,1,1,
+1,1,0xfeec,0xfeec,1,1,1,1,1,1,1,1,0xfef4,0xfef4,0xfef4,0xfef4,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0x1879,0x187f,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xf9f1,1,1,1,1,1,1,1,1,1,1,1,
+0xffb8,0xffb8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0xffb8,1,0xffb8,
+1,0xffb0,1,1,1,1,1,1,0x1885,1,1,1,1,1,1,1,
+1,1,0x188b,1,1,1,1,0x1891,1,1,1,1,0x1897,1,1,1,
+1,0x189d,1,1,1,1,1,1,1,1,1,1,1,1,0x18a3,1,
+1,1,1,1,1,1,0xff02,0xff04,0x543a,0xff08,0x5442,0x18a8,0x18ae,0x18b6,0x18bc,0xff04,
+0xff04,0xff04,0xff04,1,1,0xff04,0x544a,0xffcc,0xffcc,0xfe12,1,0xffcc,0xffcc,1,1,1,
+1,1,1,1,1,1,1,1,0x18c5,1,1,1,1,1,1,1,
+1,1,0x18cb,1,1,1,1,0x18d1,1,1,1,1,0x18d7,1,1,1,
+1,0x18dd,1,1,1,1,1,1,1,1,1,1,1,1,0x18e3,1,
+1,1,1,1,1,0xffb8,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x4a4,
+0xd95,1,1,1,1,1,1,1,0xfc00,1,1,1,1,1,1,1,
+1,0xfe0e,1,0xfe12,0xfe12,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0xffb8,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x18e9,0x18ed,0x18f1,0x18f5,0x18f9,0x18fd,0x1901,0x1905,0x1909,0x190d,0x1911,
+0x1915,0x1919,0x191d,0x1921,0x1925,0x1929,0x192d,0x1931,0x1935,0x1939,0x193d,0x1941,0x1945,0x1949,0x194d,0x1951,
+0x1955,0x1959,0x195d,0x1961,0x1965,0x1969,0x196d,0x1971,0x1975,0x1979,0x197d,1,0x1981,1,1,1,
+1,1,0x1985,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0xf8f9,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x54d6,0x54d6,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,
+0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,
+0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,0xfe00,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xf9b9,0xf9b9,0xf9b9,0xf9b9,0xf9b9,0xf9b9,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xfe12,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xfe12,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x54d6,0x54d6,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xfe12,1,1,1,1,1,1,1,1,
+1,1,0xffcc,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x54d6,0x54d6,0x54d6,0x54d6,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0xffc8,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xffbc,0xffcc,0xffb8,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0xffcc,0xffb8,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xfe12,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,1,1,0xffb8,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffb8,0xffb8,0xffb8,0xffb8,
+0xffb8,0xffb8,0xffcc,0xffcc,0xffb8,1,1,1,1,1,0x4a8,0xd9b,0x4ac,0xda1,0x4b0,0xda7,
+0x4b4,0xdad,0x4b8,0xdb3,1,1,0x4bc,0xdb9,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0xfe0e,0xfc00,1,1,1,1,0x4c0,
+0xdbf,0x4c4,0xdc5,0x4c8,0x4cc,0xdcb,0xdd1,0x4d0,0xdd7,0xfe12,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0xffcc,0xffb8,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0xfe12,0xfe12,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0xfe0e,1,1,1,1,
+1,1,1,1,1,1,1,0xfe12,0xfe12,1,1,1,1,1,1,1,
+1,1,1,1,1,0x1989,0x198d,0x1990,0x1995,0x1999,0x1999,0x199d,0x19a1,0x19a5,1,1,
+1,1,1,1,1,0x19a9,0x19ad,0x19b1,0x19b5,0x19b9,0x19bd,0x19c1,0x19c5,0x19c9,0x19cd,0x19d1,
+0x19d5,0x19d9,0x19dd,0x19e1,0x19e5,0x19e9,0x19ed,0x19f1,0x19f5,0x19f9,0x19fd,0x1a01,0x1a05,0x1a09,0x1a0d,0x1a11,
+0x1a15,0x1a19,0x1a1d,0x1a21,0x1a25,0x1a29,0x1a2d,0x1a31,0x1a35,0x1a39,0x1a3d,0x1a41,0x1a45,0x1a49,0x1a4d,0x1a51,
+1,1,0x1a55,0x1a59,0x1a5d,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0xffcc,0xffcc,0xffcc,1,0xfe02,0xffb8,0xffb8,0xffb8,0xffb8,0xffb8,0xffcc,
+0xffcc,0xffb8,0xffb8,0xffb8,0xffb8,0xffcc,1,0xfe02,0xfe02,0xfe02,0xfe02,0xfe02,0xfe02,0xfe02,1,1,
+1,1,0xffb8,1,1,1,1,1,1,0xffcc,1,1,1,0xffcc,0xffcc,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0x165a,0x1a60,0x1a64,1,0x1a68,
+0x1a6c,0x16cf,0x1a70,0x1740,0x1a74,0x1748,0x1a78,0x177c,0x1a7c,0x1a80,1,0x1680,0x1a85,0x1a88,0x174c,0x1a8c,
+0x1a90,0x1750,0x165a,0x1a95,0x1a99,0x1a9d,0x1a64,0x1a68,0x1a6c,0x16d3,0x16d7,0x1aa1,0x1a70,1,0x1a78,0x1a7c,
+0x1aa5,0x1680,0x16c3,0xf809,0xf809,0x1a88,0x1a8c,0x1a90,0xf819,0x16eb,0x1aa8,0xf841,0x1aad,0x1ab1,0x1ab5,0x1ab9,
+0x1abd,0x1a74,0x174c,0x1a90,0x1aa8,0x1aad,0x1ab1,0x1ac0,0x1ab9,0x1abd,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x1ac5,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x1ac9,0x1acc,0x1ad1,0x1ad5,0x1aa1,0x1ad8,0x1add,0x1ae1,0x1ae5,0x16e7,0x16e3,0x1ae9,0xf899,
+0x1aed,0x1af1,0xf8d1,0x1af5,0x1af9,0x1afd,0x16ef,0x1b01,0x1b05,0x16f3,0x1b09,0x1b0d,0x16fb,0x1b11,0x1739,0x1703,
+0x1b15,0x1707,0x173d,0x1b18,0x1b1d,0x1b21,0x170a,0x1b25,0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffb8,0xffcc,0xffcc,0xffd4,0xffac,0xffb8,0xff94,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffd0,0xffc8,
+0xffc8,0xffb8,1,0xffcc,0xffd2,0xffb8,0xffcc,0xffb8,0xfa04,0xddc,0xfa04,0xde2,0xfa04,0xde9,0xfa04,0xdef,
+0xfa04,0xdf7,0xfa04,0xdfe,0xfa04,0xe04,0xfa04,0xe0a,0xfa04,0xe11,0xfa04,0xe16,0xfa04,0xe1e,0xfa04,0xe28,
+0xfa04,0xe30,0xfa04,0xe36,0xfa04,0xe3f,0xfa04,0xe47,0xfa04,0xe4c,0xfa04,0xe52,0xfa04,0xe58,0xfa04,0xe5e,
+0xfa04,0xe65,0xfa04,0xe6a,0xfa04,0xe70,0xfa04,0xe78,0xfa04,0xe80,0xfa04,0xe86,0xfa04,0xe8c,0xfa04,0x834,
+0xfa04,0xe94,0xfa04,0xe9c,0xfa04,0xea2,0xfa04,0xea8,0xfa04,0xeae,0xfa04,0xeb5,0xfa04,0xeba,0xfa04,0xec0,
+0xfa04,0xec6,0xfa04,0xecc,0xfa04,0xed4,0xfa04,0xede,0xfa04,0xee8,0xfa04,0xef2,0xfa04,0xefb,0xfa04,0xf01,
+0xfa04,0xf06,0xfa04,0x83e,0xfa04,0xf0e,0xfa04,0xf16,0xfa04,0xf1c,0xfa04,0x848,0xfa04,0xf24,0xfa04,0xf2e,
+0xfa04,0xf38,0xfa04,0xf40,0xfa04,0xf46,0xfa04,0xf4c,0xfa04,0xf52,0xfa04,0xf58,0xfa04,0xf5e,0xfa04,0xf64,
+0xfa04,0xf6c,0xfa04,0xf76,0xfa04,0xf7e,0xfa04,0xf85,0xfa04,0xf8a,0xfa04,0xf90,0xfa04,0xf96,0xfa04,0xf9c,
+0xfa04,0xfa3,0xfa04,0xfa9,0xfa04,0xfaf,0xfa04,0xfb4,0xfa04,0xfba,0xfa04,0xfc1,0xfa04,0xfc7,0xfcc,0xfd2,
+0xfd8,0xfde,0x1b29,0xf82c,1,1,0x169c,1,0xfa04,0x852,0xfa04,0xfe4,0xfa04,0xfec,0xfa04,0xff6,
+0xfa04,0x1000,0xfa04,0x100a,0xfa04,0x1014,0xfa04,0x101e,0xfa04,0x1028,0xfa04,0x1032,0xfa04,0x103c,0xfa04,0x1046,
+0xfa04,0x860,0xfa04,0x104e,0xfa04,0x1054,0xfa04,0x105c,0xfa04,0x1066,0xfa04,0x1070,0xfa04,0x107a,0xfa04,0x1084,
+0xfa04,0x108c,0xfa04,0x1092,0xfa04,0x86a,0xfa04,0x1098,0xfa04,0x10a0,0xfa04,0x10aa,0xfa04,0x10b4,0xfa04,0x10be,
+0xfa04,0x10c8,0xfa04,0x10d2,0xfa04,0x10dc,0xfa04,0x10e6,0xfa04,0x10f0,0xfa04,0x10fa,0xfa04,0x1102,0xfa04,0x1108,
+0xfa04,0x1110,0xfa04,0x111a,0xfa04,0x1124,0xfa04,0x112e,0xfa04,0x1138,0xfa04,0x1140,0xfa04,0x1147,0xfa04,0x114c,
+0xfa04,0x1152,0xfa01,1,0xfa01,1,0xfa01,1,0x874,0x886,0x115b,0x1165,0x116f,0x1179,0x1183,0x118d,
+0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0x898,0x8a6,0x1197,0x11a1,0x11ab,0x11b5,1,1,
+0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,1,1,0x8b4,0x8c6,0x11bf,0x11c9,0x11d3,0x11dd,0x11e7,0x11f1,
+0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0x8d8,0x8ea,0x11fb,0x1205,0x120f,0x1219,0x1223,0x122d,
+0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0x8fc,0x90a,0x1237,0x1241,0x124b,0x1255,1,1,
+0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,1,1,0x918,0x92a,0x125f,0x1269,0x1273,0x127d,0x1287,0x1291,
+1,0xf9bc,1,0xf9bc,1,0xf9bc,1,0xf9bc,0x93c,0x94e,0x129b,0x12a5,0x12af,0x12b9,0x12c3,0x12cd,
+0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0xf9bc,0x12d5,0x4c26,0x12db,0x4c2e,0x12e1,0x4c36,0x12e7,0x4c3e,
+0x12ed,0x4c46,0x12f3,0x4c4e,0x12f9,0x4c56,1,1,0x4c5e,0x4c68,0x4c76,0x4c86,0x4c96,0x4ca6,0x4cb6,0x4cc6,
+0x4c5e,0x4c68,0x4c76,0x4c86,0x4c96,0x4ca6,0x4cb6,0x4cc6,0x4cd2,0x4cdc,0x4cea,0x4cfa,0x4d0a,0x4d1a,0x4d2a,0x4d3a,
+0x4cd2,0x4cdc,0x4cea,0x4cfa,0x4d0a,0x4d1a,0x4d2a,0x4d3a,0x4d46,0x4d50,0x4d5e,0x4d6e,0x4d7e,0x4d8e,0x4d9e,0x4dae,
+0x4d46,0x4d50,0x4d5e,0x4d6e,0x4d7e,0x4d8e,0x4d9e,0x4dae,0x12ff,0x1305,0x4dba,0x1b2e,0x4dc4,1,0x130b,0x4dce,
+0xf9bc,0xf9bc,0x4dd8,0x4c26,0x1b2e,0x1b34,0x1b3a,0x1b34,0x1b3e,0x1b44,0x4de0,0x1b4c,0x4dea,1,0x1311,0x4df4,
+0x4dfe,0x4c2e,0x4e06,0x4c36,0x1b4c,0x1b52,0x1b5a,0x1b62,0x1317,0x131d,0x1325,0x4e10,1,1,0x132d,0x1335,
+0xf9bc,0xf9bc,0x4e1a,0x4c3e,1,0x1b6a,0x1b72,0x1b7a,0x133d,0x1343,0x134b,0x4e24,0x1353,0x1359,0x135f,0x1367,
+0xf9bc,0xf9bc,0x4e2e,0x4c4e,0xf9c4,0x1b82,0x17a0,0x1b8b,1,1,0x4e36,0x1b8e,0x4e40,1,0x136f,0x4e4a,
+0x4e54,0x4c46,0x4e5c,0x4c56,0x1b8e,0x166c,0x1b94,1,0x1651,0x1651,0x1651,0x1651,0x1651,0x1651,0x1651,0x1651,
+0x1651,0x1651,0x1651,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,1,0xf9f1,1,1,1,1,1,0x1b9a,
+1,1,1,1,1,1,1,1,1,1,1,1,0x1ba1,0x1ba5,0x1bab,1,
+1,1,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x1651,1,1,1,0x1bb3,0x1bb9,1,0x1bc1,0x1bc7,
+1,1,1,1,0x1bcf,1,0x1bd4,1,1,1,1,1,1,1,0x1bdb,0x1be1,
+0x1be7,1,1,1,1,1,1,1,1,1,1,1,1,1,0x1bed,1,
+1,1,1,1,1,1,0x1651,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,
+0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x1bf7,0x1a74,1,1,0x1bfb,0x1bff,0x1c03,0x1c07,0x1c0b,
+0x1c0f,0x1c13,0x1c17,0x1c1a,0x1c1f,0x1c23,0x1a80,0x1bf7,0x167d,0x1665,0x1669,0x1bfb,0x1bff,0x1c03,0x1c07,0x1c0b,
+0x1c0f,0x1c13,0x1c17,0x1c1a,0x1c1f,0x1c23,1,0x165a,0x1a6c,0x1680,0x1780,0x16d3,0x1740,0x1a78,0x177c,0x1a7c,
+0x1a80,0x1a88,0x16ba,0x1a8c,1,1,1,1,1,1,1,1,1,1,1,0x1c26,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xffcc,0xffcc,0xfe02,0xfe02,0xffcc,0xffcc,0xffcc,0xffcc,0xfe02,
+0xfe02,0xfe02,0xffcc,0xffcc,1,1,1,1,0xffcc,1,1,1,0xfe02,0xfe02,0xffcc,0xffb8,
+0xffcc,0xfe02,0xfe02,0xffb8,0xffb8,0xffb8,0xffb8,0xffcc,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x1c2c,0x1c34,0x1acc,0x1c3c,1,0x1c42,0x1c4a,0x16d7,1,
+0x1c52,0x1a70,0x1740,0x1740,0x1740,0x1740,0x1c59,0x1a74,0x1a74,0x177c,0x177c,1,0x1a80,0x1c5c,1,1,
+0x1a88,0x1c63,0x174c,0x174c,0x174c,1,1,0x1c66,0x1c6c,0x1c74,1,0x1b18,1,0x1c7a,1,0x1b18,
+1,0x1a78,0x4e64,0x1a64,0x1acc,1,0x1a6c,0x1a6c,0x1ad8,0xfad9,0x1a7c,0x1680,0x1c7f,0x1c83,0x1c87,0x1c8b,
+0x1a74,1,0x1c8e,0x1c97,0x1ab1,0x1ab1,0x1c97,0x1c9b,1,1,1,1,0x1a68,0x1a68,0x1a6c,0x1a74,
+0x1748,1,1,1,1,1,1,0x1c9f,0x1ca7,0x1caf,0x1cb9,0x1cc1,0x1cc9,0x1cd1,0x1cd9,0x1ce1,
+0x1ce9,0x1cf1,0x1cf9,0x1d01,0x1d09,0x1d11,0x1d19,0x1a74,0x1d1e,0x1d24,0x1d2c,0x1aa8,0x1d32,0x1d38,0x1d40,0x1d4a,
+0x1780,0x1d50,0x1d56,0x177c,0x1acc,0x1a68,0x1a7c,0x1a74,0x1d1e,0x1d24,0x1d2c,0x1aa8,0x1d32,0x1d38,0x1d40,0x1d4a,
+0x1780,0x1d50,0x1d56,0x177c,0x1acc,0x1a68,0x1a7c,1,1,1,0xfa01,1,1,1,1,1,
+0x1d5f,1,1,1,1,1,1,0x4d4,1,0x4d8,1,0x4dc,1,1,1,1,
+1,0x1375,0x137b,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x1381,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x1387,0x138d,0x1393,0x4e0,1,0x4e4,1,0x4e8,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x4ec,0x1399,1,1,1,0x4f0,
+0x139f,1,0x4f4,0x13a5,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x4f8,0x13ab,0x4fc,0x13b1,1,1,
+1,1,1,0x1d67,0x1d6d,1,0x1d75,0x1d7b,1,1,1,1,1,1,1,1,
+1,1,1,0x500,1,1,1,0x13b7,1,0x504,0x13bd,0x508,1,0x13c3,0x50c,0x13c9,
+1,1,1,0x510,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0x13cf,0x514,0x13d5,1,0x518,0x51c,1,1,1,1,
+1,1,1,0x13db,0x13e1,0x13e7,0x13ed,0x13f3,0x520,0x524,0x13f9,0x13ff,0x528,0x52c,0x1405,0x140b,
+0x530,0x534,0x538,0x53c,1,1,0x1411,0x1417,0x540,0x544,0x141d,0x1423,0x548,0x54c,0x1429,0x142f,
+1,1,1,1,1,1,1,0x550,0x554,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0x558,1,1,1,1,1,0x55c,0x560,
+1,0x564,0x1435,0x143b,0x1441,0x1447,1,1,0x568,0x56c,0x570,0x574,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0x144d,0x1453,0x1459,0x145f,
+1,1,1,1,1,1,0x1465,0x146b,0x1471,0x1477,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x1d83,0x1d87,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x167d,0x1665,0x1669,0x1bfb,0x1bff,0x1c03,0x1c07,0x1c0b,0x1c0f,0x1d8b,0x1d91,
+0x1d97,0x1d9d,0x1da3,0x1da9,0x1daf,0x1db5,0x1dbb,0x1dc1,0x1dc7,0x1dcd,0x1dd5,0x1ddd,0x1de5,0x1ded,0x1df5,0x1dfd,
+0x1e05,0x1e0d,0x1e15,0x1e1f,0x1e29,0x1e33,0x1e3d,0x1e47,0x1e51,0x1e5b,0x1e65,0x1e6f,0x1e79,0x1e83,0x1e89,0x1e8f,
+0x1e95,0x1e9b,0x1ea1,0x1ea7,0x1ead,0x1eb3,0x1eb9,0x1ec1,0x1ec9,0x1ed1,0x1ed9,0x1ee1,0x1ee9,0x1ef1,0x1ef9,0x1f01,
+0x1f09,0x1f11,0x1f19,0x1f21,0x1f29,0x1f31,0x1f39,0x1f41,0x1f49,0x1f51,0x1f59,0x1f61,0x1f69,0x1f71,0x1f79,0x1f81,
+0x1f89,0x1f91,0x1f99,0x1fa1,0x1fa9,0x1fb1,0x1fb9,0x1fc1,0x1fc9,0x1fd1,0x1fd9,0x165a,0x1a64,0x1acc,0x1a68,0x1a6c,
+0x1ad8,0x1a70,0x1740,0x1a74,0x1748,0x1a78,0x177c,0x1a7c,0x1a80,0x1680,0x1a88,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,
+0x1aa8,0x1750,0x1780,0x1754,0x1b18,0x165a,0x1a64,0x1acc,0x1a68,0x1a6c,0x1ad8,0x1a70,0x1740,0x1a74,0x1748,0x1a78,
+0x177c,0x1a7c,0x1a80,0x1680,0x1a88,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,0x1b18,0x1bf7,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x1fe1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x1fea,0x1ff2,0x1ff8,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0x2001,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0xfb79,0xfb79,0xfb79,
+0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,
+0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,
+0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,0xfb79,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0xfa01,1,0x2007,0x200b,
+0x200f,1,1,0xfa01,1,0xfa01,1,0xfa01,1,0x1a99,0x1af9,0x1a95,0x1ac9,1,0xfa01,1,
+1,0xfa01,1,1,1,1,1,1,0x1748,0x1aa8,0x2013,0x2017,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,1,1,1,1,
+1,1,1,0xfa01,1,0xfa01,1,0xffcc,0xffcc,0xffcc,0xfa01,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0xf989,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0xfe12,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x201b,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x201f,1,
+1,1,1,1,1,1,1,1,1,1,1,0x2023,0x2027,0x202b,0x202f,0x2033,
+0x2037,0x203b,0x203f,0x2043,0x2047,0x204b,0x204f,0x2053,0x2057,0x205b,0x205f,0x2063,0x2067,0x206b,0x206f,0x2073,
+0x2077,0x207b,0x207f,0x2083,0x2087,0x208b,0x208f,0x2093,0x2097,0x209b,0x209f,0x20a3,0x20a7,0x20ab,0x20af,0x20b3,
+0x20b7,0x20bb,0x20bf,0x20c3,0x20c7,0x20cb,0x20cf,0x20d3,0x20d7,0x20db,0x20df,0x20e3,0x20e7,0x20eb,0x20ef,0x20f3,
+0x20f7,0x20fb,0x20ff,0x2103,0x2107,0x210b,0x210f,0x2113,0x2117,0x211b,0x211f,0x2123,0x2127,0x212b,0x212f,0x2133,
+0x2137,0x213b,0x213f,0x2143,0x2147,0x214b,0x214f,0x2153,0x2157,0x215b,0x215f,0x2163,0x2167,0x216b,0x216f,0x2173,
+0x2177,0x217b,0x217f,0x2183,0x2187,0x218b,0x218f,0x2193,0x2197,0x219b,0x219f,0x21a3,0x21a7,0x21ab,0x21af,0x21b3,
+0x21b7,0x21bb,0x21bf,0x21c3,0x21c7,0x21cb,0x21cf,0x21d3,0x21d7,0x21db,0x21df,0x21e3,0x21e7,0x21eb,0x21ef,0x21f3,
+0x21f7,0x21fb,0x21ff,0x2203,0x2207,0x220b,0x220f,0x2213,0x2217,0x221b,0x221f,0x2223,0x2227,0x222b,0x222f,0x2233,
+0x2237,0x223b,0x223f,0x2243,0x2247,0x224b,0x224f,0x2253,0x2257,0x225b,0x225f,0x2263,0x2267,0x226b,0x226f,0x2273,
+0x2277,0x227b,0x227f,0x2283,0x2287,0x228b,0x228f,0x2293,0x2297,0x229b,0x229f,0x22a3,0x22a7,0x22ab,0x22af,0x22b3,
+0x22b7,0x22bb,0x22bf,0x22c3,0x22c7,0x22cb,0x22cf,0x22d3,0x22d7,0x22db,0x22df,0x22e3,0x22e7,0x22eb,0x22ef,0x22f3,
+0x22f7,0x22fb,0x22ff,0x2303,0x2307,0x230b,0x230f,0x2313,0x2317,0x231b,0x231f,0x2323,0x2327,0x232b,0x232f,0x2333,
+0x2337,0x233b,0x233f,0x2343,0x2347,0x234b,0x234f,0x2353,0x2357,0x235b,0x235f,0x2363,0x2367,0x236b,0x236f,0x2373,
+0x2377,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0x1651,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0xffb4,0xffc8,0xffd0,0xffbc,0xffc0,0xffc0,1,1,1,1,1,
+1,0xf8d9,1,0x207f,0x237b,0x237f,1,1,1,1,1,1,0x578,1,1,1,
+1,0x57c,0x147d,0x580,0x1483,0x584,0x1489,0x588,0x148f,0x58c,0x1495,0x590,0x149b,0x594,0x14a1,0x598,
+0x14a7,0x59c,0x14ad,0x5a0,0x14b3,0x5a4,0x14b9,0x5a8,0x14bf,1,0x5ac,0x14c5,0x5b0,0x14cb,0x5b4,0x14d1,
+1,1,1,1,1,0x5b8,0x14d7,0x14dd,0x5c0,0x14e3,0x14e9,0x5c8,0x14ef,0x14f5,0x5d0,0x14fb,
+0x1501,0x5d8,0x1507,0x150d,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0x1513,1,1,1,1,0xfc10,0xfc10,0x2382,
+0x2388,0x5e0,0x1519,0x238f,1,1,1,1,1,1,0x5e4,1,1,1,1,0x5e8,
+0x151f,0x5ec,0x1525,0x5f0,0x152b,0x5f4,0x1531,0x5f8,0x1537,0x5fc,0x153d,0x600,0x1543,0x604,0x1549,0x608,
+0x154f,0x60c,0x1555,0x610,0x155b,0x614,0x1561,1,0x618,0x1567,0x61c,0x156d,0x620,0x1573,1,1,
+1,1,1,0x624,0x1579,0x157f,0x62c,0x1585,0x158b,0x634,0x1591,0x1597,0x63c,0x159d,0x15a3,0x644,
+0x15a9,0x15af,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x64c,0x650,0x654,0x658,1,0x15b5,1,1,0x15bb,0x15c1,0x15c7,0x15cd,1,
+1,0x65c,0x15d3,0x2394,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x239a,0x239e,0x5450,0x23a2,0x5454,0x5458,0x23a6,0x23aa,0x23ae,0x545c,0x5460,
+0x5464,0x5468,0x546c,0x5470,0x23b3,0x23b6,0x23ba,0x23be,0x23c3,0x23c6,0x23ca,0x23ce,0x23d2,0x23d6,0x23da,0x23de,
+0x23e2,0x23e6,0x23ea,0x5474,0x5478,0x547c,0x5480,0x5484,0x5488,0x548c,0x5490,0x5494,0x5498,0x549c,0x54a0,0x54a4,
+0x54a8,0x54ac,0x54b0,0x54b4,0x54b8,0x54bc,0x54c0,0x54c4,0x54d6,0x23ef,0x23f3,0x23f7,0x23fb,0x23ff,0x2403,0x2407,
+0x240b,0x240f,0x2413,0x2417,0x241b,0x241f,0x2423,0x2427,0x242b,0x242f,0x2433,0x2437,0x243b,0x243f,0x2443,0x2447,
+0x244b,0x244f,0x2453,0x2457,0x245b,0x245f,0x2463,0x2467,0x246b,0x246f,0x2473,0x2477,0x247b,0x247f,0x2483,0x2487,
+0x248b,0x248f,0x2493,1,1,1,0x2023,0x203b,0x2497,0x249b,0x249f,0x24a3,0x24a7,0x24ab,0x2033,0x24af,
+0x24b3,0x24b7,0x24bb,0x2043,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0x24bf,0x24c7,0x24cf,0x24d7,0x24df,0x24e7,0x24ef,0x24f7,0x24ff,0x2507,0x250f,0x2517,
+0x251f,0x2527,0x4e73,0x4e85,0x4e97,0x4ea9,0x4ebb,0x4ecd,0x4edf,0x4ef1,0x4f03,0x4f15,0x4f27,0x4f39,0x4f4b,0x4f5d,
+0x4f6f,0x4f83,0x4f9d,1,0x252f,0x2537,0x253f,0x2547,0x254f,0x2557,0x255f,0x2567,0x256f,0x2577,0x257f,0x2587,
+0x258f,0x2597,0x259f,0x25a7,0x25af,0x25b7,0x25bf,0x25c7,0x25cf,0x25d7,0x25df,0x25e7,0x25ef,0x25f7,0x25ff,0x2607,
+0x260f,0x2617,0x261f,0x2627,0x262f,0x2637,0x263f,0x2647,0x264f,0x2653,0x212b,0x2657,1,1,1,1,
+1,1,1,1,0x265a,0x2663,0x2669,0x266f,0x2675,0x267b,0x2681,0x2687,0x268d,0x2693,0x2699,0x269f,
+0x26a5,0x26ab,0x26b1,0x26b7,0x239a,0x23a2,0x23a6,0x23ae,0x23b6,0x23ba,0x23c6,0x23ce,0x23d2,0x23da,0x23de,0x23e2,
+0x23e6,0x23ea,0x4fac,0x4fb4,0x4fbc,0x4fc4,0x4fcc,0x4fd4,0x4fdc,0x4fe4,0x4fec,0x4ff4,0x4ffc,0x5004,0x500c,0x5014,
+0x5020,0x5032,0x503e,1,0x2023,0x203b,0x2497,0x249b,0x26bd,0x26c1,0x26c5,0x204f,0x26c9,0x207f,0x2147,0x2177,
+0x2173,0x214b,0x22bb,0x209f,0x213f,0x26cd,0x26d1,0x26d5,0x26d9,0x26dd,0x26e1,0x26e5,0x26e9,0x26ed,0x26f1,0x20b7,
+0x26f5,0x26f9,0x26fd,0x2701,0x2705,0x2709,0x270d,0x2711,0x249f,0x24a3,0x24a7,0x2715,0x2719,0x271d,0x2721,0x2725,
+0x2729,0x272d,0x2731,0x2735,0x2739,0x273d,0x2743,0x2749,0x274f,0x2755,0x275b,0x2761,0x2767,0x276d,0x2773,0x2779,
+0x277f,0x2785,0x278b,0x2791,0x2797,0x279d,0x27a3,0x27a9,0x27af,0x27b5,0x27bb,0x27c1,0x27c7,0x27cd,0x27d5,0x27dd,
+0x27e4,0x27ea,0x27f2,0x27f8,0x2801,0x2805,0x2808,0x280d,0x2811,0x2814,0x2818,0x281c,0x2820,0x2824,0x2828,0x282c,
+0x2830,0x2834,0x2838,0x283c,0x2840,0x2844,0x2848,0x284c,0x2851,0x2855,0x2859,0x285d,0x2861,0x2864,0x2868,0x286c,
+0x2870,0x2874,0x2879,0x287d,0x2881,0x2885,0x2889,0x288d,0x2891,0x2895,0x2899,0x289d,0x28a1,0x28a5,0x28a9,0x28ac,
+0x28b0,0x28b4,0x28b8,1,0x504e,0x28bd,0x5065,0x28c7,0x507a,0x28ce,0x28d7,0x5092,0x28df,0x28e8,0x28f1,0x28f9,
+0x2900,0x290b,0x50a3,0x50af,0x50be,0x50cb,0x2915,0x50df,0x291f,0x50f9,0x2925,0x2932,0x5109,0x5115,0x512f,0x293f,
+0x2948,0x2951,0x5144,0x2959,0x2963,0x5158,0x296e,0x2976,0x5166,0x5172,0x517d,0x297f,0x2985,0x298a,0x2992,0x5186,
+0x5196,0x51a3,0x51b1,0x51c1,0x51cc,0x51d7,0x51ea,0x299a,0x51fb,0x29a5,0x29ad,0x520a,0x5214,0x29b8,0x5220,0x5232,
+0x5240,0x524c,0x525a,0x29c1,0x526c,0x29c7,0x29cf,0x29d7,0x29e1,0x29e8,0x29f0,0x29f9,0x2a05,0x2a0f,0x5285,0x5298,
+0x52ab,0x2a15,0x52be,0x2a1f,0x2a27,0x2a2f,0x2a39,0x52d1,0x52e5,0x2a3f,0x52fd,0x2a44,0x2a4d,0x2a53,0x2a59,0x2a5f,
+0x2a65,0x2a6b,0x2a71,0x2a77,0x2a7d,0x2a83,0x2a89,0x2a91,0x2a99,0x2aa1,0x2aa9,0x2ab1,0x2ab9,0x2ac1,0x2ac9,0x2ad1,
+0x2ad9,0x2ae1,0x2ae9,0x2af1,0x2af9,0x2b00,0x2b08,0x2b0e,0x2b14,0x2b1c,0x2b22,0x2b28,0x2b2f,0x2b37,0x2b3e,0x2b45,
+0x2b4b,0x2b51,0x2b57,0x2b5d,0x2b66,0x2b6c,0x2b72,0x2b78,0x2b7e,0x2b84,0x2b8a,0x2b90,0x2b96,0x2b9e,0x2ba8,0x2bae,
+0x2bb4,0x2bba,0x2bc0,0x2bc6,0x2bcc,0x2bd2,0x2bda,0x2be2,0x2bea,0x2bf2,0x2bf8,0x2bfe,0x2c04,0x2c0a,0x2c10,0x2c16,
+0x2c1c,0x2c22,0x2c28,0x2c2f,0x2c37,0x2c3f,0x2c45,0x2c4d,0x2c55,0x2c5d,0x2c63,0x2c6a,0x2c73,0x2b66,0x2c7c,0x2c84,
+0x2c8c,0x2c94,0x2c9c,0x2ca9,0x2cb6,0x2cbc,0x2cc2,0x2cc8,0x2cce,0x2cd4,0x2cda,0x2ce0,0x2ce6,0x2ce0,0x2cec,0x2cf2,
+0x2cf8,0x2cfe,0x2d04,0x2cfe,0x2d0a,0x2d10,0x2d17,0x2d21,0x2d26,0x2d2c,0x2d32,0x2d3d,0x2d44,0x2d4a,0x2d50,0x2d56,
+0x2d5c,0x2d62,0x2c28,0x2d68,0x2d6e,0x2d74,0x2d7a,0x2d82,0x2b8a,0x2d88,0x2d90,0x2d98,0x2d9f,0x2da8,0x2db0,0x2db6,
+0x2dbc,0x2dc2,0x2dc8,0x2dd0,0x2dd9,0x2ddf,0x2de5,0x2deb,0x2df1,0x2df7,0x2dfd,0x2e03,0x2e09,0x2e0f,0x2e17,0x2e1f,
+0x2e27,0x2e2f,0x2e37,0x2e3f,0x2e47,0x2e4f,0x2e57,0x2e5f,0x2e67,0x2e6f,0x2e77,0x2e7f,0x2e87,0x2e8f,0x2e97,0x2e9f,
+0x2ea7,0x2eaf,0x2eb7,0x2ebe,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,1,0xffcc,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,1,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0x199d,0x2ec7,0xffcc,0xffcc,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0xffcc,0xffcc,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,1,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xf9f1,1,1,1,1,1,1,1,
+1,0xfa01,1,0xfa01,1,0x2ecb,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,1,1,
+1,0xfa01,1,0x1ae5,1,1,0xfa01,1,0xfa01,1,1,1,0xfa01,1,0xfa01,1,
+0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,0xfa01,1,
+0x1745,0x1aa1,0x1ae1,0x2ecf,0x1ae9,1,0x2ed3,0x2ed7,0x1aed,0x2edb,0xfa01,1,0xfa01,1,0xfa01,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x1c59,0x2edf,1,1,1,1,1,1,0xfe12,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0xfe12,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0xffb8,0xffb8,0xffb8,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xfe12,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0xffcc,1,0xffcc,0xffcc,0xffb8,1,1,0xffcc,0xffcc,
+1,1,1,1,1,0xffcc,0xffcc,1,0xffcc,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0xfe12,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x2ee3,0xf8c9,0x2007,0xf991,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x2ee7,0x2eeb,
+0x2eef,0x2ef3,0x2ef7,0x2efb,0x2eff,0x2f03,0x2f07,0x2f0b,0x2f0f,0x2f13,0x2f17,0x2f1b,0x2f1f,0x2f23,0x2f27,0x2f2b,
+0x2f2f,0x2f33,0x2f37,0x2f3b,0x2f3f,0x2f43,0x2f47,0x2f4b,0x2f4f,0x2f53,0x2f57,0x2f5b,0x2f5f,0x2f63,0x2f67,0x2f6b,
+0x2f6f,0x2f73,0x2f77,0x2f7b,0x2f7f,0x2f83,0x2f87,0x2f8b,0x2f8f,0x2f93,0x2f97,0x2f9b,0x2f9f,0x2fa3,0x2fa7,0x2fab,
+0x2faf,0x2fb3,0x2fb7,0x2fbb,0x2fbf,0x2fc3,0x2fc7,0x2fcb,0x2fcf,0x2fd3,0x2fd7,0x2fdb,0x2fdf,0x2fe3,0x2fe7,0x2feb,
+0x2fef,0x2ff3,0x2ff7,0x2ffb,0x2fff,0x3003,0x3007,0x300b,0x300f,0x3013,0x3017,0x301b,0x301f,0x3023,0x6a8,0x961,
+0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,
+0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x6a8,0x961,0x961,0x961,0x961,0x961,
+0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,
+0x961,0x961,0x961,0x961,0x961,0x961,0x6a8,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,
+0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,
+0x961,0x961,0x6a8,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,
+0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,0x961,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x54d8,0x54d9,0x54d8,0x54d8,0x54d8,0x54d8,
+0x54d8,0x54d8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0x54d8,0x54d9,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0x54d8,1,1,1,1,0x54d8,0x4260,
+1,1,0x54d8,1,0x54d8,0x426c,0x5418,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x4bd1,1,0x54d6,0x54d6,0x54d6,0x54d6,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x3027,0x302b,0x229b,0x302f,0x3033,0x3037,0x303b,0x2373,0x2373,
+0x303f,0x22bb,0x3043,0x3047,0x304b,0x304f,0x3053,0x3057,0x305b,0x305f,0x3063,0x3067,0x306b,0x306f,0x3073,0x3077,
+0x307b,0x307f,0x3083,0x3087,0x308b,0x308f,0x3093,0x3097,0x309b,0x309f,0x30a3,0x30a7,0x30ab,0x30af,0x30b3,0x30b7,
+0x30bb,0x30bf,0x30c3,0x30c7,0x30cb,0x30cf,0x30d3,0x30d7,0x30db,0x30df,0x30e3,0x2213,0x30e7,0x30eb,0x30ef,0x30f3,
+0x30f7,0x30fb,0x30ff,0x3103,0x3107,0x310b,0x310f,0x2337,0x3113,0x3117,0x311b,0x311f,0x3123,0x3127,0x312b,0x312f,
+0x3133,0x3137,0x313b,0x313f,0x3143,0x3147,0x314b,0x314f,0x3153,0x3157,0x315b,0x315f,0x3163,0x3167,0x316b,0x316f,
+0x3173,0x3177,0x317b,0x3067,0x317f,0x3183,0x3187,0x318b,0x318f,0x3193,0x3197,0x319b,0x319f,0x31a3,0x31a7,0x31ab,
+0x31af,0x31b3,0x31b7,0x31bb,0x31bf,0x31c3,0x31c7,0x31cb,0x22a3,0x31cf,0x31d3,0x31d7,0x31db,0x31df,0x31e3,0x31e7,
+0x31eb,0x31ef,0x31f3,0x31f7,0x31fb,0x31ff,0x3203,0x3207,0x20b7,0x320b,0x320f,0x3213,0x3217,0x321b,0x321f,0x3223,
+0x3227,0x206b,0x322b,0x322f,0x3233,0x3237,0x323b,0x323f,0x3243,0x3247,0x324b,0x324f,0x3253,0x3257,0x325b,0x325f,
+0x3263,0x3267,0x326b,0x326f,0x3273,0x3277,0x327b,0x327f,0x31c7,0x3283,0x3287,0x328b,0x328f,0x3293,0x3297,0x329b,
+0x329f,0x3187,0x32a3,0x32a7,0x32ab,0x32af,0x32b3,0x32b7,0x32bb,0x32bf,0x32c3,0x32c7,0x32cb,0x32cf,0x32d3,0x32d7,
+0x32db,0x32df,0x32e3,0x32e7,0x32eb,0x32ef,0x3067,0x32f3,0x32f7,0x32fb,0x32ff,0x236f,0x3303,0x3307,0x330b,0x330f,
+0x3313,0x3317,0x331b,0x331f,0x3323,0x3327,0x332b,0x332f,0x26c1,0x3333,0x3337,0x333b,0x333f,0x3343,0x3347,0x334b,
+0x334f,0x3353,0x318f,0x3357,0x335b,0x335f,0x3363,0x3367,0x336b,0x336f,0x3373,0x3377,0x337b,0x337f,0x3383,0x3387,
+0x22b7,0x338b,0x338f,0x3393,0x3397,0x339b,0x339f,0x33a3,0x33a7,0x33ab,0x33af,0x33b3,0x33b7,0x33bb,0x21f3,0x33bf,
+0x33c3,0x33c7,0x33cb,0x33cf,0x33d3,0x33d7,0x33db,0x33df,0x33e3,0x33e7,0x33eb,0x33ef,0x33f3,0x33f7,0x33fb,0x225f,
+0x33ff,0x226b,0x3403,0x3407,0x340b,1,1,0x340f,1,0x3413,1,1,0x3417,0x341b,0x341f,0x3423,
+0x3427,0x342b,0x342f,0x3433,0x3437,0x220f,1,0x343b,1,0x343f,1,1,0x3443,0x3447,1,1,
+1,0x344b,0x344f,0x3453,0x3457,0x345b,0x345f,0x3463,0x3467,0x346b,0x346f,0x3473,0x3477,0x347b,0x347f,0x3483,
+0x3487,0x348b,0x348f,0x20d3,0x3493,0x3497,0x349b,0x349f,0x34a3,0x34a7,0x34ab,0x34af,0x34b3,0x34b7,0x34bb,0x34bf,
+0x34c3,0x34c7,0x34cb,0x26d5,0x34cf,0x34d3,0x34d7,0x34db,0x26e5,0x34df,0x34e3,0x34e7,0x34eb,0x34ef,0x3257,0x34f3,
+0x34f7,0x34fb,0x34ff,0x3503,0x3507,0x3507,0x350b,0x350f,0x3513,0x3517,0x351b,0x351f,0x3523,0x3527,0x3443,0x352b,
+0x352f,0x3533,0x3537,0x353b,0x3541,1,1,0x3545,0x3549,0x354d,0x3551,0x3555,0x3559,0x355d,0x3561,0x347b,
+0x3565,0x3569,0x356d,0x340f,0x3571,0x3575,0x3579,0x357d,0x3581,0x3585,0x3589,0x358d,0x3591,0x3595,0x3599,0x359d,
+0x349b,0x35a1,0x349f,0x35a5,0x35a9,0x35ad,0x35b1,0x35b5,0x3413,0x30bb,0x35b9,0x35bd,0x2157,0x31cb,0x3317,0x35c1,
+0x35c5,0x34bb,0x35c9,0x34bf,0x35cd,0x35d1,0x35d5,0x341b,0x35d9,0x35dd,0x35e1,0x35e5,0x35e9,0x341f,0x35ed,0x35f1,
+0x35f5,0x35f9,0x35fd,0x3601,0x34ef,0x3605,0x3609,0x3257,0x360d,0x34ff,0x3611,0x3615,0x3619,0x361d,0x3621,0x3513,
+0x3625,0x343f,0x3629,0x3517,0x317f,0x362d,0x351b,0x3631,0x3523,0x3635,0x3639,0x363d,0x3641,0x3645,0x352b,0x3433,
+0x3649,0x352f,0x364d,0x3533,0x3651,0x2373,0x3655,0x365b,0x3661,0x3667,0x366b,0x366f,0x3673,0x3679,0x367f,0x3685,
+0x3689,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x368c,0x3692,0x3698,0x369e,0x36a6,0x36ae,0x36ae,1,1,
+1,1,1,1,1,1,1,1,1,1,0x36b5,0x36bb,0x36c1,0x36c7,0x36cd,1,
+1,1,1,1,0x36d2,0xfe34,0x36d8,0x36df,0x1c7f,0x1c8b,0x36e3,0x36e7,0x36eb,0x36ef,0x36f3,0x36f7,
+0x1c13,0x36fa,0x3700,0x3706,0x370e,0x3716,0x371c,0x3722,0x3728,0x372e,0x3734,0x373a,0x3740,0x3746,1,0x374c,
+0x3752,0x3758,0x375e,0x3764,1,0x376a,1,0x3770,0x3776,1,0x377c,0x3782,1,0x3788,0x378e,0x3794,
+0x379a,0x37a0,0x37a6,0x37ac,0x37b2,0x37b8,0x37bf,0x37c5,0x37c5,0x37c9,0x37c9,0x37c9,0x37c9,0x37cd,0x37cd,0x37cd,
+0x37cd,0x37d1,0x37d1,0x37d1,0x37d1,0x37d5,0x37d5,0x37d5,0x37d5,0x37d9,0x37d9,0x37d9,0x37d9,0x37dd,0x37dd,0x37dd,
+0x37dd,0x37e1,0x37e1,0x37e1,0x37e1,0x37e5,0x37e5,0x37e5,0x37e5,0x37e9,0x37e9,0x37e9,0x37e9,0x37ed,0x37ed,0x37ed,
+0x37ed,0x37f1,0x37f1,0x37f1,0x37f1,0x37f5,0x37f5,0x37f9,0x37f9,0x37fd,0x37fd,0x3801,0x3801,0x3805,0x3805,0x3809,
+0x3809,0x380d,0x380d,0x3811,0x3811,0x3811,0x3811,0x3815,0x3815,0x3815,0x3815,0x3819,0x3819,0x3819,0x3819,0x381d,
+0x381d,0x381d,0x381d,0x3821,0x3821,0x3825,0x3825,0x3825,0x3825,0x530c,0x530c,0x3828,0x3828,0x3828,0x3828,0x382d,
+0x382d,0x382d,0x382d,0x3830,0x3830,0x5314,0x5314,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0x3835,0x3835,0x3835,0x3835,0x3839,0x3839,
+0x383d,0x383d,0x3841,0x3841,0x17ef,0x3845,0x3845,0x3849,0x3849,0x384d,0x384d,0x3851,0x3851,0x3851,0x3851,0x3855,
+0x3855,0x531c,0x531c,0x5326,0x5326,0x5330,0x5330,0x533b,0x533b,0x5345,0x5345,0x534f,0x534f,0x5359,0x5359,0x5359,
+0x5363,0x5363,0x5363,0x3859,0x3859,0x3859,0x3859,0x536d,0x5377,0x5381,0x5363,0x538a,0x385d,0x3863,0x3869,0x386f,
+0x3875,0x387a,0x3881,0x3887,0x388d,0x3893,0x3899,0x389e,0x38a5,0x38ab,0x38b1,0x38b6,0x38bd,0x38c3,0x38c9,0x38cf,
+0x38d5,0x38db,0x38e1,0x38e7,0x38ed,0x38f3,0x38f9,0x38ff,0x3905,0x390b,0x3911,0x3917,0x391d,0x3923,0x3929,0x392f,
+0x3935,0x393b,0x3941,0x3947,0x394d,0x3953,0x3959,0x395f,0x3965,0x396a,0x3971,0x3977,0x397d,0x3982,0x3988,0x398f,
+0x3995,0x399b,0x39a1,0x39a7,0x39ad,0x39b2,0x39b9,0x39bf,0x39c5,0x39cb,0x39d1,0x39d6,0x39dd,0x39e3,0x39e9,0x39ef,
+0x39f5,0x39fa,0x3a01,0x3a07,0x3a0d,0x3a13,0x3a19,0x3a1e,0x3a25,0x3a2b,0x3a31,0x3a36,0x3a3d,0x3a43,0x3a49,0x3a4f,
+0x3a55,0x3a5a,0x3a60,0x3a66,0x3a6c,0x3a72,0x3a7a,0x3a82,0x3a8a,0x3a92,0x3a9a,0x5395,0x539f,0x5381,0x53a9,0x5363,
+0x538a,0x3aa3,0x3aa9,0x386f,0x3aaf,0x3875,0x387a,0x3ab5,0x3abb,0x3893,0x3ac1,0x3899,0x389e,0x3ac7,0x3acd,0x38ab,
+0x3ad3,0x38b1,0x38b6,0x3965,0x396a,0x397d,0x3982,0x3988,0x39a1,0x39a7,0x39ad,0x39b2,0x39cb,0x39d1,0x39d6,0x3ad8,
+0x39ef,0x3adf,0x3ae5,0x3a13,0x3aeb,0x3a19,0x3a1e,0x3a6c,0x3af1,0x3af7,0x3a4f,0x3afd,0x3a55,0x3a5a,0x536d,0x5377,
+0x53b3,0x5381,0x53bd,0x385d,0x3863,0x3869,0x386f,0x3b03,0x3881,0x3887,0x388d,0x3893,0x3b09,0x38ab,0x38bd,0x38c3,
+0x38c9,0x38cf,0x38d5,0x38e1,0x38e7,0x38ed,0x38f3,0x38f9,0x38ff,0x3b0f,0x3905,0x390b,0x3911,0x3917,0x391d,0x3923,
+0x392f,0x3935,0x393b,0x3941,0x3947,0x394d,0x3953,0x3959,0x395f,0x3971,0x3977,0x398f,0x3995,0x399b,0x39a1,0x39a7,
+0x39b9,0x39bf,0x39c5,0x39cb,0x3b15,0x39dd,0x39e3,0x39e9,0x39ef,0x3a01,0x3a07,0x3a0d,0x3a13,0x3b1b,0x3a25,0x3a2b,
+0x3b20,0x3a3d,0x3a43,0x3a49,0x3a4f,0x3b27,0x5381,0x53bd,0x386f,0x3b03,0x3893,0x3b09,0x38ab,0x3b2d,0x38f9,0x3b33,
+0x3b39,0x3b3f,0x39a1,0x39a7,0x39cb,0x3a13,0x3b1b,0x3a4f,0x3b27,0x3b44,0x3b4c,0x3b54,0x3b5d,0x3b62,0x3b69,0x3b6e,
+0x3b75,0x3b7a,0x3b81,0x3b86,0x3b8d,0x3b92,0x3b99,0x3b9e,0x3ba5,0x3baa,0x3bb1,0x3bb6,0x3bbd,0x3bc2,0x3bc9,0x3bce,
+0x3bd5,0x3bdb,0x3be1,0x3b39,0x3be7,0x3bed,0x3bf3,0x3bf9,0x3b5d,0x3b62,0x3b69,0x3b6e,0x3b75,0x3b7a,0x3b81,0x3b86,
+0x3b8d,0x3b92,0x3b99,0x3b9e,0x3ba5,0x3baa,0x3bb1,0x3bb6,0x3bbd,0x3bc2,0x3bc9,0x3bce,0x3bd5,0x3bdb,0x3be1,0x3b39,
+0x3be7,0x3bed,0x3bf3,0x3bf9,0x3bd5,0x3bdb,0x3be1,0x3b39,0x3b33,0x3b3f,0x3929,0x38e7,0x38ed,0x38f3,0x3bd5,0x3bdb,
+0x3be1,0x3929,0x392f,0x3bfe,0x3bfe,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x3c05,0x3c0d,0x3c0d,0x3c15,0x3c1d,0x3c25,0x3c2d,0x3c35,0x3c3d,0x3c3d,0x3c44,
+0x3c4d,0x3c55,0x3c5d,0x3c65,0x3c6d,0x3c6d,0x3c75,0x3c7d,0x3c7d,0x3c85,0x3c85,0x3c8d,0x3c95,0x3c95,0x3c9c,0x3ca5,
+0x3ca5,0x3cad,0x3cad,0x3cb5,0x3cbd,0x3cbd,0x3cc5,0x3cc5,0x3ccd,0x3cd4,0x3cdd,0x3ce5,0x3ce5,0x3ced,0x3cf5,0x3cfc,
+0x3d05,0x3d0d,0x3d0d,0x3d15,0x3d1d,0x3d25,0x3d2c,0x3d35,0x3d3d,0x3d3d,0x3d45,0x3d45,0x3d4d,0x3d4d,0x3d55,0x3d5d,
+0x3d64,0x3d6d,0x3d75,0x3d7d,0x3d85,1,1,0x3d8d,0x3d95,0x3d9d,0x3da5,0x3dad,0x3db5,0x3db5,0x3dbd,0x3dc4,
+0x3dcd,0x3dd5,0x3dd5,0x3ddc,0x3de4,0x3ded,0x3df4,0x3dfd,0x3e04,0x3e0d,0x3e14,0x3e1d,0x3e25,0x3e2d,0x3e34,0x3e3c,
+0x3e44,0x3e4c,0x3e54,0x3e5c,0x3e64,0x3e6c,0x3e74,0x3e7c,0x3e84,0x3d15,0x3d25,0x3e8c,0x3e94,0x3e9d,0x3ea4,0x3ead,
+0x3eb5,0x3ead,0x3e9d,0x3ebc,0x3ec4,0x3ecc,0x3ed4,0x3edc,0x3eb5,0x3cdd,0x3c8d,0x3ee4,0x3eec,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x3ef4,0x3efc,0x3f05,0x3f0f,0x3f19,0x3f23,0x3f2d,0x3f37,0x3f41,0x3f4b,0x3f53,
+0x3f79,0x3f8b,1,1,1,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,
+0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x3f95,0x3f99,0x3f9d,0x3fa1,0x1799,0x3fa5,0x3fa9,0x3fad,0x3fb1,0x1bab,1,
+1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffb8,0xffb8,0xffb8,0xffb8,
+0xffb8,0xffb8,0xffb8,0xffcc,0xffcc,0x1ba5,0x3fb5,0x3fb9,0x3fbd,0x3fbd,0x1c1f,0x1c23,0x3fc1,0x3fc5,0x3fc9,0x3fcd,
+0x3fd1,0x3fd5,0x3fd9,0x3fdd,0x1d83,0x1d87,0x3fe1,0x3fe5,0x3fe9,0x3fed,1,1,0x3ff1,0x3ff5,0x1bd4,0x1bd4,
+0x1bd4,0x1bd4,0x3fbd,0x3fbd,0x3fbd,0x3f95,0x3f99,0x1ba1,1,0x1799,0x3fa1,0x3fa9,0x3fa5,0x3fb5,0x1c1f,0x1c23,
+0x3fc1,0x3fc5,0x3fc9,0x3fcd,0x3ff9,0x3ffd,0x4001,0x1c13,0x4005,0x4008,0x400c,0x1c1a,1,0x4011,0x4015,0x4019,
+0x401d,1,1,1,1,0x4020,0x4026,0x402c,1,0x4032,1,0x4038,0x403e,0x4044,0x404a,0x4050,
+0x4056,0x405c,0x4062,0x4068,0x406e,0x4075,0x53c6,0x53c6,0x53ce,0x53ce,0x53d6,0x53d6,0x53de,0x53de,0x53e6,0x53e6,
+0x53e6,0x53e6,0x4078,0x4078,0x407d,0x407d,0x407d,0x407d,0x4081,0x4081,0x4085,0x4085,0x4085,0x4085,0x4089,0x4089,
+0x4089,0x4089,0x408d,0x408d,0x408d,0x408d,0x4091,0x4091,0x4091,0x4091,0x4095,0x4095,0x4095,0x4095,0x4099,0x4099,
+0x409d,0x409d,0x40a1,0x40a1,0x40a5,0x40a5,0x40a9,0x40a9,0x40a9,0x40a9,0x40ad,0x40ad,0x40ad,0x40ad,0x40b1,0x40b1,
+0x40b1,0x40b1,0x40b5,0x40b5,0x40b5,0x40b9,0x40b9,0x40b9,0x40b9,0x40bd,0x40bd,0x40bd,0x40bd,0x40c1,0x40c1,0x40c1,
+0x40c1,0x40c5,0x40c5,0x40c5,0x40c5,0x40c9,0x40c9,0x40c9,0x40c9,0x40cd,0x40cd,0x40cd,0x40cd,0x40d1,0x40d1,0x40d1,
+0x40d1,0x40d5,0x40d5,0x40d5,0x40d5,0x40d9,0x40d9,0x40d9,0x40d9,0x40dd,0x40dd,0x40dd,0x40dd,0x40e1,0x40e1,0x40e1,
+0x40e1,0x40e4,0x40e4,0x3855,0x3855,0x40e8,0x40e8,0x40e8,0x40e8,0x53f2,0x53f2,0x5400,0x5400,0x540e,0x540e,0x40ec,
+0x40ec,1,1,0x54d6,1,0x3fa5,0x40f3,0x3ff9,0x4015,0x4019,0x3ffd,0x40f7,0x1c1f,0x1c23,0x4001,0x1c13,
+0x3f95,0x4005,0x1ba1,0x40fb,0x1bf7,0x167d,0x1665,0x1669,0x1bfb,0x1bff,0x1c03,0x1c07,0x1c0b,0x1c0f,0x3fa1,0x1799,
+0x4008,0x1c1a,0x400c,0x3fa9,0x401d,0x165a,0x1a64,0x1acc,0x1a68,0x1a6c,0x1ad8,0x1a70,0x1740,0x1a74,0x1748,0x1a78,
+0x177c,0x1a7c,0x1a80,0x1680,0x1a88,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,0x1b18,0x3ff1,
+0x4011,0x3ff5,0x40ff,0x3fbd,0x1b8b,0x165a,0x1a64,0x1acc,0x1a68,0x1a6c,0x1ad8,0x1a70,0x1740,0x1a74,0x1748,0x1a78,
+0x177c,0x1a7c,0x1a80,0x1680,0x1a88,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,0x1b18,0x3fc1,
+0x4103,0x3fc5,0x4107,0x410b,0x410f,0x3f9d,0x3fe1,0x3fe5,0x3f99,0x4113,0x28b8,0x4117,0x411b,0x411f,0x4123,0x4127,
+0x412b,0x412f,0x4133,0x4137,0x413b,0x2801,0x2805,0x2808,0x280d,0x2811,0x2814,0x2818,0x281c,0x2820,0x2824,0x2828,
+0x282c,0x2830,0x2834,0x2838,0x283c,0x2840,0x2844,0x2848,0x284c,0x2851,0x2855,0x2859,0x285d,0x2861,0x2864,0x2868,
+0x286c,0x2870,0x2874,0x2879,0x287d,0x2881,0x2885,0x2889,0x288d,0x2891,0x2895,0x2899,0x289d,0x28a1,0x28a5,0x28a9,
+0x28ac,0x413f,0x54ca,0x54d0,0x54d6,0x239a,0x239e,0x5450,0x23a2,0x5454,0x5458,0x23a6,0x23aa,0x23ae,0x545c,0x5460,
+0x5464,0x5468,0x546c,0x5470,0x23b3,0x23b6,0x23ba,0x23be,0x23c3,0x23c6,0x23ca,0x23ce,0x23d2,0x23d6,0x23da,0x23de,
+0x23e2,0x23e6,0x23ea,1,1,0x5474,0x5478,0x547c,0x5480,0x5484,0x5488,1,1,0x548c,0x5490,0x5494,
+0x5498,0x549c,0x54a0,1,1,0x54a4,0x54a8,0x54ac,0x54b0,0x54b4,0x54b8,1,1,0x54bc,0x54c0,0x54c4,
+1,1,1,0x4143,0x4147,0x414b,0x165e,0x414f,0x4153,0x4157,1,0x415b,0x415e,0x4163,0x4166,0x416b,
+0x416f,0x4173,1,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,1,1,1,1,
+1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,1,1,0xfb39,0xfb39,0xfb39,
+0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,0xfb39,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0xffb8,1,0xffcc,1,1,1,
+1,1,1,1,1,0xffcc,0xfe02,0xffb8,1,1,1,1,0xfe12,0xfbf9,0xfbf9,0xfbf9,
+0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,0xfbf9,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,1,1,
+1,1,1,1,1,1,0xffb8,0xffb8,0xffcc,0xffcc,0xffcc,0xffb8,0xffcc,0xffb8,0xffb8,0xffb8,
+1,1,1,1,1,1,1,1,1,0x660,0x15d9,0x666,0x15e3,1,1,1,
+1,1,0x66c,1,1,1,1,1,0x15ed,1,1,1,1,1,1,1,
+1,1,0xfe12,0xfc0e,1,1,1,1,1,1,1,0xfc00,1,1,1,1,
+1,1,0x15f7,0x1601,1,0x672,0x678,0xfe12,0xfe12,1,1,1,1,1,1,1,
+1,1,1,1,0xfe12,1,1,1,1,1,1,1,1,1,0xfe0e,1,
+1,1,1,1,0xfe12,0xfe0e,1,1,1,1,1,1,1,1,1,0xfe0e,
+0xfe12,1,1,1,1,1,1,1,1,1,1,1,0xfe0e,0xfe0e,1,0xfc00,
+1,1,1,1,1,1,1,0x67e,1,1,1,0x160b,0x1615,0xfe12,1,1,
+1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,0xfe12,1,
+1,1,0xfe0e,1,1,1,1,1,1,1,1,1,0xfc00,1,1,1,
+1,1,1,1,1,0x68a,0xfc00,0x161f,0x1629,0xfc00,0x1633,1,1,0xfe12,0xfe0e,1,
+1,1,1,1,1,1,1,1,1,1,1,0x69c,0x6a2,0x163d,0x1647,1,
+1,1,0xfe12,0xfe0e,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0xfe12,0xfe0e,1,1,1,1,1,1,1,1,0xfaf9,0xfaf9,0xfaf9,
+0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfaf9,0xfe02,0xfe02,0xfe02,
+0xfe02,0xfe02,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0xfe02,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x4176,
+0x4180,0x418a,0x4198,0x41a6,0x41b4,0x41c2,0xffb0,0xffb0,0xfe02,0xfe02,0xfe02,1,1,1,0xffc4,0xffb0,
+0xffb0,0xffb0,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0x54d6,0xffb8,0xffb8,0xffb8,0xffb8,0xffb8,1,
+1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffb8,0xffb8,1,1,1,1,1,1,1,1,
+1,1,1,0x41d0,0x41da,0x41e4,0x41f2,0x4200,0x420e,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0x1acc,0x1a68,0x1a6c,0x1ad8,0x1a70,1,0x1a74,0x1748,
+0x1a78,0x177c,0x1a7c,0x1a80,0x1680,0x1a88,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,0x1b18,
+0x165a,1,0x1acc,0x1a68,1,1,0x1a70,1,1,0x1748,0x1a78,1,1,0x1a80,0x1680,0x1a88,
+0x1c63,1,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,0x1b18,0x165a,0x1a64,0x1acc,0x1a68,1,0x1ad8,
+1,0x1740,0x1a74,0x1748,0x1a78,0x177c,0x1a7c,0x1a80,1,0x1a88,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,0x1aa8,
+0x1750,0x1780,0x1754,0x1b18,0x165a,0x1a64,1,0x1a68,0x1a6c,0x1ad8,0x1a70,1,1,0x1748,0x1a78,0x177c,
+0x1a7c,0x1a80,0x1680,0x1a88,0x1c63,1,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,1,0x165a,0x1a64,
+0x1a74,0x1748,0x1a78,0x177c,0x1a7c,1,0x1680,1,1,1,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,
+0x1754,1,0x165a,0x1a64,0x1acc,0x1a68,0x1a6c,0x1ad8,0x1a70,0x1740,0x1a74,0x1748,0x1a78,0x177c,0x1a7c,0x1a80,
+0x1750,0x1780,0x1754,0x1b18,0x421d,0x4221,1,1,0x4224,0x1aad,0x1ab1,0x1ab5,0x4228,0x422d,0x4230,0x1b25,
+0x1b3a,0x4235,0x4239,0x1673,0x423d,0x4241,0x4244,0x1c97,0x1ac0,0x1b25,0x4249,0x424d,0x4250,0x1ab9,0x1abd,0x4255,
+0x1c7a,0x4259,0x4224,0x1aad,0x1ab1,0x1ab5,0x4228,0x422d,0x4230,0x1b25,0x1b3a,0x4235,0x4239,0x1673,0x423d,0x4241,
+0x4244,0x1c97,0x1ac0,0x4249,0x4249,0x424d,0x4250,0x1ab9,0x1abd,0x4255,0x1c7a,0x425d,0x4228,0x1b25,0x4235,0x1ab9,
+0x1ac0,0x1c97,0x4224,0x1aad,0x1ab1,0x1ab5,0x4228,0x422d,0x4230,0x1b25,0x1b3a,0x4235,0x4239,0x1673,0x423d,0x4241,
+0x1abd,0x4255,0x1c7a,0x425d,0x4228,0x1b25,0x4235,0x1ab9,0x1ac0,0x1c97,0x4261,0x4261,1,1,0x1bf7,0x167d,
+0x1665,0x1669,0x1bfb,0x1bff,0x1c03,0x1c07,0x1c0b,0x1c0f,0x1bf7,0x167d,0x1665,0x1669,0x1bfb,0x1bff,0x1c03,0x1c07,
+0x1c0b,0x1c0f,0x1bf7,0x167d,0x1665,0x1669,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,0xffcc,0xffcc,
+0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,0xffcc,
+0xffcc,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,1,1,1,1,1,0xffb8,0xffb8,0xffb8,0xffb8,
+0xffb8,0xffb8,0xffb8,1,1,1,1,1,1,1,1,1,0xfb09,0xfb09,0xfb09,0xfb09,
+0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,0xfb09,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,0xffcc,
+0xfe0e,1,1,1,1,1,0x4078,0x407d,0x408d,0x4099,1,0x40e4,0x40a5,0x4091,0x40b9,0x40e8,
+0x40d1,0x40d5,0x40d9,0x40dd,0x40a9,0x40c1,0x40c9,0x40b1,0x40cd,0x40a1,0x40ad,0x4085,0x4089,0x4095,0x409d,0x40b5,
+0x40bd,0x40c5,0x4265,0x3821,0x4269,0x426d,1,0x407d,0x408d,1,0x40e1,1,1,0x4091,1,0x40e8,
+0x40d1,0x40d5,0x40d9,0x40dd,0x40a9,0x40c1,0x40c9,0x40b1,0x40cd,1,0x40ad,0x4085,0x4089,0x4095,1,0x40b5,
+1,0x40c5,1,1,1,1,0x408d,1,1,1,1,0x4091,1,0x40e8,1,0x40d5,
+1,0x40dd,0x40a9,0x40c1,1,0x40b1,0x40cd,1,0x40ad,1,1,0x4095,1,0x40b5,1,0x40c5,
+1,0x3821,1,0x426d,1,0x407d,0x408d,1,0x40e1,1,1,0x4091,0x40b9,0x40e8,0x40d1,1,
+0x40d9,0x40dd,0x40a9,0x40c1,0x40c9,0x40b1,0x40cd,1,0x40ad,0x4085,0x4089,0x4095,1,0x40b5,0x40bd,0x40c5,
+0x4265,1,0x4269,1,0x4078,0x407d,0x408d,0x4099,0x40e1,0x40e4,0x40a5,0x4091,0x40b9,0x40e8,1,0x40d5,
+0x40d9,0x40dd,0x40a9,0x40c1,0x40c9,0x40b1,0x40cd,0x40a1,0x40ad,0x4085,0x4089,0x4095,0x409d,0x40b5,0x40bd,0x40c5,
+1,1,1,1,0x407d,0x408d,0x4099,1,0x40e4,0x40a5,0x4091,0x40b9,0x40e8,1,0x40d5,0x40d9,
+0x40dd,0x40a9,0x40c1,0x4271,0x4277,0x427d,0x4283,0x4289,0x428f,0x4295,0x429b,0x42a1,0x42a7,0x42ad,1,1,
+1,1,1,0x1f91,0x1f99,0x1fa1,0x1fa9,0x1fb1,0x1fb9,0x1fc1,0x1fc9,0x1fd1,0x1fd9,0x42b3,0x1acc,0x174c,
+0x2d2c,0x42ba,1,0x1c63,0x174c,0x16ba,0x1a8c,0x1a90,0x1aa8,0x1750,0x1780,0x1754,0x1b18,0x42c0,0x2ce0,0x42c6,
+0x169c,0x42cc,0x42d4,1,1,1,1,1,1,1,1,1,1,0x42da,0x42e0,1,
+1,1,1,0x42e6,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x42ec,0x42f2,0x2828,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x211f,0x42f9,0x42fd,0x5418,0x203b,0x4301,0x4305,0x24b7,0x4309,0x430d,0x4311,0x32ef,0x4315,
+0x4319,0x431d,0x4321,0x4325,0x4329,0x21af,0x432d,0x4331,0x4335,0x4339,0x433d,0x4341,0x2023,0x2497,0x4345,0x2715,
+0x24a3,0x2719,0x4349,0x228f,0x434d,0x4351,0x4355,0x4359,0x435d,0x26d1,0x2147,0x4361,0x4365,0x4369,0x436d,1,
+1,1,1,0x4371,0x4379,0x4381,0x4389,0x4391,0x4399,0x43a1,0x43a9,0x43b1,1,1,1,1,
+1,1,1,0x43b9,0x43bd,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0x43c1,0x43c5,0x43c9,0x43cd,0x43d3,0x3463,0x43d7,0x43db,0x43df,0x43e3,0x3467,0x43e7,0x43eb,
+0x43ef,0x346b,0x43f5,0x43f9,0x43fd,0x4401,0x4407,0x440b,0x431d,0x440f,0x4415,0x4419,0x441d,0x4421,0x3549,0x4425,
+0x2063,0x442b,0x442f,0x4433,0x4437,0x4365,0x443b,0x443f,0x355d,0x346f,0x3473,0x3561,0x4443,0x4447,0x3197,0x444b,
+0x3477,0x444f,0x4453,0x4457,0x445b,0x445b,0x445b,0x445f,0x4465,0x4469,0x446d,0x4471,0x4477,0x447b,0x447f,0x4483,
+0x4487,0x448b,0x448f,0x4493,0x4497,0x449b,0x449f,0x44a3,0x44a7,0x44a7,0x3569,0x44ab,0x44af,0x44b3,0x44b7,0x347f,
+0x44bb,0x44bf,0x44c3,0x33df,0x44c7,0x44cb,0x44cf,0x44d3,0x44d7,0x44db,0x44df,0x44e3,0x44e7,0x44ed,0x44f1,0x44f5,
+0x4301,0x44f9,0x44fd,0x4501,0x4507,0x450d,0x4511,0x4515,0x4519,0x451d,0x4521,0x4525,0x4529,0x452d,0x452d,0x4531,
+0x4537,0x453b,0x3187,0x453f,0x4543,0x4549,0x454d,0x4551,0x20cb,0x4555,0x4559,0x20d3,0x455d,0x4561,0x4565,0x456b,
+0x456f,0x4575,0x4579,0x457d,0x4581,0x4585,0x4589,0x458d,0x4591,0x4595,0x4599,0x459d,0x45a1,0x45a7,0x45ab,0x45af,
+0x45b3,0x30b7,0x45b7,0x20fb,0x45bd,0x45bd,0x45c3,0x45c7,0x45c7,0x45cb,0x45cf,0x45d5,0x45db,0x45df,0x45e3,0x45e7,
+0x45eb,0x45ef,0x45f3,0x45f7,0x45fb,0x45ff,0x3493,0x4603,0x4609,0x460d,0x4611,0x3599,0x4611,0x4615,0x349b,0x4619,
+0x461d,0x4621,0x4625,0x349f,0x304b,0x4629,0x462d,0x4631,0x4635,0x4639,0x463d,0x4641,0x4647,0x464b,0x464f,0x4653,
+0x4657,0x465b,0x4661,0x4665,0x4669,0x466d,0x4671,0x4675,0x4679,0x467d,0x4681,0x34a3,0x4685,0x4689,0x468f,0x4693,
+0x4697,0x469b,0x34ab,0x469f,0x46a3,0x46a7,0x46ab,0x46af,0x46b3,0x46b7,0x46bb,0x30bb,0x35b9,0x46bf,0x46c3,0x46c7,
+0x46cb,0x46d1,0x46d5,0x46d9,0x46dd,0x34af,0x46e1,0x46e7,0x46eb,0x46ef,0x3667,0x46f3,0x46f7,0x46fb,0x46ff,0x4703,
+0x4709,0x470d,0x4711,0x4715,0x471b,0x471f,0x4723,0x4727,0x31cb,0x472b,0x472f,0x4735,0x473b,0x4741,0x4745,0x474b,
+0x474f,0x4753,0x4757,0x475b,0x34b3,0x3317,0x475f,0x4763,0x4767,0x476b,0x4771,0x4775,0x4779,0x477d,0x35c5,0x4781,
+0x4785,0x478b,0x478f,0x4793,0x4799,0x479f,0x47a3,0x35c9,0x47a7,0x47ab,0x47af,0x47b3,0x47b7,0x47bb,0x47bf,0x47c5,
+0x47c9,0x47cf,0x47d3,0x47d9,0x35d1,0x47dd,0x47e1,0x47e7,0x47eb,0x47ef,0x47f5,0x47fb,0x47ff,0x4803,0x4807,0x480b,
+0x480b,0x480f,0x4813,0x35d9,0x4817,0x481b,0x481f,0x4823,0x4827,0x482d,0x4831,0x3193,0x4837,0x483d,0x4841,0x4847,
+0x484d,0x4853,0x4857,0x35f1,0x485b,0x4861,0x4867,0x486d,0x4873,0x4877,0x4877,0x35f5,0x366f,0x487b,0x487f,0x4883,
+0x4887,0x488d,0x30ff,0x35fd,0x4891,0x4895,0x34db,0x489b,0x48a1,0x342f,0x48a7,0x48ab,0x34e7,0x48af,0x48b3,0x48b7,
+0x48bd,0x48bd,0x48c3,0x48c7,0x48cb,0x48d1,0x48d5,0x48d9,0x48dd,0x48e3,0x48e7,0x48eb,0x48ef,0x48f3,0x48f7,0x48fd,
+0x4901,0x4905,0x4909,0x490d,0x4911,0x4915,0x491b,0x4921,0x4925,0x492b,0x492f,0x4935,0x4939,0x34ff,0x493d,0x4943,
+0x4949,0x494d,0x4953,0x4957,0x495d,0x4961,0x4965,0x4969,0x496d,0x4971,0x4975,0x497b,0x4981,0x4987,0x45c3,0x498d,
+0x4991,0x4995,0x4999,0x499d,0x49a1,0x49a5,0x49a9,0x49ad,0x49b1,0x49b5,0x49b9,0x31d7,0x49bf,0x49c3,0x49c7,0x49cb,
+0x49cf,0x49d3,0x350b,0x49d7,0x49db,0x49df,0x49e3,0x49e7,0x49ed,0x49f3,0x49f9,0x49fd,0x4a01,0x4a05,0x4a09,0x4a0f,
+0x4a13,0x4a19,0x4a1d,0x4a21,0x4a27,0x4a2d,0x4a31,0x30eb,0x4a35,0x4a39,0x4a3d,0x4a41,0x4a45,0x4a49,0x3619,0x4a4d,
+0x4a51,0x4a55,0x4a59,0x4a5d,0x4a61,0x4a65,0x4a69,0x2263,0x4a6d,0x4a73,0x4a77,0x4a7b,0x4a7f,0x4a83,0x4a87,0x4a8d,
+0x4a93,0x4a97,0x4a9b,0x362d,0x3631,0x227f,0x4a9f,0x4aa5,0x4aa9,0x4aad,0x4ab1,0x4ab5,0x4abb,0x4ac1,0x4ac5,0x4ac9,
+0x4acd,0x4ad3,0x3635,0x4ad7,0x4add,0x4ae3,0x4ae7,0x4aeb,0x4aef,0x4af5,0x4af9,0x4afd,0x4b01,0x4b05,0x4b09,0x4b0d,
+0x4b11,0x4b17,0x4b1b,0x4b1f,0x4b23,0x4b29,0x4b2d,0x4b31,0x4b35,0x4b39,0x4b3f,0x4b45,0x4b49,0x4b4d,0x4b51,0x4b57,
+0x4b5b,0x364d,0x364d,0x4b61,0x4b65,0x4b6b,0x4b6f,0x4b73,0x4b77,0x4b7b,0x4b7f,0x4b83,0x4b87,0x3651,0x4b8d,0x4b91,
+0x4b95,0x4b99,0x4b9d,0x4ba1,0x4ba7,0x4bab,0x4bb1,0x4bb7,0x233f,0x4bbd,0x234f,0x4bc1,0x4bc5,0x4bc9,0x4bcd,0x2363,
+0x4bd1,1,1
+};
+
+static const UCPTrie norm2_nfkc_cf_data_trie={
+    norm2_nfkc_cf_data_trieIndex,
+    { norm2_nfkc_cf_data_trieData },
+    1997, 12531,
+    0xe1000, 0xe1,
+    0, 0,
+    0, 0,
+    0xd0, 0x61f,
+    0x1,
+};
+
+static const uint16_t norm2_nfkc_cf_data_extraData[10860]={
+0xffff,0xffff,0x8670,0x44dc,0x8670,0x44c0,0x8670,0x44de,0x600,0x1c0,0x602,0x1c2,0x604,0x1c5,0x606,0x1c6,
+0x608,0x202,0x60c,0x207,0x60e,0x44f,0x610,0x1c9,0x612,0x3d46,0x614,0x1cb,0x618,0x39c,0x61e,0x402,
+0x622,0x406,0x646,0x3d43,0x64a,0x3c02,0x8650,0x20a,0x60e,0x3c06,0x646,0x3c0a,0x8662,0x3c0e,0x602,0x20e,
+0x604,0x212,0x60e,0x216,0x618,0x21a,0x864e,0x1cf,0x60e,0x3c16,0x618,0x21e,0x646,0x3c1a,0x64e,0x3c22,
+0x65a,0x3c26,0x8662,0x3c1e,0x600,0x1d0,0x602,0x1d2,0x604,0x1d5,0x606,0x3d7a,0x608,0x227,0x60c,0x22a,
+0x60e,0x22e,0x610,0x1d6,0x612,0x3d76,0x618,0x236,0x61e,0x40a,0x622,0x40e,0x646,0x3d73,0x64e,0x453,
+0x650,0x232,0x65a,0x3c32,0x8660,0x3c36,0x860e,0x3c3e,0x602,0x3ea,0x604,0x23a,0x608,0x3c42,0x60c,0x23e,
+0x60e,0x242,0x618,0x3ce,0x864e,0x246,0x604,0x24a,0x60e,0x3c46,0x610,0x3c4e,0x618,0x43e,0x646,0x3c4a,
+0x64e,0x3c52,0x65c,0x3c56,0x8662,0x3d2c,0x600,0x1d8,0x602,0x1da,0x604,0x1dc,0x606,0x252,0x608,0x256,
+0x60c,0x25a,0x610,0x1df,0x612,0x3d92,0x618,0x3a0,0x61e,0x412,0x622,0x416,0x646,0x3d96,0x650,0x25e,
+0x8660,0x3c5a,0x604,0x26a,0x8618,0x3e0,0x602,0x3c62,0x618,0x3d2,0x646,0x3c66,0x64e,0x26e,0x8662,0x3c6a,
+0x602,0x274,0x618,0x27c,0x646,0x3c6f,0x64e,0x278,0x65a,0x3c7a,0x8662,0x3c76,0x602,0x3c7e,0x60e,0x3c82,
+0x8646,0x3c86,0x600,0x3f2,0x602,0x288,0x606,0x1e2,0x60e,0x3c8a,0x618,0x290,0x646,0x3c8e,0x64e,0x28c,
+0x65a,0x3c96,0x8662,0x3c92,0x600,0x1e4,0x602,0x1e6,0x604,0x1e9,0x606,0x1eb,0x608,0x29b,0x60c,0x29e,
+0x60e,0x45f,0x610,0x1ed,0x612,0x3d9e,0x616,0x2a2,0x618,0x3a4,0x61e,0x41a,0x622,0x41e,0x636,0x343,
+0x646,0x3d9b,0x8650,0x3d7,0x602,0x3caa,0x860e,0x3cae,0x602,0x2aa,0x60e,0x3cb2,0x618,0x2b2,0x61e,0x422,
+0x622,0x426,0x646,0x3cb7,0x64e,0x2ae,0x8662,0x3cbe,0x602,0x2b7,0x604,0x2ba,0x60e,0x3cc2,0x618,0x2c3,
+0x646,0x3cc7,0x64c,0x432,0x864e,0x2be,0x60e,0x3cd6,0x610,0x3d2e,0x618,0x2ca,0x646,0x3cda,0x64c,0x436,
+0x64e,0x2c6,0x65a,0x3ce2,0x8662,0x3cde,0x600,0x1f2,0x602,0x1f4,0x604,0x1f6,0x606,0x2d3,0x608,0x2d7,
+0x60c,0x2da,0x610,0x1f9,0x612,0x3dce,0x614,0x2de,0x616,0x2e2,0x618,0x3a8,0x61e,0x42a,0x622,0x42e,
+0x636,0x361,0x646,0x3dca,0x648,0x3ce6,0x650,0x2e6,0x65a,0x3cee,0x8660,0x3cea,0x606,0x3cfa,0x8646,0x3cfe,
+0x600,0x3d02,0x602,0x3d06,0x604,0x2ea,0x60e,0x3d0e,0x610,0x3d0a,0x614,0x3d30,0x8646,0x3d12,0x60e,0x3d16,
+0x8610,0x3d1a,0x600,0x3de6,0x602,0x1fa,0x604,0x2ee,0x606,0x3df2,0x608,0x466,0x60e,0x3d1e,0x610,0x1fe,
+0x612,0x3dee,0x614,0x3d32,0x8646,0x3dea,0x602,0x2f4,0x604,0x3d22,0x60e,0x2f8,0x618,0x2fc,0x646,0x3d26,
+0x8662,0x3d2a,0x602,0x3fa,0x8608,0x3c6,0x8602,0x3fe,0x8618,0x3de,0x600,0x3ee0,0x602,0x758,0x608,0x3f62,
+0x60c,0x3f60,0x626,0x3e01,0x628,0x3e03,0x8684,0x3f6c,0x600,0x3ee4,0x602,0x75a,0x626,0x3e21,0x8628,0x3e23,
+0x600,0x3ee8,0x602,0x75c,0x626,0x3e41,0x628,0x3e43,0x8684,0x3f8c,0x600,0x3eec,0x602,0x75e,0x608,0x3fa2,
+0x60c,0x3fa0,0x610,0x795,0x626,0x3e61,0x628,0x3e63,0x8684,0x3fac,0x600,0x3ef0,0x602,0x798,0x626,0x3e81,
+0x8628,0x3e83,0x626,0x3fc8,0x8628,0x3fca,0x600,0x3ef4,0x602,0x79a,0x608,0x3fc2,0x60c,0x3fc0,0x610,0x797,
+0x626,0x3ea1,0x628,0x3ea3,0x8684,0x3fcc,0x600,0x3ef8,0x602,0x79c,0x626,0x3ec1,0x628,0x3ec3,0x8684,0x3fec,
+0x60c,0x9a2,0x8610,0x9a6,0x8602,0x8a6,0x600,0x8a0,0x60c,0x9ae,0x8610,0x8a2,0x60c,0x984,0x8610,0x9ba,
+0x8610,0x9be,0x600,0x8ba,0x608,0x9c6,0x60c,0x872,0x8610,0x9ca,0x8602,0x8b8,0x8610,0x9ce,0x608,0x9de,
+0x60c,0x8bc,0x610,0x9e2,0x8616,0x9e6,0x8610,0x9ea,0x8610,0x9f2,0x8610,0x9da,0x8610,0x8ae,0x861e,0x8ee,
+0x8610,0x9b6,0x8610,0x9d6,0xca6,0xc44,0xca8,0xc46,0x8caa,0xc4a,0x8ca8,0xc48,0x8ca8,0xc4c,0x8ca8,0xd84,
+0x8ca8,0xda6,0x8ca8,0xd80,0x9278,0x1252,0x9278,0x1262,0x9278,0x1268,0x137c,0x1396,0x93ae,0x1398,0x167c,0x1696,
+0x16ac,0x1690,0x96ae,0x1698,0x97ae,0x1728,0x177c,0x1794,0x97ae,0x1798,0x977c,0x1796,0x98ac,0x1890,0x99aa,0x1980,
+0x1984,0x1995,0x19aa,0x198e,0x99ac,0x1990,0x1a7c,0x1a94,0x9aae,0x1a98,0x9a7c,0x1a96,0x1b94,0x1bb4,0x1b9e,0x1bb9,
+0x9bbe,0x1bbc,0xa05c,0x204c,0xb66a,0x360c,0xb66a,0x3610,0xb66a,0x3614,0xb66a,0x3618,0xb66a,0x361c,0xb66a,0x3624,
+0xb66a,0x3676,0xb66a,0x367a,0xb66a,0x3680,0xb66a,0x3682,0xb66a,0x3686,0x8670,0x4334,0x8670,0x4336,0x8670,0x435c,
+0x8670,0x439a,0x8670,0x439e,0x8670,0x439c,0x8670,0x4408,0x8670,0x4412,0x8670,0x4418,0x8670,0x4448,0x8670,0x444c,
+0x8670,0x4482,0x8670,0x4488,0x8670,0x448e,0x8670,0x4492,0x8670,0x44da,0x8670,0x44c4,0x8670,0x44e0,0x8670,0x44e2,
+0x8670,0x44e8,0x8670,0x44ea,0x8670,0x44f0,0x8670,0x44f2,0x8670,0x4500,0x8670,0x4502,0x8670,0x45c0,0x8670,0x45c2,
+0x8670,0x4508,0x8670,0x450a,0x8670,0x4510,0x8670,0x4512,0x8670,0x45c4,0x8670,0x45c6,0x8670,0x4558,0x8670,0x455a,
+0x8670,0x455c,0x8670,0x455e,0x8670,0x45d4,0x8670,0x45d6,0x8670,0x45d8,0x8670,0x45da,0xe132,0x6128,0xe132,0x6098,
+0xe132,0x609c,0xe132,0x60a0,0xe132,0x60a4,0xe132,0x60a8,0xe132,0x60ac,0xe132,0x60b0,0xe132,0x60b4,0xe132,0x60b8,
+0xe132,0x60bc,0xe132,0x60c0,0xe132,0x60c4,0xe132,0x60ca,0xe132,0x60ce,0xe132,0x60d2,0x6132,0x60e0,0xe134,0x60e2,
+0x6132,0x60e6,0xe134,0x60e8,0x6132,0x60ec,0xe134,0x60ee,0x6132,0x60f2,0xe134,0x60f4,0x6132,0x60f8,0xe134,0x60fa,
+0xe132,0x613c,0xe132,0x61e8,0xe132,0x6158,0xe132,0x615c,0xe132,0x6160,0xe132,0x6164,0xe132,0x6168,0xe132,0x616c,
+0xe132,0x6170,0xe132,0x6174,0xe132,0x6178,0xe132,0x617c,0xe132,0x6180,0xe132,0x6184,0xe132,0x618a,0xe132,0x618e,
+0xe132,0x6192,0x6132,0x61a0,0xe134,0x61a2,0x6132,0x61a6,0xe134,0x61a8,0x6132,0x61ac,0xe134,0x61ae,0x6132,0x61b2,
+0xe134,0x61b4,0x6132,0x61b8,0xe134,0x61ba,0xe132,0x61ee,0xe132,0x61f0,0xe132,0x61f2,0xe132,0x61f4,0xe132,0x61fc,
+0xb489,0x2e82,0x2134,0xb489,0x2e82,0x2138,0xb489,0x2e82,0x2156,0xb489,0x49c2,0x225c,0xb489,0x49c2,0x225e,0x3489,
+0xcf82,0x2696,0xb489,0xd5c2,0x2698,0x348b,0x2c02,0x2978,0x348b,0x2e82,0x2976,0xb48b,0x2f42,0x297c,0xb48b,0x6bc2,
+0x2b74,0xb48b,0x6bc2,0x2b76,2,0xe602,0x61,0x302,0x600,0x3d4e,0x602,0x3d4a,0x606,0x3d56,0x8612,0x3d52,
+0xe602,0x61,0x308,0x8608,0x3be,0xe602,0x61,0x30a,0x8602,0x3f6,0xca02,0x63,0x327,0x8602,0x3c12,0xe602,
+0x65,0x302,0x600,0x3d82,0x602,0x3d7e,0x606,0x3d8a,0x8612,0x3d86,0xe602,0x69,0x308,0x8602,0x3c5e,0xe602,
+0x6f,0x302,0x600,0x3da6,0x602,0x3da2,0x606,0x3dae,0x8612,0x3daa,0xe602,0x6f,0x303,0x602,0x3c9a,0x608,
+0x45a,0x8610,0x3c9e,0xe602,0x6f,0x308,0x8608,0x456,0xe602,0x75,0x308,0x600,0x3b8,0x602,0x3b0,0x608,
+0x3ac,0x8618,0x3b4,0xe602,0x61,0x306,0x600,0x3d62,0x602,0x3d5e,0x606,0x3d6a,0x8612,0x3d66,0xe602,0x65,
+0x304,0x600,0x3c2a,0x8602,0x3c2e,0xe602,0x6f,0x304,0x600,0x3ca2,0x8602,0x3ca6,0xe602,0x73,0x301,0x860e,
+0x3cca,0xe602,0x73,0x30c,0x860e,0x3cce,0xe602,0x75,0x303,0x8602,0x3cf2,0xe602,0x75,0x304,0x8610,0x3cf6,
+0xd802,0x6f,0x31b,0x600,0x3dba,0x602,0x3db6,0x606,0x3dc2,0x612,0x3dbe,0x8646,0x3dc6,0xd802,0x75,0x31b,
+0x600,0x3dd6,0x602,0x3dd2,0x606,0x3dde,0x612,0x3dda,0x8646,0x3de2,0xca02,0x6f,0x328,0x8608,0x3da,0xe602,
+0x61,0x307,0x8608,0x3c2,0xca02,0x65,0x327,0x860c,0x3c3a,0xe602,0x6f,0x307,0x8608,0x462,0xe602,0x3b9,
+0x308,0x600,0x3fa4,0x602,0x720,0x8684,0x3fae,0xe602,0x3c5,0x308,0x600,0x3fc4,0x602,0x760,0x8684,0x3fce,
+2,0xcc6,0xcc2,0x99aa,0x1996,2,0xdd9,0xdcf,0x9b94,0x1bba,0xdc02,0x6c,0x323,0x8608,0x3c72,0xdc02,
+0x72,0x323,0x8608,0x3cba,0xdc02,0x73,0x323,0x860e,0x3cd2,0xdc02,0x61,0x323,0x604,0x3d5a,0x860c,0x3d6e,
+0xdc02,0x65,0x323,0x8604,0x3d8e,0xdc02,0x6f,0x323,0x8604,0x3db2,0xe602,0x3b1,0x313,0x600,0x3e04,0x602,
+0x3e08,0x8684,0x3e0c,0xe602,0x3b1,0x314,0x600,0x3e06,0x602,0x3e0a,0x8684,0x3e0e,0xe602,0x3b5,0x313,0x600,
+0x3e24,0x8602,0x3e28,0xe602,0x3b5,0x314,0x600,0x3e26,0x8602,0x3e2a,0xe602,0x3b7,0x313,0x600,0x3e44,0x602,
+0x3e48,0x8684,0x3e4c,0xe602,0x3b7,0x314,0x600,0x3e46,0x602,0x3e4a,0x8684,0x3e4e,0xe602,0x3b9,0x313,0x600,
+0x3e64,0x602,0x3e68,0x8684,0x3e6c,0xe602,0x3b9,0x314,0x600,0x3e66,0x602,0x3e6a,0x8684,0x3e6e,0xe602,0x3bf,
+0x313,0x600,0x3e84,0x8602,0x3e88,0xe602,0x3bf,0x314,0x600,0x3e86,0x8602,0x3e8a,0xe602,0x3c5,0x313,0x600,
+0x3ea4,0x602,0x3ea8,0x8684,0x3eac,0xe602,0x3c5,0x314,0x600,0x3ea6,0x602,0x3eaa,0x8684,0x3eae,0xe602,0x3c9,
+0x313,0x600,0x3ec4,0x602,0x3ec8,0x8684,0x3ecc,0xe602,0x3c9,0x314,0x600,0x3ec6,0x602,0x3eca,0x8684,0x3ece,
+3,0xe602,0x61,0x300,0xe602,0x61,0x301,0xe602,0x61,0x303,0xe602,0x65,0x300,0xe602,0x65,0x301,
+0xe602,0x65,0x308,0xe602,0x69,0x300,0xe602,0x69,0x301,0xe602,0x69,0x302,0xe602,0x6e,0x303,0xe602,
+0x6f,0x300,0xe602,0x6f,0x301,0xe602,0x75,0x300,0xe602,0x75,0x301,0xe602,0x75,0x302,0xe602,0x79,
+0x301,0xe602,0x79,0x308,0xe602,0x61,0x304,0xca02,0x61,0x328,0xe602,0x63,0x301,0xe602,0x63,0x302,
+0xe602,0x63,0x307,0xe602,0x63,0x30c,0xe602,0x64,0x30c,0xe602,0x65,0x306,0xe602,0x65,0x307,0xca02,
+0x65,0x328,0xe602,0x65,0x30c,0xe602,0x67,0x302,0xe602,0x67,0x306,0xe602,0x67,0x307,0xca02,0x67,
+0x327,0xe602,0x68,0x302,0xe602,0x69,0x303,0xe602,0x69,0x304,0xe602,0x69,0x306,0xca02,0x69,0x328,
+0xe602,0x6a,0x302,0xca02,0x6b,0x327,0xe602,0x6c,0x301,0xca02,0x6c,0x327,0xe602,0x6c,0x30c,0xe602,
+0x6e,0x301,0xca02,0x6e,0x327,0xe602,0x6e,0x30c,0xe602,0x6f,0x306,0xe602,0x6f,0x30b,0xe602,0x72,
+0x301,0xca02,0x72,0x327,0xe602,0x72,0x30c,0xe602,0x73,0x302,0xca02,0x73,0x327,0xca02,0x74,0x327,
+0xe602,0x74,0x30c,0xe602,0x75,0x306,0xe602,0x75,0x30a,0xe602,0x75,0x30b,0xca02,0x75,0x328,0xe602,
+0x77,0x302,0xe602,0x79,0x302,0xe602,0x7a,0x301,0xe602,0x7a,0x307,0xe602,0x7a,0x30c,0xe602,0x61,
+0x30c,0xe602,0x69,0x30c,0xe602,0x6f,0x30c,0xe602,0x75,0x30c,0xfc,0xe643,0x75,0x308,0x304,0xfc,
+0xe643,0x75,0x308,0x301,0xfc,0xe643,0x75,0x308,0x30c,0xfc,0xe643,0x75,0x308,0x300,0xe4,0xe643,
+0x61,0x308,0x304,0x227,0xe643,0x61,0x307,0x304,0xe602,0xe6,0x304,0xe602,0x67,0x30c,0xe602,0x6b,
+0x30c,0x1eb,0xe643,0x6f,0x328,0x304,0xe602,0x292,0x30c,0xe602,0x6a,0x30c,0xe602,0x67,0x301,0xe602,
+0x6e,0x300,0xe5,0xe643,0x61,0x30a,0x301,0xe602,0xe6,0x301,0xe602,0xf8,0x301,0xe602,0x61,0x30f,
+0xe602,0x61,0x311,0xe602,0x65,0x30f,0xe602,0x65,0x311,0xe602,0x69,0x30f,0xe602,0x69,0x311,0xe602,
+0x6f,0x30f,0xe602,0x6f,0x311,0xe602,0x72,0x30f,0xe602,0x72,0x311,0xe602,0x75,0x30f,0xe602,0x75,
+0x311,0xdc02,0x73,0x326,0xdc02,0x74,0x326,0xe602,0x68,0x30c,0xf6,0xe643,0x6f,0x308,0x304,0xf5,
+0xe643,0x6f,0x303,0x304,0x22f,0xe643,0x6f,0x307,0x304,0xe602,0x79,0x304,0x3ca,0xe643,0x3b9,0x308,
+0x301,0xe602,0x3b1,0x301,0xe602,0x3b5,0x301,0xe602,0x3b7,0x301,0xe602,0x3b9,0x301,0x3cb,0xe643,0x3c5,
+0x308,0x301,0xe602,0x3bf,0x301,0xe602,0x3c5,0x301,0xe602,0x3c9,0x301,0xe602,0x438,0x306,0xe602,0x435,
+0x300,0xe602,0x435,0x308,0xe602,0x433,0x301,0xe602,0x456,0x308,0xe602,0x43a,0x301,0xe602,0x438,0x300,
+0xe602,0x443,0x306,0xe602,0x475,0x30f,0xe602,0x436,0x306,0xe602,0x430,0x306,0xe602,0x430,0x308,0xe602,
+0x435,0x306,0xe602,0x4d9,0x308,0xe602,0x436,0x308,0xe602,0x437,0x308,0xe602,0x438,0x304,0xe602,0x438,
+0x308,0xe602,0x43e,0x308,0xe602,0x4e9,0x308,0xe602,0x44d,0x308,0xe602,0x443,0x304,0xe602,0x443,0x308,
+0xe602,0x443,0x30b,0xe602,0x447,0x308,0xe602,0x44b,0x308,0xe602,0x627,0x653,0xe602,0x627,0x654,0xe602,
+0x648,0x654,0xdc02,0x627,0x655,0xe602,0x64a,0x654,0xe602,0x6d5,0x654,0xe602,0x6c1,0x654,0xe602,0x6d2,
+0x654,0x702,0x928,0x93c,0x702,0x930,0x93c,0x702,0x933,0x93c,2,0x9c7,0x9be,2,0x9c7,0x9d7,
+2,0xb47,0xb56,2,0xb47,0xb3e,2,0xb47,0xb57,2,0xb92,0xbd7,2,0xbc6,0xbbe,2,
+0xbc7,0xbbe,2,0xbc6,0xbd7,0x5b02,0xc46,0xc56,2,0xcbf,0xcd5,2,0xcc6,0xcd5,2,0xcc6,
+0xcd6,0xcca,0x43,0xcc6,0xcc2,0xcd5,2,0xd46,0xd3e,2,0xd47,0xd3e,2,0xd46,0xd57,0x902,
+0xdd9,0xdca,0xddc,0x943,0xdd9,0xdcf,0xdca,2,0xdd9,0xddf,2,0x1025,0x102e,2,0x1b05,0x1b35,
+2,0x1b07,0x1b35,2,0x1b09,0x1b35,2,0x1b0b,0x1b35,2,0x1b0d,0x1b35,2,0x1b11,0x1b35,2,
+0x1b3a,0x1b35,2,0x1b3c,0x1b35,2,0x1b3e,0x1b35,2,0x1b3f,0x1b35,2,0x1b42,0x1b35,0xdc02,0x61,
+0x325,0xe602,0x62,0x307,0xdc02,0x62,0x323,0xdc02,0x62,0x331,0xe7,0xe643,0x63,0x327,0x301,0xe602,
+0x64,0x307,0xdc02,0x64,0x323,0xdc02,0x64,0x331,0xca02,0x64,0x327,0xdc02,0x64,0x32d,0x113,0xe643,
+0x65,0x304,0x300,0x113,0xe643,0x65,0x304,0x301,0xdc02,0x65,0x32d,0xdc02,0x65,0x330,0x229,0xe643,
+0x65,0x327,0x306,0xe602,0x66,0x307,0xe602,0x67,0x304,0xe602,0x68,0x307,0xdc02,0x68,0x323,0xe602,
+0x68,0x308,0xca02,0x68,0x327,0xdc02,0x68,0x32e,0xdc02,0x69,0x330,0xef,0xe643,0x69,0x308,0x301,
+0xe602,0x6b,0x301,0xdc02,0x6b,0x323,0xdc02,0x6b,0x331,0x1e37,0xe643,0x6c,0x323,0x304,0xdc02,0x6c,
+0x331,0xdc02,0x6c,0x32d,0xe602,0x6d,0x301,0xe602,0x6d,0x307,0xdc02,0x6d,0x323,0xe602,0x6e,0x307,
+0xdc02,0x6e,0x323,0xdc02,0x6e,0x331,0xdc02,0x6e,0x32d,0xf5,0xe643,0x6f,0x303,0x301,0xf5,0xe643,
+0x6f,0x303,0x308,0x14d,0xe643,0x6f,0x304,0x300,0x14d,0xe643,0x6f,0x304,0x301,0xe602,0x70,0x301,
+0xe602,0x70,0x307,0xe602,0x72,0x307,0x1e5b,0xe643,0x72,0x323,0x304,0xdc02,0x72,0x331,0xe602,0x73,
+0x307,0x15b,0xe643,0x73,0x301,0x307,0x161,0xe643,0x73,0x30c,0x307,0x1e63,0xe643,0x73,0x323,0x307,
+0xe602,0x74,0x307,0xdc02,0x74,0x323,0xdc02,0x74,0x331,0xdc02,0x74,0x32d,0xdc02,0x75,0x324,0xdc02,
+0x75,0x330,0xdc02,0x75,0x32d,0x169,0xe643,0x75,0x303,0x301,0x16b,0xe643,0x75,0x304,0x308,0xe602,
+0x76,0x303,0xdc02,0x76,0x323,0xe602,0x77,0x300,0xe602,0x77,0x301,0xe602,0x77,0x308,0xe602,0x77,
+0x307,0xdc02,0x77,0x323,0xe602,0x78,0x307,0xe602,0x78,0x308,0xe602,0x79,0x307,0xe602,0x7a,0x302,
+0xdc02,0x7a,0x323,0xdc02,0x7a,0x331,0xdc02,0x68,0x331,0xe602,0x74,0x308,0xe602,0x77,0x30a,0xe602,
+0x79,0x30a,0xe602,0x61,0x309,0xe2,0xe643,0x61,0x302,0x301,0xe2,0xe643,0x61,0x302,0x300,0xe2,
+0xe643,0x61,0x302,0x309,0xe2,0xe643,0x61,0x302,0x303,0x1ea1,0xe643,0x61,0x323,0x302,0x103,0xe643,
+0x61,0x306,0x301,0x103,0xe643,0x61,0x306,0x300,0x103,0xe643,0x61,0x306,0x309,0x103,0xe643,0x61,
+0x306,0x303,0x1ea1,0xe643,0x61,0x323,0x306,0xe602,0x65,0x309,0xe602,0x65,0x303,0xea,0xe643,0x65,
+0x302,0x301,0xea,0xe643,0x65,0x302,0x300,0xea,0xe643,0x65,0x302,0x309,0xea,0xe643,0x65,0x302,
+0x303,0x1eb9,0xe643,0x65,0x323,0x302,0xe602,0x69,0x309,0xdc02,0x69,0x323,0xe602,0x6f,0x309,0xf4,
+0xe643,0x6f,0x302,0x301,0xf4,0xe643,0x6f,0x302,0x300,0xf4,0xe643,0x6f,0x302,0x309,0xf4,0xe643,
+0x6f,0x302,0x303,0x1ecd,0xe643,0x6f,0x323,0x302,0x1a1,0xe643,0x6f,0x31b,0x301,0x1a1,0xe643,0x6f,
+0x31b,0x300,0x1a1,0xe643,0x6f,0x31b,0x309,0x1a1,0xe643,0x6f,0x31b,0x303,0x1a1,0xdc43,0x6f,0x31b,
+0x323,0xdc02,0x75,0x323,0xe602,0x75,0x309,0x1b0,0xe643,0x75,0x31b,0x301,0x1b0,0xe643,0x75,0x31b,
+0x300,0x1b0,0xe643,0x75,0x31b,0x309,0x1b0,0xe643,0x75,0x31b,0x303,0x1b0,0xdc43,0x75,0x31b,0x323,
+0xe602,0x79,0x300,0xdc02,0x79,0x323,0xe602,0x79,0x309,0xe602,0x79,0x303,0x1f00,0xe643,0x3b1,0x313,
+0x300,0x1f01,0xe643,0x3b1,0x314,0x300,0x1f00,0xe643,0x3b1,0x313,0x301,0x1f01,0xe643,0x3b1,0x314,0x301,
+0x1f00,0xe643,0x3b1,0x313,0x342,0x1f01,0xe643,0x3b1,0x314,0x342,0x1f10,0xe643,0x3b5,0x313,0x300,0x1f11,
+0xe643,0x3b5,0x314,0x300,0x1f10,0xe643,0x3b5,0x313,0x301,0x1f11,0xe643,0x3b5,0x314,0x301,0x1f20,0xe643,
+0x3b7,0x313,0x300,0x1f21,0xe643,0x3b7,0x314,0x300,0x1f20,0xe643,0x3b7,0x313,0x301,0x1f21,0xe643,0x3b7,
+0x314,0x301,0x1f20,0xe643,0x3b7,0x313,0x342,0x1f21,0xe643,0x3b7,0x314,0x342,0x1f30,0xe643,0x3b9,0x313,
+0x300,0x1f31,0xe643,0x3b9,0x314,0x300,0x1f30,0xe643,0x3b9,0x313,0x301,0x1f31,0xe643,0x3b9,0x314,0x301,
+0x1f30,0xe643,0x3b9,0x313,0x342,0x1f31,0xe643,0x3b9,0x314,0x342,0x1f40,0xe643,0x3bf,0x313,0x300,0x1f41,
+0xe643,0x3bf,0x314,0x300,0x1f40,0xe643,0x3bf,0x313,0x301,0x1f41,0xe643,0x3bf,0x314,0x301,0x1f50,0xe643,
+0x3c5,0x313,0x300,0x1f51,0xe643,0x3c5,0x314,0x300,0x1f50,0xe643,0x3c5,0x313,0x301,0x1f51,0xe643,0x3c5,
+0x314,0x301,0x1f50,0xe643,0x3c5,0x313,0x342,0x1f51,0xe643,0x3c5,0x314,0x342,0x1f60,0xe643,0x3c9,0x313,
+0x300,0x1f61,0xe643,0x3c9,0x314,0x300,0x1f60,0xe643,0x3c9,0x313,0x301,0x1f61,0xe643,0x3c9,0x314,0x301,
+0x1f60,0xe643,0x3c9,0x313,0x342,0x1f61,0xe643,0x3c9,0x314,0x342,0xe602,0x3b1,0x300,0xe602,0x3b5,0x300,
+0xe602,0x3b7,0x300,0xe602,0x3b9,0x300,0xe602,0x3bf,0x300,0xe602,0x3c5,0x300,0xe602,0x3c9,0x300,0xe602,
+0x3b1,0x306,0xe602,0x3b1,0x304,0xe602,0x3b1,0x342,0xe602,0x3b7,0x342,0xe602,0x3b9,0x306,0xe602,0x3b9,
+0x304,0x3ca,0xe643,0x3b9,0x308,0x300,0xe602,0x3b9,0x342,0x3ca,0xe643,0x3b9,0x308,0x342,0xe602,0x3c5,
+0x306,0xe602,0x3c5,0x304,0x3cb,0xe643,0x3c5,0x308,0x300,0xe602,0x3c1,0x313,0xe602,0x3c1,0x314,0xe602,
+0x3c5,0x342,0x3cb,0xe643,0x3c5,0x308,0x342,0xe602,0x3c9,0x342,0x102,0x2190,0x338,0x102,0x2192,0x338,
+0x102,0x2194,0x338,0x102,0x21d0,0x338,0x102,0x21d4,0x338,0x102,0x21d2,0x338,0x102,0x2203,0x338,0x102,
+0x2208,0x338,0x102,0x220b,0x338,0x102,0x2223,0x338,0x102,0x2225,0x338,0x102,0x223c,0x338,0x102,0x2243,
+0x338,0x102,0x2245,0x338,0x102,0x2248,0x338,0x102,0x3d,0x338,0x102,0x2261,0x338,0x102,0x224d,0x338,
+0x102,0x3c,0x338,0x102,0x3e,0x338,0x102,0x2264,0x338,0x102,0x2265,0x338,0x102,0x2272,0x338,0x102,
+0x2273,0x338,0x102,0x2276,0x338,0x102,0x2277,0x338,0x102,0x227a,0x338,0x102,0x227b,0x338,0x102,0x2282,
+0x338,0x102,0x2283,0x338,0x102,0x2286,0x338,0x102,0x2287,0x338,0x102,0x22a2,0x338,0x102,0x22a8,0x338,
+0x102,0x22a9,0x338,0x102,0x22ab,0x338,0x102,0x227c,0x338,0x102,0x227d,0x338,0x102,0x2291,0x338,0x102,
+0x2292,0x338,0x102,0x22b2,0x338,0x102,0x22b3,0x338,0x102,0x22b4,0x338,0x102,0x22b5,0x338,0x802,0x304b,
+0x3099,0x802,0x304d,0x3099,0x802,0x304f,0x3099,0x802,0x3051,0x3099,0x802,0x3053,0x3099,0x802,0x3055,0x3099,
+0x802,0x3057,0x3099,0x802,0x3059,0x3099,0x802,0x305b,0x3099,0x802,0x305d,0x3099,0x802,0x305f,0x3099,0x802,
+0x3061,0x3099,0x802,0x3064,0x3099,0x802,0x3066,0x3099,0x802,0x3068,0x3099,0x802,0x306f,0x3099,0x802,0x306f,
+0x309a,0x802,0x3072,0x3099,0x802,0x3072,0x309a,0x802,0x3075,0x3099,0x802,0x3075,0x309a,0x802,0x3078,0x3099,
+0x802,0x3078,0x309a,0x802,0x307b,0x3099,0x802,0x307b,0x309a,0x802,0x3046,0x3099,0x802,0x309d,0x3099,0x802,
+0x30ab,0x3099,0x802,0x30ad,0x3099,0x802,0x30af,0x3099,0x802,0x30b1,0x3099,0x802,0x30b3,0x3099,0x802,0x30b5,
+0x3099,0x802,0x30b7,0x3099,0x802,0x30b9,0x3099,0x802,0x30bb,0x3099,0x802,0x30bd,0x3099,0x802,0x30bf,0x3099,
+0x802,0x30c1,0x3099,0x802,0x30c4,0x3099,0x802,0x30c6,0x3099,0x802,0x30c8,0x3099,0x802,0x30cf,0x3099,0x802,
+0x30cf,0x309a,0x802,0x30d2,0x3099,0x802,0x30d2,0x309a,0x802,0x30d5,0x3099,0x802,0x30d5,0x309a,0x802,0x30d8,
+0x3099,0x802,0x30d8,0x309a,0x802,0x30db,0x3099,0x802,0x30db,0x309a,0x802,0x30a6,0x3099,0x802,0x30ef,0x3099,
+0x802,0x30f0,0x3099,0x802,0x30f1,0x3099,0x802,0x30f2,0x3099,0x802,0x30fd,0x3099,0x704,0xd804,0xdc99,0xd804,
+0xdcba,0x704,0xd804,0xdc9b,0xd804,0xdcba,0x704,0xd804,0xdca5,0xd804,0xdcba,4,0xd804,0xdd31,0xd804,0xdd27,
+4,0xd804,0xdd32,0xd804,0xdd27,4,0xd804,0xdf47,0xd804,0xdf3e,4,0xd804,0xdf47,0xd804,0xdf57,4,
+0xd805,0xdcb9,0xd805,0xdcba,4,0xd805,0xdcb9,0xd805,0xdcb0,4,0xd805,0xdcb9,0xd805,0xdcbd,4,0xd805,
+0xddb8,0xd805,0xddaf,4,0xd805,0xddb9,0xd805,0xddaf,1,0x20,0xe602,0x20,0x308,1,0x61,0xe602,
+0x20,0x304,1,0x32,1,0x33,0xe602,0x20,0x301,1,0x3bc,0xca02,0x20,0x327,1,0x31,
+1,0x6f,3,0x31,0x2044,0x34,3,0x31,0x2044,0x32,3,0x33,0x2044,0x34,2,0x73,
+0x73,0xe602,0x69,0x307,2,0x69,0x6a,2,0x6c,0xb7,2,0x2bc,0x6e,1,0x73,1,
+0x253,1,0x254,1,0x256,1,0x257,1,0x1dd,1,0x259,1,0x25b,1,0x260,1,
+0x263,1,0x269,1,0x268,1,0x26f,1,0x272,1,0x275,1,0x280,1,0x283,1,
+0x288,1,0x28a,1,0x28b,1,0x292,2,0x6c,0x6a,2,0x6e,0x6a,2,0x64,0x7a,
+1,0x195,1,0x19e,1,0x2c65,1,0x19a,1,0x2c66,1,0x180,1,0x289,1,0x28c,
+1,0x68,1,0x266,1,0x6a,1,0x72,1,0x77,1,0x79,0xe602,0x20,0x306,0xe602,
+0x20,0x307,0xe602,0x20,0x30a,0xca02,0x20,0x328,0xe602,0x20,0x303,0xe602,0x20,0x30b,1,0x6c,
+1,0x78,1,0x295,0xf0,0x81,0x3b9,1,0x2b9,2,0x20,0x3b9,1,0x3b,1,0x3f3,
+0xe603,0x20,0x308,0x301,1,0xb7,1,0x37b,1,0x37c,1,0x37d,1,0x452,1,0x454,
+1,0x455,1,0x456,1,0x458,1,0x459,1,0x45a,1,0x45b,1,0x45f,2,0x565,
+0x582,2,0x627,0x674,2,0x648,0x674,2,0x6c7,0x674,2,0x64a,0x674,0x702,0x915,0x93c,
+0x702,0x916,0x93c,0x702,0x917,0x93c,0x702,0x91c,0x93c,0x702,0x921,0x93c,0x702,0x922,0x93c,0x702,
+0x92b,0x93c,0x702,0x92f,0x93c,0x702,0x9a1,0x9bc,0x702,0x9a2,0x9bc,0x702,0x9af,0x9bc,0x702,0xa32,
+0xa3c,0x702,0xa38,0xa3c,0x702,0xa16,0xa3c,0x702,0xa17,0xa3c,0x702,0xa1c,0xa3c,0x702,0xa2b,0xa3c,
+0x702,0xb21,0xb3c,0x702,0xb22,0xb3c,2,0xe4d,0xe32,2,0xecd,0xeb2,2,0xeab,0xe99,2,
+0xeab,0xea1,2,0xf42,0xfb7,2,0xf4c,0xfb7,2,0xf51,0xfb7,2,0xf56,0xfb7,2,0xf5b,
+0xfb7,2,0xf40,0xfb5,0x8202,0xfb2,0xf80,0x8203,0xfb2,0xf71,0xf80,0x8202,0xfb3,0xf80,0x8203,0xfb3,
+0xf71,0xf80,2,0xf92,0xfb7,2,0xf9c,0xfb7,2,0xfa1,0xfb7,2,0xfa6,0xfb7,2,0xfab,
+0xfb7,2,0xf90,0xfb5,1,0x2d00,1,0x2d01,1,0x2d02,1,0x2d03,1,0x2d04,1,0x2d05,
+1,0x2d06,1,0x2d07,1,0x2d08,1,0x2d09,1,0x2d0a,1,0x2d0b,1,0x2d0c,1,0x2d0d,
+1,0x2d0e,1,0x2d0f,1,0x2d10,1,0x2d11,1,0x2d12,1,0x2d13,1,0x2d14,1,0x2d15,
+1,0x2d16,1,0x2d17,1,0x2d18,1,0x2d19,1,0x2d1a,1,0x2d1b,1,0x2d1c,1,0x2d1d,
+1,0x2d1e,1,0x2d1f,1,0x2d20,1,0x2d21,1,0x2d22,1,0x2d23,1,0x2d24,1,0x2d25,
+1,0x2d27,1,0x2d2d,1,0x432,1,0x434,1,0x43e,1,0x441,1,0x442,1,0x44a,
+1,0x463,1,0xa64b,1,0x10d0,1,0x10d1,1,0x10d2,1,0x10d3,1,0x10d4,1,0x10d5,
+1,0x10d6,1,0x10d7,1,0x10d8,1,0x10d9,1,0x10da,1,0x10db,1,0x10dc,1,0x10dd,
+1,0x10de,1,0x10df,1,0x10e0,1,0x10e1,1,0x10e2,1,0x10e3,1,0x10e4,1,0x10e5,
+1,0x10e6,1,0x10e7,1,0x10e8,1,0x10e9,1,0x10ea,1,0x10eb,1,0x10ec,1,0x10ed,
+1,0x10ee,1,0x10ef,1,0x10f0,1,0x10f1,1,0x10f2,1,0x10f3,1,0x10f4,1,0x10f5,
+1,0x10f6,1,0x10f7,1,0x10f8,1,0x10f9,1,0x10fa,1,0x10fd,1,0x10fe,1,0x10ff,
+1,0xe6,1,0x62,1,0x64,1,0x65,1,0x67,1,0x69,1,0x6b,1,0x6d,
+1,0x6e,1,0x223,1,0x70,1,0x74,1,0x75,1,0x250,1,0x251,1,0x1d02,
+1,0x25c,1,0x14b,1,0x76,1,0x3b2,1,0x3b3,1,0x3b4,1,0x3c6,1,0x3c7,
+1,0x3c1,1,0x43d,1,0x252,1,0x63,1,0x255,1,0xf0,1,0x66,1,0x25f,
+1,0x261,1,0x265,1,0x26a,1,0x29d,1,0x26d,1,0x29f,1,0x271,1,0x270,
+1,0x273,1,0x274,1,0x278,1,0x282,1,0x1ab,1,0x1d1c,1,0x7a,1,0x290,
+1,0x291,1,0x3b8,2,0x61,0x2be,2,0x3b1,0x3b9,0xe602,0x20,0x313,1,0x3b9,0xe602,
+0x20,0x342,0xe603,0x20,0x308,0x342,2,0x3b7,0x3b9,0xe603,0x20,0x313,0x300,0xe603,0x20,0x313,
+0x301,0xe603,0x20,0x313,0x342,0xe603,0x20,0x314,0x300,0xe603,0x20,0x314,0x301,0xe603,0x20,0x314,
+0x342,0xe603,0x20,0x308,0x300,1,0x60,2,0x3c9,0x3b9,0xe602,0x20,0x314,0xdc02,0x20,0x333,
+1,0x2e,2,0x2e,0x2e,3,0x2e,0x2e,0x2e,2,0x2032,0x2032,3,0x2032,0x2032,0x2032,
+2,0x2035,0x2035,3,0x2035,0x2035,0x2035,2,0x21,0x21,0xe602,0x20,0x305,2,0x3f,0x3f,
+2,0x3f,0x21,2,0x21,0x3f,4,0x2032,0x2032,0x2032,0x2032,1,0x30,1,0x34,1,
+0x35,1,0x36,1,0x37,1,0x38,1,0x39,1,0x2b,1,0x2212,1,0x3d,1,
+0x28,1,0x29,2,0x72,0x73,3,0x61,0x2f,0x63,3,0x61,0x2f,0x73,2,0xb0,
+0x63,3,0x63,0x2f,0x6f,3,0x63,0x2f,0x75,2,0xb0,0x66,1,0x127,2,0x6e,
+0x6f,1,0x71,2,0x73,0x6d,3,0x74,0x65,0x6c,2,0x74,0x6d,1,0x3c9,1,
+0x5d0,1,0x5d1,1,0x5d2,1,0x5d3,3,0x66,0x61,0x78,1,0x3c0,1,0x2211,3,
+0x31,0x2044,0x37,3,0x31,0x2044,0x39,4,0x31,0x2044,0x31,0x30,3,0x31,0x2044,0x33,
+3,0x32,0x2044,0x33,3,0x31,0x2044,0x35,3,0x32,0x2044,0x35,3,0x33,0x2044,0x35,
+3,0x34,0x2044,0x35,3,0x31,0x2044,0x36,3,0x35,0x2044,0x36,3,0x31,0x2044,0x38,
+3,0x33,0x2044,0x38,3,0x35,0x2044,0x38,3,0x37,0x2044,0x38,2,0x31,0x2044,2,
+0x69,0x69,3,0x69,0x69,0x69,2,0x69,0x76,2,0x76,0x69,3,0x76,0x69,0x69,
+4,0x76,0x69,0x69,0x69,2,0x69,0x78,2,0x78,0x69,3,0x78,0x69,0x69,3,
+0x30,0x2044,0x33,2,0x222b,0x222b,3,0x222b,0x222b,0x222b,2,0x222e,0x222e,3,0x222e,0x222e,
+0x222e,1,0x3008,1,0x3009,2,0x31,0x30,2,0x31,0x31,2,0x31,0x32,2,0x31,
+0x33,2,0x31,0x34,2,0x31,0x35,2,0x31,0x36,2,0x31,0x37,2,0x31,0x38,
+2,0x31,0x39,2,0x32,0x30,3,0x28,0x31,0x29,3,0x28,0x32,0x29,3,0x28,
+0x33,0x29,3,0x28,0x34,0x29,3,0x28,0x35,0x29,3,0x28,0x36,0x29,3,0x28,
+0x37,0x29,3,0x28,0x38,0x29,3,0x28,0x39,0x29,4,0x28,0x31,0x30,0x29,4,
+0x28,0x31,0x31,0x29,4,0x28,0x31,0x32,0x29,4,0x28,0x31,0x33,0x29,4,0x28,
+0x31,0x34,0x29,4,0x28,0x31,0x35,0x29,4,0x28,0x31,0x36,0x29,4,0x28,0x31,
+0x37,0x29,4,0x28,0x31,0x38,0x29,4,0x28,0x31,0x39,0x29,4,0x28,0x32,0x30,
+0x29,2,0x31,0x2e,2,0x32,0x2e,2,0x33,0x2e,2,0x34,0x2e,2,0x35,0x2e,
+2,0x36,0x2e,2,0x37,0x2e,2,0x38,0x2e,2,0x39,0x2e,3,0x31,0x30,0x2e,
+3,0x31,0x31,0x2e,3,0x31,0x32,0x2e,3,0x31,0x33,0x2e,3,0x31,0x34,0x2e,
+3,0x31,0x35,0x2e,3,0x31,0x36,0x2e,3,0x31,0x37,0x2e,3,0x31,0x38,0x2e,
+3,0x31,0x39,0x2e,3,0x32,0x30,0x2e,3,0x28,0x61,0x29,3,0x28,0x62,0x29,
+3,0x28,0x63,0x29,3,0x28,0x64,0x29,3,0x28,0x65,0x29,3,0x28,0x66,0x29,
+3,0x28,0x67,0x29,3,0x28,0x68,0x29,3,0x28,0x69,0x29,3,0x28,0x6a,0x29,
+3,0x28,0x6b,0x29,3,0x28,0x6c,0x29,3,0x28,0x6d,0x29,3,0x28,0x6e,0x29,
+3,0x28,0x6f,0x29,3,0x28,0x70,0x29,3,0x28,0x71,0x29,3,0x28,0x72,0x29,
+3,0x28,0x73,0x29,3,0x28,0x74,0x29,3,0x28,0x75,0x29,3,0x28,0x76,0x29,
+3,0x28,0x77,0x29,3,0x28,0x78,0x29,3,0x28,0x79,0x29,3,0x28,0x7a,0x29,
+4,0x222b,0x222b,0x222b,0x222b,3,0x3a,0x3a,0x3d,2,0x3d,0x3d,3,0x3d,0x3d,0x3d,
+0x102,0x2add,0x338,1,0x26b,1,0x1d7d,1,0x27d,1,0x23f,1,0x240,1,0x6bcd,1,
+0x9f9f,1,0x4e00,1,0x4e28,1,0x4e36,1,0x4e3f,1,0x4e59,1,0x4e85,1,0x4e8c,1,
+0x4ea0,1,0x4eba,1,0x513f,1,0x5165,1,0x516b,1,0x5182,1,0x5196,1,0x51ab,1,
+0x51e0,1,0x51f5,1,0x5200,1,0x529b,1,0x52f9,1,0x5315,1,0x531a,1,0x5338,1,
+0x5341,1,0x535c,1,0x5369,1,0x5382,1,0x53b6,1,0x53c8,1,0x53e3,1,0x56d7,1,
+0x571f,1,0x58eb,1,0x5902,1,0x590a,1,0x5915,1,0x5927,1,0x5973,1,0x5b50,1,
+0x5b80,1,0x5bf8,1,0x5c0f,1,0x5c22,1,0x5c38,1,0x5c6e,1,0x5c71,1,0x5ddb,1,
+0x5de5,1,0x5df1,1,0x5dfe,1,0x5e72,1,0x5e7a,1,0x5e7f,1,0x5ef4,1,0x5efe,1,
+0x5f0b,1,0x5f13,1,0x5f50,1,0x5f61,1,0x5f73,1,0x5fc3,1,0x6208,1,0x6236,1,
+0x624b,1,0x652f,1,0x6534,1,0x6587,1,0x6597,1,0x65a4,1,0x65b9,1,0x65e0,1,
+0x65e5,1,0x66f0,1,0x6708,1,0x6728,1,0x6b20,1,0x6b62,1,0x6b79,1,0x6bb3,1,
+0x6bcb,1,0x6bd4,1,0x6bdb,1,0x6c0f,1,0x6c14,1,0x6c34,1,0x706b,1,0x722a,1,
+0x7236,1,0x723b,1,0x723f,1,0x7247,1,0x7259,1,0x725b,1,0x72ac,1,0x7384,1,
+0x7389,1,0x74dc,1,0x74e6,1,0x7518,1,0x751f,1,0x7528,1,0x7530,1,0x758b,1,
+0x7592,1,0x7676,1,0x767d,1,0x76ae,1,0x76bf,1,0x76ee,1,0x77db,1,0x77e2,1,
+0x77f3,1,0x793a,1,0x79b8,1,0x79be,1,0x7a74,1,0x7acb,1,0x7af9,1,0x7c73,1,
+0x7cf8,1,0x7f36,1,0x7f51,1,0x7f8a,1,0x7fbd,1,0x8001,1,0x800c,1,0x8012,1,
+0x8033,1,0x807f,1,0x8089,1,0x81e3,1,0x81ea,1,0x81f3,1,0x81fc,1,0x820c,1,
+0x821b,1,0x821f,1,0x826e,1,0x8272,1,0x8278,1,0x864d,1,0x866b,1,0x8840,1,
+0x884c,1,0x8863,1,0x897e,1,0x898b,1,0x89d2,1,0x8a00,1,0x8c37,1,0x8c46,1,
+0x8c55,1,0x8c78,1,0x8c9d,1,0x8d64,1,0x8d70,1,0x8db3,1,0x8eab,1,0x8eca,1,
+0x8f9b,1,0x8fb0,1,0x8fb5,1,0x9091,1,0x9149,1,0x91c6,1,0x91cc,1,0x91d1,1,
+0x9577,1,0x9580,1,0x961c,1,0x96b6,1,0x96b9,1,0x96e8,1,0x9751,1,0x975e,1,
+0x9762,1,0x9769,1,0x97cb,1,0x97ed,1,0x97f3,1,0x9801,1,0x98a8,1,0x98db,1,
+0x98df,1,0x9996,1,0x9999,1,0x99ac,1,0x9aa8,1,0x9ad8,1,0x9adf,1,0x9b25,1,
+0x9b2f,1,0x9b32,1,0x9b3c,1,0x9b5a,1,0x9ce5,1,0x9e75,1,0x9e7f,1,0x9ea5,1,
+0x9ebb,1,0x9ec3,1,0x9ecd,1,0x9ed1,1,0x9ef9,1,0x9efd,1,0x9f0e,1,0x9f13,1,
+0x9f20,1,0x9f3b,1,0x9f4a,1,0x9f52,1,0x9f8d,1,0x9f9c,1,0x9fa0,1,0x5344,1,
+0x5345,0x802,0x20,0x3099,0x802,0x20,0x309a,2,0x3088,0x308a,2,0x30b3,0x30c8,1,0x1100,1,
+0x1101,1,0x1102,1,0x1103,1,0x1104,1,0x1105,1,0x111a,1,0x1106,1,0x1107,1,
+0x1108,1,0x1121,1,0x1109,1,0x110a,1,0x110b,1,0x110c,1,0x110d,1,0x110e,1,
+0x110f,1,0x1110,1,0x1111,1,0x1112,1,0x1114,1,0x1115,1,0x11c7,1,0x11c8,1,
+0x11cc,1,0x11ce,1,0x11d3,1,0x11d7,1,0x11d9,1,0x111c,1,0x11dd,1,0x11df,1,
+0x111d,1,0x111e,1,0x1120,1,0x1122,1,0x1123,1,0x1127,1,0x1129,1,0x112b,1,
+0x112c,1,0x112d,1,0x112e,1,0x112f,1,0x1132,1,0x1136,1,0x1140,1,0x1147,1,
+0x114c,1,0x11f1,1,0x11f2,1,0x1157,1,0x1158,1,0x1159,1,0x1184,1,0x1185,1,
+0x1188,1,0x1191,1,0x1192,1,0x1194,1,0x119e,1,0x11a1,1,0x4e09,1,0x56db,1,
+0x4e0a,1,0x4e2d,1,0x4e0b,1,0x7532,1,0x4e19,1,0x4e01,1,0x5929,1,0x5730,3,
+0x28,0x1100,0x29,3,0x28,0x1102,0x29,3,0x28,0x1103,0x29,3,0x28,0x1105,0x29,3,
+0x28,0x1106,0x29,3,0x28,0x1107,0x29,3,0x28,0x1109,0x29,3,0x28,0x110b,0x29,3,
+0x28,0x110c,0x29,3,0x28,0x110e,0x29,3,0x28,0x110f,0x29,3,0x28,0x1110,0x29,3,
+0x28,0x1111,0x29,3,0x28,0x1112,0x29,3,0x28,0x4e00,0x29,3,0x28,0x4e8c,0x29,3,
+0x28,0x4e09,0x29,3,0x28,0x56db,0x29,3,0x28,0x4e94,0x29,3,0x28,0x516d,0x29,3,
+0x28,0x4e03,0x29,3,0x28,0x516b,0x29,3,0x28,0x4e5d,0x29,3,0x28,0x5341,0x29,3,
+0x28,0x6708,0x29,3,0x28,0x706b,0x29,3,0x28,0x6c34,0x29,3,0x28,0x6728,0x29,3,
+0x28,0x91d1,0x29,3,0x28,0x571f,0x29,3,0x28,0x65e5,0x29,3,0x28,0x682a,0x29,3,
+0x28,0x6709,0x29,3,0x28,0x793e,0x29,3,0x28,0x540d,0x29,3,0x28,0x7279,0x29,3,
+0x28,0x8ca1,0x29,3,0x28,0x795d,0x29,3,0x28,0x52b4,0x29,3,0x28,0x4ee3,0x29,3,
+0x28,0x547c,0x29,3,0x28,0x5b66,0x29,3,0x28,0x76e3,0x29,3,0x28,0x4f01,0x29,3,
+0x28,0x8cc7,0x29,3,0x28,0x5354,0x29,3,0x28,0x796d,0x29,3,0x28,0x4f11,0x29,3,
+0x28,0x81ea,0x29,3,0x28,0x81f3,0x29,1,0x554f,1,0x5e7c,1,0x7b8f,3,0x70,0x74,
+0x65,2,0x32,0x31,2,0x32,0x32,2,0x32,0x33,2,0x32,0x34,2,0x32,0x35,
+2,0x32,0x36,2,0x32,0x37,2,0x32,0x38,2,0x32,0x39,2,0x33,0x30,2,
+0x33,0x31,2,0x33,0x32,2,0x33,0x33,2,0x33,0x34,2,0x33,0x35,1,0x4e94,
+1,0x516d,1,0x4e03,1,0x4e5d,1,0x682a,1,0x6709,1,0x793e,1,0x540d,1,0x7279,
+1,0x8ca1,1,0x795d,1,0x52b4,1,0x79d8,1,0x7537,1,0x9069,1,0x512a,1,0x5370,
+1,0x6ce8,1,0x9805,1,0x4f11,1,0x5199,1,0x6b63,1,0x5de6,1,0x53f3,1,0x533b,
+1,0x5b97,1,0x5b66,1,0x76e3,1,0x4f01,1,0x8cc7,1,0x5354,1,0x591c,2,0x33,
+0x36,2,0x33,0x37,2,0x33,0x38,2,0x33,0x39,2,0x34,0x30,2,0x34,0x31,
+2,0x34,0x32,2,0x34,0x33,2,0x34,0x34,2,0x34,0x35,2,0x34,0x36,2,
+0x34,0x37,2,0x34,0x38,2,0x34,0x39,2,0x35,0x30,2,0x31,0x6708,2,0x32,
+0x6708,2,0x33,0x6708,2,0x34,0x6708,2,0x35,0x6708,2,0x36,0x6708,2,0x37,0x6708,
+2,0x38,0x6708,2,0x39,0x6708,3,0x31,0x30,0x6708,3,0x31,0x31,0x6708,3,0x31,
+0x32,0x6708,2,0x68,0x67,3,0x65,0x72,0x67,2,0x65,0x76,3,0x6c,0x74,0x64,
+1,0x30a2,1,0x30a4,1,0x30a6,1,0x30a8,1,0x30aa,1,0x30ab,1,0x30ad,1,0x30af,
+1,0x30b1,1,0x30b3,1,0x30b5,1,0x30b7,1,0x30b9,1,0x30bb,1,0x30bd,1,0x30bf,
+1,0x30c1,1,0x30c4,1,0x30c6,1,0x30c8,1,0x30ca,1,0x30cb,1,0x30cc,1,0x30cd,
+1,0x30ce,1,0x30cf,1,0x30d2,1,0x30d5,1,0x30d8,1,0x30db,1,0x30de,1,0x30df,
+1,0x30e0,1,0x30e1,1,0x30e2,1,0x30e4,1,0x30e6,1,0x30e8,1,0x30e9,1,0x30ea,
+1,0x30eb,1,0x30ec,1,0x30ed,1,0x30ef,1,0x30f0,1,0x30f1,1,0x30f2,4,0x30a2,
+0x30eb,0x30d5,0x30a1,3,0x30a2,0x30fc,0x30eb,3,0x30a4,0x30f3,0x30c1,3,0x30a6,0x30a9,0x30f3,4,
+0x30a8,0x30fc,0x30ab,0x30fc,3,0x30aa,0x30f3,0x30b9,3,0x30aa,0x30fc,0x30e0,3,0x30ab,0x30a4,0x30ea,
+4,0x30ab,0x30e9,0x30c3,0x30c8,4,0x30ab,0x30ed,0x30ea,0x30fc,4,0x30ad,0x30e5,0x30ea,0x30fc,2,
+0x30ad,0x30ed,6,0x30ad,0x30ed,0x30e1,0x30fc,0x30c8,0x30eb,5,0x30ad,0x30ed,0x30ef,0x30c3,0x30c8,4,
+0x30af,0x30ed,0x30fc,0x30cd,3,0x30b1,0x30fc,0x30b9,3,0x30b3,0x30eb,0x30ca,4,0x30b5,0x30a4,0x30af,
+0x30eb,5,0x30b5,0x30f3,0x30c1,0x30fc,0x30e0,3,0x30bb,0x30f3,0x30c1,3,0x30bb,0x30f3,0x30c8,2,
+0x30c8,0x30f3,2,0x30ca,0x30ce,3,0x30ce,0x30c3,0x30c8,3,0x30cf,0x30a4,0x30c4,4,0x30d5,0x30a3,
+0x30fc,0x30c8,3,0x30d5,0x30e9,0x30f3,5,0x30d8,0x30af,0x30bf,0x30fc,0x30eb,3,0x30d8,0x30eb,0x30c4,
+2,0x30db,0x30f3,3,0x30db,0x30fc,0x30eb,3,0x30db,0x30fc,0x30f3,4,0x30de,0x30a4,0x30af,0x30ed,
+3,0x30de,0x30a4,0x30eb,3,0x30de,0x30c3,0x30cf,3,0x30de,0x30eb,0x30af,5,0x30de,0x30f3,0x30b7,
+0x30e7,0x30f3,4,0x30df,0x30af,0x30ed,0x30f3,2,0x30df,0x30ea,4,0x30e1,0x30fc,0x30c8,0x30eb,3,
+0x30e4,0x30fc,0x30eb,3,0x30e6,0x30a2,0x30f3,4,0x30ea,0x30c3,0x30c8,0x30eb,2,0x30ea,0x30e9,2,
+0x30ec,0x30e0,3,0x30ef,0x30c3,0x30c8,2,0x30,0x70b9,2,0x31,0x70b9,2,0x32,0x70b9,2,
+0x33,0x70b9,2,0x34,0x70b9,2,0x35,0x70b9,2,0x36,0x70b9,2,0x37,0x70b9,2,0x38,
+0x70b9,2,0x39,0x70b9,3,0x31,0x30,0x70b9,3,0x31,0x31,0x70b9,3,0x31,0x32,0x70b9,
+3,0x31,0x33,0x70b9,3,0x31,0x34,0x70b9,3,0x31,0x35,0x70b9,3,0x31,0x36,0x70b9,
+3,0x31,0x37,0x70b9,3,0x31,0x38,0x70b9,3,0x31,0x39,0x70b9,3,0x32,0x30,0x70b9,
+3,0x32,0x31,0x70b9,3,0x32,0x32,0x70b9,3,0x32,0x33,0x70b9,3,0x32,0x34,0x70b9,
+3,0x68,0x70,0x61,2,0x64,0x61,2,0x61,0x75,3,0x62,0x61,0x72,2,0x6f,
+0x76,2,0x70,0x63,2,0x64,0x6d,3,0x64,0x6d,0x32,3,0x64,0x6d,0x33,2,
+0x69,0x75,2,0x5e73,0x6210,2,0x662d,0x548c,2,0x5927,0x6b63,2,0x660e,0x6cbb,4,0x682a,
+0x5f0f,0x4f1a,0x793e,2,0x70,0x61,2,0x6e,0x61,2,0x3bc,0x61,2,0x6d,0x61,2,
+0x6b,0x61,2,0x6b,0x62,2,0x6d,0x62,2,0x67,0x62,3,0x63,0x61,0x6c,4,
+0x6b,0x63,0x61,0x6c,2,0x70,0x66,2,0x6e,0x66,2,0x3bc,0x66,2,0x3bc,0x67,
+2,0x6d,0x67,2,0x6b,0x67,2,0x68,0x7a,3,0x6b,0x68,0x7a,3,0x6d,0x68,
+0x7a,3,0x67,0x68,0x7a,3,0x74,0x68,0x7a,2,0x3bc,0x6c,2,0x6d,0x6c,2,
+0x64,0x6c,2,0x6b,0x6c,2,0x66,0x6d,2,0x6e,0x6d,2,0x3bc,0x6d,2,0x6d,
+0x6d,2,0x63,0x6d,2,0x6b,0x6d,3,0x6d,0x6d,0x32,3,0x63,0x6d,0x32,2,
+0x6d,0x32,3,0x6b,0x6d,0x32,3,0x6d,0x6d,0x33,3,0x63,0x6d,0x33,2,0x6d,
+0x33,3,0x6b,0x6d,0x33,3,0x6d,0x2215,0x73,4,0x6d,0x2215,0x73,0x32,3,0x6b,
+0x70,0x61,3,0x6d,0x70,0x61,3,0x67,0x70,0x61,3,0x72,0x61,0x64,5,0x72,
+0x61,0x64,0x2215,0x73,6,0x72,0x61,0x64,0x2215,0x73,0x32,2,0x70,0x73,2,0x6e,
+0x73,2,0x3bc,0x73,2,0x6d,0x73,2,0x70,0x76,2,0x6e,0x76,2,0x3bc,0x76,
+2,0x6d,0x76,2,0x6b,0x76,2,0x70,0x77,2,0x6e,0x77,2,0x3bc,0x77,2,
+0x6d,0x77,2,0x6b,0x77,2,0x6b,0x3c9,2,0x6d,0x3c9,4,0x61,0x2e,0x6d,0x2e,
+2,0x62,0x71,2,0x63,0x63,2,0x63,0x64,4,0x63,0x2215,0x6b,0x67,3,0x63,
+0x6f,0x2e,2,0x64,0x62,2,0x67,0x79,2,0x68,0x61,2,0x68,0x70,2,0x69,
+0x6e,2,0x6b,0x6b,2,0x6b,0x74,2,0x6c,0x6d,2,0x6c,0x6e,3,0x6c,0x6f,
+0x67,2,0x6c,0x78,3,0x6d,0x69,0x6c,3,0x6d,0x6f,0x6c,2,0x70,0x68,4,
+0x70,0x2e,0x6d,0x2e,3,0x70,0x70,0x6d,2,0x70,0x72,2,0x73,0x72,2,0x73,
+0x76,2,0x77,0x62,3,0x76,0x2215,0x6d,3,0x61,0x2215,0x6d,2,0x31,0x65e5,2,
+0x32,0x65e5,2,0x33,0x65e5,2,0x34,0x65e5,2,0x35,0x65e5,2,0x36,0x65e5,2,0x37,
+0x65e5,2,0x38,0x65e5,2,0x39,0x65e5,3,0x31,0x30,0x65e5,3,0x31,0x31,0x65e5,3,
+0x31,0x32,0x65e5,3,0x31,0x33,0x65e5,3,0x31,0x34,0x65e5,3,0x31,0x35,0x65e5,3,
+0x31,0x36,0x65e5,3,0x31,0x37,0x65e5,3,0x31,0x38,0x65e5,3,0x31,0x39,0x65e5,3,
+0x32,0x30,0x65e5,3,0x32,0x31,0x65e5,3,0x32,0x32,0x65e5,3,0x32,0x33,0x65e5,3,
+0x32,0x34,0x65e5,3,0x32,0x35,0x65e5,3,0x32,0x36,0x65e5,3,0x32,0x37,0x65e5,3,
+0x32,0x38,0x65e5,3,0x32,0x39,0x65e5,3,0x33,0x30,0x65e5,3,0x33,0x31,0x65e5,3,
+0x67,0x61,0x6c,1,0x44c,1,0x1d79,1,0x26c,1,0x29e,1,0x287,1,0xab53,1,
+0x153,1,0xa727,1,0x13a0,1,0x13a1,1,0x13a2,1,0x13a3,1,0x13a4,1,0x13a5,1,
+0x13a6,1,0x13a7,1,0x13a8,1,0x13a9,1,0x13aa,1,0x13ab,1,0x13ac,1,0x13ad,1,
+0x13ae,1,0x13af,1,0x13b0,1,0x13b1,1,0x13b2,1,0x13b3,1,0x13b4,1,0x13b5,1,
+0x13b6,1,0x13b7,1,0x13b8,1,0x13b9,1,0x13ba,1,0x13bb,1,0x13bc,1,0x13bd,1,
+0x13be,1,0x13bf,1,0x13c0,1,0x13c1,1,0x13c2,1,0x13c3,1,0x13c4,1,0x13c5,1,
+0x13c6,1,0x13c7,1,0x13c8,1,0x13c9,1,0x13ca,1,0x13cb,1,0x13cc,1,0x13cd,1,
+0x13ce,1,0x13cf,1,0x13d0,1,0x13d1,1,0x13d2,1,0x13d3,1,0x13d4,1,0x13d5,1,
+0x13d6,1,0x13d7,1,0x13d8,1,0x13d9,1,0x13da,1,0x13db,1,0x13dc,1,0x13dd,1,
+0x13de,1,0x13df,1,0x13e0,1,0x13e1,1,0x13e2,1,0x13e3,1,0x13e4,1,0x13e5,1,
+0x13e6,1,0x13e7,1,0x13e8,1,0x13e9,1,0x13ea,1,0x13eb,1,0x13ec,1,0x13ed,1,
+0x13ee,1,0x13ef,1,0x8c48,1,0x66f4,1,0x8cc8,1,0x6ed1,1,0x4e32,1,0x53e5,1,
+0x5951,1,0x5587,1,0x5948,1,0x61f6,1,0x7669,1,0x7f85,1,0x863f,1,0x87ba,1,
+0x88f8,1,0x908f,1,0x6a02,1,0x6d1b,1,0x70d9,1,0x73de,1,0x843d,1,0x916a,1,
+0x99f1,1,0x4e82,1,0x5375,1,0x6b04,1,0x721b,1,0x862d,1,0x9e1e,1,0x5d50,1,
+0x6feb,1,0x85cd,1,0x8964,1,0x62c9,1,0x81d8,1,0x881f,1,0x5eca,1,0x6717,1,
+0x6d6a,1,0x72fc,1,0x90ce,1,0x4f86,1,0x51b7,1,0x52de,1,0x64c4,1,0x6ad3,1,
+0x7210,1,0x76e7,1,0x8606,1,0x865c,1,0x8def,1,0x9732,1,0x9b6f,1,0x9dfa,1,
+0x788c,1,0x797f,1,0x7da0,1,0x83c9,1,0x9304,1,0x8ad6,1,0x58df,1,0x5f04,1,
+0x7c60,1,0x807e,1,0x7262,1,0x78ca,1,0x8cc2,1,0x96f7,1,0x58d8,1,0x5c62,1,
+0x6a13,1,0x6dda,1,0x6f0f,1,0x7d2f,1,0x7e37,1,0x964b,1,0x52d2,1,0x808b,1,
+0x51dc,1,0x51cc,1,0x7a1c,1,0x7dbe,1,0x83f1,1,0x9675,1,0x8b80,1,0x62cf,1,
+0x8afe,1,0x4e39,1,0x5be7,1,0x6012,1,0x7387,1,0x7570,1,0x5317,1,0x78fb,1,
+0x4fbf,1,0x5fa9,1,0x4e0d,1,0x6ccc,1,0x6578,1,0x7d22,1,0x53c3,1,0x585e,1,
+0x7701,1,0x8449,1,0x8aaa,1,0x6bba,1,0x6c88,1,0x62fe,1,0x82e5,1,0x63a0,1,
+0x7565,1,0x4eae,1,0x5169,1,0x51c9,1,0x6881,1,0x7ce7,1,0x826f,1,0x8ad2,1,
+0x91cf,1,0x52f5,1,0x5442,1,0x5eec,1,0x65c5,1,0x6ffe,1,0x792a,1,0x95ad,1,
+0x9a6a,1,0x9e97,1,0x9ece,1,0x66c6,1,0x6b77,1,0x8f62,1,0x5e74,1,0x6190,1,
+0x6200,1,0x649a,1,0x6f23,1,0x7149,1,0x7489,1,0x79ca,1,0x7df4,1,0x806f,1,
+0x8f26,1,0x84ee,1,0x9023,1,0x934a,1,0x5217,1,0x52a3,1,0x54bd,1,0x70c8,1,
+0x88c2,1,0x5ec9,1,0x5ff5,1,0x637b,1,0x6bae,1,0x7c3e,1,0x7375,1,0x4ee4,1,
+0x56f9,1,0x5dba,1,0x601c,1,0x73b2,1,0x7469,1,0x7f9a,1,0x8046,1,0x9234,1,
+0x96f6,1,0x9748,1,0x9818,1,0x4f8b,1,0x79ae,1,0x91b4,1,0x96b8,1,0x60e1,1,
+0x4e86,1,0x50da,1,0x5bee,1,0x5c3f,1,0x6599,1,0x71ce,1,0x7642,1,0x84fc,1,
+0x907c,1,0x6688,1,0x962e,1,0x5289,1,0x677b,1,0x67f3,1,0x6d41,1,0x6e9c,1,
+0x7409,1,0x7559,1,0x786b,1,0x7d10,1,0x985e,1,0x622e,1,0x9678,1,0x502b,1,
+0x5d19,1,0x6dea,1,0x8f2a,1,0x5f8b,1,0x6144,1,0x6817,1,0x9686,1,0x5229,1,
+0x540f,1,0x5c65,1,0x6613,1,0x674e,1,0x68a8,1,0x6ce5,1,0x7406,1,0x75e2,1,
+0x7f79,1,0x88cf,1,0x88e1,1,0x96e2,1,0x533f,1,0x6eba,1,0x541d,1,0x71d0,1,
+0x7498,1,0x85fa,1,0x96a3,1,0x9c57,1,0x9e9f,1,0x6797,1,0x6dcb,1,0x81e8,1,
+0x7b20,1,0x7c92,1,0x72c0,1,0x7099,1,0x8b58,1,0x4ec0,1,0x8336,1,0x523a,1,
+0x5207,1,0x5ea6,1,0x62d3,1,0x7cd6,1,0x5b85,1,0x6d1e,1,0x66b4,1,0x8f3b,1,
+0x964d,1,0x5ed3,1,0x5140,1,0x55c0,1,0x585a,1,0x6674,1,0x51de,1,0x732a,1,
+0x76ca,1,0x793c,1,0x795e,1,0x7965,1,0x798f,1,0x9756,1,0x7cbe,1,0x8612,1,
+0x8af8,1,0x9038,1,0x90fd,1,0x98ef,1,0x98fc,1,0x9928,1,0x9db4,1,0x90de,1,
+0x96b7,1,0x4fae,1,0x50e7,1,0x514d,1,0x52c9,1,0x52e4,1,0x5351,1,0x559d,1,
+0x5606,1,0x5668,1,0x5840,1,0x58a8,1,0x5c64,1,0x6094,1,0x6168,1,0x618e,1,
+0x61f2,1,0x654f,1,0x65e2,1,0x6691,1,0x6885,1,0x6d77,1,0x6e1a,1,0x6f22,1,
+0x716e,1,0x722b,1,0x7422,1,0x7891,1,0x7949,1,0x7948,1,0x7950,1,0x7956,1,
+0x798d,1,0x798e,1,0x7a40,1,0x7a81,1,0x7bc0,1,0x7e09,1,0x7e41,1,0x7f72,1,
+0x8005,1,0x81ed,1,0x8279,1,0x8457,1,0x8910,1,0x8996,1,0x8b01,1,0x8b39,1,
+0x8cd3,1,0x8d08,1,0x8fb6,1,0x96e3,1,0x97ff,1,0x983b,1,0x6075,2,0xd850,0xdeee,
+1,0x8218,1,0x4e26,1,0x51b5,1,0x5168,1,0x4f80,1,0x5145,1,0x5180,1,0x52c7,
+1,0x52fa,1,0x5555,1,0x5599,1,0x55e2,1,0x58b3,1,0x5944,1,0x5954,1,0x5a62,
+1,0x5b28,1,0x5ed2,1,0x5ed9,1,0x5f69,1,0x5fad,1,0x60d8,1,0x614e,1,0x6108,
+1,0x6160,1,0x6234,1,0x63c4,1,0x641c,1,0x6452,1,0x6556,1,0x671b,1,0x6756,
+1,0x6edb,1,0x6ecb,1,0x701e,1,0x77a7,1,0x7235,1,0x72af,1,0x7471,1,0x7506,
+1,0x753b,1,0x761d,1,0x761f,1,0x76db,1,0x76f4,1,0x774a,1,0x7740,1,0x78cc,
+1,0x7ab1,1,0x7c7b,1,0x7d5b,1,0x7f3e,1,0x8352,1,0x83ef,1,0x8779,1,0x8941,
+1,0x8986,1,0x8abf,1,0x8acb,1,0x8aed,1,0x8b8a,1,0x8f38,1,0x9072,1,0x9199,
+1,0x9276,1,0x967c,1,0x97db,1,0x980b,1,0x9b12,2,0xd84a,0xdc4a,2,0xd84a,0xdc44,
+2,0xd84c,0xdfd5,1,0x3b9d,1,0x4018,1,0x4039,2,0xd854,0xde49,2,0xd857,0xdcd0,2,
+0xd85f,0xded3,1,0x9f43,1,0x9f8e,2,0x66,0x66,2,0x66,0x69,2,0x66,0x6c,3,
+0x66,0x66,0x69,3,0x66,0x66,0x6c,2,0x73,0x74,2,0x574,0x576,2,0x574,0x565,
+2,0x574,0x56b,2,0x57e,0x576,2,0x574,0x56d,0xe02,0x5d9,0x5b4,0x1102,0x5f2,0x5b7,1,
+0x5e2,1,0x5d4,1,0x5db,1,0x5dc,1,0x5dd,1,0x5e8,1,0x5ea,0x1802,0x5e9,0x5c1,
+0x1902,0x5e9,0x5c2,0x1803,0x5e9,0x5bc,0x5c1,0x1903,0x5e9,0x5bc,0x5c2,0x1102,0x5d0,0x5b7,0x1202,0x5d0,
+0x5b8,0x1502,0x5d0,0x5bc,0x1502,0x5d1,0x5bc,0x1502,0x5d2,0x5bc,0x1502,0x5d3,0x5bc,0x1502,0x5d4,0x5bc,
+0x1502,0x5d5,0x5bc,0x1502,0x5d6,0x5bc,0x1502,0x5d8,0x5bc,0x1502,0x5d9,0x5bc,0x1502,0x5da,0x5bc,0x1502,
+0x5db,0x5bc,0x1502,0x5dc,0x5bc,0x1502,0x5de,0x5bc,0x1502,0x5e0,0x5bc,0x1502,0x5e1,0x5bc,0x1502,0x5e3,
+0x5bc,0x1502,0x5e4,0x5bc,0x1502,0x5e6,0x5bc,0x1502,0x5e7,0x5bc,0x1502,0x5e8,0x5bc,0x1502,0x5e9,0x5bc,
+0x1502,0x5ea,0x5bc,0x1302,0x5d5,0x5b9,0x1702,0x5d1,0x5bf,0x1702,0x5db,0x5bf,0x1702,0x5e4,0x5bf,2,
+0x5d0,0x5dc,1,0x671,1,0x67b,1,0x67e,1,0x680,1,0x67a,1,0x67f,1,0x679,
+1,0x6a4,1,0x6a6,1,0x684,1,0x683,1,0x686,1,0x687,1,0x68d,1,0x68c,
+1,0x68e,1,0x688,1,0x698,1,0x691,1,0x6a9,1,0x6af,1,0x6b3,1,0x6b1,
+1,0x6ba,1,0x6bb,1,0x6c1,1,0x6be,1,0x6d2,1,0x6ad,1,0x6c7,1,0x6c6,
+1,0x6c8,1,0x6cb,1,0x6c5,1,0x6c9,1,0x6d0,1,0x649,1,0x6cc,2,0x628,
+0x62c,2,0x628,0x62d,2,0x628,0x62e,2,0x628,0x645,2,0x628,0x649,2,0x628,0x64a,
+2,0x62a,0x62c,2,0x62a,0x62d,2,0x62a,0x62e,2,0x62a,0x645,2,0x62a,0x649,2,
+0x62a,0x64a,2,0x62b,0x62c,2,0x62b,0x645,2,0x62b,0x649,2,0x62b,0x64a,2,0x62c,
+0x62d,2,0x62c,0x645,2,0x62d,0x62c,2,0x62d,0x645,2,0x62e,0x62c,2,0x62e,0x62d,
+2,0x62e,0x645,2,0x633,0x62c,2,0x633,0x62d,2,0x633,0x62e,2,0x633,0x645,2,
+0x635,0x62d,2,0x635,0x645,2,0x636,0x62c,2,0x636,0x62d,2,0x636,0x62e,2,0x636,
+0x645,2,0x637,0x62d,2,0x637,0x645,2,0x638,0x645,2,0x639,0x62c,2,0x639,0x645,
+2,0x63a,0x62c,2,0x63a,0x645,2,0x641,0x62c,2,0x641,0x62d,2,0x641,0x62e,2,
+0x641,0x645,2,0x641,0x649,2,0x641,0x64a,2,0x642,0x62d,2,0x642,0x645,2,0x642,
+0x649,2,0x642,0x64a,2,0x643,0x627,2,0x643,0x62c,2,0x643,0x62d,2,0x643,0x62e,
+2,0x643,0x644,2,0x643,0x645,2,0x643,0x649,2,0x643,0x64a,2,0x644,0x62c,2,
+0x644,0x62d,2,0x644,0x62e,2,0x644,0x645,2,0x644,0x649,2,0x644,0x64a,2,0x645,
+0x62c,2,0x645,0x62d,2,0x645,0x62e,2,0x645,0x645,2,0x645,0x649,2,0x645,0x64a,
+2,0x646,0x62c,2,0x646,0x62d,2,0x646,0x62e,2,0x646,0x645,2,0x646,0x649,2,
+0x646,0x64a,2,0x647,0x62c,2,0x647,0x645,2,0x647,0x649,2,0x647,0x64a,2,0x64a,
+0x62c,2,0x64a,0x62d,2,0x64a,0x62e,2,0x64a,0x645,2,0x64a,0x649,2,0x64a,0x64a,
+0x2302,0x630,0x670,0x2302,0x631,0x670,0x2302,0x649,0x670,0x2103,0x20,0x64c,0x651,0x2103,0x20,0x64d,
+0x651,0x2103,0x20,0x64e,0x651,0x2103,0x20,0x64f,0x651,0x2103,0x20,0x650,0x651,0x2303,0x20,0x651,
+0x670,2,0x628,0x631,2,0x628,0x632,2,0x628,0x646,2,0x62a,0x631,2,0x62a,0x632,
+2,0x62a,0x646,2,0x62b,0x631,2,0x62b,0x632,2,0x62b,0x646,2,0x645,0x627,2,
+0x646,0x631,2,0x646,0x632,2,0x646,0x646,2,0x64a,0x631,2,0x64a,0x632,2,0x64a,
+0x646,2,0x628,0x647,2,0x62a,0x647,2,0x635,0x62e,2,0x644,0x647,2,0x646,0x647,
+0x2302,0x647,0x670,2,0x64a,0x647,2,0x62b,0x647,2,0x633,0x647,2,0x634,0x645,2,
+0x634,0x647,0x2103,0x640,0x64e,0x651,0x2103,0x640,0x64f,0x651,0x2103,0x640,0x650,0x651,2,0x637,
+0x649,2,0x637,0x64a,2,0x639,0x649,2,0x639,0x64a,2,0x63a,0x649,2,0x63a,0x64a,
+2,0x633,0x649,2,0x633,0x64a,2,0x634,0x649,2,0x634,0x64a,2,0x62d,0x649,2,
+0x62d,0x64a,2,0x62c,0x649,2,0x62c,0x64a,2,0x62e,0x649,2,0x62e,0x64a,2,0x635,
+0x649,2,0x635,0x64a,2,0x636,0x649,2,0x636,0x64a,2,0x634,0x62c,2,0x634,0x62d,
+2,0x634,0x62e,2,0x634,0x631,2,0x633,0x631,2,0x635,0x631,2,0x636,0x631,0x1b02,
+0x627,0x64b,3,0x62a,0x62c,0x645,3,0x62a,0x62d,0x62c,3,0x62a,0x62d,0x645,3,0x62a,
+0x62e,0x645,3,0x62a,0x645,0x62c,3,0x62a,0x645,0x62d,3,0x62a,0x645,0x62e,3,0x62c,
+0x645,0x62d,3,0x62d,0x645,0x64a,3,0x62d,0x645,0x649,3,0x633,0x62d,0x62c,3,0x633,
+0x62c,0x62d,3,0x633,0x62c,0x649,3,0x633,0x645,0x62d,3,0x633,0x645,0x62c,3,0x633,
+0x645,0x645,3,0x635,0x62d,0x62d,3,0x635,0x645,0x645,3,0x634,0x62d,0x645,3,0x634,
+0x62c,0x64a,3,0x634,0x645,0x62e,3,0x634,0x645,0x645,3,0x636,0x62d,0x649,3,0x636,
+0x62e,0x645,3,0x637,0x645,0x62d,3,0x637,0x645,0x645,3,0x637,0x645,0x64a,3,0x639,
+0x62c,0x645,3,0x639,0x645,0x645,3,0x639,0x645,0x649,3,0x63a,0x645,0x645,3,0x63a,
+0x645,0x64a,3,0x63a,0x645,0x649,3,0x641,0x62e,0x645,3,0x642,0x645,0x62d,3,0x642,
+0x645,0x645,3,0x644,0x62d,0x645,3,0x644,0x62d,0x64a,3,0x644,0x62d,0x649,3,0x644,
+0x62c,0x62c,3,0x644,0x62e,0x645,3,0x644,0x645,0x62d,3,0x645,0x62d,0x62c,3,0x645,
+0x62d,0x645,3,0x645,0x62d,0x64a,3,0x645,0x62c,0x62d,3,0x645,0x62c,0x645,3,0x645,
+0x62e,0x62c,3,0x645,0x62e,0x645,3,0x645,0x62c,0x62e,3,0x647,0x645,0x62c,3,0x647,
+0x645,0x645,3,0x646,0x62d,0x645,3,0x646,0x62d,0x649,3,0x646,0x62c,0x645,3,0x646,
+0x62c,0x649,3,0x646,0x645,0x64a,3,0x646,0x645,0x649,3,0x64a,0x645,0x645,3,0x628,
+0x62e,0x64a,3,0x62a,0x62c,0x64a,3,0x62a,0x62c,0x649,3,0x62a,0x62e,0x64a,3,0x62a,
+0x62e,0x649,3,0x62a,0x645,0x64a,3,0x62a,0x645,0x649,3,0x62c,0x645,0x64a,3,0x62c,
+0x62d,0x649,3,0x62c,0x645,0x649,3,0x633,0x62e,0x649,3,0x635,0x62d,0x64a,3,0x634,
+0x62d,0x64a,3,0x636,0x62d,0x64a,3,0x644,0x62c,0x64a,3,0x644,0x645,0x64a,3,0x64a,
+0x62d,0x64a,3,0x64a,0x62c,0x64a,3,0x64a,0x645,0x64a,3,0x645,0x645,0x64a,3,0x642,
+0x645,0x64a,3,0x646,0x62d,0x64a,3,0x639,0x645,0x64a,3,0x643,0x645,0x64a,3,0x646,
+0x62c,0x62d,3,0x645,0x62e,0x64a,3,0x644,0x62c,0x645,3,0x643,0x645,0x645,3,0x62c,
+0x62d,0x64a,3,0x62d,0x62c,0x64a,3,0x645,0x62c,0x64a,3,0x641,0x645,0x64a,3,0x628,
+0x62d,0x64a,3,0x633,0x62e,0x64a,3,0x646,0x62c,0x64a,3,0x635,0x644,0x6d2,3,0x642,
+0x644,0x6d2,4,0x627,0x644,0x644,0x647,4,0x627,0x643,0x628,0x631,4,0x645,0x62d,0x645,
+0x62f,4,0x635,0x644,0x639,0x645,4,0x631,0x633,0x648,0x644,4,0x639,0x644,0x64a,0x647,
+4,0x648,0x633,0x644,0x645,3,0x635,0x644,0x649,0x12,0x635,0x644,0x649,0x20,0x627,0x644,
+0x644,0x647,0x20,0x639,0x644,0x64a,0x647,0x20,0x648,0x633,0x644,0x645,8,0x62c,0x644,0x20,
+0x62c,0x644,0x627,0x644,0x647,4,0x631,0x6cc,0x627,0x644,1,0x2c,1,0x3001,1,0x3002,
+1,0x3a,1,0x21,1,0x3f,1,0x3016,1,0x3017,1,0x2014,1,0x2013,1,0x5f,
+1,0x7b,1,0x7d,1,0x3014,1,0x3015,1,0x3010,1,0x3011,1,0x300a,1,0x300b,
+1,0x300c,1,0x300d,1,0x300e,1,0x300f,1,0x5b,1,0x5d,1,0x23,1,0x26,
+1,0x2a,1,0x2d,1,0x3c,1,0x3e,1,0x5c,1,0x24,1,0x25,1,0x40,
+0x1b02,0x20,0x64b,0x1b02,0x640,0x64b,0x1c02,0x20,0x64c,0x1d02,0x20,0x64d,0x1e02,0x20,0x64e,0x1e02,
+0x640,0x64e,0x1f02,0x20,0x64f,0x1f02,0x640,0x64f,0x2002,0x20,0x650,0x2002,0x640,0x650,0x2102,0x20,
+0x651,0x2102,0x640,0x651,0x2202,0x20,0x652,0x2202,0x640,0x652,1,0x621,1,0x627,1,0x628,
+1,0x629,1,0x62a,1,0x62b,1,0x62c,1,0x62d,1,0x62e,1,0x62f,1,0x630,
+1,0x631,1,0x632,1,0x633,1,0x634,1,0x635,1,0x636,1,0x637,1,0x638,
+1,0x639,1,0x63a,1,0x641,1,0x642,1,0x643,1,0x644,1,0x645,1,0x646,
+1,0x647,1,0x648,1,0x64a,2,0x644,0x627,1,0x22,1,0x27,1,0x2f,1,
+0x5e,1,0x7c,1,0x7e,1,0x2985,1,0x2986,1,0x30fb,1,0x30a1,1,0x30a3,1,
+0x30a5,1,0x30a7,1,0x30a9,1,0x30e3,1,0x30e5,1,0x30e7,1,0x30c3,1,0x30fc,1,
+0x30f3,1,0xa2,1,0xa3,1,0xac,1,0xa6,1,0xa5,1,0x20a9,1,0x2502,1,
+0x2190,1,0x2191,1,0x2192,1,0x2193,1,0x25a0,1,0x25cb,0xd804,0xd834,0xdd57,0xd834,0xdd65,
+0xd804,0xd834,0xdd58,0xd834,0xdd65,0xd806,0xd834,0xdd58,0xd834,0xdd65,0xd834,0xdd6e,0xd806,0xd834,0xdd58,0xd834,
+0xdd65,0xd834,0xdd6f,0xd806,0xd834,0xdd58,0xd834,0xdd65,0xd834,0xdd70,0xd806,0xd834,0xdd58,0xd834,0xdd65,0xd834,
+0xdd71,0xd806,0xd834,0xdd58,0xd834,0xdd65,0xd834,0xdd72,0xd804,0xd834,0xddb9,0xd834,0xdd65,0xd804,0xd834,0xddba,
+0xd834,0xdd65,0xd806,0xd834,0xddb9,0xd834,0xdd65,0xd834,0xdd6e,0xd806,0xd834,0xddba,0xd834,0xdd65,0xd834,0xdd6e,
+0xd806,0xd834,0xddb9,0xd834,0xdd65,0xd834,0xdd6f,0xd806,0xd834,0xddba,0xd834,0xdd65,0xd834,0xdd6f,1,0x131,
+1,0x237,1,0x3b1,1,0x3b5,1,0x3b6,1,0x3b7,1,0x3ba,1,0x3bb,1,0x3bd,
+1,0x3be,1,0x3bf,1,0x3c3,1,0x3c4,1,0x3c5,1,0x3c8,1,0x2207,1,0x2202,
+1,0x3dd,1,0x66e,1,0x6a1,1,0x66f,2,0x30,0x2e,2,0x30,0x2c,2,0x31,
+0x2c,2,0x32,0x2c,2,0x33,0x2c,2,0x34,0x2c,2,0x35,0x2c,2,0x36,0x2c,
+2,0x37,0x2c,2,0x38,0x2c,2,0x39,0x2c,3,0x3014,0x73,0x3015,2,0x77,0x7a,
+2,0x68,0x76,2,0x73,0x64,3,0x70,0x70,0x76,2,0x77,0x63,2,0x6d,0x63,
+2,0x6d,0x64,2,0x64,0x6a,2,0x307b,0x304b,2,0x30b3,0x30b3,1,0x5b57,1,0x53cc,
+1,0x591a,1,0x89e3,1,0x4ea4,1,0x6620,1,0x7121,1,0x524d,1,0x5f8c,1,0x518d,
+1,0x65b0,1,0x521d,1,0x7d42,1,0x8ca9,1,0x58f0,1,0x5439,1,0x6f14,1,0x6295,
+1,0x6355,1,0x904a,1,0x6307,1,0x6253,1,0x7981,1,0x7a7a,1,0x5408,1,0x6e80,
+1,0x7533,1,0x5272,1,0x55b6,1,0x914d,3,0x3014,0x672c,0x3015,3,0x3014,0x4e09,0x3015,
+3,0x3014,0x4e8c,0x3015,3,0x3014,0x5b89,0x3015,3,0x3014,0x70b9,0x3015,3,0x3014,0x6253,0x3015,
+3,0x3014,0x76d7,0x3015,3,0x3014,0x52dd,0x3015,3,0x3014,0x6557,0x3015,1,0x5f97,1,0x53ef,
+1,0x4e3d,1,0x4e38,1,0x4e41,2,0xd840,0xdd22,1,0x4f60,1,0x4fbb,1,0x5002,1,
+0x507a,1,0x5099,1,0x50cf,1,0x349e,2,0xd841,0xde3a,1,0x5154,1,0x5164,1,0x5177,
+2,0xd841,0xdd1c,1,0x34b9,1,0x5167,2,0xd841,0xdd4b,1,0x5197,1,0x51a4,1,0x4ecc,
+1,0x51ac,2,0xd864,0xdddf,1,0x5203,1,0x34df,1,0x523b,1,0x5246,1,0x5277,1,
+0x3515,1,0x5305,1,0x5306,1,0x5349,1,0x535a,1,0x5373,1,0x537d,1,0x537f,2,
+0xd842,0xde2c,1,0x7070,1,0x53ca,1,0x53df,2,0xd842,0xdf63,1,0x53eb,1,0x53f1,1,
+0x5406,1,0x549e,1,0x5438,1,0x5448,1,0x5468,1,0x54a2,1,0x54f6,1,0x5510,1,
+0x5553,1,0x5563,1,0x5584,1,0x55ab,1,0x55b3,1,0x55c2,1,0x5716,1,0x5717,1,
+0x5651,1,0x5674,1,0x58ee,1,0x57ce,1,0x57f4,1,0x580d,1,0x578b,1,0x5832,1,
+0x5831,1,0x58ac,2,0xd845,0xdce4,1,0x58f2,1,0x58f7,1,0x5906,1,0x5922,1,0x5962,
+2,0xd845,0xdea8,2,0xd845,0xdeea,1,0x59ec,1,0x5a1b,1,0x5a27,1,0x59d8,1,0x5a66,
+1,0x36ee,1,0x36fc,1,0x5b08,1,0x5b3e,2,0xd846,0xddc8,1,0x5bc3,1,0x5bd8,1,
+0x5bf3,2,0xd846,0xdf18,1,0x5bff,1,0x5c06,1,0x5f53,1,0x3781,1,0x5c60,1,0x5cc0,
+1,0x5c8d,2,0xd847,0xdde4,1,0x5d43,2,0xd847,0xdde6,1,0x5d6e,1,0x5d6b,1,0x5d7c,
+1,0x5de1,1,0x5de2,1,0x382f,1,0x5dfd,1,0x5e28,1,0x5e3d,1,0x5e69,1,0x3862,
+2,0xd848,0xdd83,1,0x387c,1,0x5eb0,1,0x5eb3,1,0x5eb6,2,0xd868,0xdf92,2,0xd848,
+0xdf31,1,0x8201,1,0x5f22,1,0x38c7,2,0xd84c,0xdeb8,2,0xd858,0xddda,1,0x5f62,1,
+0x5f6b,1,0x38e3,1,0x5f9a,1,0x5fcd,1,0x5fd7,1,0x5ff9,1,0x6081,1,0x393a,1,
+0x391c,2,0xd849,0xded4,1,0x60c7,1,0x6148,1,0x614c,1,0x617a,1,0x61b2,1,0x61a4,
+1,0x61af,1,0x61de,1,0x6210,1,0x621b,1,0x625d,1,0x62b1,1,0x62d4,1,0x6350,
+2,0xd84a,0xdf0c,1,0x633d,1,0x62fc,1,0x6368,1,0x6383,1,0x63e4,2,0xd84a,0xdff1,
+1,0x6422,1,0x63c5,1,0x63a9,1,0x3a2e,1,0x6469,1,0x647e,1,0x649d,1,0x6477,
+1,0x3a6c,1,0x656c,2,0xd84c,0xdc0a,1,0x65e3,1,0x66f8,1,0x6649,1,0x3b19,1,
+0x3b08,1,0x3ae4,1,0x5192,1,0x5195,1,0x6700,1,0x669c,1,0x80ad,1,0x43d9,1,
+0x6721,1,0x675e,1,0x6753,2,0xd84c,0xdfc3,1,0x3b49,1,0x67fa,1,0x6785,1,0x6852,
+2,0xd84d,0xdc6d,1,0x688e,1,0x681f,1,0x6914,1,0x6942,1,0x69a3,1,0x69ea,1,
+0x6aa8,2,0xd84d,0xdea3,1,0x6adb,1,0x3c18,1,0x6b21,2,0xd84e,0xdca7,1,0x6b54,1,
+0x3c4e,1,0x6b72,1,0x6b9f,1,0x6bbb,2,0xd84e,0xde8d,2,0xd847,0xdd0b,2,0xd84e,0xdefa,
+1,0x6c4e,2,0xd84f,0xdcbc,1,0x6cbf,1,0x6ccd,1,0x6c67,1,0x6d16,1,0x6d3e,1,
+0x6d69,1,0x6d78,1,0x6d85,2,0xd84f,0xdd1e,1,0x6d34,1,0x6e2f,1,0x6e6e,1,0x3d33,
+1,0x6ec7,2,0xd84f,0xded1,1,0x6df9,1,0x6f6e,2,0xd84f,0xdf5e,2,0xd84f,0xdf8e,1,
+0x6fc6,1,0x7039,1,0x701b,1,0x3d96,1,0x704a,1,0x707d,1,0x7077,1,0x70ad,2,
+0xd841,0xdd25,1,0x7145,2,0xd850,0xde63,1,0x719c,2,0xd850,0xdfab,1,0x7228,1,0x7250,
+2,0xd851,0xde08,1,0x7280,1,0x7295,2,0xd851,0xdf35,2,0xd852,0xdc14,1,0x737a,1,
+0x738b,1,0x3eac,1,0x73a5,1,0x3eb8,1,0x7447,1,0x745c,1,0x7485,1,0x74ca,1,
+0x3f1b,1,0x7524,2,0xd853,0xdc36,1,0x753e,2,0xd853,0xdc92,2,0xd848,0xdd9f,1,0x7610,
+2,0xd853,0xdfa1,2,0xd853,0xdfb8,2,0xd854,0xdc44,1,0x3ffc,1,0x4008,2,0xd854,0xdcf3,
+2,0xd854,0xdcf2,2,0xd854,0xdd19,2,0xd854,0xdd33,1,0x771e,1,0x771f,1,0x778b,1,
+0x4046,1,0x4096,2,0xd855,0xdc1d,1,0x784e,1,0x40e3,2,0xd855,0xde26,2,0xd855,0xde9a,
+2,0xd855,0xdec5,1,0x79eb,1,0x412f,1,0x7a4a,1,0x7a4f,2,0xd856,0xdd7c,2,0xd856,
+0xdea7,1,0x7aee,1,0x4202,2,0xd856,0xdfab,1,0x7bc6,1,0x7bc9,1,0x4227,2,0xd857,
+0xdc80,1,0x7cd2,1,0x42a0,1,0x7ce8,1,0x7ce3,1,0x7d00,2,0xd857,0xdf86,1,0x7d63,
+1,0x4301,1,0x7dc7,1,0x7e02,1,0x7e45,1,0x4334,2,0xd858,0xde28,2,0xd858,0xde47,
+1,0x4359,2,0xd858,0xded9,1,0x7f7a,2,0xd858,0xdf3e,1,0x7f95,1,0x7ffa,2,0xd859,
+0xdcda,2,0xd859,0xdd23,1,0x8060,2,0xd859,0xdda8,1,0x8070,2,0xd84c,0xdf5f,1,0x43d5,
+1,0x80b2,1,0x8103,1,0x440b,1,0x813e,1,0x5ab5,2,0xd859,0xdfa7,2,0xd859,0xdfb5,
+2,0xd84c,0xdf93,2,0xd84c,0xdf9c,1,0x8204,1,0x8f9e,1,0x446b,1,0x8291,1,0x828b,
+1,0x829d,1,0x52b3,1,0x82b1,1,0x82b3,1,0x82bd,1,0x82e6,2,0xd85a,0xdf3c,1,
+0x831d,1,0x8363,1,0x83ad,1,0x8323,1,0x83bd,1,0x83e7,1,0x8353,1,0x83ca,1,
+0x83cc,1,0x83dc,2,0xd85b,0xdc36,2,0xd85b,0xdd6b,2,0xd85b,0xdcd5,1,0x452b,1,0x84f1,
+1,0x84f3,1,0x8516,2,0xd85c,0xdfca,1,0x8564,2,0xd85b,0xdf2c,1,0x455d,1,0x4561,
+2,0xd85b,0xdfb1,2,0xd85c,0xdcd2,1,0x456b,1,0x8650,1,0x8667,1,0x8669,1,0x86a9,
+1,0x8688,1,0x870e,1,0x86e2,1,0x8728,1,0x876b,1,0x8786,1,0x45d7,1,0x87e1,
+1,0x8801,1,0x45f9,1,0x8860,2,0xd85d,0xde67,1,0x88d7,1,0x88de,1,0x4635,1,
+0x88fa,1,0x34bb,2,0xd85e,0xdcae,2,0xd85e,0xdd66,1,0x46be,1,0x46c7,1,0x8aa0,2,
+0xd85f,0xdca8,1,0x8cab,1,0x8cc1,1,0x8d1b,1,0x8d77,2,0xd85f,0xdf2f,2,0xd842,0xdc04,
+1,0x8dcb,1,0x8dbc,1,0x8df0,2,0xd842,0xdcde,1,0x8ed4,2,0xd861,0xddd2,2,0xd861,
+0xdded,1,0x9094,1,0x90f1,1,0x9111,2,0xd861,0xdf2e,1,0x911b,1,0x9238,1,0x92d7,
+1,0x92d8,1,0x927c,1,0x93f9,1,0x9415,2,0xd862,0xdffa,1,0x958b,1,0x4995,1,
+0x95b7,2,0xd863,0xdd77,1,0x49e6,1,0x96c3,1,0x5db2,1,0x9723,2,0xd864,0xdd45,2,
+0xd864,0xde1a,1,0x4a6e,1,0x4a76,1,0x97e0,2,0xd865,0xdc0a,1,0x4ab2,2,0xd865,0xdc96,
+1,0x9829,2,0xd865,0xddb6,1,0x98e2,1,0x4b33,1,0x9929,1,0x99a7,1,0x99c2,1,
+0x99fe,1,0x4bce,2,0xd866,0xdf30,1,0x9c40,1,0x9cfd,1,0x4cce,1,0x4ced,1,0x9d67,
+2,0xd868,0xdcce,1,0x4cf8,2,0xd868,0xdd05,2,0xd868,0xde0e,2,0xd868,0xde91,1,0x4d56,
+1,0x9efe,1,0x9f05,1,0x9f0f,1,0x9f16,2,0xd869,0xde00,0xff,0xe642,0x79,0x308,0x64,
+0x17e,2,0xe643,0x64,0x7a,0x30c,0x450,0xe642,0x435,0x300,0x451,0xe642,0x435,0x308,0x453,0xe642,
+0x433,0x301,0x457,0xe642,0x456,0x308,0x45c,0xe642,0x43a,0x301,0x45d,0xe642,0x438,0x300,0x45e,0xe642,
+0x443,0x306,0x3ac,0xe642,0x3b1,0x301,0x3ad,0xe642,0x3b5,0x301,0x3ae,0xe642,0x3b7,0x301,0x3af,0xe642,
+0x3b9,0x301,0x3cc,0xe642,0x3bf,0x301,0x3cd,0xe642,0x3c5,0x301,0x3ce,0xe642,0x3c9,0x301,0x1f00,0x43,
+0x3b1,0x313,0x3b9,0x1f01,0x43,0x3b1,0x314,0x3b9,0x1f02,0x3b9,2,0x44,0x3b1,0x313,0x300,0x3b9,
+0x1f03,0x3b9,2,0x44,0x3b1,0x314,0x300,0x3b9,0x1f04,0x3b9,2,0x44,0x3b1,0x313,0x301,0x3b9,
+0x1f05,0x3b9,2,0x44,0x3b1,0x314,0x301,0x3b9,0x1f06,0x3b9,2,0x44,0x3b1,0x313,0x342,0x3b9,
+0x1f07,0x3b9,2,0x44,0x3b1,0x314,0x342,0x3b9,0x1f20,0x43,0x3b7,0x313,0x3b9,0x1f21,0x43,0x3b7,
+0x314,0x3b9,0x1f22,0x3b9,2,0x44,0x3b7,0x313,0x300,0x3b9,0x1f23,0x3b9,2,0x44,0x3b7,0x314,
+0x300,0x3b9,0x1f24,0x3b9,2,0x44,0x3b7,0x313,0x301,0x3b9,0x1f25,0x3b9,2,0x44,0x3b7,0x314,
+0x301,0x3b9,0x1f26,0x3b9,2,0x44,0x3b7,0x313,0x342,0x3b9,0x1f27,0x3b9,2,0x44,0x3b7,0x314,
+0x342,0x3b9,0x1f60,0x43,0x3c9,0x313,0x3b9,0x1f61,0x43,0x3c9,0x314,0x3b9,0x1f62,0x3b9,2,0x44,
+0x3c9,0x313,0x300,0x3b9,0x1f63,0x3b9,2,0x44,0x3c9,0x314,0x300,0x3b9,0x1f64,0x3b9,2,0x44,
+0x3c9,0x313,0x301,0x3b9,0x1f65,0x3b9,2,0x44,0x3c9,0x314,0x301,0x3b9,0x1f66,0x3b9,2,0x44,
+0x3c9,0x313,0x342,0x3b9,0x1f67,0x3b9,2,0x44,0x3c9,0x314,0x342,0x3b9,0x1f70,0x43,0x3b1,0x300,
+0x3b9,0x3ac,0x43,0x3b1,0x301,0x3b9,0x1fb6,0x43,0x3b1,0x342,0x3b9,0x1f70,0xe642,0x3b1,0x300,0x1f74,
+0x43,0x3b7,0x300,0x3b9,0x3ae,0x43,0x3b7,0x301,0x3b9,0x1fc6,0x43,0x3b7,0x342,0x3b9,0x1f72,0xe642,
+0x3b5,0x300,0x1f74,0xe642,0x3b7,0x300,0x390,1,0xe643,0x3b9,0x308,0x301,0x1f76,0xe642,0x3b9,0x300,
+0x3b0,1,0xe643,0x3c5,0x308,0x301,0x1f7a,0xe642,0x3c5,0x300,0x1f7c,0x43,0x3c9,0x300,0x3b9,0x3ce,
+0x43,0x3c9,0x301,0x3b9,0x1ff6,0x43,0x3c9,0x342,0x3b9,0x1f78,0xe642,0x3bf,0x300,0x1f7c,0xe642,0x3c9,
+0x300,0xe5,0xe642,0x61,0x30a,0x28,0xac00,0x29,3,0x44,0x28,0x1100,0x1161,0x29,0x28,0xb098,
+0x29,3,0x44,0x28,0x1102,0x1161,0x29,0x28,0xb2e4,0x29,3,0x44,0x28,0x1103,0x1161,0x29,
+0x28,0xb77c,0x29,3,0x44,0x28,0x1105,0x1161,0x29,0x28,0xb9c8,0x29,3,0x44,0x28,0x1106,
+0x1161,0x29,0x28,0xbc14,0x29,3,0x44,0x28,0x1107,0x1161,0x29,0x28,0xc0ac,0x29,3,0x44,
+0x28,0x1109,0x1161,0x29,0x28,0xc544,0x29,3,0x44,0x28,0x110b,0x1161,0x29,0x28,0xc790,0x29,
+3,0x44,0x28,0x110c,0x1161,0x29,0x28,0xcc28,0x29,3,0x44,0x28,0x110e,0x1161,0x29,0x28,
+0xce74,0x29,3,0x44,0x28,0x110f,0x1161,0x29,0x28,0xd0c0,0x29,3,0x44,0x28,0x1110,0x1161,
+0x29,0x28,0xd30c,0x29,3,0x44,0x28,0x1111,0x1161,0x29,0x28,0xd558,0x29,3,0x44,0x28,
+0x1112,0x1161,0x29,0x28,0xc8fc,0x29,3,0x44,0x28,0x110c,0x116e,0x29,0x28,0xc624,0xc804,0x29,
+4,0x47,0x28,0x110b,0x1169,0x110c,0x1165,0x11ab,0x29,0x28,0xc624,0xd6c4,0x29,4,0x46,0x28,
+0x110b,0x1169,0x1112,0x116e,0x29,0xac00,0x42,0x1100,0x1161,0xb098,0x42,0x1102,0x1161,0xb2e4,0x42,0x1103,
+0x1161,0xb77c,0x42,0x1105,0x1161,0xb9c8,0x42,0x1106,0x1161,0xbc14,0x42,0x1107,0x1161,0xc0ac,0x42,0x1109,
+0x1161,0xc544,0x42,0x110b,0x1161,0xc790,0x42,0x110c,0x1161,0xcc28,0x42,0x110e,0x1161,0xce74,0x42,0x110f,
+0x1161,0xd0c0,0x42,0x1110,0x1161,0xd30c,0x42,0x1111,0x1161,0xd558,0x42,0x1112,0x1161,0xcc38,0xace0,2,
+0x45,0x110e,0x1161,0x11b7,0x1100,0x1169,0xc8fc,0xc758,2,0x44,0x110c,0x116e,0x110b,0x1174,0xc6b0,0x42,
+0x110b,0x116e,0x30a2,0x30d1,0x30fc,0x30c8,4,0x45,0x30a2,0x30cf,0x309a,0x30fc,0x30c8,0x30a2,0x30f3,0x30da,
+0x30a2,4,0x45,0x30a2,0x30f3,0x30d8,0x309a,0x30a2,0x30a4,0x30cb,0x30f3,0x30b0,4,0x845,0x30a4,0x30cb,
+0x30f3,0x30af,0x3099,0x30a8,0x30b9,0x30af,0x30fc,0x30c9,5,0x846,0x30a8,0x30b9,0x30af,0x30fc,0x30c8,0x3099,
+0x30ac,0x44,0x30ab,0x3099,0x30ed,0x30f3,0x30ac,0x44,0x30ab,0x3099,0x30f3,0x30de,0x30ae,0x30ac,2,0x844,
+0x30ad,0x3099,0x30ab,0x3099,0x30ae,0x44,0x30ad,0x3099,0x30cb,0x30fc,0x30ae,0x30eb,0x30c0,0x30fc,4,0x46,
+0x30ad,0x3099,0x30eb,0x30bf,0x3099,0x30fc,0x30ad,0x30ed,0x30b0,0x30e9,0x30e0,5,0x46,0x30ad,0x30ed,0x30af,
+0x3099,0x30e9,0x30e0,0x30b0,0x44,0x30af,0x3099,0x30e9,0x30e0,0x30b0,0x46,0x30af,0x3099,0x30e9,0x30e0,0x30c8,
+0x30f3,0x30af,0x30eb,0x30bc,0x30a4,0x30ed,5,0x46,0x30af,0x30eb,0x30bb,0x3099,0x30a4,0x30ed,0x30b3,0x30fc,
+0x30dd,3,0x844,0x30b3,0x30fc,0x30db,0x309a,0x30b7,0x30ea,0x30f3,0x30b0,4,0x845,0x30b7,0x30ea,0x30f3,
+0x30af,0x3099,0x30c0,0x44,0x30bf,0x3099,0x30fc,0x30b9,0x30c7,0x43,0x30c6,0x3099,0x30b7,0x30c9,0x43,0x30c8,
+0x3099,0x30eb,0x30d1,0x46,0x30cf,0x309a,0x30fc,0x30bb,0x30f3,0x30c8,0x30d1,0x44,0x30cf,0x309a,0x30fc,0x30c4,
+0x30d0,0x45,0x30cf,0x3099,0x30fc,0x30ec,0x30eb,0x30d4,0x46,0x30d2,0x309a,0x30a2,0x30b9,0x30c8,0x30eb,0x30d4,
+0x44,0x30d2,0x309a,0x30af,0x30eb,0x30d4,0x43,0x30d2,0x309a,0x30b3,0x30d3,0x43,0x30d2,0x3099,0x30eb,0x30d5,
+0x30a1,0x30e9,0x30c3,0x30c9,5,0x846,0x30d5,0x30a1,0x30e9,0x30c3,0x30c8,0x3099,0x30d6,0x46,0x30d5,0x3099,
+0x30c3,0x30b7,0x30a7,0x30eb,0x30da,0x43,0x30d8,0x309a,0x30bd,0x30da,0x44,0x30d8,0x309a,0x30cb,0x30d2,0x30da,
+0x44,0x30d8,0x309a,0x30f3,0x30b9,0x30da,0x30fc,0x30b8,3,0x845,0x30d8,0x309a,0x30fc,0x30b7,0x3099,0x30d9,
+0x44,0x30d8,0x3099,0x30fc,0x30bf,0x30dd,0x45,0x30db,0x309a,0x30a4,0x30f3,0x30c8,0x30dc,0x44,0x30db,0x3099,
+0x30eb,0x30c8,0x30dd,0x30f3,0x30c9,3,0x845,0x30db,0x309a,0x30f3,0x30c8,0x3099,0x30df,0x30ea,0x30d0,0x30fc,
+0x30eb,5,0x46,0x30df,0x30ea,0x30cf,0x3099,0x30fc,0x30eb,0x30e1,0x30ac,2,0x843,0x30e1,0x30ab,0x3099,
+0x30e1,0x30ac,0x30c8,0x30f3,4,0x45,0x30e1,0x30ab,0x3099,0x30c8,0x30f3,0x30e4,0x30fc,0x30c9,3,0x844,
+0x30e4,0x30fc,0x30c8,0x3099,0x30eb,0x30d4,0x30fc,3,0x44,0x30eb,0x30d2,0x309a,0x30fc,0x30eb,0x30fc,0x30d6,
+0x30eb,4,0x45,0x30eb,0x30fc,0x30d5,0x3099,0x30eb,0x30ec,0x30f3,0x30c8,0x30b2,0x30f3,5,0x46,0x30ec,
+0x30f3,0x30c8,0x30b1,0x3099,0x30f3,0x6c0,0xe642,0x6d5,0x654,0x6d3,0xe642,0x6d2,0x654,0x626,0x43,0x64a,
+0x654,0x627,0x626,0x43,0x64a,0x654,0x6d5,0x626,0x43,0x64a,0x654,0x648,0x626,0x43,0x64a,0x654,
+0x6c7,0x626,0x43,0x64a,0x654,0x6c6,0x626,0x43,0x64a,0x654,0x6c8,0x626,0x43,0x64a,0x654,0x6d0,
+0x626,0x43,0x64a,0x654,0x649,0x626,0x43,0x64a,0x654,0x62c,0x626,0x43,0x64a,0x654,0x62d,0x626,
+0x43,0x64a,0x654,0x645,0x626,0x43,0x64a,0x654,0x64a,0x626,0x43,0x64a,0x654,0x631,0x626,0x43,
+0x64a,0x654,0x632,0x626,0x43,0x64a,0x654,0x646,0x626,0x43,0x64a,0x654,0x62e,0x626,0x43,0x64a,
+0x654,0x647,0x622,0xe642,0x627,0x653,0x623,0xe642,0x627,0x654,0x624,0xe642,0x648,0x654,0x625,0xdc42,
+0x627,0x655,0x626,0xe642,0x64a,0x654,0x644,0x622,2,0xe643,0x644,0x627,0x653,0x644,0x623,2,
+0xe643,0x644,0x627,0x654,0x644,0x625,2,0xdc43,0x644,0x627,0x655,0x30c7,0x842,0x30c6,0x3099,0xe6e6,
+0xe681,0x300,0xe6e6,0xe681,0x301,0xe6e6,0xe681,0x313,0xe6e6,0xe682,0x308,0x301,0x8100,0x8282,0xf71,0xf72,
+0x8100,0x8482,0xf71,0xf74,0x8100,0x8282,0xf71,0xf80,1,0x11aa,1,0x11ac,1,0x11ad,1,0x11b0,
+1,0x11b1,1,0x11b2,1,0x11b3,1,0x11b4,1,0x11b5,1,0x1161,1,0x1162,1,0x1163,
+1,0x1164,1,0x1165,1,0x1166,1,0x1167,1,0x1168,1,0x1169,1,0x116a,1,0x116b,
+1,0x116c,1,0x116d,1,0x116e,1,0x116f,1,0x1170,1,0x1171,1,0x1172,1,0x1173,
+1,0x1174,1,0x1175,0x800,0x881,0x3099,0x800,0x881,0x309a,0x100,0xff80
+};
+
+static const uint8_t norm2_nfkc_cf_data_smallFCD[256]={
+0xe0,0xef,0x43,0x7f,0xdf,0x70,0xcf,0x87,0xc7,0xe6,0x66,0x46,0x64,0x46,0x66,0x5b,
+0x12,0xc,0,4,0,0,0,0x63,0x21,2,0x29,0xae,0xc2,0xc0,0xff,0xef,
+0xcb,0x72,0xbf,0,0,0,0,0,0,0,0x40,0,0x80,0x88,0,0,
+0xfe,8,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x98,0,0xc1,0x66,0xe0,0x80,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,0,0,4,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x27,0xdc,2,0x9f,0xb0
+};
+
+#endif  // INCLUDED_FROM_NORMALIZER2_CPP
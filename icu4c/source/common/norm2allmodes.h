@@ -186,7 +186,7 @@ class Normalizer2WithImpl : public Normalizer2 {
     const Normalizer2Impl &impl;
 };
 
-class DecomposeNormalizer2 : public Normalizer2WithImpl {
+class DecomposeNormalizer2 U_FINAL : public Normalizer2WithImpl {
 public:
     DecomposeNormalizer2(const Normalizer2Impl &ni) : Normalizer2WithImpl(ni) {}
     virtual ~DecomposeNormalizer2();
@@ -217,7 +217,7 @@ class DecomposeNormalizer2 : public Normalizer2WithImpl {
     virtual UBool isInert(UChar32 c) const { return impl.isDecompInert(c); }
 };
 
-class ComposeNormalizer2 : public Normalizer2WithImpl {
+class ComposeNormalizer2 U_FINAL : public Normalizer2WithImpl {
 public:
     ComposeNormalizer2(const Normalizer2Impl &ni, UBool fcc) :
         Normalizer2WithImpl(ni), onlyContiguous(fcc) {}
@@ -313,7 +313,7 @@ class ComposeNormalizer2 : public Normalizer2WithImpl {
     const UBool onlyContiguous;
 };
 
-class FCDNormalizer2 : public Normalizer2WithImpl {
+class FCDNormalizer2 U_FINAL : public Normalizer2WithImpl {
 public:
     FCDNormalizer2(const Normalizer2Impl &ni) : Normalizer2WithImpl(ni) {}
     virtual ~FCDNormalizer2();
@@ -336,6 +336,15 @@ class FCDNormalizer2 : public Normalizer2WithImpl {
         return impl.makeFCD(src, limit, NULL, errorCode);
     }
     using Normalizer2WithImpl::spanQuickCheckYes;  // Avoid warning about hiding base class function.
+    virtual UBool
+    isNormalizedUTF8(StringPiece sp, UErrorCode &errorCode) const U_OVERRIDE {
+        if(U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sp.data());
+        const uint8_t *limit = s + sp.length();
+        return impl.spanFCDUTF8(s, limit) == limit;
+    }
     virtual UBool hasBoundaryBefore(UChar32 c) const { return impl.hasFCDBoundaryBefore(c); }
     virtual UBool hasBoundaryAfter(UChar32 c) const { return impl.hasFCDBoundaryAfter(c); }
     virtual UBool isInert(UChar32 c) const { return impl.isFCDInert(c); }
@@ -348,6 +357,7 @@ struct Norm2AllModes : public UMemory {
 
     static Norm2AllModes *createInstance(Normalizer2Impl *impl, UErrorCode &errorCode);
     static Norm2AllModes *createNFCInstance(UErrorCode &errorCode);
+    static Norm2AllModes *createNFKC_CFInstance(UErrorCode &errorCode);
     static Norm2AllModes *createInstance(const char *packageName,
                                          const char *name,
                                          UErrorCode &errorCode);
@@ -363,6 +373,96 @@ struct Norm2AllModes : public UMemory {
     ComposeNormalizer2 fcc;
 };
 
+/**
+ * ICU-internal, non-virtual entry points for NFC and NFKC_Casefold.
+ * They call the Normalizer2Impl directly rather than through the Normalizer2 vtable,
+ * and they are inline so that the compiler can specialize them for each call site.
+ * With NORM2_HARDCODE_NFC_DATA and NORM2_HARDCODE_NFKC_CF_DATA,
+ * getting an instance never loads data.
+ *
+ * Only use an instance if the errorCode passed into forNFC() or forNFKC_CF()
+ * was a success code afterwards.
+ */
+class InlineComposer {
+public:
+    static InlineComposer forNFC(UErrorCode &errorCode) {
+        const Norm2AllModes *allModes=Norm2AllModes::getNFCInstance(errorCode);
+        return InlineComposer(allModes!=NULL ? allModes->impl : NULL);
+    }
+    static InlineComposer forNFKC_CF(UErrorCode &errorCode) {
+        const Norm2AllModes *allModes=Norm2AllModes::getNFKC_CFInstance(errorCode);
+        return InlineComposer(allModes!=NULL ? allModes->impl : NULL);
+    }
+
+    /** Same as ComposeNormalizer2::normalize(src, dest, errorCode). */
+    UnicodeString &normalize(const UnicodeString &src, UnicodeString &dest,
+                             UErrorCode &errorCode) const {
+        if(U_FAILURE(errorCode)) {
+            dest.setToBogus();
+            return dest;
+        }
+        const UChar *sArray=src.getBuffer();
+        if(&dest==&src || sArray==NULL) {
+            errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            dest.setToBogus();
+            return dest;
+        }
+        dest.remove();
+        ReorderingBuffer buffer(*impl, dest);
+        if(buffer.init(src.length(), errorCode)) {
+            impl->compose(sArray, sArray+src.length(), FALSE, TRUE, buffer, errorCode);
+        }
+        return dest;
+    }
+    /** Same as ComposeNormalizer2::normalizeUTF8() without options and Edits. */
+    void normalizeUTF8(StringPiece src, ByteSink &sink, UErrorCode &errorCode) const {
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        const uint8_t *s=reinterpret_cast<const uint8_t *>(src.data());
+        impl->composeUTF8(0, FALSE, s, s+src.length(), &sink, NULL, errorCode);
+        sink.Flush();
+    }
+    UBool isNormalized(const UnicodeString &s, UErrorCode &errorCode) const {
+        if(U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        const UChar *sArray=s.getBuffer();
+        if(sArray==NULL) {
+            errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return FALSE;
+        }
+        UnicodeString temp;
+        ReorderingBuffer buffer(*impl, temp);
+        if(!buffer.init(5, errorCode)) {  // small destCapacity for substring normalization
+            return FALSE;
+        }
+        return impl->compose(sArray, sArray+s.length(), FALSE, FALSE, buffer, errorCode);
+    }
+    UBool isNormalizedUTF8(StringPiece sp, UErrorCode &errorCode) const {
+        if(U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        const uint8_t *s=reinterpret_cast<const uint8_t *>(sp.data());
+        return impl->composeUTF8(0, FALSE, s, s+sp.length(), NULL, NULL, errorCode);
+    }
+    const UChar *spanQuickCheckYes(const UChar *src, const UChar *limit) const {
+        return impl->composeQuickCheck(src, limit, FALSE, NULL);
+    }
+    UNormalizationCheckResult getQuickCheck(UChar32 c) const {
+        return impl->getCompQuickCheck(impl->getNorm16(c));
+    }
+    UBool hasBoundaryBefore(UChar32 c) const { return impl->hasCompBoundaryBefore(c); }
+    UBool hasBoundaryAfter(UChar32 c) const { return impl->hasCompBoundaryAfter(c, FALSE); }
+
+    const Normalizer2Impl &getImpl() const { return *impl; }
+
+private:
+    InlineComposer(const Normalizer2Impl *ni) : impl(ni) {}
+
+    const Normalizer2Impl *impl;
+};
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
@@ -25,20 +25,34 @@
 #include "unicode/stringoptions.h"
 #include "unicode/unistr.h"
 #include "unicode/unorm.h"
+#include "unicode/ustring.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "norm2allmodes.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
+#include "umutex.h"
+#include "uparallel.h"
 
 using icu::Normalizer2Impl;
 
-#if NORM2_HARDCODE_NFC_DATA
-// NFC/NFD data machine-generated by gennorm2 --csource
+#if NORM2_HARDCODE_NFC_DATA || NORM2_HARDCODE_NFKC_CF_DATA
 #define INCLUDED_FROM_NORMALIZER2_CPP
+#endif
+#if NORM2_HARDCODE_NFC_DATA
+// NFC/NFD data machine-generated by gennorm2 --csource --canoniterdata
 #include "norm2_nfc_data.h"
 #endif
+#if NORM2_HARDCODE_NFKC_CF_DATA
+// NFKC_Casefold data machine-generated by gennorm2 --csource
+// from nfc.txt nfkc.txt nfkc_cf.txt
+#include "norm2_nfkc_cf_data.h"
+#endif
 
 U_NAMESPACE_BEGIN
 
@@ -80,6 +94,219 @@ Normalizer2::isNormalizedUTF8(StringPiece s, UErrorCode &errorCode) const {
     return U_SUCCESS(errorCode) && isNormalized(UnicodeString::fromUTF8(s), errorCode);
 }
 
+UnicodeString &
+Normalizer2::normalizeInPlace(UnicodeString &s, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return s;
+    }
+    if (s.isBogus()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return s;
+    }
+    int32_t length = s.length();
+    int32_t spanLength = spanQuickCheckYes(s, errorCode);
+    if (U_FAILURE(errorCode) || spanLength == length) {
+        return s;  // the common case: nothing to do
+    }
+    UChar *buffer = s.getBuffer(-1);
+    if (buffer == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return s;
+    }
+    // Text before dest is done; text from src onward has not been looked at yet.
+    // dest<=src as long as the normalized segments are not longer than the originals.
+    int32_t dest = spanLength, src = spanLength;
+    UnicodeString segment;
+    for (;;) {
+        // [src, segmentLimit[ is not normalized and ends before the next boundary.
+        int32_t segmentLimit = src;
+        UChar32 c;
+        U16_NEXT(buffer, segmentLimit, length, c);
+        while (segmentLimit < length) {
+            int32_t i = segmentLimit;
+            U16_NEXT(buffer, i, length, c);
+            if (hasBoundaryBefore(c)) {
+                break;
+            }
+            segmentLimit = i;
+        }
+        normalize(UnicodeString(FALSE, buffer + src, segmentLimit - src), segment, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        int32_t segmentLength = segment.length();
+        if (segmentLength > (segmentLimit - dest)) {
+            // The output would overtake the input.
+            // Normalize the rest of the text in one piece and append it.
+            UnicodeString rest;
+            normalize(UnicodeString(FALSE, buffer + src, length - src), rest, errorCode);
+            if (U_FAILURE(errorCode)) {
+                break;
+            }
+            s.releaseBuffer(dest);
+            return s.append(rest);
+        }
+        segment.extract(0, segmentLength, buffer + dest);
+        dest += segmentLength;
+        src = segmentLimit;
+        if (src == length) {
+            break;
+        }
+        spanLength = spanQuickCheckYes(
+            UnicodeString(FALSE, buffer + src, length - src), errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        if (dest != src) {
+            u_memmove(buffer + dest, buffer + src, spanLength);
+        }
+        dest += spanLength;
+        src += spanLength;
+        if (src == length) {
+            break;
+        }
+    }
+    s.releaseBuffer(dest);
+    if (U_FAILURE(errorCode)) {
+        s.setToBogus();
+    }
+    return s;
+}
+
+namespace {
+
+// Segment lengths for normalizeUTF8Parallel(), in bytes.
+// Shorter strings are normalized on the calling thread.
+const int32_t MIN_PARALLEL_SEGMENT_LENGTH = 0x10000;
+// Limits the amount of buffered output.
+const int32_t MAX_PARALLEL_SEGMENT_LENGTH = 0x400000;
+// More segments than threads balance the load when some segments take longer.
+const int32_t PARALLEL_SEGMENTS_PER_THREAD = 4;
+
+struct ParallelNormalizeContext {
+    const Normalizer2 *norm2;
+    const char *s;
+    const int32_t *segmentStarts;  // numSegments+1 indexes
+    CharString *outputs;
+    UErrorCode *errorCodes;
+    int32_t numSegments;
+    u_atomic_int32_t nextSegment;
+};
+
+void U_CALLCONV
+normalizeSegments(void *context, int32_t /*threadIndex*/) {
+    ParallelNormalizeContext &c = *static_cast<ParallelNormalizeContext *>(context);
+    int32_t i;
+    while ((i = umtx_atomic_inc(&c.nextSegment) - 1) < c.numSegments) {
+        CharStringByteSink sink(&c.outputs[i]);
+        int32_t start = c.segmentStarts[i];
+        c.norm2->normalizeUTF8(0, StringPiece(c.s + start, c.segmentStarts[i + 1] - start),
+                               sink, nullptr, c.errorCodes[i]);
+    }
+}
+
+/**
+ * Returns the start of the first well-formed character at or after start
+ * that has a normalization boundary before it; limit if there is none.
+ * The bytes before and after that position normalize independently.
+ */
+int32_t findBoundary(const Normalizer2 &norm2, const char *s, int32_t start, int32_t limit) {
+    while (start < limit && U8_IS_TRAIL(s[start])) {
+        ++start;
+    }
+    while (start < limit) {
+        int32_t i = start;
+        UChar32 c;
+        U8_NEXT(s, i, limit, c);
+        if (c >= 0 && norm2.hasBoundaryBefore(c)) {
+            break;
+        }
+        start = i;
+    }
+    return start;
+}
+
+}  // namespace
+
+void
+Normalizer2::normalizeUTF8Parallel(StringPiece src, ByteSink &sink, int32_t threadCount,
+                                   UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (threadCount < 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (threadCount == 0) {
+        threadCount = uprv_getDefaultThreadCount();
+    }
+    if (threadCount > UPRV_MAX_PARALLEL_THREADS) {
+        threadCount = UPRV_MAX_PARALLEL_THREADS;
+    }
+    const char *s = src.data();
+    int32_t length = src.length();
+    if (threadCount == 1 || length < 2 * MIN_PARALLEL_SEGMENT_LENGTH) {
+        normalizeUTF8(0, src, sink, nullptr, errorCode);
+        return;
+    }
+    int32_t maxSegments = threadCount * PARALLEL_SEGMENTS_PER_THREAD;
+    int32_t segmentLength = length / maxSegments;
+    if (segmentLength < MIN_PARALLEL_SEGMENT_LENGTH) {
+        segmentLength = MIN_PARALLEL_SEGMENT_LENGTH;
+    } else if (segmentLength > MAX_PARALLEL_SEGMENT_LENGTH) {
+        segmentLength = MAX_PARALLEL_SEGMENT_LENGTH;
+    }
+    LocalArray<CharString> outputs(new CharString[maxSegments], errorCode);
+    MaybeStackArray<int32_t, 33> segmentStarts;
+    MaybeStackArray<UErrorCode, 32> errorCodes;
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if ((maxSegments >= segmentStarts.getCapacity() &&
+                segmentStarts.resize(maxSegments + 1) == nullptr) ||
+            (maxSegments > errorCodes.getCapacity() && errorCodes.resize(maxSegments) == nullptr)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    ParallelNormalizeContext context;
+    context.norm2 = this;
+    context.s = s;
+    context.segmentStarts = segmentStarts.getAlias();
+    context.outputs = outputs.getAlias();
+    context.errorCodes = errorCodes.getAlias();
+    // Normalize up to maxSegments segments at a time.
+    int32_t start = 0;
+    while (start < length) {
+        int32_t numSegments = 0;
+        segmentStarts[0] = start;
+        while (numSegments < maxSegments && start < length) {
+            if ((length - start) <= segmentLength) {
+                start = length;
+            } else {
+                start = findBoundary(*this, s, start + segmentLength, length);
+            }
+            segmentStarts[++numSegments] = start;
+        }
+        for (int32_t i = 0; i < numSegments; ++i) {
+            outputs[i].clear();
+            errorCodes[i] = U_ZERO_ERROR;
+        }
+        context.numSegments = numSegments;
+        context.nextSegment = 0;
+        uprv_parallelRun(threadCount < numSegments ? threadCount : numSegments,
+                         normalizeSegments, &context);
+        for (int32_t i = 0; i < numSegments; ++i) {
+            if (U_FAILURE(errorCodes[i])) {
+                errorCode = errorCodes[i];
+                return;
+            }
+            sink.Append(outputs[i].data(), outputs[i].length());
+        }
+    }
+    sink.Flush();
+}
+
 // Normalizer2 implementation for the old UNORM_NONE.
 class NoopNormalizer2 : public Normalizer2 {
     virtual ~NoopNormalizer2();
@@ -240,6 +467,8 @@ Norm2AllModes::createNFCInstance(UErrorCode &errorCode) {
     }
     impl->init(norm2_nfc_data_indexes, &norm2_nfc_data_trie,
                norm2_nfc_data_extraData, norm2_nfc_data_smallFCD);
+    impl->setCanonIterData(&norm2_nfc_data_canonIter_trie, norm2_nfc_data_canonStartSets,
+                           UPRV_LENGTHOF(norm2_nfc_data_canonStartSets));
     return createInstance(impl, errorCode);
 }
 
@@ -288,6 +517,51 @@ Normalizer2Factory::getNFCImpl(UErrorCode &errorCode) {
 }
 #endif  // NORM2_HARDCODE_NFC_DATA
 
+#if NORM2_HARDCODE_NFKC_CF_DATA
+Norm2AllModes *
+Norm2AllModes::createNFKC_CFInstance(UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    Normalizer2Impl *impl=new Normalizer2Impl;
+    if(impl==NULL) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    impl->init(norm2_nfkc_cf_data_indexes, &norm2_nfkc_cf_data_trie,
+               norm2_nfkc_cf_data_extraData, norm2_nfkc_cf_data_smallFCD);
+    return createInstance(impl, errorCode);
+}
+
+static Norm2AllModes *nfkc_cfSingleton;
+
+static icu::UInitOnce nfkc_cfInitOnce = U_INITONCE_INITIALIZER;
+
+static void U_CALLCONV initNFKC_CFSingleton(UErrorCode &errorCode) {
+    nfkc_cfSingleton=Norm2AllModes::createNFKC_CFInstance(errorCode);
+    ucln_common_registerCleanup(UCLN_COMMON_NORMALIZER2, uprv_normalizer2_cleanup);
+}
+
+const Norm2AllModes *
+Norm2AllModes::getNFKC_CFInstance(UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return NULL; }
+    umtx_initOnce(nfkc_cfInitOnce, &initNFKC_CFSingleton, errorCode);
+    return nfkc_cfSingleton;
+}
+
+const Normalizer2 *
+Normalizer2::getNFKCCasefoldInstance(UErrorCode &errorCode) {
+    const Norm2AllModes *allModes=Norm2AllModes::getNFKC_CFInstance(errorCode);
+    return allModes!=NULL ? &allModes->comp : NULL;
+}
+
+const Normalizer2Impl *
+Normalizer2Factory::getNFKC_CFImpl(UErrorCode &errorCode) {
+    const Norm2AllModes *allModes=Norm2AllModes::getNFKC_CFInstance(errorCode);
+    return allModes!=NULL ? allModes->impl : NULL;
+}
+#endif  // NORM2_HARDCODE_NFKC_CF_DATA
+
 U_CDECL_BEGIN
 
 static UBool U_CALLCONV uprv_normalizer2_cleanup() {
@@ -298,6 +572,11 @@ static UBool U_CALLCONV uprv_normalizer2_cleanup() {
     delete nfcSingleton;
     nfcSingleton = NULL;
     nfcInitOnce.reset(); 
+#endif
+#if NORM2_HARDCODE_NFKC_CF_DATA
+    delete nfkc_cfSingleton;
+    nfkc_cfSingleton = NULL;
+    nfkc_cfInitOnce.reset();
 #endif
     return TRUE;
 }
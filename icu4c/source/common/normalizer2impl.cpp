@@ -29,6 +29,7 @@
 #include "unicode/ucptrie.h"
 #include "unicode/udata.h"
 #include "unicode/umutablecptrie.h"
+#include "unicode/uset.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
 #include "unicode/utf8.h"
@@ -62,6 +63,68 @@ inline uint8_t leadByteForCP(UChar32 c) {
     }
 }
 
+/*
+ * Fast-path pre-scans: Skip code units below a threshold eight bytes at a time.
+ * A byte or UTF-16 lane is below the threshold if the lane's top bit stays clear
+ * in the per-lane sum computed by hasUnitAbove(); the sum never carries into the next lane.
+ * This is portable and needs no compiler intrinsics.
+ */
+
+const uint64_t ONES8 = 0x0101010101010101ULL;
+const uint64_t ONES16 = 0x0001000100010001ULL;
+
+/**
+ * Returns nonzero if any of the lanes in w is greater than max,
+ * where each lane has width bits and high is the mask of their top bits.
+ */
+inline uint64_t hasUnitAbove(uint64_t w, uint32_t max, uint64_t ones, uint64_t high) {
+    uint64_t low = ~high;
+    uint32_t topBit = (uint32_t)(high / ones);  // 0x80 or 0x8000
+    if (max < topBit) {
+        return (((w & low) + ones * ((topBit - 1) - max)) | w) & high;
+    } else {
+        return ((w & low) + ones * ((topBit - 1) - (max - topBit))) & w & high;
+    }
+}
+
+/** Returns the first byte in [src, limit[ that is at least minByte, or limit. */
+inline const uint8_t *skipBytesBelow(const uint8_t *src, const uint8_t *limit, uint8_t minByte) {
+    if (minByte == 0) {
+        return src;
+    }
+    while ((limit - src) >= 8) {
+        uint64_t w;
+        uprv_memcpy(&w, src, 8);
+        if (hasUnitAbove(w, minByte - 1, ONES8, ONES8 << 7) != 0) {
+            break;
+        }
+        src += 8;
+    }
+    while (src != limit && *src < minByte) {
+        ++src;
+    }
+    return src;
+}
+
+/** Returns the first code unit in [src, limit[ that is at least minUnit, or limit. */
+inline const UChar *skipUnitsBelow(const UChar *src, const UChar *limit, UChar minUnit) {
+    if (minUnit == 0) {
+        return src;
+    }
+    while ((limit - src) >= 4) {
+        uint64_t w;
+        uprv_memcpy(&w, src, 8);
+        if (hasUnitAbove(w, minUnit - 1, ONES16, ONES16 << 15) != 0) {
+            break;
+        }
+        src += 4;
+    }
+    while (src != limit && *src < minUnit) {
+        ++src;
+    }
+    return src;
+}
+
 /**
  * Returns the code point from one single well-formed UTF-8 byte sequence
  * between cpStart and cpLimit.
@@ -418,9 +481,11 @@ struct CanonIterData : public UMemory {
     CanonIterData(UErrorCode &errorCode);
     ~CanonIterData();
     void addToStartSet(UChar32 origin, UChar32 decompLead, UErrorCode &errorCode);
+    void build(UErrorCode &errorCode);
     UMutableCPTrie *mutableTrie;
     UCPTrie *trie;
-    UVector canonStartSets;  // contains UnicodeSet *
+    UVector canonStartSets;  // contains UnicodeSet *, while building
+    UnicodeString serializedStartSets;  // canonStartSets after build()
 };
 
 Normalizer2Impl::~Normalizer2Impl() {
@@ -518,7 +583,7 @@ Normalizer2Impl::addCanonIterPropertyStarts(const USetAdder *sa, UErrorCode &err
     // Currently only used for the SEGMENT_STARTER property.
     UChar32 start = 0, end;
     uint32_t value;
-    while ((end = ucptrie_getRange(fCanonIterData->trie, start, UCPMAP_RANGE_NORMAL, 0,
+    while ((end = ucptrie_getRange(fCanonTrie, start, UCPMAP_RANGE_NORMAL, 0,
                                    segmentStarterMapper, nullptr, &value)) >= 0) {
         sa->add(sa->set, start);
         start = end + 1;
@@ -607,9 +672,9 @@ Normalizer2Impl::decompose(const UChar *src, const UChar *limit,
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
         for(prevSrc=src; src!=limit;) {
-            if( (c=*src)<minNoCP ||
-                isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if( (c=*src)<minNoCP ) {
+                src = skipUnitsBelow(src + 1, limit, (UChar)minNoCP);
+            } else if (isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else if(!U16_IS_LEAD(c)) {
                 break;
@@ -1340,9 +1405,9 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
                 }
                 return TRUE;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if( (c=*src)<minNoMaybeCP ) {
+                src = skipUnitsBelow(src + 1, limit, (UChar)minNoMaybeCP);
+            } else if (isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1601,9 +1666,9 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
             if(src==limit) {
                 return src;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if( (c=*src)<minNoMaybeCP ) {
+                src = skipUnitsBelow(src + 1, limit, (UChar)minNoMaybeCP);
+            } else if (isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1753,7 +1818,7 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
                 return TRUE;
             }
             if (*src < minNoMaybeLead) {
-                ++src;
+                src = skipBytesBelow(src + 1, limit, minNoMaybeLead);
             } else {
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
@@ -2165,8 +2230,8 @@ Normalizer2Impl::makeFCD(const UChar *src, const UChar *limit,
         // count code units with lccc==0
         for(prevSrc=src; src!=limit;) {
             if((c=*src)<minLcccCP) {
-                prevFCD16=~c;
-                ++src;
+                src=skipUnitsBelow(src+1, limit, (UChar)minLcccCP);
+                prevFCD16=~*(src-1);
             } else if(!singleLeadMightHaveNonZeroFCD16(c)) {
                 prevFCD16=0;
                 ++src;
@@ -2267,6 +2332,70 @@ Normalizer2Impl::makeFCD(const UChar *src, const UChar *limit,
     return src;
 }
 
+const uint8_t *
+Normalizer2Impl::spanFCDUTF8(const uint8_t *src, const uint8_t *limit) const {
+    // Tracks the last FCD-safe boundary, before lccc=0 or after properly-ordered tccc<=1,
+    // like makeFCD() does.
+    const uint8_t *const start=src;
+    const uint8_t *prevBoundary=src;
+    // Code points below minLcccCP have lccc=0.
+    // Since ccc(U+0300)!=0 they take at most two bytes.
+    uint8_t minLcccLead=leadByteForCP(minLcccCP);
+    // <0: The previous code point is below minLcccCP, and fetching its fcd16 value was deferred.
+    int32_t prevFCD16=0;
+    while(src!=limit) {
+        if(*src<minLcccLead) {
+            src=skipBytesBelow(src+1, limit, minLcccLead);
+            if(src==limit) {
+                break;
+            }
+            prevFCD16=-1;
+        }
+        const uint8_t *prevSrc=src;
+        uint16_t norm16;
+        UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+        if(norm16<=minYesNo) {
+            // No decomposition and ccc=0, or an ill-formed sequence: fcd16=0
+            prevBoundary=src;
+            prevFCD16=0;
+            continue;
+        }
+        uint16_t fcd16=getFCD16FromNormData(codePointFromValidUTF8(prevSrc, src));
+        uint8_t lccc=(uint8_t)(fcd16>>8);
+        if(lccc==0) {
+            prevBoundary=prevSrc;
+        } else {
+            if(prevFCD16<0) {
+                // Fetch the deferred fcd16 value of the code point before c.
+                // It was skipped, so it is a single byte or a two-byte sequence.
+                // Any other non-ASCII byte (a lone lead or trail byte) is ill-formed: U+FFFD.
+                const uint8_t *p=prevSrc-1;
+                UChar32 prev=*p;
+                if(U8_IS_TRAIL(prev)) {
+                    if(p!=start && 0xc2<=p[-1] && p[-1]<0xe0) {
+                        --p;
+                        prev=((*p&0x1f)<<6)|(prev&0x3f);
+                    } else {
+                        prev=0xfffd;
+                    }
+                } else if(prev>=0x80) {
+                    prev=0xfffd;
+                }
+                prevFCD16=getFCD16(prev);
+                prevBoundary= prevFCD16>1 ? p : prevSrc;
+            }
+            if((prevFCD16&0xff)>lccc) {
+                return prevBoundary;  // quick check "no"
+            }
+        }
+        if((fcd16&0xff)<=1) {
+            prevBoundary=src;
+        }
+        prevFCD16=fcd16;
+    }
+    return limit;
+}
+
 void Normalizer2Impl::makeFCDAndAppend(const UChar *src, const UChar *limit,
                                        UBool doMakeFCD,
                                        UnicodeString &safeMiddle,
@@ -2372,6 +2501,59 @@ void CanonIterData::addToStartSet(UChar32 origin, UChar32 decompLead, UErrorCode
     }
 }
 
+/**
+ * Serializes the start sets and builds the immutable trie.
+ * While building, a CANON_HAS_SET value contains the index of the set;
+ * in the built trie, it contains the offset of the serialized set.
+ */
+void CanonIterData::build(UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    MaybeStackArray<int32_t, 256> offsets;
+    if(canonStartSets.size() > offsets.getCapacity() &&
+            offsets.resize(canonStartSets.size()) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    MaybeStackArray<uint16_t, 256> buffer;
+    for(int32_t i = 0; i < canonStartSets.size(); ++i) {
+        const UnicodeSet &set = *(const UnicodeSet *)canonStartSets[i];
+        int32_t length = set.serialize(buffer.getAlias(), buffer.getCapacity(), errorCode);
+        if(errorCode == U_BUFFER_OVERFLOW_ERROR) {
+            errorCode = U_ZERO_ERROR;
+            if(buffer.resize(length) == nullptr) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            length = set.serialize(buffer.getAlias(), buffer.getCapacity(), errorCode);
+        }
+        if(U_FAILURE(errorCode)) { return; }
+        offsets[i] = serializedStartSets.length();
+        if(offsets[i] > (int32_t)CANON_VALUE_MASK) {
+            errorCode = U_BUFFER_OVERFLOW_ERROR;
+            return;
+        }
+        serializedStartSets.append(reinterpret_cast<const UChar *>(buffer.getAlias()), length);
+    }
+    canonStartSets.removeAllElements();
+    UChar32 start = 0, end;
+    uint32_t value;
+    while((end = umutablecptrie_getRange(mutableTrie, start, UCPMAP_RANGE_NORMAL, 0,
+                                         nullptr, nullptr, &value)) >= 0) {
+        if((value & CANON_HAS_SET) != 0) {
+            value = (value & ~CANON_VALUE_MASK) | (uint32_t)offsets[value & CANON_VALUE_MASK];
+            umutablecptrie_setRange(mutableTrie, start, end, value, &errorCode);
+        }
+        start = end + 1;
+    }
+#ifdef UCPTRIE_DEBUG
+    umutablecptrie_setName(mutableTrie, "CanonIterData");
+#endif
+    trie = umutablecptrie_buildImmutable(
+        mutableTrie, UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32, &errorCode);
+    umutablecptrie_close(mutableTrie);
+    mutableTrie = nullptr;
+}
+
 // C++ class for friend access to private Normalizer2Impl members.
 class InitCanonIterData {
 public:
@@ -2389,37 +2571,62 @@ initCanonIterData(Normalizer2Impl *impl, UErrorCode &errorCode) {
 U_CDECL_END
 
 void InitCanonIterData::doInit(Normalizer2Impl *impl, UErrorCode &errorCode) {
+    if (impl->fCanonTrie != NULL) {
+        return;  // precomputed data, see setCanonIterData()
+    }
     U_ASSERT(impl->fCanonIterData == NULL);
     impl->fCanonIterData = new CanonIterData(errorCode);
     if (impl->fCanonIterData == NULL) {
         errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
     }
+    impl->makeCanonIterData(*impl->fCanonIterData, errorCode);
     if (U_SUCCESS(errorCode)) {
-        UChar32 start = 0, end;
-        uint32_t value;
-        while ((end = ucptrie_getRange(impl->normTrie, start,
-                                       UCPMAP_RANGE_FIXED_LEAD_SURROGATES, Normalizer2Impl::INERT,
-                                       nullptr, nullptr, &value)) >= 0) {
-            // Call Normalizer2Impl::makeCanonIterDataFromNorm16() for a range of same-norm16 characters.
-            if (value != Normalizer2Impl::INERT) {
-                impl->makeCanonIterDataFromNorm16(start, end, value, *impl->fCanonIterData, errorCode);
-            }
-            start = end + 1;
-        }
-#ifdef UCPTRIE_DEBUG
-        umutablecptrie_setName(impl->fCanonIterData->mutableTrie, "CanonIterData");
-#endif
-        impl->fCanonIterData->trie = umutablecptrie_buildImmutable(
-            impl->fCanonIterData->mutableTrie, UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32, &errorCode);
-        umutablecptrie_close(impl->fCanonIterData->mutableTrie);
-        impl->fCanonIterData->mutableTrie = nullptr;
-    }
-    if (U_FAILURE(errorCode)) {
+        const CanonIterData &data = *impl->fCanonIterData;
+        impl->fCanonTrie = data.trie;
+        impl->fCanonStartSets = reinterpret_cast<const uint16_t *>(data.serializedStartSets.getBuffer());
+        impl->fCanonStartSetsLength = data.serializedStartSets.length();
+    } else {
         delete impl->fCanonIterData;
         impl->fCanonIterData = NULL;
     }
 }
 
+void Normalizer2Impl::makeCanonIterData(CanonIterData &newData, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) { return; }
+    UChar32 start = 0, end;
+    uint32_t value;
+    while ((end = ucptrie_getRange(normTrie, start,
+                                   UCPMAP_RANGE_FIXED_LEAD_SURROGATES, INERT,
+                                   nullptr, nullptr, &value)) >= 0) {
+        // Call makeCanonIterDataFromNorm16() for a range of same-norm16 characters.
+        if (value != INERT) {
+            makeCanonIterDataFromNorm16(start, end, value, newData, errorCode);
+        }
+        start = end + 1;
+    }
+    newData.build(errorCode);
+}
+
+void Normalizer2Impl::setCanonIterData(const UCPTrie *canonTrie,
+                                       const uint16_t *canonStartSets,
+                                       int32_t canonStartSetsLength) {
+    fCanonTrie = canonTrie;
+    fCanonStartSets = canonStartSets;
+    fCanonStartSetsLength = canonStartSetsLength;
+}
+
+UCPTrie *Normalizer2Impl::buildCanonIterData(UnicodeString &canonStartSets,
+                                             UErrorCode &errorCode) const {
+    CanonIterData newData(errorCode);
+    makeCanonIterData(newData, errorCode);
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    canonStartSets = newData.serializedStartSets;
+    UCPTrie *trie = newData.trie;
+    newData.trie = nullptr;
+    return trie;
+}
+
 void Normalizer2Impl::makeCanonIterDataFromNorm16(UChar32 start, UChar32 end, const uint16_t norm16,
                                                   CanonIterData &newData,
                                                   UErrorCode &errorCode) const {
@@ -2505,11 +2712,7 @@ UBool Normalizer2Impl::ensureCanonIterData(UErrorCode &errorCode) const {
 }
 
 int32_t Normalizer2Impl::getCanonValue(UChar32 c) const {
-    return (int32_t)ucptrie_get(fCanonIterData->trie, c);
-}
-
-const UnicodeSet &Normalizer2Impl::getCanonStartSet(int32_t n) const {
-    return *(const UnicodeSet *)fCanonIterData->canonStartSets[n];
+    return (int32_t)ucptrie_get(fCanonTrie, c);
 }
 
 UBool Normalizer2Impl::isCanonSegmentStarter(UChar32 c) const {
@@ -2524,7 +2727,16 @@ UBool Normalizer2Impl::getCanonStartSet(UChar32 c, UnicodeSet &set) const {
     set.clear();
     int32_t value=canonValue&CANON_VALUE_MASK;
     if((canonValue&CANON_HAS_SET)!=0) {
-        set.addAll(getCanonStartSet(value));
+        // Read the serialized set in place.
+        USerializedSet startSet;
+        if(uset_getSerializedSet(&startSet, fCanonStartSets+value, fCanonStartSetsLength-value)) {
+            int32_t count=uset_getSerializedRangeCount(&startSet);
+            for(int32_t i=0; i<count; ++i) {
+                UChar32 start, end;
+                uset_getSerializedRange(&startSet, i, &start, &end);
+                set.add(start, end);
+            }
+        }
     } else if(value!=0) {
         set.add(value);
     }
@@ -2648,7 +2860,18 @@ unorm2_swap(const UDataSwapper *ds,
         offset=nextOffset;
 
         /* no need to swap the uint8_t smallFCD[] (new in formatVersion 2) */
-        nextOffset=indexes[Normalizer2Impl::IX_SMALL_FCD_OFFSET+1];
+        nextOffset=indexes[Normalizer2Impl::IX_CANON_TRIE_OFFSET];
+        offset=nextOffset;
+
+        /* swap the optional CanonicalIterator trie and uint16_t canonStartSets[] */
+        nextOffset=indexes[Normalizer2Impl::IX_CANON_START_SETS_OFFSET];
+        if(offset<nextOffset) {
+            utrie_swapAnyVersion(ds, inBytes+offset, nextOffset-offset, outBytes+offset, pErrorCode);
+        }
+        offset=nextOffset;
+
+        nextOffset=indexes[Normalizer2Impl::IX_RESERVED5_OFFSET];
+        ds->swapArray16(ds, inBytes+offset, nextOffset-offset, outBytes+offset, pErrorCode);
         offset=nextOffset;
 
         U_ASSERT(offset==size);
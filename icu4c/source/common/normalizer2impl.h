@@ -39,6 +39,11 @@
 // Add nfc.nrm to icu4c/source/data/Makefile.in DAT_FILES_SHORT
 #define NORM2_HARDCODE_NFC_DATA 1
 
+// Same for the nfkc_cf.nrm data, which is used for NFKC_Casefold
+// and for the Changes_When_NFKC_Casefolded and NFKC_Casefold properties.
+// When it is not hardcoded, then nfkc_cf.nrm needs to remain in DAT_FILES_SHORT.
+#define NORM2_HARDCODE_NFKC_CF_DATA 1
+
 U_NAMESPACE_BEGIN
 
 struct CanonIterData;
@@ -245,13 +250,30 @@ class U_COMMON_API ReorderingBuffer : public UMemory {
  */
 class U_COMMON_API Normalizer2Impl : public UObject {
 public:
-    Normalizer2Impl() : normTrie(NULL), fCanonIterData(NULL) {
+    Normalizer2Impl() : normTrie(NULL), fCanonIterData(NULL),
+                        fCanonTrie(NULL), fCanonStartSets(NULL), fCanonStartSetsLength(0) {
         fCanonIterDataInitOnce.reset();
     }
     virtual ~Normalizer2Impl();
 
     void init(const int32_t *inIndexes, const UCPTrie *inTrie,
               const uint16_t *inExtraData, const uint8_t *inSmallFCD);
+    /**
+     * Sets precomputed CanonicalIterator data, as written by gennorm2,
+     * so that ensureCanonIterData() need not build it.
+     * Must be called right after init(), before the object is shared.
+     * The data must remain valid as long as this object.
+     */
+    void setCanonIterData(const UCPTrie *canonTrie,
+                          const uint16_t *canonStartSets, int32_t canonStartSetsLength);
+    /**
+     * Builds the CanonicalIterator data from the normalization data,
+     * in the form that setCanonIterData() takes.
+     * Used by gennorm2 for precomputing it.
+     * @param canonStartSets receives the serialized canonical start sets
+     * @return the canonical iterator trie; the caller must ucptrie_close() it
+     */
+    UCPTrie *buildCanonIterData(UnicodeString &canonStartSets, UErrorCode &errorCode) const;
 
     void addLcccChars(UnicodeSet &set) const;
     void addPropertyStarts(const USetAdder *sa, UErrorCode &errorCode) const;
@@ -420,8 +442,8 @@ class U_COMMON_API Normalizer2Impl : public UObject {
         IX_NORM_TRIE_OFFSET,
         IX_EXTRA_DATA_OFFSET,
         IX_SMALL_FCD_OFFSET,
-        IX_RESERVED3_OFFSET,
-        IX_RESERVED4_OFFSET,
+        IX_CANON_TRIE_OFFSET,
+        IX_CANON_START_SETS_OFFSET,
         IX_RESERVED5_OFFSET,
         IX_RESERVED6_OFFSET,
         IX_TOTAL_SIZE,
@@ -518,6 +540,13 @@ class U_COMMON_API Normalizer2Impl : public UObject {
                           UnicodeString &safeMiddle,
                           ReorderingBuffer &buffer,
                           UErrorCode &errorCode) const;
+    /**
+     * UTF-8 version of makeFCD(src, limit, NULL, errorCode):
+     * Returns the end of the FCD prefix of [src, limit[,
+     * which is limit if the whole string passes the FCD check.
+     * Ill-formed sequences are treated like U+FFFD.
+     */
+    const uint8_t *spanFCDUTF8(const uint8_t *src, const uint8_t *limit) const;
 
     UBool hasDecompBoundaryBefore(UChar32 c) const;
     UBool norm16HasDecompBoundaryBefore(uint16_t norm16) const;
@@ -692,11 +721,11 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     const UChar *findPreviousFCDBoundary(const UChar *start, const UChar *p) const;
     const UChar *findNextFCDBoundary(const UChar *p, const UChar *limit) const;
 
+    void makeCanonIterData(CanonIterData &newData, UErrorCode &errorCode) const;
     void makeCanonIterDataFromNorm16(UChar32 start, UChar32 end, const uint16_t norm16,
                                      CanonIterData &newData, UErrorCode &errorCode) const;
 
     int32_t getCanonValue(UChar32 c) const;
-    const UnicodeSet &getCanonStartSet(int32_t n) const;
 
     // UVersionInfo dataVersion;
 
@@ -722,13 +751,16 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     const uint8_t *smallFCD;  // [0x100] one bit per 32 BMP code points, set if any FCD!=0
 
     UInitOnce       fCanonIterDataInitOnce;
-    CanonIterData  *fCanonIterData;
+    CanonIterData  *fCanonIterData;  // built at runtime if not precomputed
+    const UCPTrie  *fCanonTrie;
+    const uint16_t *fCanonStartSets;  // serialized UnicodeSets
+    int32_t         fCanonStartSetsLength;
 };
 
 // bits in canonIterData
 #define CANON_NOT_SEGMENT_STARTER 0x80000000
 #define CANON_HAS_COMPOSITIONS 0x40000000
-#define CANON_HAS_SET 0x200000
+#define CANON_HAS_SET 0x200000  // the value is an offset into the canonStartSets
 #define CANON_VALUE_MASK 0x1fffff
 
 /**
@@ -900,6 +932,23 @@ unorm_getFCD16(UChar32 c);
  *
  *      This bit set is most useful for the large blocks of CJK characters with FCD=0.
  *
+ * The following two parts are optional (new in ICU 64, still format version 4).
+ * If they are empty, then the CanonicalIterator data is built at runtime when first needed.
+ * gennorm2 --canoniterdata writes them. Readers that do not know them ignore them.
+ *
+ * UCPTrie canonTrie; -- see CANON_NOT_SEGMENT_STARTER etc.
+ *
+ *      This is a UCPTrie of type small and with 32-bit values, 4-aligned.
+ *      Each value has the CANON_... flag bits.
+ *      The CANON_VALUE_MASK bits contain either the one code point whose canonical
+ *      decomposition starts with this one, or, with CANON_HAS_SET,
+ *      the offset of a serialized UnicodeSet with all such code points
+ *      in the canonStartSets[].
+ *
+ * uint16_t canonStartSets[];
+ *
+ *      Concatenated UnicodeSet::serialize() forms of the canonical start sets.
+ *
  * Changes from format version 1 to format version 2 ---------------------------
  *
  * - Addition of data for raw (not recursively decomposed) mappings.
@@ -0,0 +1,241 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// normstream.cpp
+// created: 2018oct22
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/normstream.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "charstr.h"
+#include "cmemory.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+const int32_t MIN_MAX_PENDING_LENGTH = 32;
+
+/**
+ * Returns the length of an incomplete but so far well-formed UTF-8 sequence
+ * at the end of s, if any. The following chunk may complete it.
+ */
+int32_t incompleteUTF8TailLength(const char *s, int32_t length) {
+    for(int32_t i = 1; i <= 3 && i <= length; ++i) {
+        uint8_t b = (uint8_t)s[length - i];
+        if(U8_IS_TRAIL(b)) { continue; }
+        if(U8_IS_LEAD(b) && i <= U8_COUNT_TRAIL_BYTES(b)) {
+            return i;
+        }
+        break;
+    }
+    return 0;
+}
+
+/**
+ * Normalizes and writes all of the pending text except for a character
+ * that the following chunk may complete.
+ * Called when the pending text exceeds the length limit.
+ */
+void flushPending(const Normalizer2 &norm2, UnicodeString &pending,
+                  UnicodeString &normalized, UnicodeString &dest, UErrorCode &errorCode) {
+    int32_t flushLength = pending.length();
+    if(U16_IS_LEAD(pending.charAt(flushLength - 1))) {
+        --flushLength;
+    }
+    dest.append(norm2.normalize(pending.tempSubString(0, flushLength), normalized, errorCode));
+    pending.remove(0, flushLength);
+}
+
+void flushPendingUTF8(const Normalizer2 &norm2, CharString &pending,
+                      ByteSink &sink, UErrorCode &errorCode) {
+    int32_t tailLength = incompleteUTF8TailLength(pending.data(), pending.length());
+    int32_t flushLength = pending.length() - tailLength;
+    norm2.normalizeUTF8(0, StringPiece(pending.data(), flushLength), sink, NULL, errorCode);
+    uprv_memmove(pending.data(), pending.data() + flushLength, tailLength);
+    pending.truncate(tailLength);
+}
+
+/**
+ * Surrogate code points in the middle of a stream are usually
+ * halves of pairs that are split across chunks.
+ */
+inline UBool isBoundary(const Normalizer2 &norm2, UChar32 c) {
+    return c >= 0 && !U_IS_SURROGATE(c) && norm2.hasBoundaryBefore(c);
+}
+
+}  // namespace
+
+StreamingNormalizer::StreamingNormalizer(const Normalizer2 &n2, int32_t maxPendingLength)
+        : norm2(n2),
+          maxPending(maxPendingLength > MIN_MAX_PENDING_LENGTH ?
+                     maxPendingLength : MIN_MAX_PENDING_LENGTH),
+          pending8(NULL) {}
+
+StreamingNormalizer::~StreamingNormalizer() {
+    delete pending8;
+}
+
+void StreamingNormalizer::reset() {
+    pending.remove();
+    if(pending8 != NULL) {
+        pending8->clear();
+    }
+}
+
+int32_t StreamingNormalizer::getPendingLength() const {
+    if(!pending.isEmpty()) {
+        return pending.length();
+    }
+    return pending8 != NULL ? pending8->length() : 0;
+}
+
+UnicodeString &
+StreamingNormalizer::normalizeChunk(const UnicodeString &chunk, UnicodeString &dest,
+                                    UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return dest; }
+    if(pending8 != NULL && !pending8->isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return dest;
+    }
+    const UChar *s = chunk.getBuffer();
+    int32_t length = chunk.length();
+    if(s == NULL) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return dest;
+    }
+    // Find the first and last boundaries in the chunk.
+    // Only the text before the first one needs to be normalized together with
+    // the pending text. The text from the last one on is held back.
+    int32_t first = 0;
+    UChar32 c;
+    for(;;) {
+        if(first == length) {
+            // No boundary: Everything is pending.
+            pending.append(chunk);
+            if(pending.length() > maxPending) {
+                flushPending(norm2, pending, normalized, dest, errorCode);
+            }
+            return dest;
+        }
+        int32_t start = first;
+        U16_NEXT(s, first, length, c);
+        if(isBoundary(norm2, c)) {
+            first = start;
+            break;
+        }
+    }
+    int32_t last = length;
+    for(;;) {
+        U16_PREV(s, first, last, c);
+        if(last == first || isBoundary(norm2, c)) { break; }
+    }
+    if(!pending.isEmpty() || first > 0) {
+        pending.append(s, 0, first);
+        dest.append(norm2.normalize(pending, normalized, errorCode));
+    }
+    if(first < last) {
+        dest.append(norm2.normalize(chunk.tempSubString(first, last - first),
+                                    normalized, errorCode));
+    }
+    pending.setTo(chunk, last);
+    if(pending.length() > maxPending) {
+        flushPending(norm2, pending, normalized, dest, errorCode);
+    }
+    return dest;
+}
+
+UnicodeString &
+StreamingNormalizer::finish(UnicodeString &dest, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return dest; }
+    if(pending8 != NULL && !pending8->isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return dest;
+    }
+    if(!pending.isEmpty()) {
+        dest.append(norm2.normalize(pending, normalized, errorCode));
+        pending.remove();
+    }
+    return dest;
+}
+
+void
+StreamingNormalizer::normalizeChunkUTF8(StringPiece chunk, ByteSink &sink,
+                                        UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    if(!pending.isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return;
+    }
+    if(pending8 == NULL) {
+        pending8 = new CharString();
+        if(pending8 == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    const char *s = chunk.data();
+    int32_t length = chunk.length();
+    // Same as for UTF-16, except that only well-formed characters count:
+    // Ill-formed sequences include the trail bytes of a character that
+    // started in the previous chunk.
+    int32_t first = 0;
+    UChar32 c;
+    for(;;) {
+        if(first == length) {
+            pending8->append(s, length, errorCode);
+            if(U_SUCCESS(errorCode) && pending8->length() > maxPending) {
+                flushPendingUTF8(norm2, *pending8, sink, errorCode);
+            }
+            return;
+        }
+        int32_t start = first;
+        U8_NEXT(s, first, length, c);
+        if(isBoundary(norm2, c)) {
+            first = start;
+            break;
+        }
+    }
+    int32_t last = length;
+    for(;;) {
+        U8_PREV(s, first, last, c);
+        if(last == first || isBoundary(norm2, c)) { break; }
+    }
+    if(!pending8->isEmpty() || first > 0) {
+        pending8->append(s, first, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, NULL, errorCode);
+    }
+    if(first < last) {
+        norm2.normalizeUTF8(0, StringPiece(s + first, last - first), sink, NULL, errorCode);
+    }
+    pending8->clear().append(s + last, length - last, errorCode);
+    if(U_SUCCESS(errorCode) && pending8->length() > maxPending) {
+        flushPendingUTF8(norm2, *pending8, sink, errorCode);
+    }
+}
+
+void
+StreamingNormalizer::finishUTF8(ByteSink &sink, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    if(!pending.isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return;
+    }
+    if(pending8 != NULL && !pending8->isEmpty()) {
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, NULL, errorCode);
+        pending8->clear();
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -337,6 +337,25 @@ uprv_getRawUTCtime()
 #endif
 }
 
+/* Return a monotonic time in milliseconds, for measuring durations.*/
+U_CAPI double U_EXPORT2
+uprv_getMonotonicMillis()
+{
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    LARGE_INTEGER counter, frequency;
+    if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
+        return (double)counter.QuadPart * U_MILLIS_PER_SECOND / (double)frequency.QuadPart;
+    }
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec monotonicTime;
+    if (clock_gettime(CLOCK_MONOTONIC, &monotonicTime) == 0) {
+        return (double)monotonicTime.tv_sec * U_MILLIS_PER_SECOND +
+            (double)monotonicTime.tv_nsec / 1000000.0;
+    }
+#endif
+    return uprv_getRawUTCtime();
+}
+
 /*-----------------------------------------------------------------------------
   IEEE 754
   These methods detect and return NaN and infinity values for doubles
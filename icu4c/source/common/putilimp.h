@@ -514,6 +514,16 @@ U_INTERNAL UDate U_EXPORT2 uprv_getUTCtime(void);
  */
 U_INTERNAL UDate U_EXPORT2 uprv_getRawUTCtime(void);
 
+/**
+ * Get a monotonic time in milliseconds, with sub-millisecond precision where
+ * the platform provides it. The value is unrelated to the calendar time;
+ * only differences between two calls are meaningful.
+ * Falls back to uprv_getRawUTCtime() on platforms without a monotonic clock.
+ * @return a monotonic time measured in milliseconds
+ * @internal
+ */
+U_INTERNAL double U_EXPORT2 uprv_getMonotonicMillis(void);
+
 /**
  * Determine whether a pathname is absolute or not, as defined by the platform.
  * @param path Pathname to test
@@ -40,6 +40,10 @@
 #include "ucnv_imp.h"
 #include "ucnv_cnv.h"
 #include "ucnv_bld.h"
+#include "ucnvmbcs.h"
+#include "udatamem.h"
+#include "umutex.h"
+#include "uparallel.h"
 
 /* size of intermediate and preflighting buffers in ucnv_convert() */
 #define CHUNK_SIZE 1024
@@ -393,6 +397,70 @@ ucnv_close (UConverter * converter)
     UTRACE_EXIT();
 }
 
+static int32_t
+getSharedDataMappedBytes(const UConverterSharedData *sharedData) {
+    int32_t length;
+
+    if(sharedData->dataMemory==NULL) {
+        return 0;
+    }
+    length=udata_getLength((const UDataMemory *)sharedData->dataMemory);
+    return length>0 ? length : 0;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_getMemoryUsage(const UConverter *cnv, UConverterMemoryUsage *pUsage, UErrorCode *pErrorCode) {
+    const UConverterSharedData *sharedData;
+    int32_t size;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if(cnv==NULL || pUsage==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    sharedData=cnv->sharedData;
+
+    /* the safeClone() size covers the UConverter and its extraInfo */
+    pUsage->instanceHeapBytes=0;
+    if(!cnv->isCopyLocal) {
+        pUsage->instanceHeapBytes+=(int32_t)sizeof(UConverter);
+    }
+    if(cnv->extraInfo!=NULL && !cnv->isExtraLocal && sharedData->impl->safeClone!=NULL) {
+        size=0;
+        sharedData->impl->safeClone(cnv, NULL, &size, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return;
+        }
+        if(size>(int32_t)sizeof(UConverter)) {
+            pUsage->instanceHeapBytes+=size-(int32_t)sizeof(UConverter);
+        }
+    }
+    if(cnv->subChars!=(uint8_t *)cnv->subUChars) {
+        pUsage->instanceHeapBytes+=UCNV_ERROR_BUFFER_LENGTH*U_SIZEOF_UCHAR;
+    }
+
+    /* algorithmic converters use static shared data */
+    pUsage->sharedHeapBytes=0;
+    pUsage->mappedBytes=getSharedDataMappedBytes(sharedData);
+    if(sharedData->isReferenceCounted) {
+        pUsage->sharedHeapBytes+=(int32_t)sizeof(UConverterSharedData);
+    }
+    switch(sharedData->staticData->conversionType) {
+    case UCNV_SBCS:
+    case UCNV_DBCS:
+    case UCNV_MBCS:
+        pUsage->sharedHeapBytes+=ucnv_MBCSGetSharedHeapSize(sharedData);
+        if(sharedData->mbcs.baseSharedData!=NULL) {
+            pUsage->mappedBytes+=getSharedDataMappedBytes(sharedData->mbcs.baseSharedData);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
 /*returns a single Name from the list, will return NULL if out of bounds
  */
 U_CAPI const char*   U_EXPORT2
@@ -1711,6 +1779,155 @@ ucnv_toUnicode(UConverter *cnv,
     *target=args.target;
 }
 
+/* ucnv_to/fromUnicodeSegments() ------------------------------------------- */
+
+static UBool
+isValidSegmentPosition(const UConverterSegment *segments, int32_t count,
+                       const int32_t *pIndex, const int32_t *pOffset) {
+    if(count<0 || (segments==NULL && count>0) || pIndex==NULL || pOffset==NULL) {
+        return FALSE;
+    }
+    int32_t index=*pIndex;
+    if(index<0 || index>count || *pOffset<0) {
+        return FALSE;
+    }
+    if(index==count) {
+        return *pOffset==0;
+    }
+    if(*pOffset>segments[index].length) {
+        return FALSE;
+    }
+    for(; index<count; ++index) {
+        if(segments[index].length<0 || (segments[index].start==NULL && segments[index].length>0)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/*
+ * Calls the streaming conversion function once per pair of source and target segments.
+ * The converter carries partial characters across segments as usual:
+ * Partial input sequences in its toUBytes/preFromU state and
+ * partial output in its overflow buffers.
+ * The flush flag is set only for the last source segment.
+ *
+ * When all target segments are full, then the conversion function is called
+ * with an empty target range so that it reports a U_BUFFER_OVERFLOW_ERROR
+ * if and only if there is more output.
+ */
+template<typename S, typename T>
+static void
+convertSegments(UConverter *cnv,
+                void (U_EXPORT2 *convert)(UConverter *, T **, const T *, const S **, const S *,
+                                          int32_t *, UBool, UErrorCode *),
+                const UConverterSegment *targets, int32_t targetCount,
+                int32_t *pTargetIndex, int32_t *pTargetOffset,
+                const UConverterSegment *sources, int32_t sourceCount,
+                int32_t *pSourceIndex, int32_t *pSourceOffset,
+                UBool flush,
+                UErrorCode *err) {
+    if(err==NULL || U_FAILURE(*err)) {
+        return;
+    }
+    if( cnv==NULL ||
+        !isValidSegmentPosition(targets, targetCount, pTargetIndex, pTargetOffset) ||
+        !isValidSegmentPosition(sources, sourceCount, pSourceIndex, pSourceOffset)
+    ) {
+        *err=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    int32_t targetIndex=*pTargetIndex, targetOffset=*pTargetOffset;
+    int32_t sourceIndex=*pSourceIndex, sourceOffset=*pSourceOffset;
+    T emptyTarget[1];
+    S emptySource[1]={ 0 };
+    for(;;) {
+        /* skip full target segments */
+        while(targetIndex<targetCount && targetOffset==targets[targetIndex].length) {
+            ++targetIndex;
+            targetOffset=0;
+        }
+        /* skip consumed source segments but not the last one, for flushing */
+        while(sourceIndex<(sourceCount-1) && sourceOffset==sources[sourceIndex].length) {
+            ++sourceIndex;
+            sourceOffset=0;
+        }
+        UBool isLastSource=(UBool)(sourceIndex>=(sourceCount-1));
+
+        T *t, *targetLimit;
+        if(targetIndex<targetCount) {
+            t=(T *)targets[targetIndex].start+targetOffset;
+            targetLimit=(T *)targets[targetIndex].start+targets[targetIndex].length;
+        } else {
+            t=targetLimit=emptyTarget;
+        }
+        const S *s, *sourceLimit;
+        if(sourceIndex<sourceCount) {
+            s=(const S *)sources[sourceIndex].start+sourceOffset;
+            sourceLimit=(const S *)sources[sourceIndex].start+sources[sourceIndex].length;
+        } else {
+            s=sourceLimit=emptySource;
+        }
+
+        T *t0=t;
+        const S *s0=s;
+        convert(cnv, &t, targetLimit, &s, sourceLimit, NULL, (UBool)(flush && isLastSource), err);
+        if(targetIndex<targetCount) {
+            targetOffset+=(int32_t)(t-t0);
+        }
+        if(sourceIndex<sourceCount) {
+            sourceOffset+=(int32_t)(s-s0);
+        }
+
+        if(*err==U_BUFFER_OVERFLOW_ERROR) {
+            if(targetIndex<targetCount) {
+                /* this target segment is full, continue with the next one */
+                *err=U_ZERO_ERROR;
+                continue;
+            }
+            break;  /* all target segments are full */
+        }
+        if(U_FAILURE(*err) || isLastSource) {
+            break;
+        }
+        /* this source segment is consumed, continue with the next one */
+    }
+
+    *pTargetIndex=targetIndex;
+    *pTargetOffset=targetOffset;
+    *pSourceIndex=sourceIndex;
+    *pSourceOffset=sourceOffset;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_fromUnicodeSegments(UConverter *cnv,
+                         const UConverterSegment *targets, int32_t targetCount,
+                         int32_t *pTargetIndex, int32_t *pTargetOffset,
+                         const UConverterSegment *sources, int32_t sourceCount,
+                         int32_t *pSourceIndex, int32_t *pSourceOffset,
+                         UBool flush,
+                         UErrorCode *err) {
+    convertSegments<UChar, char>(cnv, ucnv_fromUnicode,
+                                 targets, targetCount, pTargetIndex, pTargetOffset,
+                                 sources, sourceCount, pSourceIndex, pSourceOffset,
+                                 flush, err);
+}
+
+U_CAPI void U_EXPORT2
+ucnv_toUnicodeSegments(UConverter *cnv,
+                       const UConverterSegment *targets, int32_t targetCount,
+                       int32_t *pTargetIndex, int32_t *pTargetOffset,
+                       const UConverterSegment *sources, int32_t sourceCount,
+                       int32_t *pSourceIndex, int32_t *pSourceOffset,
+                       UBool flush,
+                       UErrorCode *err) {
+    convertSegments<char, UChar>(cnv, ucnv_toUnicode,
+                                 targets, targetCount, pTargetIndex, pTargetOffset,
+                                 sources, sourceCount, pSourceIndex, pSourceOffset,
+                                 flush, err);
+}
+
 /* ucnv_to/fromUChars() ----------------------------------------------------- */
 
 U_CAPI int32_t U_EXPORT2
@@ -1827,6 +2044,524 @@ ucnv_toUChars(UConverter *cnv,
     return u_terminateUChars(originalDest, destCapacity, destLength, pErrorCode);
 }
 
+/* converter descriptors ---------------------------------------------------- */
+
+/*
+ * A descriptor holds a converter in its initial state which is never modified.
+ * Each conversion works on a private copy of it.
+ *
+ * If the converter has no extraInfo and no separately allocated subChars,
+ * then a plain struct copy on the stack is a complete, independent converter
+ * that does not own anything: It need not (and must not) be closed,
+ * and the descriptor holds the only reference to the shared data.
+ * Otherwise each conversion uses a ucnv_safeClone().
+ */
+struct UConverterDescriptor {
+    UConverter prototype;
+    UBool isCopyable;
+    /* where parallel conversion may split the input, see initDescriptorSplits() */
+    int8_t toUSplit, fromUSplit;
+    UBool isToUSplitByte[256];
+};
+
+/* How the input of a parallel conversion can be split. */
+enum {
+    SPLIT_NONE,         /* stateful: never */
+    SPLIT_ANY,          /* between any two units */
+    SPLIT_CODE_POINTS,  /* UTF-16 input: not inside a surrogate pair */
+    SPLIT_UTF8,         /* before a byte that is not a UTF-8 trail byte */
+    SPLIT_UTF16BE,      /* at an even index, not inside a surrogate pair */
+    SPLIT_UTF16LE,
+    SPLIT_UTF32,        /* at a multiple of 4 */
+    SPLIT_BYTES         /* after a byte with isToUSplitByte[b] */
+};
+
+static void
+initDescriptorSplits(UConverterDescriptor *descriptor) {
+    const UConverter *cnv=&descriptor->prototype;
+    int8_t toUSplit=SPLIT_NONE, fromUSplit=SPLIT_NONE;
+    uprv_memset(descriptor->isToUSplitByte, 0, sizeof(descriptor->isToUSplitByte));
+    switch(ucnv_getType(cnv)) {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    case UCNV_SBCS:
+    case UCNV_DBCS:
+    case UCNV_MBCS:
+        if(ucnv_MBCSGetToUSplitBytes(cnv->sharedData, descriptor->isToUSplitByte)) {
+            toUSplit=SPLIT_BYTES;
+        }
+        if(ucnv_MBCSCanSplitFromUnicode(cnv->sharedData)) {
+            fromUSplit=SPLIT_CODE_POINTS;
+        }
+        break;
+#endif
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+        toUSplit=SPLIT_ANY;
+        fromUSplit=SPLIT_CODE_POINTS;
+        break;
+    case UCNV_UTF8:
+        toUSplit=SPLIT_UTF8;
+        fromUSplit=SPLIT_CODE_POINTS;
+        break;
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+        if(UCNV_GET_VERSION(cnv)==0) {  /* version 1 handles a BOM */
+            toUSplit= ucnv_getType(cnv)==UCNV_UTF16_BigEndian ? SPLIT_UTF16BE : SPLIT_UTF16LE;
+            fromUSplit=SPLIT_CODE_POINTS;
+        }
+        break;
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        toUSplit=SPLIT_UTF32;
+        fromUSplit=SPLIT_CODE_POINTS;
+        break;
+    default:
+        break;
+    }
+    descriptor->toUSplit=toUSplit;
+    descriptor->fromUSplit=fromUSplit;
+}
+
+U_CAPI UConverterDescriptor * U_EXPORT2
+ucnv_openDescriptor(const char *converterName, UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    UConverterDescriptor *descriptor=
+        (UConverterDescriptor *)uprv_malloc(sizeof(UConverterDescriptor));
+    if(descriptor==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if(ucnv_createConverter(&descriptor->prototype, converterName, pErrorCode)==NULL) {
+        uprv_free(descriptor);
+        return NULL;
+    }
+    const UConverter *cnv=&descriptor->prototype;
+    descriptor->isCopyable=
+        cnv->extraInfo==NULL &&
+        cnv->subChars==(uint8_t *)cnv->subUChars &&
+        cnv->sharedData->impl->safeClone==NULL &&
+        cnv->sharedData->impl->close==NULL;
+    initDescriptorSplits(descriptor);
+    return descriptor;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_closeDescriptor(UConverterDescriptor *descriptor) {
+    if(descriptor!=NULL) {
+        ucnv_close(&descriptor->prototype);  /* isCopyLocal: does not free the struct */
+        uprv_free(descriptor);
+    }
+}
+
+/*
+ * Returns a private converter for one conversion, either cnv itself (a copy of the prototype)
+ * or a clone which must be closed by the caller.
+ */
+static UConverter *
+getDescriptorConverter(const UConverterDescriptor *descriptor, UConverter *cnv,
+                       UErrorCode *pErrorCode) {
+    if(descriptor->isCopyable) {
+        uprv_memcpy(cnv, &descriptor->prototype, sizeof(UConverter));
+        cnv->subChars=(uint8_t *)cnv->subUChars;
+        return cnv;
+    } else {
+        UErrorCode cloneErrorCode=U_ZERO_ERROR;
+        UConverter *clone=ucnv_safeClone(&descriptor->prototype, NULL, NULL, &cloneErrorCode);
+        if(U_FAILURE(cloneErrorCode)) {
+            *pErrorCode=cloneErrorCode;
+        }
+        return clone;
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_descriptorFromUChars(const UConverterDescriptor *descriptor,
+                          char *dest, int32_t destCapacity,
+                          const UChar *src, int32_t srcLength,
+                          UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(descriptor==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UConverter stackCnv;
+    UConverter *cnv=getDescriptorConverter(descriptor, &stackCnv, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    int32_t length=ucnv_fromUChars(cnv, dest, destCapacity, src, srcLength, pErrorCode);
+    if(cnv!=&stackCnv) {
+        ucnv_close(cnv);
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_descriptorToUChars(const UConverterDescriptor *descriptor,
+                        UChar *dest, int32_t destCapacity,
+                        const char *src, int32_t srcLength,
+                        UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(descriptor==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UConverter stackCnv;
+    UConverter *cnv=getDescriptorConverter(descriptor, &stackCnv, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    int32_t length=ucnv_toUChars(cnv, dest, destCapacity, src, srcLength, pErrorCode);
+    if(cnv!=&stackCnv) {
+        ucnv_close(cnv);
+    }
+    return length;
+}
+
+/* ucnv_descriptorTo/FromUCharsParallel() ---------------------------------- */
+
+/* Chunk lengths for parallel conversion, in source units. */
+/* Shorter strings are converted on the calling thread. */
+#define MIN_PARALLEL_CHUNK_LENGTH 0x10000
+/* Limits the amount of buffered output. */
+#define MAX_PARALLEL_CHUNK_LENGTH 0x400000
+/* More chunks than threads balance the load when some chunks take longer. */
+#define PARALLEL_CHUNKS_PER_THREAD 4
+
+/* One piece of the input and its converted output. */
+struct ParallelChunk {
+    int32_t start, limit;
+    void *output;
+    int32_t *offsets;
+    int32_t length, capacity;
+    UErrorCode errorCode;
+};
+
+struct ParallelConversion {
+    const UConverterDescriptor *descriptor;
+    const void *src;
+    ParallelChunk *chunks;
+    int32_t numChunks;
+    UBool withOffsets;
+    icu::u_atomic_int32_t nextChunk;
+};
+
+/*
+ * Returns the first index at or after start, and at least 1,
+ * where the conversion of src can be split; limit if there is none.
+ */
+static int32_t
+findSplit(const UConverterDescriptor *descriptor, const char *src, int32_t start, int32_t limit) {
+    if(start==0) {
+        ++start;
+    }
+    switch(descriptor->toUSplit) {
+    case SPLIT_ANY:
+        break;
+    case SPLIT_UTF8:
+        while(start<limit && U8_IS_TRAIL(src[start])) {
+            ++start;
+        }
+        break;
+    case SPLIT_UTF16BE:
+    case SPLIT_UTF16LE: {
+        /* the high byte of the previous unit must not be that of a lead surrogate */
+        int32_t high= descriptor->toUSplit==SPLIT_UTF16BE ? 2 : 1;
+        start=(start+1)&~1;
+        while(start<limit && (src[start-high]&0xfc)==0xd8) {
+            start+=2;
+        }
+        break;
+    }
+    case SPLIT_UTF32:
+        start=(start+3)&~3;
+        break;
+    case SPLIT_BYTES:
+        while(start<limit && !descriptor->isToUSplitByte[(uint8_t)src[start-1]]) {
+            ++start;
+        }
+        break;
+    default:
+        start=limit;
+        break;
+    }
+    return start<limit ? start : limit;
+}
+
+static int32_t
+findSplit(const UConverterDescriptor *descriptor, const UChar *src, int32_t start, int32_t limit) {
+    if(start==0) {
+        ++start;
+    }
+    if(descriptor->fromUSplit==SPLIT_NONE) {
+        start=limit;
+    } else if(start<limit && U16_IS_TRAIL(src[start]) && U16_IS_LEAD(src[start-1])) {
+        ++start;
+    }
+    return start<limit ? start : limit;
+}
+
+/* The initial output capacity for a chunk; it grows if that is not enough. */
+static inline int32_t
+getChunkCapacity(const UConverter *, const char *, int32_t length) {
+    return length+16;
+}
+
+static inline int32_t
+getChunkCapacity(const UConverter *cnv, const UChar *, int32_t length) {
+    return UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(cnv));
+}
+
+/*
+ * Converts chunks until there are none left.
+ * Each chunk is converted from scratch into a buffer that is large enough for
+ * the whole chunk, so that the offsets are complete and relative to the chunk start.
+ */
+template<typename S, typename T>
+static void
+convertChunks(ParallelConversion &c,
+              void (U_EXPORT2 *convert)(UConverter *, T **, const T *, const S **, const S *,
+                                        int32_t *, UBool, UErrorCode *)) {
+    const S *src=(const S *)c.src;
+    UConverter stackCnv;
+    UConverter *cnv=NULL;
+    int32_t i;
+    while((i=icu::umtx_atomic_inc(&c.nextChunk)-1)<c.numChunks) {
+        ParallelChunk &chunk=c.chunks[i];
+        if(cnv==NULL) {
+            cnv=getDescriptorConverter(c.descriptor, &stackCnv, &chunk.errorCode);
+            if(U_FAILURE(chunk.errorCode)) {
+                cnv=NULL;
+                continue;
+            }
+        }
+        int32_t capacity=getChunkCapacity(cnv, src, chunk.limit-chunk.start);
+        for(;;) {
+            if(capacity>chunk.capacity) {
+                uprv_free(chunk.output);
+                uprv_free(chunk.offsets);
+                chunk.output=uprv_malloc((size_t)capacity*sizeof(T));
+                chunk.offsets= c.withOffsets ? (int32_t *)uprv_malloc((size_t)capacity*4) : NULL;
+                if(chunk.output==NULL || (c.withOffsets && chunk.offsets==NULL)) {
+                    chunk.capacity=0;
+                    chunk.errorCode=U_MEMORY_ALLOCATION_ERROR;
+                    break;
+                }
+                chunk.capacity=capacity;
+            }
+            T *t=(T *)chunk.output;
+            const S *s=src+chunk.start;
+            ucnv_reset(cnv);
+            convert(cnv, &t, t+capacity, &s, src+chunk.limit, chunk.offsets, TRUE, &chunk.errorCode);
+            if(chunk.errorCode==U_BUFFER_OVERFLOW_ERROR && capacity<=0x3fffffff/(int32_t)sizeof(T)) {
+                chunk.errorCode=U_ZERO_ERROR;
+                capacity*=2;
+                continue;
+            }
+            chunk.length=(int32_t)(t-(T *)chunk.output);
+            break;
+        }
+    }
+    if(cnv!=NULL && cnv!=&stackCnv) {
+        ucnv_close(cnv);
+    }
+}
+
+static void U_CALLCONV
+fromUnicodeChunks(void *context, int32_t /*threadIndex*/) {
+    convertChunks<UChar, char>(*(ParallelConversion *)context, ucnv_fromUnicode);
+}
+
+static void U_CALLCONV
+toUnicodeChunks(void *context, int32_t /*threadIndex*/) {
+    convertChunks<char, UChar>(*(ParallelConversion *)context, ucnv_toUnicode);
+}
+
+static inline int32_t
+getStringLength(const char *s) {
+    return (int32_t)uprv_strlen(s);
+}
+
+static inline int32_t
+getStringLength(const UChar *s) {
+    return u_strlen(s);
+}
+
+static inline int32_t
+terminateString(char *dest, int32_t destCapacity, int32_t length, UErrorCode *pErrorCode) {
+    return u_terminateChars(dest, destCapacity, length, pErrorCode);
+}
+
+static inline int32_t
+terminateString(UChar *dest, int32_t destCapacity, int32_t length, UErrorCode *pErrorCode) {
+    return u_terminateUChars(dest, destCapacity, length, pErrorCode);
+}
+
+template<typename S, typename T>
+static int32_t
+convertParallel(const UConverterDescriptor *descriptor,
+                T *dest, int32_t destCapacity,
+                const S *src, int32_t srcLength,
+                int32_t *offsets, int32_t threadCount,
+                void (U_EXPORT2 *convert)(UConverter *, T **, const T *, const S **, const S *,
+                                          int32_t *, UBool, UErrorCode *),
+                UParallelTask *convertChunksTask,
+                UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( descriptor==NULL || threadCount<0 ||
+        destCapacity<0 || (destCapacity>0 && dest==NULL) ||
+        srcLength<-1 || (srcLength!=0 && src==NULL)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(srcLength==-1) {
+        srcLength=getStringLength(src);
+    }
+    if(threadCount==0) {
+        threadCount=uprv_getDefaultThreadCount();
+    }
+    if(threadCount>UPRV_MAX_PARALLEL_THREADS) {
+        threadCount=UPRV_MAX_PARALLEL_THREADS;
+    }
+
+    int32_t maxChunks=threadCount*PARALLEL_CHUNKS_PER_THREAD;
+    int32_t chunkLength=srcLength/maxChunks;
+    if(chunkLength<MIN_PARALLEL_CHUNK_LENGTH) {
+        chunkLength=MIN_PARALLEL_CHUNK_LENGTH;
+    } else if(chunkLength>MAX_PARALLEL_CHUNK_LENGTH) {
+        chunkLength=MAX_PARALLEL_CHUNK_LENGTH;
+    }
+    if( threadCount==1 || srcLength<2*MIN_PARALLEL_CHUNK_LENGTH ||
+        findSplit(descriptor, src, chunkLength, srcLength)==srcLength
+    ) {
+        /* one piece: convert directly into dest, then count the rest */
+        UConverter stackCnv;
+        UConverter *cnv=getDescriptorConverter(descriptor, &stackCnv, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return 0;
+        }
+        T *t=dest;
+        const S *s=src;
+        convert(cnv, &t, dest+destCapacity, &s, src+srcLength, offsets, TRUE, pErrorCode);
+        int32_t length=(int32_t)(t-dest);
+        if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+            T buffer[1024];
+            do {
+                *pErrorCode=U_ZERO_ERROR;
+                t=buffer;
+                convert(cnv, &t, buffer+UPRV_LENGTHOF(buffer), &s, src+srcLength, NULL, TRUE, pErrorCode);
+                length+=(int32_t)(t-buffer);
+            } while(*pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+        }
+        if(cnv!=&stackCnv) {
+            ucnv_close(cnv);
+        }
+        return terminateString(dest, destCapacity, length, pErrorCode);
+    }
+
+    ParallelChunk *chunks=(ParallelChunk *)uprv_malloc(maxChunks*sizeof(ParallelChunk));
+    if(chunks==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    uprv_memset(chunks, 0, maxChunks*sizeof(ParallelChunk));
+    ParallelConversion context;
+    context.descriptor=descriptor;
+    context.src=src;
+    context.chunks=chunks;
+    context.withOffsets=(UBool)(offsets!=NULL && destCapacity>0);
+
+    /* Convert up to maxChunks chunks at a time. */
+    int32_t start=0, length=0;
+    while(start<srcLength && U_SUCCESS(*pErrorCode)) {
+        int32_t numChunks=0;
+        while(numChunks<maxChunks && start<srcLength) {
+            ParallelChunk &chunk=chunks[numChunks++];
+            chunk.start=start;
+            if((srcLength-start)<=chunkLength) {
+                start=srcLength;
+            } else {
+                start=findSplit(descriptor, src, start+chunkLength, srcLength);
+            }
+            chunk.limit=start;
+            chunk.errorCode=U_ZERO_ERROR;
+        }
+        context.numChunks=numChunks;
+        context.nextChunk=0;
+        uprv_parallelRun(threadCount<numChunks ? threadCount : numChunks,
+                         convertChunksTask, &context);
+
+        for(int32_t i=0; i<numChunks; ++i) {
+            const ParallelChunk &chunk=chunks[i];
+            if(U_FAILURE(chunk.errorCode)) {
+                *pErrorCode=chunk.errorCode;
+                break;
+            }
+            if(chunk.length>(0x7fffffff-length)) {
+                *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+                break;
+            }
+            /* copy as much as fits, and count the rest */
+            int32_t copyLength=destCapacity-length;
+            if(copyLength>chunk.length) {
+                copyLength=chunk.length;
+            }
+            if(copyLength>0) {
+                uprv_memcpy(dest+length, chunk.output, (size_t)copyLength*sizeof(T));
+                if(offsets!=NULL) {
+                    int32_t *destOffsets=offsets+length;
+                    for(int32_t j=0; j<copyLength; ++j) {
+                        int32_t offset=chunk.offsets[j];
+                        destOffsets[j]= offset>=0 ? offset+chunk.start : offset;
+                    }
+                }
+            }
+            length+=chunk.length;
+        }
+    }
+
+    for(int32_t i=0; i<maxChunks; ++i) {
+        uprv_free(chunks[i].output);
+        uprv_free(chunks[i].offsets);
+    }
+    uprv_free(chunks);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    return terminateString(dest, destCapacity, length, pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_descriptorFromUCharsParallel(const UConverterDescriptor *descriptor,
+                                  char *dest, int32_t destCapacity,
+                                  const UChar *src, int32_t srcLength,
+                                  int32_t *offsets, int32_t threadCount,
+                                  UErrorCode *pErrorCode) {
+    return convertParallel<UChar, char>(descriptor, dest, destCapacity, src, srcLength,
+                                        offsets, threadCount,
+                                        ucnv_fromUnicode, fromUnicodeChunks, pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_descriptorToUCharsParallel(const UConverterDescriptor *descriptor,
+                                UChar *dest, int32_t destCapacity,
+                                const char *src, int32_t srcLength,
+                                int32_t *offsets, int32_t threadCount,
+                                UErrorCode *pErrorCode) {
+    return convertParallel<char, UChar>(descriptor, dest, destCapacity, src, srcLength,
+                                        offsets, threadCount,
+                                        ucnv_toUnicode, toUnicodeChunks, pErrorCode);
+}
+
 /* ucnv_getNextUChar() ------------------------------------------------------ */
 
 U_CAPI UChar32 U_EXPORT2
@@ -1140,4 +1140,53 @@ ucnv_extGetUnicodeSet(const UConverterSharedData *sharedData,
     }
 }
 
+/* safe split points for parallel conversion -------------------------------- */
+
+U_CFUNC void
+ucnv_extGetToUContinuationBytes(const int32_t *cx, UBool isContinuation[256]) {
+    const uint32_t *toUSection, *toUTableLimit;
+    int32_t length;
+
+    if(cx==NULL || cx[UCNV_EXT_TO_U_LENGTH]<=0) {
+        return;
+    }
+    toUSection=UCNV_EXT_ARRAY(cx, UCNV_EXT_TO_U_INDEX, uint32_t);
+    toUTableLimit=toUSection+cx[UCNV_EXT_TO_U_LENGTH];
+
+    /*
+     * The sections are stored one after the other, each with a header word
+     * that contains the number of its entries.
+     * Skip the first section which is for the initial byte.
+     */
+    toUSection+=1+UCNV_EXT_TO_U_GET_BYTE(*toUSection);
+    while(toUSection<toUTableLimit) {
+        length=(int32_t)UCNV_EXT_TO_U_GET_BYTE(*toUSection++);
+        for(; length>0 && toUSection<toUTableLimit; --length) {
+            uint32_t word=*toUSection++;
+            if(UCNV_EXT_TO_U_GET_VALUE(word)!=0) {
+                isContinuation[UCNV_EXT_TO_U_GET_BYTE(word)]=TRUE;
+            }
+        }
+    }
+}
+
+U_CFUNC UBool
+ucnv_extHasFromUSequences(const int32_t *cx) {
+    const uint32_t *stage3b;
+    int32_t i, length;
+
+    if(cx==NULL) {
+        return FALSE;
+    }
+    stage3b=UCNV_EXT_ARRAY(cx, UCNV_EXT_FROM_U_STAGE_3B_INDEX, uint32_t);
+    length=cx[UCNV_EXT_FROM_U_STAGE_3B_LENGTH];
+    for(i=0; i<length; ++i) {
+        uint32_t value=stage3b[i];
+        if(value!=0 && UCNV_EXT_FROM_U_IS_PARTIAL(value)) {
+            return TRUE;  /* some mappings continue after this code point */
+        }
+    }
+    return FALSE;
+}
+
 #endif /* #if !UCONFIG_NO_LEGACY_CONVERSION */
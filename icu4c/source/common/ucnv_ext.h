@@ -404,6 +404,24 @@ ucnv_extGetUnicodeSet(const UConverterSharedData *sharedData,
                       UConverterSetFilter filter,
                       UErrorCode *pErrorCode);
 
+/*
+ * Sets isContinuation[b]=TRUE for each byte b that occurs after the first byte
+ * of an extension toUnicode mapping. Other bytes are left unchanged.
+ * A toUnicode extension match never continues past a byte that is not
+ * a continuation byte.
+ * Used for finding safe split points for parallel conversion.
+ */
+U_CFUNC void
+ucnv_extGetToUContinuationBytes(const int32_t *cx, UBool isContinuation[256]);
+
+/*
+ * Returns TRUE if some extension fromUnicode mappings have inputs
+ * of more than one code point.
+ * Used for finding safe split points for parallel conversion.
+ */
+U_CFUNC UBool
+ucnv_extHasFromUSequences(const int32_t *cx);
+
 /* toUnicode helpers -------------------------------------------------------- */
 
 #define UCNV_EXT_TO_U_BYTE_SHIFT 24
@@ -25,6 +25,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "ustr_imp.h"
 
 #define MAXIMUM_UCS2            0x0000FFFF
 #define MAXIMUM_UTF             0x0010FFFF
@@ -41,6 +42,79 @@ enum {
     UCNV_NEED_TO_WRITE_BOM=1
 };
 
+/* UTF-8 <-> platform-endian UTF-32 --------------------------------------- */
+
+/*
+ * Direct conversion between UTF-8 and the UTF-32 form with the platform byte order,
+ * using the bulk transcoding kernels on aligned UChar32 units.
+ * Anything else falls back to pivoting with U_USING_DEFAULT_WARNING:
+ * Misaligned buffers, partial sequences kept in either converter,
+ * ill-formed input (for callback handling) and characters that do not fit
+ * into the remaining target buffer.
+ */
+U_CDECL_BEGIN
+static void U_CALLCONV
+ucnv_UTF32PlatformFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                           UConverterToUnicodeArgs *pToUArgs,
+                           UErrorCode *pErrorCode) {
+    const uint8_t *source=(const uint8_t *)pToUArgs->source;
+    const uint8_t *sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    char *target=pFromUArgs->target;
+
+    if( pToUArgs->converter->toULength>0 || pFromUArgs->converter->fromUChar32!=0 ||
+        (((uintptr_t)target)&3)!=0
+    ) {
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    UChar32 *t=(UChar32 *)target;
+    UChar32 *targetLimit=t+(pFromUArgs->targetLimit-target)/4;
+    uprv_transcodeUTF8ToUTF32(&source, sourceLimit, &t, targetLimit);
+
+    if(source<sourceLimit) {
+        if(t==targetLimit && (char *)t==pFromUArgs->targetLimit) {
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        } else {
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+        }
+    }
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)t;
+}
+
+static void U_CALLCONV
+ucnv_UTF32PlatformToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                         UConverterToUnicodeArgs *pToUArgs,
+                         UErrorCode *pErrorCode) {
+    const char *source=pToUArgs->source;
+    uint8_t *target=(uint8_t *)pFromUArgs->target;
+    const uint8_t *targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    if( pToUArgs->converter->toULength>0 || pFromUArgs->converter->fromUChar32!=0 ||
+        (((uintptr_t)source)&3)!=0
+    ) {
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    const UChar32 *s=(const UChar32 *)source;
+    const UChar32 *sourceLimit=s+(pToUArgs->sourceLimit-source)/4;
+    uprv_transcodeUTF32ToUTF8(&s, sourceLimit, &target, targetLimit);
+
+    if((const char *)s<pToUArgs->sourceLimit) {
+        if(s<sourceLimit && target==targetLimit) {
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        } else {
+            /* ill-formed, too long for the target, or a partial code unit */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+        }
+    }
+    pToUArgs->source=(const char *)s;
+    pFromUArgs->target=(char *)target;
+}
+U_CDECL_END
+
 /* UTF-32BE ----------------------------------------------------------------- */
 U_CDECL_BEGIN
 static void U_CALLCONV
@@ -484,8 +558,13 @@ static const UConverterImpl _UTF32BEImpl = {
     NULL,
     ucnv_getNonSurrogateUnicodeSet,
 
+#if U_IS_BIG_ENDIAN
+    ucnv_UTF32PlatformToUTF8,
+    ucnv_UTF32PlatformFromUTF8
+#else
     NULL,
     NULL
+#endif
 };
 
 /* The 1232 CCSID refers to any version of Unicode with any endianess of UTF-32 */
@@ -979,8 +1058,13 @@ static const UConverterImpl _UTF32LEImpl = {
     NULL,
     ucnv_getNonSurrogateUnicodeSet,
 
+#if U_IS_BIG_ENDIAN
     NULL,
     NULL
+#else
+    ucnv_UTF32PlatformToUTF8,
+    ucnv_UTF32PlatformFromUTF8
+#endif
 };
 
 /* The 1232 CCSID refers to any version of Unicode with any endianess of UTF-32 */
@@ -90,6 +90,15 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8 (UConverterToUnicodeArgs * args,
 
     while (mySource < sourceLimit && myTarget < targetLimit)
     {
+        if (!isCESU8)
+        {
+            /* Bulk-convert well-formed text, up to an error, a truncated sequence or a too-long character. */
+            uprv_transcodeUTF8ToUTF16(&mySource, sourceLimit, &myTarget, targetLimit);
+            if (mySource >= sourceLimit || myTarget >= targetLimit)
+            {
+                break;
+            }
+        }
         ch = *(mySource++);
         if (U8_IS_SINGLE(ch))        /* Simple case */
         {
@@ -320,6 +329,15 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8 (UConverterFromUnicodeArgs * args
 
     while (mySource < sourceLimit && myTarget < targetLimit)
     {
+        if (isNotCESU8)
+        {
+            /* Bulk-convert well-formed text, up to an unpaired surrogate or a too-long character. */
+            uprv_transcodeUTF16ToUTF8(&mySource, sourceLimit, &myTarget, targetLimit);
+            if (mySource >= sourceLimit || myTarget >= targetLimit)
+            {
+                break;
+            }
+        }
         ch = *(mySource++);
 
         if (ch < 0x80)        /* Single byte */
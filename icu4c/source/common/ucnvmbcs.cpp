@@ -65,6 +65,118 @@
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
 #define MBCS_UNROLL_SINGLE_FROM_BMP 0
 
+/*
+ * ASCII fast paths:
+ * In ASCII-based codepages, runs of ASCII bytes map 1:1 to U+0000..U+007F and back,
+ * except for the few mbcs.asciiExceptions[] (like 5c and 7e in Shift-JIS).
+ * These helpers test 8 bytes or 4 UChars per 64-bit word and copy
+ * whole words without table lookups.
+ * The caller continues with the regular per-character code at the first word
+ * that contains a non-ASCII unit or an exception.
+ */
+
+#define MBCS_ONES8 0x0101010101010101ULL
+#define MBCS_HIGHS8 0x8080808080808080ULL
+#define MBCS_ONES16 0x0001000100010001ULL
+#define MBCS_HIGHS16 0x8000800080008000ULL
+#define MBCS_NON_ASCII16 0xff80ff80ff80ff80ULL
+
+/*
+ * @param w a word with only ASCII units
+ * @return TRUE if none of the units of w is one of the exceptions
+ */
+static inline UBool
+hasNoASCIIExceptions(uint64_t w, uint64_t ones, uint64_t highs,
+                     const uint8_t *exceptions, int32_t countExceptions) {
+    uint64_t found=0;
+    for(int32_t i=0; i<countExceptions; ++i) {
+        /* is there a zero unit in x? */
+        uint64_t x=w^(ones*exceptions[i]);
+        found|=(x-ones)&~x;
+    }
+    return (found&highs)==0;
+}
+
+/*
+ * Converts the initial ASCII bytes of [source, source+length[ in units of 8 bytes.
+ * @return the number of bytes converted, a multiple of 8
+ */
+static inline int32_t
+asciiBytesToUnicode(const uint8_t *source, UChar *target, int32_t length,
+                    const uint8_t *exceptions, int32_t countExceptions) {
+    const uint8_t *s=source;
+    const uint8_t *limit=source+(length&~7);
+    while(s<limit) {
+        uint64_t w;
+        uprv_memcpy(&w, s, 8);
+        if((w&MBCS_HIGHS8)!=0 ||
+                !hasNoASCIIExceptions(w, MBCS_ONES8, MBCS_HIGHS8, exceptions, countExceptions)) {
+            break;
+        }
+        target[0]=s[0];
+        target[1]=s[1];
+        target[2]=s[2];
+        target[3]=s[3];
+        target[4]=s[4];
+        target[5]=s[5];
+        target[6]=s[6];
+        target[7]=s[7];
+        s+=8;
+        target+=8;
+    }
+    return (int32_t)(s-source);
+}
+
+/*
+ * Converts the initial ASCII UChars of [source, source+length[ in units of 4 UChars.
+ * @return the number of UChars converted, a multiple of 4
+ */
+static inline int32_t
+asciiUnicodeToBytes(const UChar *source, uint8_t *target, int32_t length,
+                    const uint8_t *exceptions, int32_t countExceptions) {
+    const UChar *s=source;
+    const UChar *limit=source+(length&~3);
+    while(s<limit) {
+        uint64_t w;
+        uprv_memcpy(&w, s, 8);
+        if((w&MBCS_NON_ASCII16)!=0 ||
+                !hasNoASCIIExceptions(w, MBCS_ONES16, MBCS_HIGHS16, exceptions, countExceptions)) {
+            break;
+        }
+        target[0]=(uint8_t)s[0];
+        target[1]=(uint8_t)s[1];
+        target[2]=(uint8_t)s[2];
+        target[3]=(uint8_t)s[3];
+        s+=4;
+        target+=4;
+    }
+    return (int32_t)(s-source);
+}
+
+/*
+ * Copies the initial ASCII bytes of [source, source+length[ in units of 8 bytes,
+ * for conversion between UTF-8 and a codepage.
+ * @return the number of bytes copied, a multiple of 8
+ */
+static inline int32_t
+asciiBytesToBytes(const uint8_t *source, uint8_t *target, int32_t length,
+                  const uint8_t *exceptions, int32_t countExceptions) {
+    const uint8_t *s=source;
+    const uint8_t *limit=source+(length&~7);
+    while(s<limit) {
+        uint64_t w;
+        uprv_memcpy(&w, s, 8);
+        if((w&MBCS_HIGHS8)!=0 ||
+                !hasNoASCIIExceptions(w, MBCS_ONES8, MBCS_HIGHS8, exceptions, countExceptions)) {
+            break;
+        }
+        uprv_memcpy(target, &w, 8);
+        s+=8;
+        target+=8;
+    }
+    return (int32_t)(s-source);
+}
+
 /*
  * _MBCSHeader versions 5.3 & 4.3
  * (Note that the _MBCSHeader version is in addition to the converter formatVersion.)
@@ -406,6 +518,63 @@ static const char* U_CALLCONV
 ucnv_MBCSGetName(const UConverter *cnv);
 U_CDECL_END
 
+U_CFUNC UBool
+ucnv_MBCSGetToUSplitBytes(const UConverterSharedData *sharedData, UBool isSplitByte[256]) {
+    const UConverterMBCSTable *mbcsTable=&sharedData->mbcs;
+    const int32_t (*stateTable)[256]=mbcsTable->stateTable;
+    UBool isContinuation[256];
+    UBool hasSplitBytes=FALSE;
+    int32_t b, state;
+
+    uprv_memset(isSplitByte, 0, 256);
+    if((mbcsTable->outputType&0xff)==MBCS_OUTPUT_2_SISO || mbcsTable->dbcsOnlyState!=0) {
+        return FALSE;   /* stateful */
+    }
+    uprv_memset(isContinuation, 0, 256);
+    ucnv_extGetToUContinuationBytes(mbcsTable->extIndexes, isContinuation);
+
+    for(b=0; b<256; ++b) {
+        /*
+         * The byte must be an assigned single-byte character in the initial state,
+         * so that it does not start an extension match, and it must not
+         * continue any extension match.
+         */
+        int32_t entry=stateTable[0][b];
+        if( isContinuation[b] || MBCS_ENTRY_IS_TRANSITION(entry) ||
+            MBCS_ENTRY_FINAL_STATE(entry)!=0 ||
+            MBCS_ENTRY_FINAL_ACTION(entry)>MBCS_STATE_FALLBACK_DIRECT_20
+        ) {
+            continue;
+        }
+        /*
+         * The byte must be illegal in all other states.
+         * Then it ends any illegal sequence before it and is converted
+         * from the initial state, see the ticket 5691 code in
+         * ucnv_MBCSToUnicodeWithOffsets().
+         */
+        for(state=1; state<mbcsTable->countStates; ++state) {
+            entry=stateTable[state][b];
+            if( MBCS_ENTRY_IS_TRANSITION(entry) ||
+                MBCS_ENTRY_FINAL_STATE(entry)!=0 ||
+                MBCS_ENTRY_FINAL_ACTION(entry)!=MBCS_STATE_ILLEGAL
+            ) {
+                break;
+            }
+        }
+        if(state==mbcsTable->countStates) {
+            isSplitByte[b]=hasSplitBytes=TRUE;
+        }
+    }
+    return hasSplitBytes;
+}
+
+U_CFUNC UBool
+ucnv_MBCSCanSplitFromUnicode(const UConverterSharedData *sharedData) {
+    return (UBool)(
+        (sharedData->mbcs.outputType&0xff)!=MBCS_OUTPUT_2_SISO &&
+        !ucnv_extHasFromUSequences(sharedData->mbcs.extIndexes));
+}
+
 static void U_CALLCONV
 ucnv_MBCSWriteSub(UConverterFromUnicodeArgs *pArgs,
               int32_t offsetIndex,
@@ -431,6 +600,16 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode);
+
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +632,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,7 +658,7 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
@@ -504,8 +683,9 @@ static const UConverterImpl _MBCSImpl={
     ucnv_MBCSWriteSub,
     NULL,
     ucnv_MBCSGetUnicodeSet,
-    NULL,
-    NULL
+
+    ucnv_MBCSToUTF8,
+    ucnv_MBCSFromUTF8
 };
 
 /* Static data is in tools/makeconv/ucnvstat.c for data-based
@@ -563,6 +743,13 @@ gb18030Ranges[14][4]={
 #define _MBCS_OPTION_JEF  0x02000
 #define _MBCS_OPTION_JIPS 0x04000
 
+/*
+ * bit flags for UConverter.options indicating that this converter has already
+ * seen the lazily built swaplfnl toUnicode state table resp. fromUnicode results
+ */
+#define _MBCS_OPTION_SWAP_LFNL_TO_U   0x10000
+#define _MBCS_OPTION_SWAP_LFNL_FROM_U 0x20000
+
 #define KEIS_SO_CHAR_1 0x0A
 #define KEIS_SO_CHAR_2 0x42
 #define KEIS_SI_CHAR_1 0x0A
@@ -1261,13 +1448,9 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
     const uint16_t *table, *results;
     const uint8_t *bytes;
 
-    int32_t (*newStateTable)[256];
-    uint16_t *newResults;
-    uint8_t *p;
     char *name;
 
     uint32_t stage2Entry;
-    uint32_t size, sizeofFromUBytes;
 
     mbcsTable=&sharedData->mbcs;
 
@@ -1314,14 +1497,10 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
         }
     }
 
-    if(mbcsTable->fromUBytesLength>0) {
+    if(mbcsTable->fromUBytesLength==0) {
         /*
          * We _know_ the number of bytes in the fromUnicodeBytes array
          * starting with header.version 4.1.
-         */
-        sizeofFromUBytes=mbcsTable->fromUBytesLength;
-    } else {
-        /*
          * Otherwise:
          * There used to be code to enumerate the fromUnicode
          * trie and find the highest entry, but it was removed in ICU 3.2
@@ -1339,64 +1518,149 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
 
     /*
      * The table has an appropriate format.
-     * Allocate and build
-     * - a modified to-Unicode state table
-     * - a modified from-Unicode output array
-     * - a converter name string with the swap option appended
+     * Allocate and set the converter name string with the swap option appended.
+     * The modified to-Unicode state table and from-Unicode output array
+     * are built lazily on first use in each direction,
+     * see _EBCDICSwapLFNLToU() and _EBCDICSwapLFNLFromU(),
+     * so that converting in only one direction does not copy the tables
+     * for the other direction.
      */
-    size=
-        mbcsTable->countStates*1024+
-        sizeofFromUBytes+
-        UCNV_MAX_CONVERTER_NAME_LENGTH+20;
-    p=(uint8_t *)uprv_malloc(size);
-    if(p==NULL) {
+    name=(char *)uprv_malloc(UCNV_MAX_CONVERTER_NAME_LENGTH+20);
+    if(name==NULL) {
         *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
         return FALSE;
     }
+    uprv_strcpy(name, sharedData->staticData->name);
+    uprv_strcat(name, UCNV_SWAP_LFNL_OPTION_STRING);
+
+    /* set the pointer */
+    umtx_lock(NULL);
+    if(mbcsTable->swapLFNLName==NULL) {
+        mbcsTable->swapLFNLName=name;
+        name=NULL;
+    }
+    umtx_unlock(NULL);
 
-    /* copy and modify the to-Unicode state table */
-    newStateTable=(int32_t (*)[256])p;
-    uprv_memcpy(newStateTable, mbcsTable->stateTable, mbcsTable->countStates*1024);
+    /* release the allocated memory if another thread beat us to it */
+    if(name!=NULL) {
+        uprv_free(name);
+    }
+    return TRUE;
+}
 
-    newStateTable[0][EBCDIC_LF]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_NL);
-    newStateTable[0][EBCDIC_NL]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_LF);
+/*
+ * Makes sure that the swaplfnl to-Unicode state table is built
+ * and visible to this converter. Only the 1kB state 0 row differs from the
+ * original table, but the state table must be contiguous and is copied whole.
+ */
+static UBool
+_EBCDICSwapLFNLToU(UConverter *cnv, UErrorCode *pErrorCode) {
+    UConverterMBCSTable *mbcsTable;
+    int32_t (*newStateTable)[256];
+    UBool isCached;
 
-    /* copy and modify the from-Unicode result table */
-    newResults=(uint16_t *)newStateTable[mbcsTable->countStates];
-    uprv_memcpy(newResults, bytes, sizeofFromUBytes);
+    if((cnv->options&_MBCS_OPTION_SWAP_LFNL_TO_U)!=0) {
+        return TRUE;
+    }
+    mbcsTable=&cnv->sharedData->mbcs;
 
-    /* conveniently, the table access macros work on the left side of expressions */
-    if(mbcsTable->outputType==MBCS_OUTPUT_1) {
-        MBCS_SINGLE_RESULT_FROM_U(table, newResults, U_LF)=EBCDIC_RT_NL;
-        MBCS_SINGLE_RESULT_FROM_U(table, newResults, U_NL)=EBCDIC_RT_LF;
-    } else /* MBCS_OUTPUT_2_SISO */ {
-        stage2Entry=MBCS_STAGE_2_FROM_U(table, U_LF);
-        MBCS_VALUE_2_FROM_STAGE_2(newResults, stage2Entry, U_LF)=EBCDIC_NL;
+    /* do this because double-checked locking is broken */
+    umtx_lock(NULL);
+    isCached=mbcsTable->swapLFNLStateTable!=NULL;
+    umtx_unlock(NULL);
 
-        stage2Entry=MBCS_STAGE_2_FROM_U(table, U_NL);
-        MBCS_VALUE_2_FROM_STAGE_2(newResults, stage2Entry, U_NL)=EBCDIC_LF;
+    if(!isCached) {
+        newStateTable=(int32_t (*)[256])uprv_malloc(mbcsTable->countStates*1024);
+        if(newStateTable==NULL) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+
+        /* copy and modify the to-Unicode state table */
+        uprv_memcpy(newStateTable, mbcsTable->stateTable, mbcsTable->countStates*1024);
+
+        newStateTable[0][EBCDIC_LF]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_NL);
+        newStateTable[0][EBCDIC_NL]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_LF);
+
+        umtx_lock(NULL);
+        if(mbcsTable->swapLFNLStateTable==NULL) {
+            mbcsTable->swapLFNLStateTable=newStateTable;
+            newStateTable=NULL;
+        }
+        umtx_unlock(NULL);
+
+        /* release the allocated memory if another thread beat us to it */
+        if(newStateTable!=NULL) {
+            uprv_free(newStateTable);
+        }
     }
 
-    /* set the canonical converter name */
-    name=(char *)newResults+sizeofFromUBytes;
-    uprv_strcpy(name, sharedData->staticData->name);
-    uprv_strcat(name, UCNV_SWAP_LFNL_OPTION_STRING);
+    /* the pointer was read or set under the lock and does not change any more */
+    cnv->options|=_MBCS_OPTION_SWAP_LFNL_TO_U;
+    return TRUE;
+}
 
-    /* set the pointers */
-    umtx_lock(NULL);
-    if(mbcsTable->swapLFNLStateTable==NULL) {
-        mbcsTable->swapLFNLStateTable=newStateTable;
-        mbcsTable->swapLFNLFromUnicodeBytes=(uint8_t *)newResults;
-        mbcsTable->swapLFNLName=name;
+/*
+ * Makes sure that the swaplfnl from-Unicode output array is built
+ * and visible to this converter.
+ */
+static UBool
+_EBCDICSwapLFNLFromU(UConverter *cnv, UErrorCode *pErrorCode) {
+    UConverterMBCSTable *mbcsTable;
+    const uint16_t *table;
+    uint16_t *newResults;
+    uint32_t stage2Entry;
+    UBool isCached;
 
-        newStateTable=NULL;
+    if((cnv->options&_MBCS_OPTION_SWAP_LFNL_FROM_U)!=0) {
+        return TRUE;
     }
+    mbcsTable=&cnv->sharedData->mbcs;
+
+    /* do this because double-checked locking is broken */
+    umtx_lock(NULL);
+    isCached=mbcsTable->swapLFNLFromUnicodeBytes!=NULL;
     umtx_unlock(NULL);
 
-    /* release the allocated memory if another thread beat us to it */
-    if(newStateTable!=NULL) {
-        uprv_free(newStateTable);
+    if(!isCached) {
+        /* _EBCDICSwapLFNL() checked that fromUBytesLength>0 */
+        newResults=(uint16_t *)uprv_malloc(mbcsTable->fromUBytesLength);
+        if(newResults==NULL) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+
+        /* copy and modify the from-Unicode result table */
+        table=mbcsTable->fromUnicodeTable;
+        uprv_memcpy(newResults, mbcsTable->fromUnicodeBytes, mbcsTable->fromUBytesLength);
+
+        /* conveniently, the table access macros work on the left side of expressions */
+        if(mbcsTable->outputType==MBCS_OUTPUT_1) {
+            MBCS_SINGLE_RESULT_FROM_U(table, newResults, U_LF)=EBCDIC_RT_NL;
+            MBCS_SINGLE_RESULT_FROM_U(table, newResults, U_NL)=EBCDIC_RT_LF;
+        } else /* MBCS_OUTPUT_2_SISO */ {
+            stage2Entry=MBCS_STAGE_2_FROM_U(table, U_LF);
+            MBCS_VALUE_2_FROM_STAGE_2(newResults, stage2Entry, U_LF)=EBCDIC_NL;
+
+            stage2Entry=MBCS_STAGE_2_FROM_U(table, U_NL);
+            MBCS_VALUE_2_FROM_STAGE_2(newResults, stage2Entry, U_NL)=EBCDIC_LF;
+        }
+
+        umtx_lock(NULL);
+        if(mbcsTable->swapLFNLFromUnicodeBytes==NULL) {
+            mbcsTable->swapLFNLFromUnicodeBytes=(uint8_t *)newResults;
+            newResults=NULL;
+        }
+        umtx_unlock(NULL);
+
+        /* release the allocated memory if another thread beat us to it */
+        if(newResults!=NULL) {
+            uprv_free(newResults);
+        }
     }
+
+    /* the pointer was read or set under the lock and does not change any more */
+    cnv->options|=_MBCS_OPTION_SWAP_LFNL_FROM_U;
     return TRUE;
 }
 
@@ -1493,6 +1757,7 @@ reconstituteData(UConverterMBCSTable *mbcsTable,
         *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    mbcsTable->reconstitutedDataLength=dataLength;
     uprv_memset(mbcsTable->reconstitutedData, 0, dataLength);
 
     /* copy existing data and reroute the pointers */
@@ -1666,6 +1931,7 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
          * is unloaded.
          */
         mbcsTable->reconstitutedData=NULL;
+        mbcsTable->reconstitutedDataLength=0;
 
         /*
          * Set a special, runtime-only outputType if the extension converter
@@ -1832,17 +2098,26 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
             }
         }
 
-        /* calculate a bit set of 4 ASCII characters per bit that round-trip to ASCII bytes */
+        /*
+         * calculate a bit set of 4 ASCII characters per bit that round-trip to ASCII bytes,
+         * and collect the individual ASCII bytes that do not round-trip
+         */
         {
             uint32_t asciiRoundtrips=0xffffffff;
-            int32_t i;
+            int32_t i, countASCIIExceptions=0;
 
             for(i=0; i<0x80; ++i) {
                 if(mbcsTable->stateTable[0][i]!=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, i)) {
                     asciiRoundtrips&=~((uint32_t)1<<(i>>2));
+                    if(countASCIIExceptions<MBCS_MAX_ASCII_EXCEPTIONS) {
+                        mbcsTable->asciiExceptions[countASCIIExceptions]=(uint8_t)i;
+                    }
+                    ++countASCIIExceptions;
                 }
             }
             mbcsTable->asciiRoundtrips=asciiRoundtrips;
+            mbcsTable->countASCIIExceptions=
+                countASCIIExceptions<=MBCS_MAX_ASCII_EXCEPTIONS ? (int8_t)countASCIIExceptions : -1;
         }
 
         if(noFromU) {
@@ -1873,6 +2148,7 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
          * MBCS_OUTPUT_2_SISO: Bypass the ASCII fastpath to handle prevLength correctly.
          */
         mbcsTable->asciiRoundtrips=0;
+        mbcsTable->countASCIIExceptions=-1;
     }
 }
 
@@ -1883,6 +2159,12 @@ ucnv_MBCSUnload(UConverterSharedData *sharedData) {
     if(mbcsTable->swapLFNLStateTable!=NULL) {
         uprv_free(mbcsTable->swapLFNLStateTable);
     }
+    if(mbcsTable->swapLFNLFromUnicodeBytes!=NULL) {
+        uprv_free(mbcsTable->swapLFNLFromUnicodeBytes);
+    }
+    if(mbcsTable->swapLFNLName!=NULL) {
+        uprv_free(mbcsTable->swapLFNLName);
+    }
     if(mbcsTable->stateTableOwned) {
         uprv_free((void *)mbcsTable->stateTable);
     }
@@ -1894,6 +2176,35 @@ ucnv_MBCSUnload(UConverterSharedData *sharedData) {
     }
 }
 
+U_CFUNC int32_t
+ucnv_MBCSGetSharedHeapSize(const UConverterSharedData *sharedData) {
+    const UConverterMBCSTable *mbcsTable=&sharedData->mbcs;
+    int32_t size=0;
+
+    /* the swaplfnl data is built lazily, possibly in another thread */
+    umtx_lock(NULL);
+    if(mbcsTable->swapLFNLStateTable!=NULL) {
+        size+=mbcsTable->countStates*1024;
+    }
+    if(mbcsTable->swapLFNLFromUnicodeBytes!=NULL) {
+        size+=(int32_t)mbcsTable->fromUBytesLength;
+    }
+    if(mbcsTable->swapLFNLName!=NULL) {
+        size+=UCNV_MAX_CONVERTER_NAME_LENGTH+20;
+    }
+    umtx_unlock(NULL);
+
+    if(mbcsTable->stateTableOwned) {
+        size+=mbcsTable->countStates*1024;
+    }
+    size+=(int32_t)mbcsTable->reconstitutedDataLength;
+    if(mbcsTable->baseSharedData!=NULL) {
+        size+=(int32_t)sizeof(UConverterSharedData)+
+              (int32_t)mbcsTable->baseSharedData->mbcs.reconstitutedDataLength;
+    }
+    return size;
+}
+
 static void U_CALLCONV
 ucnv_MBCSOpen(UConverter *cnv,
               UConverterLoadArgs *pArgs,
@@ -1920,7 +2231,7 @@ ucnv_MBCSOpen(UConverter *cnv,
         UBool isCached;
 
         umtx_lock(NULL);
-        isCached=mbcsTable->swapLFNLStateTable!=NULL;
+        isCached=mbcsTable->swapLFNLName!=NULL;
         umtx_unlock(NULL);
 
         if(!isCached) {
@@ -2055,6 +2366,9 @@ ucnv_MBCSSingleToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     offsets=pArgs->offsets;
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLToU(cnv, pErrorCode)) {
+            return;
+        }
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
@@ -2196,6 +2510,8 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2206,10 +2522,19 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     offsets=pArgs->offsets;
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLToU(cnv, pErrorCode)) {
+            return;
+        }
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        countASCIIExceptions=-1;
+    } else {
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
     sourceIndex=0;
@@ -2233,6 +2558,14 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
         loops=count=targetCapacity>>4;
         do {
+            if(countASCIIExceptions>=0 &&
+                    asciiBytesToUnicode(source, target, 16,
+                                        asciiExceptions, countASCIIExceptions)==16) {
+                /* all 16 bytes map directly to U+0000..U+007F */
+                source+=16;
+                target+=16;
+                continue;
+            }
             oredEntries=entry=stateTable[0][*source++];
             *target++=(UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
             oredEntries|=entry=stateTable[0][*source++];
@@ -2480,9 +2813,12 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t sourceIndex, nextSourceIndex;
 
-    int32_t entry;
+    int32_t entry=0;
     UChar c;
     uint8_t action;
+    int32_t length;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
 
     /* use optimized function if possible */
     cnv=pArgs->converter;
@@ -2516,11 +2852,20 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     offsets=pArgs->offsets;
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLToU(cnv, pErrorCode)) {
+            return;
+        }
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
     unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        countASCIIExceptions=-1;
+    } else {
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
 
     /* get the converter state from UConverter */
     offset=cnv->toUnicodeStatus;
@@ -2560,6 +2905,21 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
             /* optimized loop for 1/2-byte input and BMP output */
             if(offsets==NULL) {
                 do {
+                    if(*source<=0x7f && state==0 && countASCIIExceptions>=0) {
+                        /* convert a run of ASCII bytes without table lookups */
+                        length=(int32_t)(sourceLimit-source);
+                        if(length>(targetLimit-target)) {
+                            length=(int32_t)(targetLimit-target);
+                        }
+                        length=asciiBytesToUnicode(source, target, length,
+                                                   asciiExceptions, countASCIIExceptions);
+                        source+=length;
+                        target+=length;
+                        if(source>=sourceLimit || target>=targetLimit) {
+                            /* leave the optimized loop via its condition */
+                            continue;
+                        }
+                    }
                     entry=stateTable[state][*source];
                     if(MBCS_ENTRY_IS_TRANSITION(entry)) {
                         state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
@@ -2595,6 +2955,26 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 } while(source<sourceLimit && target<targetLimit);
             } else /* offsets!=NULL */ {
                 do {
+                    if(*source<=0x7f && state==0 && countASCIIExceptions>=0) {
+                        /* convert a run of ASCII bytes without table lookups */
+                        length=(int32_t)(sourceLimit-source);
+                        if(length>(targetLimit-target)) {
+                            length=(int32_t)(targetLimit-target);
+                        }
+                        length=asciiBytesToUnicode(source, target, length,
+                                                   asciiExceptions, countASCIIExceptions);
+                        source+=length;
+                        target+=length;
+                        while(length>0) {
+                            *offsets++=sourceIndex;
+                            sourceIndex=++nextSourceIndex;
+                            --length;
+                        }
+                        if(source>=sourceLimit || target>=targetLimit) {
+                            /* leave the optimized loop via its condition */
+                            continue;
+                        }
+                    }
                     entry=stateTable[state][*source];
                     if(MBCS_ENTRY_IS_TRANSITION(entry)) {
                         state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
@@ -2893,6 +3273,9 @@ ucnv_MBCSSingleGetNextUChar(UConverterToUnicodeArgs *pArgs,
     source=(const uint8_t *)pArgs->source;
     sourceLimit=(const uint8_t *)pArgs->sourceLimit;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLToU(cnv, pErrorCode)) {
+            return 0xffff;
+        }
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
@@ -3003,6 +3386,9 @@ ucnv_MBCSGetNextUChar(UConverterToUnicodeArgs *pArgs,
     sourceLimit=(const uint8_t *)pArgs->sourceLimit;
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLToU(cnv, pErrorCode)) {
+            return 0xffff;
+        }
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
@@ -3421,6 +3807,8 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     uint32_t stage2Entry;
     uint32_t asciiRoundtrips;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
     uint32_t value;
     uint8_t unicodeMask;
 
@@ -3438,11 +3826,20 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
     table=cnv->sharedData->mbcs.fromUnicodeTable;
     mbcsIndex=cnv->sharedData->mbcs.mbcsIndex;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
         bytes=cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
     } else {
         bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        countASCIIExceptions=-1;
+    } else {
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
 
     /* get the converter state from UConverter */
     c=cnv->fromUChar32;
@@ -3481,6 +3878,27 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                if(countASCIIExceptions>=0 && targetCapacity>0) {
+                    /* convert the rest of an ASCII run without table lookups */
+                    int32_t length=(int32_t)(sourceLimit-source);
+                    if(length>targetCapacity) {
+                        length=targetCapacity;
+                    }
+                    length=asciiUnicodeToBytes(source, target, length,
+                                               asciiExceptions, countASCIIExceptions);
+                    source+=length;
+                    target+=length;
+                    targetCapacity-=length;
+                    if(offsets!=NULL) {
+                        while(length>0) {
+                            *offsets++=sourceIndex;
+                            sourceIndex=++nextSourceIndex;
+                            --length;
+                        }
+                    } else {
+                        nextSourceIndex+=length;
+                    }
+                }
                 continue;
             }
             /*
@@ -3663,6 +4081,9 @@ ucnv_MBCSSingleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     table=cnv->sharedData->mbcs.fromUnicodeTable;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
         results=(uint16_t *)cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
     } else {
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
@@ -3827,6 +4248,8 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
     int32_t sourceIndex;
 
     uint32_t asciiRoundtrips;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
     uint16_t value, minValue;
 
     /* set up the local pointers */
@@ -3839,11 +4262,20 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     table=cnv->sharedData->mbcs.fromUnicodeTable;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
         results=(uint16_t *)cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
     } else {
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        countASCIIExceptions=-1;
+    } else {
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
 
     if(cnv->useFallback) {
         /* use all roundtrip and fallback results */
@@ -3940,6 +4372,14 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++=(uint8_t)c;
             --targetCapacity;
             c=0;
+            if(countASCIIExceptions>=0 && targetCapacity>0) {
+                /* convert the rest of an ASCII run without table lookups */
+                int32_t length=asciiUnicodeToBytes(source, target, targetCapacity,
+                                                   asciiExceptions, countASCIIExceptions);
+                source+=length;
+                target+=length;
+                targetCapacity-=length;
+            }
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4087,6 +4527,8 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     uint32_t stage2Entry;
     uint32_t asciiRoundtrips;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
     uint32_t value;
     /* Shift-In and Shift-Out byte sequences differ by encoding scheme. */
     uint8_t siBytes[2] = {0, 0};
@@ -4138,11 +4580,20 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
         mbcsIndex=NULL;
     }
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
         bytes=cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
     } else {
         bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        countASCIIExceptions=-1;
+    } else {
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
 
     /* get the converter state from UConverter */
     c=cnv->fromUChar32;
@@ -4211,6 +4662,28 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                if(countASCIIExceptions>=0 && targetCapacity>0) {
+                    /* convert the rest of an ASCII run without table lookups */
+                    int32_t length=(int32_t)(sourceLimit-source);
+                    if(length>targetCapacity) {
+                        length=targetCapacity;
+                    }
+                    length=asciiUnicodeToBytes(source, target, length,
+                                               asciiExceptions, countASCIIExceptions);
+                    source+=length;
+                    target+=length;
+                    targetCapacity-=length;
+                    if(offsets!=NULL) {
+                        while(length>0) {
+                            prevSourceIndex=sourceIndex;
+                            *offsets++=sourceIndex;
+                            sourceIndex=++nextSourceIndex;
+                            --length;
+                        }
+                    } else {
+                        nextSourceIndex+=length;
+                    }
+                }
                 continue;
             }
             /*
@@ -5048,6 +5521,9 @@ ucnv_SBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     table=cnv->sharedData->mbcs.fromUnicodeTable;
     sbcsIndex=cnv->sharedData->mbcs.sbcsIndex;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
         results=(uint16_t *)cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
     } else {
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
@@ -5351,6 +5827,9 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     table=cnv->sharedData->mbcs.fromUnicodeTable;
     mbcsIndex=cnv->sharedData->mbcs.mbcsIndex;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
         results=(uint16_t *)cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
     } else {
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
@@ -5622,6 +6101,667 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/*
+ * Conversion from UTF-8 for all MBCS table types that are not handled by
+ * ucnv_SBCSFromUTF8() or ucnv_DBCSFromUTF8(): 1-byte and 2-byte tables
+ * without utf8Friendly data, 3- and 4-byte tables (including GB 18030),
+ * EUC, DBCS-only and SI/SO-stateful tables.
+ *
+ * Well-formed UTF-8 is converted with the regular fromUnicode table lookup
+ * and _extFromU(). Truncated and ill-formed UTF-8 as well as code points that
+ * would need the UTF-16 representation (tables with surrogate mappings)
+ * are left for pivoting: This function stops before such a sequence and
+ * returns U_USING_DEFAULT_WARNING.
+ */
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const uint16_t *table;
+    const uint8_t *p, *bytes;
+    uint8_t outputType, unicodeMask;
+
+    UChar32 c;
+
+    uint32_t stage2Entry;
+    uint32_t asciiRoundtrips;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
+    uint32_t value;
+    uint8_t siBytes[2] = {0, 0};
+    uint8_t soBytes[2] = {0, 0};
+    uint8_t siLength, soLength;
+    int32_t i, length, prevLength;
+
+    /* set up the local pointers */
+    utf8=pToUArgs->converter;
+    cnv=pFromUArgs->converter;
+
+    if(utf8->toULength>0 || cnv->fromUChar32!=0) {
+        /* finish a partial character by pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    source=(uint8_t *)pToUArgs->source;
+    sourceLimit=(uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    table=cnv->sharedData->mbcs.fromUnicodeTable;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLFromU(cnv, pErrorCode)) {
+            return;
+        }
+        bytes=cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
+        countASCIIExceptions=-1;
+    } else {
+        bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
+    asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+    outputType=cnv->sharedData->mbcs.outputType;
+    unicodeMask=cnv->sharedData->mbcs.unicodeMask;
+
+    /* get the converter state from UConverter */
+    if(outputType==MBCS_OUTPUT_2_SISO) {
+        prevLength=cnv->fromUnicodeStatus;
+        if(prevLength==0) {
+            /* set the real value */
+            prevLength=1;
+        }
+    } else {
+        /* prevent fromUnicodeStatus from being set to something non-0 */
+        prevLength=0;
+    }
+
+    /* Get the SI/SO character for the converter */
+    siLength = static_cast<uint8_t>(getSISOBytes(SI, cnv->options, siBytes));
+    soLength = static_cast<uint8_t>(getSISOBytes(SO, cnv->options, soBytes));
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        c=*source;
+        if(U8_IS_SINGLE(c)) {
+            ++source;
+            if(IS_ASCII_ROUNDTRIP(c, asciiRoundtrips)) {
+                *target++=(uint8_t)c;
+                --targetCapacity;
+                if(countASCIIExceptions>=0 && targetCapacity>0) {
+                    /* copy the rest of an ASCII run without table lookups */
+                    length=(int32_t)(sourceLimit-source);
+                    if(length>targetCapacity) {
+                        length=targetCapacity;
+                    }
+                    length=asciiBytesToBytes(source, target, length,
+                                             asciiExceptions, countASCIIExceptions);
+                    source+=length;
+                    target+=length;
+                    targetCapacity-=length;
+                }
+                continue;
+            }
+        } else {
+            i=0;
+            length=(int32_t)(sourceLimit-source);
+            U8_NEXT(source, i, length, c);
+            if(c<0 || (c>0xffff && (unicodeMask&UCNV_HAS_SURROGATES))) {
+                /* truncated or ill-formed UTF-8, or separately mapped surrogates: pivot */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            source+=i;
+            if(c>0xffff && !(unicodeMask&UCNV_HAS_SUPPLEMENTARY)) {
+                /* BMP-only codepages are stored without stage 1 entries for supplementary code points */
+                goto unassigned;
+            }
+        }
+
+        /* get the bytes and the length for the output (same as in ucnv_MBCSFromUnicodeWithOffsets()) */
+        if(outputType==MBCS_OUTPUT_1) {
+            value=MBCS_SINGLE_RESULT_FROM_U(table, (const uint16_t *)bytes, c);
+            /* is this code point assigned, or do we use fallbacks? */
+            if(!(UCNV_FROM_U_USE_FALLBACK(cnv, c) ? value>=0x800 : value>=0xc00)) {
+                goto unassigned;
+            }
+            value&=0xff;
+            length=1;
+        } else {
+            stage2Entry=MBCS_STAGE_2_FROM_U(table, c);
+            switch(outputType) {
+            case MBCS_OUTPUT_2:
+            case MBCS_OUTPUT_2_SISO:
+                value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+                if(value<=0xff) {
+                    length=1;
+                } else {
+                    length=2;
+                }
+                break;
+            case MBCS_OUTPUT_DBCS_ONLY:
+                /* table with single-byte results, but only DBCS mappings used */
+                value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+                if(value<=0xff) {
+                    /* no mapping or SBCS result, not taken for DBCS-only */
+                    value=stage2Entry=0; /* stage2Entry=0 to reset roundtrip flags */
+                    length=0;
+                } else {
+                    length=2;
+                }
+                break;
+            case MBCS_OUTPUT_3:
+                p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+                value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+                if(value<=0xff) {
+                    length=1;
+                } else if(value<=0xffff) {
+                    length=2;
+                } else {
+                    length=3;
+                }
+                break;
+            case MBCS_OUTPUT_4:
+                value=MBCS_VALUE_4_FROM_STAGE_2(bytes, stage2Entry, c);
+                if(value<=0xff) {
+                    length=1;
+                } else if(value<=0xffff) {
+                    length=2;
+                } else if(value<=0xffffff) {
+                    length=3;
+                } else {
+                    length=4;
+                }
+                break;
+            case MBCS_OUTPUT_3_EUC:
+                value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+                /* EUC 16-bit fixed-length representation */
+                if(value<=0xff) {
+                    length=1;
+                } else if((value&0x8000)==0) {
+                    value|=0x8e8000;
+                    length=3;
+                } else if((value&0x80)==0) {
+                    value|=0x8f0080;
+                    length=3;
+                } else {
+                    length=2;
+                }
+                break;
+            case MBCS_OUTPUT_4_EUC:
+                p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+                value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+                /* EUC 16-bit fixed-length representation applied to the first two bytes */
+                if(value<=0xff) {
+                    length=1;
+                } else if(value<=0xffff) {
+                    length=2;
+                } else if((value&0x800000)==0) {
+                    value|=0x8e800000;
+                    length=4;
+                } else if((value&0x8000)==0) {
+                    value|=0x8f008000;
+                    length=4;
+                } else {
+                    length=3;
+                }
+                break;
+            default:
+                /* must not occur */
+                value=stage2Entry=0; /* stage2Entry=0 to reset roundtrip flags */
+                length=0;
+                break;
+            }
+
+            /* is this code point assigned, or do we use fallbacks? */
+            if(!(MBCS_FROM_U_IS_ROUNDTRIP(stage2Entry, c)!=0 ||
+                 (UCNV_FROM_U_USE_FALLBACK(cnv, c) && value!=0))
+            ) {
+                goto unassigned;
+            }
+
+            if(outputType==MBCS_OUTPUT_2_SISO) {
+                /* 1/2-byte stateful with Shift-In/Shift-Out */
+                if(length==1) {
+                    if(prevLength==2) {
+                        /* change from double-byte mode to single-byte */
+                        if (siLength == 1) {
+                            value|=(uint32_t)siBytes[0]<<8;
+                            length = 2;
+                        } else if (siLength == 2) {
+                            value|=(uint32_t)siBytes[1]<<8;
+                            value|=(uint32_t)siBytes[0]<<16;
+                            length = 3;
+                        }
+                        prevLength=1;
+                    }
+                } else {
+                    if(prevLength!=2) {
+                        /* change from single-byte mode to double-byte */
+                        if (soLength == 1) {
+                            value|=(uint32_t)soBytes[0]<<16;
+                            length = 3;
+                        } else if (soLength == 2) {
+                            value|=(uint32_t)soBytes[1]<<16;
+                            value|=(uint32_t)soBytes[0]<<24;
+                            length = 4;
+                        }
+                        prevLength=2;
+                    }
+                }
+            }
+        }
+
+        /* write the output character bytes from value and length */
+        /* from the first if in the loop we know that targetCapacity>0 */
+        if(length<=targetCapacity) {
+            switch(length) {
+                /* each branch falls through to the next one */
+            case 4:
+                *target++=(uint8_t)(value>>24);
+                U_FALLTHROUGH;
+            case 3:
+                *target++=(uint8_t)(value>>16);
+                U_FALLTHROUGH;
+            case 2:
+                *target++=(uint8_t)(value>>8);
+                U_FALLTHROUGH;
+            case 1:
+                *target++=(uint8_t)value;
+                U_FALLTHROUGH;
+            default:
+                /* will never occur */
+                break;
+            }
+            targetCapacity-=length;
+        } else {
+            uint8_t *charErrorBuffer;
+
+            /* output what does not fit into the regular target to the overflow buffer */
+            /* we know that 1<=targetCapacity<length<=4 */
+            length-=targetCapacity;
+            charErrorBuffer=(uint8_t *)cnv->charErrorBuffer;
+            switch(length) {
+                /* each branch falls through to the next one */
+            case 3:
+                *charErrorBuffer++=(uint8_t)(value>>16);
+                U_FALLTHROUGH;
+            case 2:
+                *charErrorBuffer++=(uint8_t)(value>>8);
+                U_FALLTHROUGH;
+            case 1:
+                *charErrorBuffer=(uint8_t)value;
+                U_FALLTHROUGH;
+            default:
+                /* will never occur */
+                break;
+            }
+            cnv->charErrorBufferLength=(int8_t)length;
+
+            /* now output what fits into the regular target */
+            value>>=8*length; /* length was reduced by targetCapacity */
+            switch(targetCapacity) {
+                /* each branch falls through to the next one */
+            case 3:
+                *target++=(uint8_t)(value>>16);
+                U_FALLTHROUGH;
+            case 2:
+                *target++=(uint8_t)(value>>8);
+                U_FALLTHROUGH;
+            case 1:
+                *target++=(uint8_t)value;
+                U_FALLTHROUGH;
+            default:
+                /* will never occur */
+                break;
+            }
+
+            /* target overflow */
+            targetCapacity=0;
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        continue;
+
+unassigned:
+        {
+            /*
+             * Try an extension mapping, or the GB 18030 four-byte ranges.
+             * Pass in no source because we don't have UTF-16 input.
+             * If we have a partial match on c, we will return and revert
+             * to UTF-8->UTF-16->charset conversion.
+             */
+            static const UChar nul=0;
+            const UChar *noSource=&nul;
+            cnv->fromUnicodeStatus=prevLength; /* for SI/SO output of the extension mapping */
+            c=_extFromU(cnv, cnv->sharedData,
+                        c, &noSource, noSource,
+                        &target, target+targetCapacity,
+                        NULL, -1,
+                        pFromUArgs->flush,
+                        pErrorCode);
+            prevLength=cnv->fromUnicodeStatus; /* restore SISO state */
+
+            if(U_FAILURE(*pErrorCode)) {
+                /* not mappable or buffer overflow */
+                cnv->fromUChar32=c;
+                break;
+            } else if(cnv->preFromUFirstCP>=0) {
+                /* partial match, return and revert to pivoting */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            } else {
+                /* a mapping was written to the target, continue */
+
+                /* recalculate the targetCapacity after an extension mapping */
+                targetCapacity=(int32_t)(pFromUArgs->targetLimit-(char *)target);
+            }
+        }
+    }
+
+    /*
+     * The direct conversion does not return to the fromUnicode function
+     * at the end of the input, so for EBCDIC_STATEFUL conversion
+     * we emit an SI here, just like ucnv_MBCSFromUnicodeWithOffsets().
+     */
+    if( U_SUCCESS(*pErrorCode) && *pErrorCode!=U_USING_DEFAULT_WARNING &&
+        outputType==MBCS_OUTPUT_2_SISO && prevLength==2 &&
+        pToUArgs->flush && source>=sourceLimit
+    ) {
+        /* EBCDIC_STATEFUL ending with DBCS: emit an SI to return the output stream to SBCS */
+        if(targetCapacity>=siLength) {
+            *target++=(uint8_t)siBytes[0];
+            if (siLength == 2) {
+                *target++=(uint8_t)siBytes[1];
+            }
+        } else {
+            /* target is full */
+            for(i=0; i<siLength; ++i) {
+                if(i<targetCapacity) {
+                    *target++=(uint8_t)siBytes[i];
+                } else {
+                    cnv->charErrorBuffer[cnv->charErrorBufferLength++]=(char)siBytes[i];
+                }
+            }
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        }
+        prevLength=1; /* we switched into SBCS */
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->fromUnicodeStatus=prevLength;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
+/* MBCS-to-UTF-8 conversion functions --------------------------------------- */
+
+/*
+ * Conversion to UTF-8 for all MBCS table types.
+ *
+ * This walks the state table like ucnv_MBCSToUnicodeWithOffsets() and writes
+ * the code points directly as UTF-8. Extension mappings (including the
+ * GB 18030 four-byte ranges) are written via a small UTF-16 buffer.
+ * Illegal and unmappable sequences, characters that are truncated at the end
+ * of the input, and results that do not fit into the target are left for
+ * pivoting: This function stops before such a character and returns
+ * U_USING_DEFAULT_WARNING.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit, *charStart;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+    const uint8_t *asciiExceptions;
+    int32_t countASCIIExceptions;
+
+    uint32_t offset;
+    uint8_t state, charState, prevState;
+
+    int32_t entry;
+    UChar32 c;
+    uint8_t action;
+    int32_t i, length;
+
+    /* set up the local pointers */
+    utf8=pFromUArgs->converter;
+    cnv=pToUArgs->converter;
+
+    if(cnv->toULength>0 || utf8->fromUChar32!=0) {
+        /* finish a partial character by pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        if(!_EBCDICSwapLFNLToU(cnv, pErrorCode)) {
+            return;
+        }
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        countASCIIExceptions=-1;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+        countASCIIExceptions=cnv->sharedData->mbcs.countASCIIExceptions;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    asciiExceptions=cnv->sharedData->mbcs.asciiExceptions;
+
+    /* get the converter state from UConverter, see ucnv_MBCSToUnicodeWithOffsets() */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        if(*source<=0x7f && state==0 && countASCIIExceptions>=0) {
+            /* copy a run of ASCII bytes without table lookups */
+            length=(int32_t)(sourceLimit-source);
+            if(length>targetCapacity) {
+                length=targetCapacity;
+            }
+            length=asciiBytesToBytes(source, target, length,
+                                     asciiExceptions, countASCIIExceptions);
+            source+=length;
+            target+=length;
+            targetCapacity-=length;
+            if(source>=sourceLimit || targetCapacity<=0) {
+                continue;
+            }
+        }
+
+        /* read one character */
+        charStart=source;
+        charState=state;
+        offset=0;
+        entry=stateTable[state][*source++];
+        while(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            if(source>=sourceLimit) {
+                /* truncated character at the end of the input */
+                goto pivot;
+            }
+            entry=stateTable[state][*source++];
+        }
+
+        /* the previous state is needed for extension mappings with SI/SO-stateful converters */
+        prevState=state;
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+
+        action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+        if(action==MBCS_STATE_VALID_16) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset];
+            if(c>=0xfffe) {
+                if(c==0xffff) {
+                    goto pivot; /* illegal */
+                }
+                if(UCNV_TO_U_USE_FALLBACK(cnv)) {
+                    c=(UChar32)ucnv_MBCSGetFallback(&cnv->sharedData->mbcs, offset);
+                }
+                if(c==0xfffe) {
+                    goto unassigned;
+                }
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_16 ||
+                  (action==MBCS_STATE_FALLBACK_DIRECT_16 && UCNV_TO_U_USE_FALLBACK(cnv))
+        ) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+        } else if(action==MBCS_STATE_VALID_16_PAIR) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset++];
+            if(c<0xd800) {
+                /* BMP code point below 0xd800 */
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? c<=0xdfff : c<=0xdbff) {
+                /* roundtrip or fallback surrogate pair */
+                c=U16_GET_SUPPLEMENTARY(c&0xdbff, unicodeCodeUnits[offset]);
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? (c&0xfffe)==0xe000 : c==0xe000) {
+                /* roundtrip BMP code point above 0xd800 or fallback BMP code point */
+                c=unicodeCodeUnits[offset];
+            } else if(c==0xffff) {
+                goto pivot; /* illegal */
+            } else {
+                goto unassigned;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_20 ||
+                  (action==MBCS_STATE_FALLBACK_DIRECT_20 && UCNV_TO_U_USE_FALLBACK(cnv))
+        ) {
+            c=(UChar32)MBCS_ENTRY_FINAL_VALUE(entry)+0x10000;
+        } else if(action==MBCS_STATE_CHANGE_ONLY && cnv->sharedData->mbcs.dbcsOnlyState==0) {
+            /* SI/SO state change without any output */
+            continue;
+        } else if(action==MBCS_STATE_UNASSIGNED || action==MBCS_STATE_FALLBACK_DIRECT_16) {
+            goto unassigned;
+        } else {
+            /* illegal sequences, SI/SO for DBCS-only conversion and reserved action codes */
+            goto pivot;
+        }
+
+        /* write the code point as UTF-8 */
+        if(c<=0x7f) {
+            *target++=(uint8_t)c;
+            --targetCapacity;
+        } else if(U_IS_SURROGATE(c)) {
+            /* a mapping to a single surrogate is not well-formed UTF-8 */
+            goto pivot;
+        } else if(targetCapacity>=U8_MAX_LENGTH) {
+            length=0;
+            U8_APPEND_UNSAFE(target, length, c);
+            target+=length;
+            targetCapacity-=length;
+        } else {
+            uint8_t bytes[U8_MAX_LENGTH];
+            length=0;
+            U8_APPEND_UNSAFE(bytes, length, c);
+            for(i=0; i<length; ++i) {
+                if(i<targetCapacity) {
+                    *target++=bytes[i];
+                } else {
+                    utf8->charErrorBuffer[utf8->charErrorBufferLength++]=(char)bytes[i];
+                }
+            }
+            if(length>targetCapacity) {
+                /* target overflow */
+                targetCapacity=0;
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+                break;
+            }
+            targetCapacity-=length;
+        }
+        continue;
+
+unassigned:
+        {
+            /* try an extension mapping, writing its UTF-16 result into a local buffer */
+            UChar uchars[UCNV_EXT_MAX_UCHARS];
+            UChar *u=uchars;
+            uint8_t bytes[3*UCNV_EXT_MAX_UCHARS];
+            int32_t uLength;
+
+            length=(int32_t)(source-charStart);
+            uprv_memcpy(cnv->toUBytes, charStart, length);
+            cnv->mode=prevState;
+            _extToU(cnv, cnv->sharedData,
+                    (int8_t)length, &source, sourceLimit,
+                    &u, uchars+UCNV_EXT_MAX_UCHARS,
+                    NULL, -1,
+                    pToUArgs->flush,
+                    pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                /* not mappable: handle the callback by pivoting */
+                *pErrorCode=U_ZERO_ERROR;
+                goto pivot;
+            } else if(cnv->preToULength>0) {
+                /* partial match at the end of the input, continue by pivoting */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+
+            uLength=(int32_t)(u-uchars);
+            length=0;
+            for(i=0; i<uLength;) {
+                U16_NEXT(uchars, i, uLength, c);
+                if(U_IS_SURROGATE(c)) {
+                    goto pivot;
+                }
+                U8_APPEND_UNSAFE(bytes, length, c);
+            }
+            if(length>targetCapacity) {
+                /* let the pivoting conversion handle the target overflow */
+                goto pivot;
+            }
+            uprv_memcpy(target, bytes, length);
+            target+=length;
+            targetCapacity-=length;
+            continue;
+        }
+
+pivot:
+        /* back out of this character and let ucnv_convertEx() pivot through UTF-16 */
+        source=charStart;
+        state=charState;
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        break;
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->mode=state;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
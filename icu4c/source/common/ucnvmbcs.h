@@ -361,6 +361,9 @@ enum {
     MBCS_FAST_LIMIT=MBCS_FAST_MAX+1     /* =0xd800 */
 };
 
+/* maximum number of ASCII bytes that do not round-trip, for the ASCII fast path */
+#define MBCS_MAX_ASCII_EXCEPTIONS 6
+
 /**
  * This is the MBCS part of the UConverterTable union (a runtime data structure).
  * It keeps all the per-converter data and points into the loaded mapping tables.
@@ -391,8 +394,17 @@ typedef struct UConverterMBCSTable {
     /* roundtrips */
     uint32_t asciiRoundtrips;
 
+    /*
+     * ASCII fast path: bytes 00..7f that do not round-trip with U+0000..U+007F.
+     * countASCIIExceptions<0 if there are more than MBCS_MAX_ASCII_EXCEPTIONS
+     * or if the converter does not use the fast path.
+     */
+    int8_t countASCIIExceptions;
+    uint8_t asciiExceptions[MBCS_MAX_ASCII_EXCEPTIONS];
+
     /* reconstituted data that was omitted from the .cnv file */
     uint8_t *reconstitutedData;
+    uint32_t reconstitutedDataLength;
 
     /* converter name for swaplfnl */
     char *swapLFNLName;
@@ -425,9 +437,11 @@ typedef struct UConverterMBCSTable {
      \
     /* roundtrips */ \
     0, \
+    -1, { 0 }, \
      \
     /* reconstituted data that was omitted from the .cnv file */ \
     NULL, \
+    0, \
      \
     /* converter name for swaplfnl */ \
     NULL, \
@@ -566,6 +580,33 @@ ucnv_MBCSSingleFromUChar32(UConverterSharedData *sharedData,
 U_CFUNC UConverterType
 ucnv_MBCSGetType(const UConverter* converter);
 
+/*
+ * Sets isSplitByte[b]=TRUE for each byte value b after which a toUnicode conversion
+ * is always back in the initial state and its output does not depend on
+ * the following bytes, regardless of the bytes before b.
+ * Conversion of a byte sequence can be split after any such byte
+ * into pieces that are converted independently.
+ * Returns FALSE if there are no such bytes, for example for stateful converters.
+ */
+U_CFUNC UBool
+ucnv_MBCSGetToUSplitBytes(const UConverterSharedData *sharedData, UBool isSplitByte[256]);
+
+/*
+ * Returns TRUE if a fromUnicode conversion can be split between any two code points
+ * into pieces that are converted independently.
+ */
+U_CFUNC UBool
+ucnv_MBCSCanSplitFromUnicode(const UConverterSharedData *sharedData);
+
+/*
+ * Returns the number of heap bytes allocated for the shared MBCS table data
+ * (swaplfnl variants, modified state tables, reconstituted fromUnicode data)
+ * in addition to the table data used directly from the loaded .cnv file.
+ * Heap data of a base table is included for extension-only converters.
+ */
+U_CFUNC int32_t
+ucnv_MBCSGetSharedHeapSize(const UConverterSharedData *sharedData);
+
 U_CFUNC void 
 ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                             UErrorCode *pErrorCode);
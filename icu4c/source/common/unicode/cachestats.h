@@ -0,0 +1,70 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// cachestats.h
+// created: 2018oct19
+
+#ifndef __CACHESTATS_H__
+#define __CACHESTATS_H__
+
+#include "unicode/utypes.h"
+#include "unicode/ucache.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Statistics for ICU's shared object cache.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Statistics for ICU's shared object cache.
+ * Same as the ucache_getStatistics() and ucache_resetStatistics() C functions.
+ *
+ * @see UCacheTypeStatistics
+ * @draft ICU 64
+ */
+class U_COMMON_API CacheStatistics U_FINAL : public UMemory {
+public:
+    /**
+     * Copies the statistics for each type of cached value into dest, in no particular order.
+     * The statistics of different types may be captured at slightly different moments
+     * while other threads use the cache.
+     *
+     * @param dest      Destination array; can be NULL if capacity==0 for preflighting.
+     * @param capacity  Number of elements in dest.
+     * @param errorCode Reference to an in/out error code value
+     *                  which must not indicate a failure before the function call.
+     *                  Set to U_BUFFER_OVERFLOW_ERROR if there are more types than capacity;
+     *                  then only capacity elements are written.
+     * @return The number of value types with statistics.
+     * @see ucache_getStatistics
+     * @draft ICU 64
+     */
+    static int32_t getStatistics(UCacheTypeStatistics *dest, int32_t capacity,
+                                 UErrorCode &errorCode);
+
+    /**
+     * Resets all of the cache statistics to zero.
+     *
+     * @param errorCode Reference to an in/out error code value
+     *                  which must not indicate a failure before the function call.
+     * @see ucache_resetStatistics
+     * @draft ICU 64
+     */
+    static void reset(UErrorCode &errorCode);
+
+private:
+    CacheStatistics() = delete;
+    CacheStatistics(const CacheStatistics &other) = delete;
+    CacheStatistics &operator=(const CacheStatistics &other) = delete;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // __CACHESTATS_H__
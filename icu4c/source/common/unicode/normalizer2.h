@@ -247,6 +247,60 @@ class U_COMMON_API Normalizer2 : public UObject {
     normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink,
                   Edits *edits, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Normalizes a string in place.
+     * Equivalent to s=normalize(s) but the already-normalized parts of s
+     * are not copied: If s is normalized, then it is not modified at all
+     * and no memory is allocated.
+     * Otherwise only the segments that change are rewritten, and the text
+     * between them is moved at most once, unless the string becomes longer,
+     * in which case the remainder of the string is normalized into
+     * a temporary string and appended.
+     * If an error occurs after s was partially rewritten, then s is set to bogus.
+     * @param s the string to be normalized
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return s
+     * @draft ICU 64
+     */
+    UnicodeString &
+    normalizeInPlace(UnicodeString &s, UErrorCode &errorCode) const;
+
+    /**
+     * Normalizes a large UTF-8 string on several threads.
+     * The result is the same as from normalizeUTF8(0, src, sink, nullptr, errorCode).
+     *
+     * The input is split into segments at normalization boundaries
+     * (see hasBoundaryBefore()), which are normalized independently on
+     * up to threadCount threads and then written to the sink in order.
+     * Strings that are too short to make this worthwhile are normalized
+     * on the calling thread.
+     * The normalized segments are buffered until they are written,
+     * and a limited number of them at a time, so that extra memory use
+     * is bounded independent of the length of src.
+     *
+     * @param src       Source UTF-8 string.
+     * @param sink      A ByteSink to which the normalized UTF-8 result string is written.
+     *                  sink.Flush() is called at the end.
+     *                  The sink is only used on the calling thread.
+     * @param threadCount number of threads to use, at least 1;
+     *                  or 0 for the number of available processors.
+     *                  1 does all of the work on the calling thread.
+     *                  Very large values are reduced to an internal limit.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void
+    normalizeUTF8Parallel(StringPiece src, ByteSink &sink, int32_t threadCount,
+                          UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Appends the normalized form of the second string to the first string
      * (merging them at the boundary) and returns the first string.
@@ -382,7 +436,8 @@ class U_COMMON_API Normalizer2 : public UObject {
      * This works for all normalization modes,
      * but it is currently optimized for UTF-8 only for "compose" modes,
      * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
+     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS),
+     * and for the FCD check (UNORM2_FCD).
      * For other modes it currently converts to UTF-16 and calls isNormalized().
      *
      * @param s UTF-8 input string
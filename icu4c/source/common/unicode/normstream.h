@@ -0,0 +1,184 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// normstream.h
+// created: 2018oct22
+
+#ifndef __NORMSTREAM_H__
+#define __NORMSTREAM_H__
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C++ API: Normalizing text that arrives in chunks.
+ */
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/bytestream.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uobject.h"
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+class CharString;
+class Normalizer2;
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Normalizes text that is passed in as a sequence of chunks,
+ * for example as it is read from a file or received over a network connection.
+ *
+ * Normalization can change text across a chunk boundary:
+ * A combining mark at the start of one chunk may compose with the base character
+ * at the end of the previous one, or reorder with marks before it.
+ * A StreamingNormalizer therefore emits the normalized text of each chunk
+ * only up to the last normalization boundary (see Normalizer2::hasBoundaryBefore())
+ * and keeps the rest, which it normalizes together with the following chunk.
+ * After the last chunk, finish() or finishUTF8() emits the remaining text.
+ *
+ * The concatenated output is the same as normalizing the concatenated input
+ * with the underlying Normalizer2 (with the exception described below),
+ * independent of where the input was split into chunks.
+ * Only the text after the last boundary is held between chunks, so memory use
+ * does not grow with the total length of the input.
+ *
+ * In Unicode text, the span between two boundaries is short, typically
+ * one or two characters. In order to keep memory bounded even for
+ * degenerate input like an unlimited sequence of combining marks, the text that
+ * is held back never grows beyond the maximum pending length given to the constructor:
+ * When a chunk would make it longer, all of it is normalized and emitted.
+ * The output is then that of normalizing the text before and after that point separately.
+ * (This is similar to the Stream-Safe Text Format of UAX #15
+ * which limits sequences of non-starters.)
+ *
+ * One instance normalizes one stream at a time, either UTF-16 with normalizeChunk()
+ * and finish(), or UTF-8 with normalizeChunkUTF8() and finishUTF8().
+ * UTF-8 chunks may begin and end in the middle of a character.
+ * A StreamingNormalizer can be reused for another stream after finish() or reset().
+ * It is not thread-safe.
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API StreamingNormalizer : public UMemory {
+public:
+    /**
+     * Default limit for the length of the text that is held back between chunks,
+     * in code units.
+     * @draft ICU 64
+     */
+    static const int32_t DEFAULT_MAX_PENDING_LENGTH = 1024;
+
+    /**
+     * Constructor.
+     * @param n2 the Normalizer2 to use;
+     *           the Normalizer2 must outlive this StreamingNormalizer.
+     * @param maxPendingLength maximum length of the text that is held back between chunks,
+     *           in code units (UChars or bytes); values below 32 are treated as 32
+     * @draft ICU 64
+     */
+    StreamingNormalizer(const Normalizer2 &n2,
+                        int32_t maxPendingLength = DEFAULT_MAX_PENDING_LENGTH);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~StreamingNormalizer();
+
+    /**
+     * Normalizes the next chunk of UTF-16 text, as far as that is possible
+     * without seeing the following text, and appends the result to dest.
+     * @param chunk the next chunk of the input
+     * @param dest destination string; the normalized text is appended to it
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if there is pending UTF-8 text.
+     * @return dest
+     * @draft ICU 64
+     */
+    UnicodeString &normalizeChunk(const UnicodeString &chunk, UnicodeString &dest,
+                                  UErrorCode &errorCode);
+
+    /**
+     * Normalizes the text held back from earlier chunks, appends the result to dest,
+     * and resets this object for a new stream.
+     * @param dest destination string; the normalized text is appended to it
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if there is pending UTF-8 text.
+     * @return dest
+     * @draft ICU 64
+     */
+    UnicodeString &finish(UnicodeString &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of UTF-8 text, as far as that is possible
+     * without seeing the following text, and writes the result to the sink.
+     * The chunk may end with an incomplete UTF-8 sequence which is completed
+     * by the following chunk.
+     * Ill-formed UTF-8 byte sequences are passed through unchanged,
+     * as with Normalizer2::normalizeUTF8().
+     * @param chunk the next chunk of the input
+     * @param sink normalized output is written here
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if there is pending UTF-16 text.
+     * @draft ICU 64
+     */
+    void normalizeChunkUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the UTF-8 text held back from earlier chunks, writes the result to the sink,
+     * and resets this object for a new stream.
+     * @param sink normalized output is written here
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if there is pending UTF-16 text.
+     * @draft ICU 64
+     */
+    void finishUTF8(ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Discards any text held back from earlier chunks.
+     * @draft ICU 64
+     */
+    void reset();
+
+    /**
+     * Returns the length of the text held back from earlier chunks,
+     * in UChars or bytes, whichever was passed in.
+     * @return the pending length
+     * @draft ICU 64
+     */
+    int32_t getPendingLength() const;
+
+private:
+    StreamingNormalizer(const StreamingNormalizer &other);  // not implemented
+    StreamingNormalizer &operator=(const StreamingNormalizer &other);  // not implemented
+
+    const Normalizer2 &norm2;
+    int32_t maxPending;
+    UnicodeString pending;
+    UnicodeString normalized;  // reused output buffer
+    CharString *pending8;  // created on first UTF-8 use
+};
+
+#endif  // U_HIDE_DRAFT_API
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
+
+#endif  // __NORMSTREAM_H__
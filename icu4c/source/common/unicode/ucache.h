@@ -0,0 +1,105 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*****************************************************************************************
+* ucache.h
+*
+* created on: 2018oct19
+*****************************************************************************************
+*/
+
+#ifndef UCACHE_H
+#define UCACHE_H
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C API: Statistics for ICU's shared object cache.
+ *
+ * ICU keeps formatters' and other services' locale data in one process-wide cache,
+ * and evicts unused entries according to an eviction policy.
+ * The statistics show, per type of cached value, how well the cache works:
+ * how often values are found, created, waited for and evicted.
+ * They can be polled at any time, for example to tune the cache size
+ * or to find types whose values are evicted and recreated over and over.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Cache statistics for the values of one type,
+ * accumulated since the cache was created or the statistics were last reset.
+ *
+ * Each cache lookup is counted exactly once: as a hit, a miss, or an in-progress wait.
+ * @draft ICU 64
+ */
+typedef struct UCacheTypeStatistics {
+    /**
+     * Implementation-defined name of the type of the cached values.
+     * It remains valid as long as the ICU library is loaded.
+     * @draft ICU 64
+     */
+    const char *typeName;
+    /**
+     * Number of lookups that found the value, or its creation error, in the cache.
+     * @draft ICU 64
+     */
+    int64_t hits;
+    /**
+     * Number of lookups that did not find the value and created it.
+     * @draft ICU 64
+     */
+    int64_t misses;
+    /**
+     * Number of lookups that waited for another thread to create the value.
+     * These are not counted as hits.
+     * @draft ICU 64
+     */
+    int64_t inProgressWaits;
+    /**
+     * Number of entries removed because of the eviction policy.
+     * @draft ICU 64
+     */
+    int64_t evictions;
+    /**
+     * Total time spent creating values on misses, in milliseconds.
+     * @draft ICU 64
+     */
+    double creationMillis;
+} UCacheTypeStatistics;
+
+/**
+ * Copies the statistics for each type of cached value into dest, in no particular order.
+ * The statistics of different types may be captured at slightly different moments
+ * while other threads use the cache.
+ *
+ * @param dest Destination array; can be NULL if capacity==0 for preflighting.
+ * @param capacity Number of elements in dest.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ *                   Set to U_BUFFER_OVERFLOW_ERROR if there are more types than capacity;
+ *                   then only capacity elements are written.
+ * @return The number of value types with statistics.
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucache_getStatistics(UCacheTypeStatistics *dest, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Resets all of the cache statistics to zero.
+ *
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucache_resetStatistics(UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // UCACHE_H
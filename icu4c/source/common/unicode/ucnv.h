@@ -569,6 +569,57 @@ ucnv_safeClone(const UConverter *cnv,
 U_STABLE void  U_EXPORT2
 ucnv_close(UConverter * converter);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Memory used by a converter, as reported by ucnv_getMemoryUsage().
+ * @draft ICU 64
+ */
+typedef struct UConverterMemoryUsage {
+    /**
+     * Heap bytes owned by this converter object alone:
+     * the UConverter itself, its conversion state and a long substitution string.
+     * @draft ICU 64
+     */
+    int32_t instanceHeapBytes;
+    /**
+     * Heap bytes of the conversion table data that is shared by all converters
+     * opened for the same charset, for example lazily built tables for the
+     * "swaplfnl" option.
+     * Algorithmic converters usually have no shared heap data.
+     * @draft ICU 64
+     */
+    int32_t sharedHeapBytes;
+    /**
+     * Bytes of conversion table data used directly from the loaded ICU data,
+     * which is normally memory-mapped and shared among processes.
+     * 0 if the converter has no table data or if its size is not known.
+     * @draft ICU 64
+     */
+    int32_t mappedBytes;
+} UConverterMemoryUsage;
+
+/**
+ * Reports the memory used by a converter.
+ * This can be used to see how much resident heap memory is attributable to
+ * a converter, separately from the mapping tables that are used directly
+ * from memory-mapped data.
+ *
+ * Conversion tables for the "swaplfnl" option are built lazily,
+ * separately for each conversion direction, the first time they are used;
+ * the sharedHeapBytes reflect what has been built so far.
+ *
+ * @param cnv the converter
+ * @param pUsage receives the memory usage values
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_getMemoryUsage(const UConverter *cnv, UConverterMemoryUsage *pUsage, UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 #if U_SHOW_CPLUSPLUS_API
 
 U_NAMESPACE_BEGIN
@@ -1218,6 +1269,101 @@ ucnv_toUnicode(UConverter *converter,
                UBool flush,
                UErrorCode *err);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * One segment of a scatter/gather buffer chain, similar to a POSIX struct iovec.
+ * Used with ucnv_fromUnicodeSegments() and ucnv_toUnicodeSegments().
+ * @draft ICU 64
+ */
+typedef struct UConverterSegment {
+    /**
+     * Start of the segment: char * for codepage bytes, UChar * for Unicode text.
+     * Can be NULL if length==0.
+     * Source segments are not modified.
+     * @draft ICU 64
+     */
+    void *start;
+    /**
+     * Length of the segment in units of the text type (bytes or UChars), must be >=0.
+     * @draft ICU 64
+     */
+    int32_t length;
+} UConverterSegment;
+
+/**
+ * Converts Unicode text from a chain of source segments into a chain of
+ * target segments of codepage bytes, with the same streaming semantics
+ * as ucnv_fromUnicode().
+ * The converter keeps its state across segment boundaries:
+ * Characters may be split across both source and target segments,
+ * and the output is written directly into the target segments.
+ *
+ * The source and target positions are in/out parameters, each given as
+ * a segment index and an offset into that segment.
+ * The function converts from the source position through the end of the last
+ * source segment, unless all target segments are filled
+ * (U_BUFFER_OVERFLOW_ERROR) or a failing error is returned from a callback.
+ * On return, the positions point after the consumed input and the written output.
+ * To continue with more target segments, call again with the new target chain
+ * and its position set to 0/0; to continue with more input, call again with
+ * the new source chain.
+ *
+ * @param cnv the converter
+ * @param targets array of targetCount segments for the output bytes
+ * @param targetCount number of target segments
+ * @param pTargetIndex in/out: index of the current target segment, 0..targetCount
+ * @param pTargetOffset in/out: number of bytes already written to the current target segment
+ * @param sources array of sourceCount segments with the input UChars
+ * @param sourceCount number of source segments
+ * @param pSourceIndex in/out: index of the current source segment, 0..sourceCount
+ * @param pSourceOffset in/out: number of UChars already consumed from the current source segment
+ * @param flush TRUE if the last source segment is the end of the input stream
+ * @param err ICU error code in/out parameter, see ucnv_fromUnicode()
+ * @see ucnv_fromUnicode
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_fromUnicodeSegments(UConverter *cnv,
+                         const UConverterSegment *targets, int32_t targetCount,
+                         int32_t *pTargetIndex, int32_t *pTargetOffset,
+                         const UConverterSegment *sources, int32_t sourceCount,
+                         int32_t *pSourceIndex, int32_t *pSourceOffset,
+                         UBool flush,
+                         UErrorCode *err);
+
+/**
+ * Converts codepage bytes from a chain of source segments into a chain of
+ * target segments of UChars, with the same streaming semantics
+ * as ucnv_toUnicode().
+ * Otherwise the same as ucnv_fromUnicodeSegments().
+ *
+ * @param cnv the converter
+ * @param targets array of targetCount segments for the output UChars
+ * @param targetCount number of target segments
+ * @param pTargetIndex in/out: index of the current target segment, 0..targetCount
+ * @param pTargetOffset in/out: number of UChars already written to the current target segment
+ * @param sources array of sourceCount segments with the input bytes
+ * @param sourceCount number of source segments
+ * @param pSourceIndex in/out: index of the current source segment, 0..sourceCount
+ * @param pSourceOffset in/out: number of bytes already consumed from the current source segment
+ * @param flush TRUE if the last source segment is the end of the input stream
+ * @param err ICU error code in/out parameter, see ucnv_toUnicode()
+ * @see ucnv_toUnicode
+ * @see ucnv_fromUnicodeSegments
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_toUnicodeSegments(UConverter *cnv,
+                       const UConverterSegment *targets, int32_t targetCount,
+                       int32_t *pTargetIndex, int32_t *pTargetOffset,
+                       const UConverterSegment *sources, int32_t sourceCount,
+                       int32_t *pSourceIndex, int32_t *pSourceOffset,
+                       UBool flush,
+                       UErrorCode *err);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Convert the Unicode string into a codepage string using an existing UConverter.
  * The output string is NUL-terminated if possible.
@@ -1283,6 +1429,216 @@ ucnv_toUChars(UConverter *cnv,
               const char *src, int32_t srcLength,
               UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * An immutable converter descriptor.
+ * It holds a converter in its initial state and can be shared by any number
+ * of threads for one-shot string conversions.
+ * @see ucnv_openDescriptor
+ * @draft ICU 64
+ */
+typedef struct UConverterDescriptor UConverterDescriptor;
+
+/**
+ * Opens an immutable converter descriptor for one-shot string conversions.
+ * The converter name is resolved as in ucnv_open().
+ *
+ * Unlike a UConverter, a descriptor is never modified after it is opened,
+ * so one descriptor can be used concurrently from multiple threads
+ * with ucnv_descriptorFromUChars() and ucnv_descriptorToUChars().
+ * Each of those calls keeps its conversion state on the stack.
+ * For most converters, including all table-based (MBCS/SBCS/DBCS) and
+ * Unicode converters, they neither allocate memory nor take any lock.
+ * Converters with additional state, for example ISO-2022 and HZ,
+ * are cloned with ucnv_safeClone() for each call.
+ *
+ * @param converterName name of the converter, see ucnv_open()
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the descriptor, or NULL if an error occurred;
+ *         must be closed with ucnv_closeDescriptor()
+ * @see ucnv_open
+ * @draft ICU 64
+ */
+U_DRAFT UConverterDescriptor * U_EXPORT2
+ucnv_openDescriptor(const char *converterName, UErrorCode *pErrorCode);
+
+/**
+ * Closes a converter descriptor and releases the converter data it references.
+ * It must not be in use by any thread when it is closed.
+ *
+ * @param descriptor the descriptor to be closed; can be NULL
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_closeDescriptor(UConverterDescriptor *descriptor);
+
+/**
+ * Convert the Unicode string into a codepage string using a shared converter descriptor.
+ * Otherwise the same as ucnv_fromUChars() with a newly opened converter:
+ * The default substitution callback is used, and the output string is NUL-terminated if possible.
+ *
+ * @param descriptor the converter descriptor, not modified
+ * @param dest destination string buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of chars available at dest
+ * @param src the input Unicode string
+ * @param srcLength the input string length, or -1 if NUL-terminated
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the length of the output string, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the string will not fit
+ *         and a buffer of the indicated length would need to be passed in
+ * @see ucnv_fromUChars
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_descriptorFromUChars(const UConverterDescriptor *descriptor,
+                          char *dest, int32_t destCapacity,
+                          const UChar *src, int32_t srcLength,
+                          UErrorCode *pErrorCode);
+
+/**
+ * Convert the codepage string into a Unicode string using a shared converter descriptor.
+ * Otherwise the same as ucnv_toUChars() with a newly opened converter:
+ * The default substitution callback is used, and the output string is NUL-terminated if possible.
+ *
+ * @param descriptor the converter descriptor, not modified
+ * @param dest destination string buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of UChars available at dest
+ * @param src the input codepage string
+ * @param srcLength the input string length, or -1 if NUL-terminated
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the length of the output string, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the string will not fit
+ *         and a buffer of the indicated length would need to be passed in
+ * @see ucnv_toUChars
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_descriptorToUChars(const UConverterDescriptor *descriptor,
+                        UChar *dest, int32_t destCapacity,
+                        const char *src, int32_t srcLength,
+                        UErrorCode *pErrorCode);
+
+/**
+ * Convert the Unicode string into a codepage string using a shared converter descriptor,
+ * splitting the conversion into pieces that are converted on several threads.
+ * The result is the same as from ucnv_descriptorFromUChars(),
+ * optionally with source offsets as from ucnv_fromUnicode().
+ *
+ * The input is split only between code points.
+ * Converters for which fromUnicode conversion can depend on the preceding text,
+ * for example stateful ones like ISO-2022-JP and EBCDIC_STATEFUL ones,
+ * and those with mappings from sequences of code points,
+ * convert the whole string on the calling thread.
+ * Short strings are also converted on the calling thread.
+ *
+ * The converted pieces are buffered in memory,
+ * in bounded amounts per thread, before they are copied into dest.
+ *
+ * @param descriptor the converter descriptor, not modified
+ * @param dest destination string buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of chars available at dest
+ * @param src the input Unicode string
+ * @param srcLength the input string length, or -1 if NUL-terminated
+ * @param offsets if not NULL, then the index of the source UChar for each
+ *                output char is written to offsets[i] (for i<destCapacity),
+ *                or -1 if there is no such index
+ * @param threadCount the maximum number of threads to use;
+ *                    0 for the number of available processors;
+ *                    very large values are reduced to an internal limit
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the length of the output string, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the string will not fit
+ *         and a buffer of the indicated length would need to be passed in
+ * @see ucnv_descriptorFromUChars
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_descriptorFromUCharsParallel(const UConverterDescriptor *descriptor,
+                                  char *dest, int32_t destCapacity,
+                                  const UChar *src, int32_t srcLength,
+                                  int32_t *offsets, int32_t threadCount,
+                                  UErrorCode *pErrorCode);
+
+/**
+ * Convert the codepage string into a Unicode string using a shared converter descriptor,
+ * splitting the conversion into pieces that are converted on several threads.
+ * The result is the same as from ucnv_descriptorToUChars(),
+ * optionally with source offsets as from ucnv_toUnicode().
+ *
+ * The input is split only at character boundaries where the conversion
+ * does not depend on the preceding bytes:
+ * For UTF-8 before any byte that is not a trail byte,
+ * for UTF-16BE/LE and UTF-32BE/LE between code points,
+ * for SBCS and stateless MBCS charsets after a single-byte character
+ * that cannot occur inside a multi-byte sequence, as determined from the
+ * converter's state table (for example, ASCII controls and digits in Shift-JIS).
+ * Other converters, in particular stateful ones like ISO-2022-JP
+ * and EBCDIC_STATEFUL ones, convert the whole string on the calling thread.
+ * Short strings are also converted on the calling thread.
+ *
+ * The converted pieces are buffered in memory,
+ * in bounded amounts per thread, before they are copied into dest.
+ *
+ * @param descriptor the converter descriptor, not modified
+ * @param dest destination string buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of UChars available at dest
+ * @param src the input codepage string
+ * @param srcLength the input string length, or -1 if NUL-terminated
+ * @param offsets if not NULL, then the index of the source byte for each
+ *                output UChar is written to offsets[i] (for i<destCapacity),
+ *                or -1 if there is no such index
+ * @param threadCount the maximum number of threads to use;
+ *                    0 for the number of available processors;
+ *                    very large values are reduced to an internal limit
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the length of the output string, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the string will not fit
+ *         and a buffer of the indicated length would need to be passed in
+ * @see ucnv_descriptorToUChars
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_descriptorToUCharsParallel(const UConverterDescriptor *descriptor,
+                                UChar *dest, int32_t destCapacity,
+                                const char *src, int32_t srcLength,
+                                int32_t *offsets, int32_t threadCount,
+                                UErrorCode *pErrorCode);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterDescriptorPointer
+ * "Smart pointer" class, closes a UConverterDescriptor via ucnv_closeDescriptor().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterDescriptorPointer, UConverterDescriptor, ucnv_closeDescriptor);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Convert a codepage buffer into Unicode one character at a time.
  * The input is completely consumed when the U_INDEX_OUTOFBOUNDS_ERROR is set.
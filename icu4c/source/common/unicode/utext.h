@@ -310,6 +310,67 @@ utext_openCharacterIterator(UText *ut, icu::CharacterIterator *ci, UErrorCode *s
 
 #endif
 
+#ifndef U_HIDE_DRAFT_API
+
+struct UNormalizer2;
+
+/**
+ * Open a read-only UText that presents the normalized form of another UText.
+ *
+ * The source text is normalized on demand, one chunk at a time, as it is accessed;
+ * the normalized form of the whole text is never stored.
+ * This allows for example regular expression matching or break iteration
+ * over the NFC or NFKC_Casefold form of a large document without first
+ * normalizing all of it into a separate string.
+ *
+ * The native indexes of the normalized UText are UTF-16 offsets in the normalized text.
+ * Use utext_getNormalizedSourceIndex() to map them back to native indexes of the source text.
+ * The length of the normalized text is not known until all of the source text has been
+ * normalized, which makes utext_nativeLength() expensive.
+ * Random access is fast for parts of the text that have been accessed before.
+ *
+ * The source UText is used by the normalized UText while it is open;
+ * the caller must not close it or use it otherwise during that time,
+ * and must close it after closing the normalized UText.
+ * Clones of the normalized UText use clones of the source UText.
+ *
+ * @param ut     Pointer to a UText struct.  If NULL, a new UText will be created.
+ *               If non-NULL, must refer to an initialized UText struct, which will then
+ *               be reset to present the normalized source text.
+ * @param src    The source text. Must not be NULL.
+ * @param norm2  The normalizer, for example from unorm2_getNFCInstance().
+ *               Must not be NULL, and must remain valid while the UText is used.
+ * @param status Errors are returned here.
+ * @return       A pointer to the UText.  If a pre-allocated UText was provided, it
+ *               will always be used and returned.
+ * @draft ICU 64
+ */
+U_DRAFT UText * U_EXPORT2
+utext_openNormalized(UText *ut, UText *src, const struct UNormalizer2 *norm2, UErrorCode *status);
+
+/**
+ * Maps a native index of a UText opened with utext_openNormalized()
+ * to the corresponding native index in its source text.
+ *
+ * Text that is unchanged by normalization maps to the exact source position.
+ * A position inside normalized text that differs from its source,
+ * for example a composed character or a reordered sequence of combining marks,
+ * maps to the start of the source text that was normalized together
+ * (the previous normalization boundary).
+ * The iteration position of the UText is set to nativeIndex.
+ *
+ * @param ut          a UText opened with utext_openNormalized()
+ * @param nativeIndex native index in the normalized text; pinned to the text bounds
+ * @param status      Errors are returned here. Set to U_ILLEGAL_ARGUMENT_ERROR
+ *                    if ut was not opened with utext_openNormalized().
+ * @return the native index in the source text
+ * @draft ICU 64
+ */
+U_DRAFT int64_t U_EXPORT2
+utext_getNormalizedSourceIndex(UText *ut, int64_t nativeIndex, UErrorCode *status);
+
+#endif  // U_HIDE_DRAFT_API
+
 
 /**
   *  Clone a UText.  This is much like opening a UText where the source text is itself
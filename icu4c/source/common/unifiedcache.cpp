@@ -12,23 +12,46 @@
 
 #include "unifiedcache.h"
 
-#include <algorithm>      // For std::max()
+#include <algorithm>      // For std::max() and std::min()
 
+#include "unicode/cachestats.h"
+#include "unicode/ucache.h"
+
+#include "cmemory.h"
+#include "cstring.h"
 #include "mutex.h"
+#include "putilimp.h"
 #include "uassert.h"
 #include "uhash.h"
 #include "ucln_cmn.h"
 #include "umutex.h"
 
 static icu::UnifiedCache *gCache = NULL;
-static UMutex gCacheMutex = U_MUTEX_INITIALIZER;
-static UConditionVar gInProgressValueAddedCond = U_CONDITION_INITIALIZER;
+static UMutex gCacheEvictMutex = U_MUTEX_INITIALIZER;
 static icu::UInitOnce gCacheInitOnce = U_INITONCE_INITIALIZER;
 
 static const int32_t MAX_EVICT_ITERATIONS = 10;
 static const int32_t DEFAULT_MAX_UNUSED = 1000;
 static const int32_t DEFAULT_PERCENTAGE_OF_IN_USE = 100;
 
+// Number of hash table shards, a power of 2.
+// Shard i of every UnifiedCache uses gCacheMutexes[i].
+static const int32_t SHARD_COUNT = 16;
+
+static UMutex gCacheMutexes[SHARD_COUNT] = {
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER,
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER,
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER,
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER
+};
+
+static UConditionVar gInProgressValueAddedConds[SHARD_COUNT] = {
+    U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER,
+    U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER,
+    U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER,
+    U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER
+};
+
 
 U_CDECL_BEGIN
 static UBool U_CALLCONV unifiedcache_cleanup() {
@@ -44,6 +67,23 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
+/**
+ * One of the UnifiedCache hash tables, with the mutex that guards it
+ * and the condition variable for waiting on its in-progress entries.
+ * The statistics count the accesses to the entries of this shard,
+ * and are also guarded by its mutex.
+ * fStatsIndexes maps type names to their indexes in fStats, plus 1.
+ */
+struct UnifiedCacheShard : public UMemory {
+    UHashtable *fHashtable;
+    int32_t fEvictPos;
+    UMutex *fMutex;
+    UConditionVar *fInProgressValueAddedCond;
+    MaybeStackArray<UCacheTypeStatistics, 8> fStats;
+    int32_t fStatsCount;
+    UHashtable *fStatsIndexes;
+};
+
 U_CAPI int32_t U_EXPORT2
 ucache_hashKeys(const UHashTok key) {
     const CacheKeyBase *ckey = (const CacheKeyBase *) key.pointer;
@@ -92,8 +132,9 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
 }
 
 UnifiedCache::UnifiedCache(UErrorCode &status) :
-        fHashtable(NULL),
-        fEvictPos(UHASH_FIRST),
+        fShards(nullptr),
+        fEvictShard(0),
+        fNumKeys(0),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
@@ -103,6 +144,20 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     if (U_FAILURE(status)) {
         return;
     }
+    fShards = new UnifiedCacheShard[SHARD_COUNT];
+    if (fShards == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < SHARD_COUNT; ++i) {
+        UnifiedCacheShard &shard = fShards[i];
+        shard.fHashtable = nullptr;
+        shard.fEvictPos = UHASH_FIRST;
+        shard.fMutex = &gCacheMutexes[i];
+        shard.fInProgressValueAddedCond = &gInProgressValueAddedConds[i];
+        shard.fStatsCount = 0;
+        shard.fStatsIndexes = nullptr;
+    }
     fNoValue = new SharedObject();
     if (fNoValue == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -112,15 +167,31 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            NULL,
-            &status);
-    if (U_FAILURE(status)) {
-        return;
+    for (int32_t i = 0; i < SHARD_COUNT; ++i) {
+        UHashtable *hashtable = uhash_open(
+                &ucache_hashKeys,
+                &ucache_compareKeys,
+                NULL,
+                &status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        uhash_setKeyDeleter(hashtable, &ucache_deleteKey);
+        fShards[i].fHashtable = hashtable;
+        // The type names are not owned.
+        fShards[i].fStatsIndexes = uhash_open(
+                uhash_hashChars, uhash_compareChars, NULL, &status);
+        if (U_FAILURE(status)) {
+            return;
+        }
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
+}
+
+UnifiedCacheShard &UnifiedCache::_getShard(const CacheKeyBase &key) const {
+    // The hash table reduces the hash code modulo its length;
+    // mix in the high bits so that the shards are used evenly.
+    uint32_t hash = (uint32_t)key.hashCode();
+    return fShards[(hash ^ (hash >> 16)) & (SHARD_COUNT - 1)];
 }
 
 void UnifiedCache::setEvictionPolicy(
@@ -132,28 +203,91 @@ void UnifiedCache::setEvictionPolicy(
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
-    Mutex lock(&gCacheMutex);
-    fMaxUnused = count;
-    fMaxPercentageOfInUse = percentageOfInUseItems;
+    umtx_storeRelease(fMaxUnused, count);
+    umtx_storeRelease(fMaxPercentageOfInUse, percentageOfInUseItems);
 }
 
 int32_t UnifiedCache::unusedCount() const {
-    Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    return umtx_loadAcquire(fNumKeys) - umtx_loadAcquire(fNumValuesInUse);
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
-    Mutex lock(&gCacheMutex);
+    Mutex lock(&gCacheEvictMutex);
     return fAutoEvictedCount;
 }
 
 int32_t UnifiedCache::keyCount() const {
-    Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable);
+    return umtx_loadAcquire(fNumKeys);
+}
+
+int32_t UnifiedCache::getStatistics(
+        UCacheTypeStatistics *dest, int32_t capacity, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (dest == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // Merge the shards' statistics per type.
+    // The same type name can have different pointers in different shards
+    // when the type is used in several libraries.
+    MaybeStackArray<UCacheTypeStatistics, 8> merged;
+    int32_t length = 0;
+    for (int32_t s = 0; s < SHARD_COUNT; ++s) {
+        UnifiedCacheShard &shard = fShards[s];
+        Mutex lock(shard.fMutex);
+        for (int32_t i = 0; i < shard.fStatsCount; ++i) {
+            const UCacheTypeStatistics &stats = shard.fStats[i];
+            int32_t j = 0;
+            while (j < length && uprv_strcmp(merged[j].typeName, stats.typeName) != 0) {
+                ++j;
+            }
+            if (j == length) {
+                if (length == merged.getCapacity() &&
+                        merged.resize(2 * length, length) == nullptr) {
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    return 0;
+                }
+                merged[length++] = stats;
+            } else {
+                UCacheTypeStatistics &total = merged[j];
+                total.hits += stats.hits;
+                total.misses += stats.misses;
+                total.inProgressWaits += stats.inProgressWaits;
+                total.evictions += stats.evictions;
+                total.creationMillis += stats.creationMillis;
+            }
+        }
+    }
+    if (length > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    int32_t copyLength = std::min(length, capacity);
+    if (copyLength > 0) {
+        uprv_memcpy(dest, merged.getAlias(), copyLength * sizeof(UCacheTypeStatistics));
+    }
+    return length;
+}
+
+void UnifiedCache::resetStatistics() const {
+    // Keep the entries: The cached keys refer to them by index.
+    for (int32_t s = 0; s < SHARD_COUNT; ++s) {
+        UnifiedCacheShard &shard = fShards[s];
+        Mutex lock(shard.fMutex);
+        for (int32_t i = 0; i < shard.fStatsCount; ++i) {
+            UCacheTypeStatistics &stats = shard.fStats[i];
+            stats.hits = 0;
+            stats.misses = 0;
+            stats.inProgressWaits = 0;
+            stats.evictions = 0;
+            stats.creationMillis = 0.0;
+        }
+    }
 }
 
 void UnifiedCache::flush() const {
-    Mutex lock(&gCacheMutex);
+    Mutex lock(&gCacheEvictMutex);
 
     // Use a loop in case cache items that are flushed held hard references to
     // other cache items making those additional cache items eligible for
@@ -162,8 +296,7 @@ void UnifiedCache::flush() const {
 }
 
 void UnifiedCache::handleUnreferencedObject() const {
-    Mutex lock(&gCacheMutex);
-    --fNumValuesInUse;
+    umtx_atomic_dec(&fNumValuesInUse);
     _runEvictionSlice();
 }
 
@@ -181,36 +314,39 @@ void UnifiedCache::dump() {
 }
 
 void UnifiedCache::dumpContents() const {
-    Mutex lock(&gCacheMutex);
     _dumpContents();
 }
 
 // Dumps content of cache.
-// On entry, gCacheMutex must be held.
+// On entry, no cache mutex may be held; each shard is locked while it is dumped.
 // On exit, cache contents dumped to stderr.
 void UnifiedCache::_dumpContents() const {
-    int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != NULL; element = uhash_nextElement(fHashtable, &pos)) {
-        const SharedObject *sharedObject =
-                (const SharedObject *) element->value.pointer;
-        const CacheKeyBase *key =
-                (const CacheKeyBase *) element->key.pointer;
-        if (sharedObject->hasHardReferences()) {
-            ++cnt;
-            fprintf(
-                    stderr,
-                    "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
-                    key->writeDescription(buffer, 256),
-                    key->creationStatus,
-                    sharedObject == fNoValue ? NULL :sharedObject,
-                    sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+    for (int32_t s = 0; s < SHARD_COUNT; ++s) {
+        const UnifiedCacheShard &shard = fShards[s];
+        Mutex lock(shard.fMutex);
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element = uhash_nextElement(shard.fHashtable, &pos);
+        for (; element != NULL; element = uhash_nextElement(shard.fHashtable, &pos)) {
+            const SharedObject *sharedObject =
+                    (const SharedObject *) element->value.pointer;
+            const CacheKeyBase *key =
+                    (const CacheKeyBase *) element->key.pointer;
+            if (sharedObject->hasHardReferences()) {
+                ++cnt;
+                fprintf(
+                        stderr,
+                        "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
+                        key->writeDescription(buffer, 256),
+                        key->creationStatus,
+                        sharedObject == fNoValue ? NULL :sharedObject,
+                        sharedObject->getRefCount(),
+                        umtx_loadAcquire(sharedObject->softRefCount));
+            }
         }
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, keyCount());
 }
 #endif
 
@@ -221,79 +357,123 @@ UnifiedCache::~UnifiedCache() {
         // Now all that should be left in the cache are entries that refer to
         // each other and entries with hard references from outside the cache.
         // Nothing we can do about these so proceed to wipe out the cache.
-        Mutex lock(&gCacheMutex);
+        Mutex lock(&gCacheEvictMutex);
         _flush(TRUE);
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
+    if (fShards != nullptr) {
+        for (int32_t i = 0; i < SHARD_COUNT; ++i) {
+            uhash_close(fShards[i].fHashtable);
+            uhash_close(fShards[i].fStatsIndexes);
+        }
+        delete[] fShards;
+        fShards = nullptr;
+    }
     delete fNoValue;
     fNoValue = nullptr;
 }
 
 const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
+UnifiedCache::_nextElement(UnifiedCacheShard &shard) const {
+    const UHashElement *element = uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
     if (element == NULL) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
+        shard.fEvictPos = UHASH_FIRST;
+        return uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
     }
     return element;
 }
 
 UBool UnifiedCache::_flush(UBool all) const {
     UBool result = FALSE;
-    int32_t origSize = uhash_count(fHashtable);
-    for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
+    if (fShards == nullptr) {
+        return result;
+    }
+    for (int32_t s = 0; s < SHARD_COUNT; ++s) {
+        UnifiedCacheShard &shard = fShards[s];
+        if (shard.fHashtable == nullptr) {
+            continue;
         }
-        if (all || _isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
-            result = TRUE;
+        Mutex lock(shard.fMutex);
+        int32_t origSize = uhash_count(shard.fHashtable);
+        for (int32_t i = 0; i < origSize; ++i) {
+            const UHashElement *element = _nextElement(shard);
+            if (element == nullptr) {
+                break;
+            }
+            if (all || _isEvictable(element)) {
+                const SharedObject *sharedObject =
+                        (const SharedObject *) element->value.pointer;
+                U_ASSERT(sharedObject->cachePtr == this);
+                uhash_removeElement(shard.fHashtable, element);
+                umtx_atomic_dec(&fNumKeys);
+                removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+                result = TRUE;
+            }
         }
     }
     return result;
 }
 
 int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+    int32_t totalItems = umtx_loadAcquire(fNumKeys);
+    int32_t numValuesInUse = umtx_loadAcquire(fNumValuesInUse);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage =
+            numValuesInUse * umtx_loadAcquire(fMaxPercentageOfInUse) / 100;
+    int32_t unusedLimit = std::max(unusedLimitByPercentage, umtx_loadAcquire(fMaxUnused));
     int32_t countOfItemsToEvict = std::max(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
 
 void UnifiedCache::_runEvictionSlice() const {
+    // Usually the cache is within its eviction policy,
+    // and then no mutex needs to be taken.
+    if (_computeCountOfItemsToEvict() <= 0) {
+        return;
+    }
+    Mutex evictLock(&gCacheEvictMutex);
+    // Recompute while holding the lock: another slice may have run meanwhile.
     int32_t maxItemsToEvict = _computeCountOfItemsToEvict();
     if (maxItemsToEvict <= 0) {
         return;
     }
-    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (_isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
+    int32_t iterations = MAX_EVICT_ITERATIONS;
+    // At the end of a shard, continue with the next one.
+    // The starting shard is visited again to wrap around within it.
+    for (int32_t n = 0; n <= SHARD_COUNT && iterations > 0; ++n) {
+        UnifiedCacheShard &shard = fShards[fEvictShard];
+        Mutex lock(shard.fMutex);
+        while (iterations > 0) {
+            const UHashElement *element =
+                    uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
+            if (element == nullptr) {
+                shard.fEvictPos = UHASH_FIRST;
+                fEvictShard = (fEvictShard + 1) & (SHARD_COUNT - 1);
                 break;
             }
+            --iterations;
+            if (_isEvictable(element)) {
+                const SharedObject *sharedObject =
+                        (const SharedObject *) element->value.pointer;
+                UCacheTypeStatistics *stats = _getTypeStatistics(
+                        shard, *(const CacheKeyBase *) element->key.pointer);
+                if (stats != nullptr) {
+                    ++stats->evictions;
+                }
+                uhash_removeElement(shard.fHashtable, element);
+                umtx_atomic_dec(&fNumKeys);
+                removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
+                ++fAutoEvictedCount;
+                if (--maxItemsToEvict == 0) {
+                    return;
+                }
+            }
         }
     }
 }
 
 void UnifiedCache::_putNew(
+        UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -307,33 +487,44 @@ void UnifiedCache::_putNew(
         return;
     }
     keyToAdopt->fCreationStatus = creationStatus;
-    if (value->softRefCount == 0) {
+    keyToAdopt->fStatsIndex = _getTypeStatisticsIndex(shard, key);
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerMaster(keyToAdopt, value);
     }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
+    void *oldValue = uhash_put(shard.fHashtable, keyToAdopt, (void *) value, &status);
     U_ASSERT(oldValue == nullptr);
     (void)oldValue;
     if (U_SUCCESS(status)) {
-        value->softRefCount++;
+        umtx_atomic_inc(&fNumKeys);
+        umtx_atomic_inc(&value->softRefCount);
     }
 }
 
 void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
+        double creationMillis,
         UErrorCode &status) const {
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
-    if (element != NULL && !_inProgress(element)) {
-        _fetch(element, value, status);
-        return;
-    }
-    if (element == NULL) {
-        UErrorCode putError = U_ZERO_ERROR;
-        // best-effort basis only.
-        _putNew(key, value, status, putError);
-    } else {
-        _put(element, value, status);
+    UnifiedCacheShard &shard = _getShard(key);
+    {
+        Mutex lock(shard.fMutex);
+        const UHashElement *element = uhash_find(shard.fHashtable, &key);
+        UCacheTypeStatistics *stats = _getTypeStatistics(
+                shard, element != NULL ? *(const CacheKeyBase *) element->key.pointer : key);
+        if (stats != nullptr) {
+            stats->creationMillis += creationMillis;
+        }
+        if (element != NULL && !_inProgress(element)) {
+            _fetch(element, value, status);
+            return;
+        }
+        if (element == NULL) {
+            UErrorCode putError = U_ZERO_ERROR;
+            // best-effort basis only.
+            _putNew(shard, key, value, status, putError);
+        } else {
+            _put(shard, element, value, status);
+        }
     }
     // Run an eviction slice. This will run even if we added a master entry
     // which doesn't increase the unused count, but that is still o.k
@@ -347,20 +538,32 @@ UBool UnifiedCache::_poll(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    UnifiedCacheShard &shard = _getShard(key);
+    Mutex lock(shard.fMutex);
+    const UHashElement *element = uhash_find(shard.fHashtable, &key);
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
+    UBool waited = FALSE;
      while (element != NULL && _inProgress(element)) {
-        umtx_condWait(&gInProgressValueAddedCond, &gCacheMutex);
-        element = uhash_find(fHashtable, &key);
+        umtx_condWait(shard.fInProgressValueAddedCond, shard.fMutex);
+        element = uhash_find(shard.fHashtable, &key);
+        waited = TRUE;
     }
 
     // If the hash table contains an entry for the key,
     // fetch out the contents and return them.
     if (element != NULL) {
+        UCacheTypeStatistics *stats =
+                _getTypeStatistics(shard, *(const CacheKeyBase *) element->key.pointer);
+        if (stats != nullptr) {
+            if (waited) {
+                ++stats->inProgressWaits;
+            } else {
+                ++stats->hits;
+            }
+        }
          _fetch(element, value, status);
         return TRUE;
     }
@@ -368,7 +571,11 @@ UBool UnifiedCache::_poll(
     // The hash table contained nothing for this key.
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
-    _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    _putNew(shard, key, fNoValue, U_ZERO_ERROR, status);
+    UCacheTypeStatistics *stats = _getTypeStatistics(shard, key);
+    if (stats != nullptr) {
+        ++stats->misses;
+    }
     return FALSE;
 }
 
@@ -388,27 +595,70 @@ void UnifiedCache::_get(
     if (U_FAILURE(status)) {
         return;
     }
+    double start = uprv_getMonotonicMillis();
     value = key.createObject(creationContext, status);
+    double creationMillis = uprv_getMonotonicMillis() - start;
     U_ASSERT(value == NULL || value->hasHardReferences());
     U_ASSERT(value != NULL || status != U_ZERO_ERROR);
     if (value == NULL) {
         SharedObject::copyPtr(fNoValue, value);
     }
-    _putIfAbsentAndGet(key, value, status);
+    _putIfAbsentAndGet(key, value, creationMillis, status);
     if (value == fNoValue) {
         SharedObject::clearPtr(value);
     }
 }
 
+UCacheTypeStatistics *UnifiedCache::_getTypeStatistics(
+        UnifiedCacheShard &shard, const CacheKeyBase &key) const {
+    int32_t index = key.fStatsIndex;
+    if (index < 0) {
+        index = _getTypeStatisticsIndex(shard, key);
+        if (index < 0) {
+            return nullptr;
+        }
+    }
+    return &shard.fStats[index];
+}
+
+int32_t UnifiedCache::_getTypeStatisticsIndex(
+        UnifiedCacheShard &shard, const CacheKeyBase &key) const {
+    const char *typeName = key.getTypeName();
+    int32_t index = uhash_geti(shard.fStatsIndexes, typeName) - 1;
+    if (index >= 0) {
+        return index;
+    }
+    if (shard.fStatsCount == shard.fStats.getCapacity() &&
+            shard.fStats.resize(2 * shard.fStatsCount, shard.fStatsCount) == nullptr) {
+        return -1;
+    }
+    index = shard.fStatsCount;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    uhash_puti(shard.fStatsIndexes, const_cast<char *>(typeName), index + 1, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return -1;
+    }
+    ++shard.fStatsCount;
+    UCacheTypeStatistics &stats = shard.fStats[index];
+    stats.typeName = typeName;
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.inProgressWaits = 0;
+    stats.evictions = 0;
+    stats.creationMillis = 0.0;
+    return index;
+}
+
 void UnifiedCache::_registerMaster(
             const CacheKeyBase *theKey, const SharedObject *value) const {
     theKey->fIsMaster = true;
     value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    umtx_atomic_inc(&fNumValuesTotal);
+    umtx_atomic_inc(&fNumValuesInUse);
 }
 
 void UnifiedCache::_put(
+        UnifiedCacheShard &shard,
         const UHashElement *element,
         const SharedObject *value,
         const UErrorCode status) const {
@@ -416,10 +666,10 @@ void UnifiedCache::_put(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     const SharedObject *oldValue = (const SharedObject *) element->value.pointer;
     theKey->fCreationStatus = status;
-    if (value->softRefCount == 0) {
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerMaster(theKey, value);
     }
-    value->softRefCount++;
+    umtx_atomic_inc(&value->softRefCount);
     UHashElement *ptr = const_cast<UHashElement *>(element);
     ptr->value.pointer = (void *) value;
     U_ASSERT(oldValue == fNoValue);
@@ -427,7 +677,7 @@ void UnifiedCache::_put(
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    umtx_condBroadcast(&gInProgressValueAddedCond);
+    umtx_condBroadcast(shard.fInProgressValueAddedCond);
 }
 
 void UnifiedCache::_fetch(
@@ -437,7 +687,7 @@ void UnifiedCache::_fetch(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     status = theKey->fCreationStatus;
 
-    // Since we have the cache lock, calling regular SharedObject add/removeRef
+    // Since we have a cache lock, calling regular SharedObject add/removeRef
     // could cause us to deadlock on ourselves since they may need to lock
     // the cache mutex.
     removeHardRef(value);
@@ -473,14 +723,15 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
 
     // We can evict entries that are either not a master or have just
     // one reference (The one reference being from the cache itself).
-    return (!theKey->fIsMaster || (theValue->softRefCount == 1 && theValue->noHardReferences()));
+    return (!theKey->fIsMaster ||
+            (umtx_loadAcquire(theValue->softRefCount) == 1 && theValue->noHardReferences()));
 }
 
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
-    U_ASSERT(value->softRefCount > 0);
-    if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+    U_ASSERT(umtx_loadAcquire(value->softRefCount) > 0);
+    if (umtx_atomic_dec(&value->softRefCount) == 0) {
+        umtx_atomic_dec(&fNumValuesTotal);
         if (value->noHardReferences()) {
             delete value;
         } else {
@@ -498,7 +749,7 @@ int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
         if (refCount == 0) {
-            --fNumValuesInUse;
+            umtx_atomic_dec(&fNumValuesInUse);
         }
     }
     return refCount;
@@ -510,10 +761,39 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
         if (refCount == 1) {
-            fNumValuesInUse++;
+            umtx_atomic_inc(&fNumValuesInUse);
         }
     }
     return refCount;
 }
 
+int32_t CacheStatistics::getStatistics(UCacheTypeStatistics *dest, int32_t capacity,
+                                       UErrorCode &errorCode) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    return cache->getStatistics(dest, capacity, errorCode);
+}
+
+void CacheStatistics::reset(UErrorCode &errorCode) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    cache->resetStatistics();
+}
+
 U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI int32_t U_EXPORT2
+ucache_getStatistics(UCacheTypeStatistics *dest, int32_t capacity, UErrorCode *pErrorCode) {
+    return CacheStatistics::getStatistics(dest, capacity, *pErrorCode);
+}
+
+U_CAPI void U_EXPORT2
+ucache_resetStatistics(UErrorCode *pErrorCode) {
+    CacheStatistics::reset(*pErrorCode);
+}
@@ -17,6 +17,7 @@
 
 #include "unicode/uobject.h"
 #include "unicode/locid.h"
+#include "unicode/ucache.h"
 #include "sharedobject.h"
 #include "unicode/unistr.h"
 #include "cstring.h"
@@ -28,19 +29,21 @@ struct UHashElement;
 U_NAMESPACE_BEGIN
 
 class UnifiedCache;
+struct UnifiedCacheShard;
 
 /**
  * A base class for all cache keys.
  */
 class U_COMMON_API CacheKeyBase : public UObject {
  public:
-   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE) {}
+   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE), fStatsIndex(-1) {}
 
    /**
     * Copy constructor. Needed to support cloning.
     */
    CacheKeyBase(const CacheKeyBase &other) 
-           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE) { }
+           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE),
+             fStatsIndex(-1) { }
    virtual ~CacheKeyBase();
 
    /**
@@ -80,6 +83,12 @@ class U_COMMON_API CacheKeyBase : public UObject {
     */
    virtual char *writeDescription(char *buffer, int32_t bufSize) const = 0;
 
+   /**
+    * Returns the name of the type of the values for this key.
+    * Used for grouping the cache statistics.
+    */
+   virtual const char *getTypeName() const = 0;
+
    /**
     * Inequality operator.
     */
@@ -89,6 +98,9 @@ class U_COMMON_API CacheKeyBase : public UObject {
  private:
    mutable UErrorCode fCreationStatus;
    mutable UBool fIsMaster;
+   // Index of the statistics for this key's value type in its cache shard.
+   // Set only on the keys stored in the cache, so that hits need not look up the type.
+   mutable int32_t fStatsIndex;
    friend class UnifiedCache;
 };
 
@@ -120,6 +132,13 @@ class CacheKey : public CacheKeyBase {
        return buffer;
    }
 
+   /**
+    * The type name of the value type, T.
+    */
+   virtual const char *getTypeName() const {
+       return typeid(T).name();
+   }
+
    /**
     * Two objects are equal if they are of the same type.
     */
@@ -341,27 +360,64 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     */
    int32_t unusedCount() const;
 
+   /**
+    * Copies the statistics for each type of cached value into dest,
+    * in no particular order. Can be polled at any time; the statistics of
+    * different types may be captured at slightly different moments.
+    * The typeName is as returned by CacheKeyBase::getTypeName(),
+    * and flush() does not count as eviction.
+    * Public API: ucache_getStatistics() and CacheStatistics.
+    *
+    * @param dest     Destination array; can be NULL if capacity==0.
+    * @param capacity Number of elements in dest.
+    * @param status   Set to U_BUFFER_OVERFLOW_ERROR if there are more
+    *                 types than capacity; then only capacity elements are written.
+    * @return the number of value types with statistics
+    */
+   int32_t getStatistics(
+           UCacheTypeStatistics *dest, int32_t capacity, UErrorCode &status) const;
+
+   /**
+    * Resets all statistics to zero.
+    * The types seen so far are still reported, with zero counts.
+    */
+   void resetStatistics() const;
+
    virtual void handleUnreferencedObject() const;
    virtual ~UnifiedCache();
    
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
+   /**
+    * The entries are spread over several hash tables, each guarded by its own
+    * mutex, so that cache hits in different shards do not wait for each other.
+    * The counts and the eviction policy are global and updated atomically.
+    * Eviction slices and flushes are serialized by gCacheEvictMutex
+    * which guards fEvictShard, the shards' eviction positions and fAutoEvictedCount.
+    * gCacheEvictMutex is always acquired before a shard mutex, never after.
+    */
+   UnifiedCacheShard *fShards;
+   mutable int32_t fEvictShard;
+   mutable u_atomic_int32_t fNumKeys;
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   mutable u_atomic_int32_t fMaxUnused;
+   mutable u_atomic_int32_t fMaxPercentageOfInUse;
    mutable int64_t fAutoEvictedCount;
    SharedObject *fNoValue;
    
    UnifiedCache(const UnifiedCache &other);
    UnifiedCache &operator=(const UnifiedCache &other);
    
+   /**
+    * Returns the shard that holds the entry for the given key.
+    */
+   UnifiedCacheShard &_getShard(const CacheKeyBase &key) const;
+
    /**
     * Flushes the contents of the cache. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns FALSE.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheEvictMutex must be held, and no shard mutex.
     * On exit, those values with are evictable are flushed.
     * 
     *  @param all if false flush evictable items only, which are those with no external
@@ -376,7 +432,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     * Gets value out of cache.
-    * On entry. gCacheMutex must not be held. value must be NULL. status
+    * On entry. no cache mutex may be held. value must be NULL. status
     * must be U_ZERO_ERROR.
     * On exit. value and status set to what is in cache at key or on cache
     * miss the key's createObject() is called and value and status are set to
@@ -393,7 +449,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
     /**
      * Attempts to fetch value and status for key from cache.
-     * On entry, gCacheMutex must not be held value must be NULL and status must
+     * On entry, no cache mutex may be held value must be NULL and status must
      * be U_ZERO_ERROR.
      * On exit, either returns FALSE (In this
      * case caller should try to create the object) or returns TRUE with value
@@ -409,11 +465,12 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, the shard's mutex must be held. key must not exist in the cache.
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
     void _putNew(
+        UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -424,25 +481,46 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * entry for key is in progress. Otherwise, it leaves the current value and
      * status there.
      * 
-     * On entry. gCacheMutex must not be held. Value must be
+     * On entry. no cache mutex may be held. Value must be
      * included in the reference count of the object to which it points.
      * 
      * On exit, value and status are changed to what was already in the cache if
      * something was there and not in progress. Otherwise, value and status are left
      * unchanged in which case they are placed in the cache on a best-effort basis.
+     * creationMillis is added to the statistics for the key's value type.
      * Caller must call removeRef() on value.
      */
    void _putIfAbsentAndGet(
            const CacheKeyBase &key,
            const SharedObject *&value,
+           double creationMillis,
            UErrorCode &status) const;
 
     /**
-     * Returns the next element in the cache round robin style.
-     * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * Returns the statistics for the value type of the given key.
+     * Uses the key's statistics index if it is a key stored in the shard,
+     * otherwise looks up the type, adding an entry for it if necessary.
+     * Returns nullptr if memory allocation failed; then nothing is counted.
+     * On entry, the shard's mutex must be held.
+     */
+    UCacheTypeStatistics *_getTypeStatistics(
+            UnifiedCacheShard &shard, const CacheKeyBase &key) const;
+
+    /**
+     * Returns the index of the statistics for the value type of the given key
+     * in the shard, adding an entry for the type if necessary.
+     * Returns -1 if memory allocation failed.
+     * On entry, the shard's mutex must be held.
+     */
+    int32_t _getTypeStatisticsIndex(
+            UnifiedCacheShard &shard, const CacheKeyBase &key) const;
+
+    /**
+     * Returns the next element in the shard round robin style.
+     * Returns nullptr if the shard is empty.
+     * On entry, gCacheEvictMutex and the shard's mutex must be held.
      */
-    const UHashElement *_nextElement() const;
+    const UHashElement *_nextElement(UnifiedCacheShard &shard) const;
    
    /**
     * Return the number of cache items that would need to be evicted
@@ -450,15 +528,16 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * Reads only atomic counts; no mutex needs to be held.
     */
    int32_t _computeCountOfItemsToEvict() const;
    
    /**
     * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * On entry, no cache mutex may be held.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
     * 10 entries in the cache round robin style evicting them if they are eligible.
+    * It continues with the next shard when it reaches the end of one.
     */
    void _runEvictionSlice() const;
  
@@ -468,7 +547,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce referneces to an already existing SharedObject are not masters -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     * On exit, items in use count incremented, entry is marked as a master
     * entry, and value registered with cache so that subsequent calls to
     * addRef() and removeRef() on it correctly interact with the cache.
@@ -477,27 +556,28 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
         
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
+    * On entry, the shard's mutex must be held. Hash entry element must be in progress.
     * value must be non NULL.
     * On Exit, soft reference added to value. value and status stored in hash
     * entry. Soft reference removed from previous stored value. Waiting
     * threads notified.
     */
    void _put(
+           UnifiedCacheShard &shard,
            const UHashElement *element,
            const SharedObject *value,
            const UErrorCode status) const;
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * The mutex of the shard with the removed entry must be held by caller.
      * @param value the SharedObject to be acted on.
      */
    void removeSoftRef(const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * A shard mutex must be held by the caller.
     * Update numValuesEvictable on transitions between zero and one reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -507,7 +587,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * A shard mutex must be held by the caller.
     * Update numValuesEvictable on transitions between one and zero reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -522,7 +602,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either NULL or must be
+    *  On entry, the shard's mutex must be held. value must be either NULL or must be
     *  included in the ref count of the object to which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
@@ -534,19 +614,19 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, the shard's mutex must be held.
      */
    UBool _inProgress(const UHashElement *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
    UBool _isEvictable(const UHashElement *element) const;
 };
@@ -0,0 +1,141 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* uparallel.cpp
+*
+* created on: 2018oct17
+*/
+
+// Defines _XOPEN_SOURCE for access to POSIX functions.
+// Must be before any other #includes.
+#include "uposixdefs.h"
+
+#include "unicode/utypes.h"
+#include "cmemory.h"
+#include "uparallel.h"
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#   define VC_EXTRALEAN
+#   define WIN32_LEAN_AND_MEAN
+#   define NOUSER
+#   define NOSERVICE
+#   define NOIME
+#   define NOMCX
+#   include <windows.h>
+#   include <process.h>
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+#   include <pthread.h>
+#   include <unistd.h>
+#   define U_PARALLEL_USE_PTHREADS 1
+#endif
+
+namespace {
+
+struct ParallelTaskArgs {
+    UParallelTask *task;
+    void *context;
+    int32_t index;
+};
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+
+typedef HANDLE ThreadHandle;
+
+extern "C" unsigned int __stdcall parallelThreadProc(void *arg) {
+    const ParallelTaskArgs *args = static_cast<const ParallelTaskArgs *>(arg);
+    args->task(args->context, args->index);
+    return 0;
+}
+
+UBool startThread(ThreadHandle &handle, ParallelTaskArgs *args) {
+    unsigned int threadID;
+    handle = (HANDLE)_beginthreadex(NULL, 0, parallelThreadProc, args, 0, &threadID);
+    return handle != 0;
+}
+
+void joinThread(ThreadHandle &handle) {
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+}
+
+#elif defined(U_PARALLEL_USE_PTHREADS)
+
+typedef pthread_t ThreadHandle;
+
+extern "C" void *parallelThreadProc(void *arg) {
+    const ParallelTaskArgs *args = static_cast<const ParallelTaskArgs *>(arg);
+    args->task(args->context, args->index);
+    return NULL;
+}
+
+UBool startThread(ThreadHandle &handle, ParallelTaskArgs *args) {
+    return pthread_create(&handle, NULL, parallelThreadProc, args) == 0;
+}
+
+void joinThread(ThreadHandle &handle) {
+    pthread_join(handle, NULL);
+}
+
+#else
+
+// No thread support: Run everything on the calling thread.
+typedef int32_t ThreadHandle;
+
+UBool startThread(ThreadHandle &, ParallelTaskArgs *) {
+    return FALSE;
+}
+
+void joinThread(ThreadHandle &) {}
+
+#endif
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+uprv_parallelRun(int32_t count, UParallelTask *task, void *context) {
+    if(count <= 0) { return; }
+    if(count == 1) {
+        task(context, 0);
+        return;
+    }
+    icu::MaybeStackArray<ParallelTaskArgs, 16> args;
+    icu::MaybeStackArray<ThreadHandle, 16> handles;
+    icu::MaybeStackArray<UBool, 16> started;
+    if(args.resize(count) == NULL || handles.resize(count) == NULL ||
+            started.resize(count) == NULL) {
+        // Out of memory: Do the work serially.
+        for(int32_t i = 0; i < count; ++i) {
+            task(context, i);
+        }
+        return;
+    }
+    for(int32_t i = 1; i < count; ++i) {
+        args[i].task = task;
+        args[i].context = context;
+        args[i].index = i;
+        started[i] = startThread(handles[i], &args[i]);
+    }
+    task(context, 0);
+    for(int32_t i = 1; i < count; ++i) {
+        if(started[i]) {
+            joinThread(handles[i]);
+        } else {
+            task(context, i);
+        }
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_getDefaultThreadCount() {
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int32_t count = (int32_t)info.dwNumberOfProcessors;
+#elif defined(U_PARALLEL_USE_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+    int32_t count = (int32_t)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    int32_t count = 1;
+#endif
+    return count > 0 ? count : 1;
+}
@@ -0,0 +1,60 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* uparallel.h
+*
+* created on: 2018oct17
+*
+* Minimal support for running independent pieces of work on several threads.
+* ICU does not otherwise create threads; this is only for bulk APIs
+* where the caller explicitly asks for parallel processing.
+*/
+
+#ifndef __UPARALLEL_H__
+#define __UPARALLEL_H__
+
+#include "unicode/utypes.h"
+
+U_CDECL_BEGIN
+
+/**
+ * Function type for one piece of parallel work.
+ * @param context the context pointer passed into uprv_parallelRun()
+ * @param index the index of the piece of work, 0..count-1
+ * @internal
+ */
+typedef void U_CALLCONV
+UParallelTask(void *context, int32_t index);
+
+U_CDECL_END
+
+/**
+ * Calls task(context, i) for each i in 0..count-1, each on its own thread,
+ * and returns when all of them have finished.
+ * Index 0 runs on the calling thread.
+ * If a thread cannot be created, then its task runs on the calling thread instead,
+ * so every index always runs exactly once.
+ * The tasks must not depend on actually running concurrently.
+ * @internal
+ */
+U_CAPI void U_EXPORT2
+uprv_parallelRun(int32_t count, UParallelTask *task, void *context);
+
+/**
+ * @return the number of threads to use for parallel work when the caller
+ *         does not specify it: the number of online processors, at least 1
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_getDefaultThreadCount(void);
+
+/**
+ * Upper limit for the number of threads used by one bulk API call.
+ * Larger requested thread counts are reduced to this value,
+ * which also keeps per-thread work item counts from overflowing.
+ * @internal
+ */
+#define UPRV_MAX_PARALLEL_THREADS 256
+
+#endif  // __UPARALLEL_H__
@@ -82,6 +82,37 @@ u_terminateUChar32s(UChar32 *dest, int32_t destCapacity, int32_t length, UErrorC
 U_CAPI int32_t U_EXPORT2
 u_terminateWChars(wchar_t *dest, int32_t destCapacity, int32_t length, UErrorCode *pErrorCode);
 
+/*
+ * Bulk transcoding kernels for well-formed Unicode text.
+ *
+ * Each function converts whole code points from [*pSrc, srcLimit[ to [*pDest, destLimit[
+ * and advances *pSrc and *pDest past what it converted.
+ * It stops at srcLimit, or before the first ill-formed or truncated sequence
+ * (including unpaired surrogates and values above U+10FFFF),
+ * or before the first code point that does not fit completely into the destination.
+ * NUL is converted like any other code point.
+ * Runs of ASCII are processed one 64-bit word at a time.
+ *
+ * The caller handles the code point where the kernel stopped,
+ * with its own error substitution, preflighting and state handling.
+ */
+
+U_CFUNC void
+uprv_transcodeUTF8ToUTF16(const uint8_t **pSrc, const uint8_t *srcLimit,
+                          UChar **pDest, const UChar *destLimit);
+
+U_CFUNC void
+uprv_transcodeUTF16ToUTF8(const UChar **pSrc, const UChar *srcLimit,
+                          uint8_t **pDest, const uint8_t *destLimit);
+
+U_CFUNC void
+uprv_transcodeUTF8ToUTF32(const uint8_t **pSrc, const uint8_t *srcLimit,
+                          UChar32 **pDest, const UChar32 *destLimit);
+
+U_CFUNC void
+uprv_transcodeUTF32ToUTF8(const UChar32 **pSrc, const UChar32 *srcLimit,
+                          uint8_t **pDest, const uint8_t *destLimit);
+
 /**
  * Counts the bytes of any whole valid sequence for a UTF-8 lead byte.
  * Returns 1 for ASCII 0..0x7f.
@@ -36,6 +36,223 @@
 #include "ustr_imp.h"
 #include "uassert.h"
 
+/* bulk transcoding kernels ------------------------------------------------- */
+
+/*
+ * The kernels convert whole code points and leave everything else to the callers:
+ * Ill-formed input and code points that do not fit into the destination
+ * are handled with the callers' own error substitution and preflighting.
+ *
+ * ASCII runs are tested and copied one 64-bit word at a time
+ * (8 bytes, 4 UChars or 2 UChar32s), with unaligned loads via uprv_memcpy().
+ * Each kernel tries a word loop only after seeing an ASCII code point
+ * so that non-ASCII text does not pay for failing word tests.
+ * The multi-byte sequences are validated like U8_NEXT() with strict checking.
+ */
+
+#define U_ASCII_HIGHS8 0x8080808080808080ULL
+#define U_ASCII_NON_ASCII16 0xff80ff80ff80ff80ULL
+#define U_ASCII_NON_ASCII32 0xffffff80ffffff80ULL
+
+U_CFUNC void
+uprv_transcodeUTF8ToUTF16(const uint8_t **pSrc, const uint8_t *srcLimit,
+                          UChar **pDest, const UChar *destLimit) {
+    const uint8_t *s = *pSrc;
+    UChar *d = *pDest;
+    while(s < srcLimit && d < destLimit) {
+        uint8_t c = *s;
+        if(U8_IS_SINGLE(c)) {
+            *d++ = c;
+            ++s;
+            int32_t n = (int32_t)(srcLimit - s);
+            if(n > (destLimit - d)) { n = (int32_t)(destLimit - d); }
+            for(; n >= 8; n -= 8) {
+                uint64_t w;
+                uprv_memcpy(&w, s, 8);
+                if((w & U_ASCII_HIGHS8) != 0) { break; }
+                d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; d[3] = s[3];
+                d[4] = s[4]; d[5] = s[5]; d[6] = s[6]; d[7] = s[7];
+                s += 8;
+                d += 8;
+            }
+        } else if(c >= 0xe0) {
+            if(c < 0xf0) {
+                if((srcLimit - s) >= 3 && U8_IS_VALID_LEAD3_AND_T1(c, s[1]) && U8_IS_TRAIL(s[2])) {
+                    *d++ = (UChar)(((c & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f));
+                    s += 3;
+                    continue;
+                }
+            } else if(c <= 0xf4 && (srcLimit - s) >= 4 && (destLimit - d) >= 2 &&
+                    U8_IS_VALID_LEAD4_AND_T1(c, s[1]) && U8_IS_TRAIL(s[2]) && U8_IS_TRAIL(s[3])) {
+                UChar32 cp = ((UChar32)(c & 7) << 18) | ((s[1] & 0x3f) << 12) |
+                             ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+                d[0] = U16_LEAD(cp);
+                d[1] = U16_TRAIL(cp);
+                s += 4;
+                d += 2;
+                continue;
+            }
+            break;
+        } else if(c >= 0xc2 && (srcLimit - s) >= 2 && U8_IS_TRAIL(s[1])) {
+            *d++ = (UChar)(((c & 0x1f) << 6) | (s[1] & 0x3f));
+            s += 2;
+        } else {
+            break;
+        }
+    }
+    *pSrc = s;
+    *pDest = d;
+}
+
+U_CFUNC void
+uprv_transcodeUTF16ToUTF8(const UChar **pSrc, const UChar *srcLimit,
+                          uint8_t **pDest, const uint8_t *destLimit) {
+    const UChar *s = *pSrc;
+    uint8_t *d = *pDest;
+    while(s < srcLimit) {
+        UChar c = *s;
+        if(c <= 0x7f) {
+            if(d >= destLimit) { break; }
+            *d++ = (uint8_t)c;
+            ++s;
+            int32_t n = (int32_t)(srcLimit - s);
+            if(n > (destLimit - d)) { n = (int32_t)(destLimit - d); }
+            for(; n >= 4; n -= 4) {
+                uint64_t w;
+                uprv_memcpy(&w, s, 8);
+                if((w & U_ASCII_NON_ASCII16) != 0) { break; }
+                d[0] = (uint8_t)s[0]; d[1] = (uint8_t)s[1];
+                d[2] = (uint8_t)s[2]; d[3] = (uint8_t)s[3];
+                s += 4;
+                d += 4;
+            }
+        } else if(c <= 0x7ff) {
+            if((destLimit - d) < 2) { break; }
+            d[0] = (uint8_t)((c >> 6) | 0xc0);
+            d[1] = (uint8_t)((c & 0x3f) | 0x80);
+            ++s;
+            d += 2;
+        } else if(!U16_IS_SURROGATE(c)) {
+            if((destLimit - d) < 3) { break; }
+            d[0] = (uint8_t)((c >> 12) | 0xe0);
+            d[1] = (uint8_t)(((c >> 6) & 0x3f) | 0x80);
+            d[2] = (uint8_t)((c & 0x3f) | 0x80);
+            ++s;
+            d += 3;
+        } else if(U16_IS_SURROGATE_LEAD(c) && (srcLimit - s) >= 2 && U16_IS_TRAIL(s[1]) &&
+                (destLimit - d) >= 4) {
+            UChar32 cp = U16_GET_SUPPLEMENTARY(c, s[1]);
+            d[0] = (uint8_t)((cp >> 18) | 0xf0);
+            d[1] = (uint8_t)(((cp >> 12) & 0x3f) | 0x80);
+            d[2] = (uint8_t)(((cp >> 6) & 0x3f) | 0x80);
+            d[3] = (uint8_t)((cp & 0x3f) | 0x80);
+            s += 2;
+            d += 4;
+        } else {
+            break;
+        }
+    }
+    *pSrc = s;
+    *pDest = d;
+}
+
+U_CFUNC void
+uprv_transcodeUTF8ToUTF32(const uint8_t **pSrc, const uint8_t *srcLimit,
+                          UChar32 **pDest, const UChar32 *destLimit) {
+    const uint8_t *s = *pSrc;
+    UChar32 *d = *pDest;
+    while(s < srcLimit && d < destLimit) {
+        uint8_t c = *s;
+        if(U8_IS_SINGLE(c)) {
+            *d++ = c;
+            ++s;
+            int32_t n = (int32_t)(srcLimit - s);
+            if(n > (destLimit - d)) { n = (int32_t)(destLimit - d); }
+            for(; n >= 8; n -= 8) {
+                uint64_t w;
+                uprv_memcpy(&w, s, 8);
+                if((w & U_ASCII_HIGHS8) != 0) { break; }
+                d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; d[3] = s[3];
+                d[4] = s[4]; d[5] = s[5]; d[6] = s[6]; d[7] = s[7];
+                s += 8;
+                d += 8;
+            }
+        } else if(c >= 0xe0) {
+            if(c < 0xf0) {
+                if((srcLimit - s) >= 3 && U8_IS_VALID_LEAD3_AND_T1(c, s[1]) && U8_IS_TRAIL(s[2])) {
+                    *d++ = ((c & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+                    s += 3;
+                    continue;
+                }
+            } else if(c <= 0xf4 && (srcLimit - s) >= 4 &&
+                    U8_IS_VALID_LEAD4_AND_T1(c, s[1]) && U8_IS_TRAIL(s[2]) && U8_IS_TRAIL(s[3])) {
+                *d++ = ((UChar32)(c & 7) << 18) | ((s[1] & 0x3f) << 12) |
+                       ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+                s += 4;
+                continue;
+            }
+            break;
+        } else if(c >= 0xc2 && (srcLimit - s) >= 2 && U8_IS_TRAIL(s[1])) {
+            *d++ = ((c & 0x1f) << 6) | (s[1] & 0x3f);
+            s += 2;
+        } else {
+            break;
+        }
+    }
+    *pSrc = s;
+    *pDest = d;
+}
+
+U_CFUNC void
+uprv_transcodeUTF32ToUTF8(const UChar32 **pSrc, const UChar32 *srcLimit,
+                          uint8_t **pDest, const uint8_t *destLimit) {
+    const UChar32 *s = *pSrc;
+    uint8_t *d = *pDest;
+    while(s < srcLimit) {
+        uint32_t c = (uint32_t)*s;
+        if(c <= 0x7f) {
+            if(d >= destLimit) { break; }
+            *d++ = (uint8_t)c;
+            ++s;
+            int32_t n = (int32_t)(srcLimit - s);
+            if(n > (destLimit - d)) { n = (int32_t)(destLimit - d); }
+            for(; n >= 2; n -= 2) {
+                uint64_t w;
+                uprv_memcpy(&w, s, 8);
+                if((w & U_ASCII_NON_ASCII32) != 0) { break; }
+                d[0] = (uint8_t)s[0];
+                d[1] = (uint8_t)s[1];
+                s += 2;
+                d += 2;
+            }
+        } else if(c <= 0x7ff) {
+            if((destLimit - d) < 2) { break; }
+            d[0] = (uint8_t)((c >> 6) | 0xc0);
+            d[1] = (uint8_t)((c & 0x3f) | 0x80);
+            ++s;
+            d += 2;
+        } else if(c <= 0xffff) {
+            if(U_IS_SURROGATE(c) || (destLimit - d) < 3) { break; }
+            d[0] = (uint8_t)((c >> 12) | 0xe0);
+            d[1] = (uint8_t)(((c >> 6) & 0x3f) | 0x80);
+            d[2] = (uint8_t)((c & 0x3f) | 0x80);
+            ++s;
+            d += 3;
+        } else if(c <= 0x10ffff && (destLimit - d) >= 4) {
+            d[0] = (uint8_t)((c >> 18) | 0xf0);
+            d[1] = (uint8_t)(((c >> 12) & 0x3f) | 0x80);
+            d[2] = (uint8_t)(((c >> 6) & 0x3f) | 0x80);
+            d[3] = (uint8_t)((c & 0x3f) | 0x80);
+            ++s;
+            d += 4;
+        } else {
+            break;
+        }
+    }
+    *pSrc = s;
+    *pDest = d;
+}
+
 U_CAPI UChar* U_EXPORT2 
 u_strFromUTF32WithSub(UChar *dest,
                int32_t destCapacity,
@@ -375,113 +592,32 @@ u_strFromUTF8WithSub(UChar *dest,
             }
         }
     } else /* srcLength >= 0 */ {
-        /* Faster loop without ongoing checking for srcLength and pDestLimit. */
         int32_t i = 0;
         UChar32 c;
-        for(;;) {
-            /*
-             * Each iteration of the inner loop progresses by at most 3 UTF-8
-             * bytes and one UChar, for most characters.
-             * For supplementary code points (4 & 2), which are rare,
-             * there is an additional adjustment.
-             */
-            int32_t count = (int32_t)(pDestLimit - pDest);
-            int32_t count2 = (srcLength - i) / 3;
-            if(count > count2) {
-                count = count2; /* min(remaining dest, remaining src/3) */
-            }
-            if(count < 3) {
-                /*
-                 * Too much overhead if we get near the end of the string,
-                 * continue with the next loop.
-                 */
+        while(i < srcLength && (pDest < pDestLimit)) {
+            /* Bulk-convert well-formed text, up to an error or a too-long character. */
+            const uint8_t *s = (const uint8_t *)src + i;
+            uprv_transcodeUTF8ToUTF16(&s, (const uint8_t *)src + srcLength, &pDest, pDestLimit);
+            i = (int32_t)(s - (const uint8_t *)src);
+            if(i == srcLength || pDest == pDestLimit) {
                 break;
             }
 
-            do {
-                // modified copy of U8_NEXT()
-                c = (uint8_t)src[i++];
-                if(U8_IS_SINGLE(c)) {
-                    *pDest++=(UChar)c;
-                } else {
-                    uint8_t __t1, __t2;
-                    if( /* handle U+0800..U+FFFF inline */
-                            (0xe0<=(c) && (c)<0xf0) &&
-                            ((i)+1)<srcLength &&
-                            U8_IS_VALID_LEAD3_AND_T1((c), src[i]) &&
-                            (__t2=src[(i)+1]-0x80)<=0x3f) {
-                        *pDest++ = (((c)&0xf)<<12)|((src[i]&0x3f)<<6)|__t2;
-                        i+=2;
-                    } else if( /* handle U+0080..U+07FF inline */
-                            ((c)<0xe0 && (c)>=0xc2) &&
-                            ((i)!=srcLength) &&
-                            (__t1=src[i]-0x80)<=0x3f) {
-                        *pDest++ = (((c)&0x1f)<<6)|__t1;
-                        ++(i);
-                    } else {
-                        if(c >= 0xf0 || subchar > 0xffff) {
-                            // We may read up to four bytes and write up to two UChars,
-                            // which we didn't account for with computing count,
-                            // so we adjust it here.
-                            if(--count == 0) {
-                                --i;  // back out byte c
-                                break;
-                            }
-                        }
-
-                        /* function call for "complicated" and error cases */
-                        (c)=utf8_nextCharSafeBody((const uint8_t *)src, &(i), srcLength, c, -1);
-                        if(c<0 && (++numSubstitutions, c = subchar) < 0) {
-                            *pErrorCode = U_INVALID_CHAR_FOUND;
-                            return NULL;
-                        } else if(c<=0xFFFF) {
-                            *(pDest++)=(UChar)c;
-                        } else {
-                            *(pDest++)=U16_LEAD(c);
-                            *(pDest++)=U16_TRAIL(c);
-                        }
-                    }
-                }
-            } while(--count > 0);
-        }
-
-        while(i < srcLength && (pDest < pDestLimit)) {
-            // modified copy of U8_NEXT()
+            /* function call for "complicated" and error cases */
             c = (uint8_t)src[i++];
-            if(U8_IS_SINGLE(c)) {
-                *pDest++=(UChar)c;
+            (c)=utf8_nextCharSafeBody((const uint8_t *)src, &(i), srcLength, c, -1);
+            if(c<0 && (++numSubstitutions, c = subchar) < 0) {
+                *pErrorCode = U_INVALID_CHAR_FOUND;
+                return NULL;
+            } else if(c<=0xFFFF) {
+                *(pDest++)=(UChar)c;
             } else {
-                uint8_t __t1, __t2;
-                if( /* handle U+0800..U+FFFF inline */
-                        (0xe0<=(c) && (c)<0xf0) &&
-                        ((i)+1)<srcLength &&
-                        U8_IS_VALID_LEAD3_AND_T1((c), src[i]) &&
-                        (__t2=src[(i)+1]-0x80)<=0x3f) {
-                    *pDest++ = (((c)&0xf)<<12)|((src[i]&0x3f)<<6)|__t2;
-                    i+=2;
-                } else if( /* handle U+0080..U+07FF inline */
-                        ((c)<0xe0 && (c)>=0xc2) &&
-                        ((i)!=srcLength) &&
-                        (__t1=src[i]-0x80)<=0x3f) {
-                    *pDest++ = (((c)&0x1f)<<6)|__t1;
-                    ++(i);
+                *(pDest++)=U16_LEAD(c);
+                if(pDest<pDestLimit) {
+                    *(pDest++)=U16_TRAIL(c);
                 } else {
-                    /* function call for "complicated" and error cases */
-                    (c)=utf8_nextCharSafeBody((const uint8_t *)src, &(i), srcLength, c, -1);
-                    if(c<0 && (++numSubstitutions, c = subchar) < 0) {
-                        *pErrorCode = U_INVALID_CHAR_FOUND;
-                        return NULL;
-                    } else if(c<=0xFFFF) {
-                        *(pDest++)=(UChar)c;
-                    } else {
-                        *(pDest++)=U16_LEAD(c);
-                        if(pDest<pDestLimit) {
-                            *(pDest++)=U16_TRAIL(c);
-                        } else {
-                            reqLength++;
-                            break;
-                        }
-                    }
+                    reqLength++;
+                    break;
                 }
             }
         }
@@ -895,77 +1031,13 @@ u_strToUTF8WithSub(char *dest,
         }
     } else {
         const UChar *pSrcLimit = (pSrc!=NULL)?(pSrc+srcLength):NULL;
-        int32_t count;
 
-        /* Faster loop without ongoing checking for pSrcLimit and pDestLimit. */
-        for(;;) {
-            /*
-             * Each iteration of the inner loop progresses by at most 3 UTF-8
-             * bytes and one UChar, for most characters.
-             * For supplementary code points (4 & 2), which are rare,
-             * there is an additional adjustment.
-             */
-            count = (int32_t)((pDestLimit - pDest) / 3);
-            srcLength = (int32_t)(pSrcLimit - pSrc);
-            if(count > srcLength) {
-                count = srcLength; /* min(remaining dest/3, remaining src) */
-            }
-            if(count < 3) {
-                /*
-                 * Too much overhead if we get near the end of the string,
-                 * continue with the next loop.
-                 */
+        while(pSrc<pSrcLimit) {
+            /* Bulk-convert well-formed text, up to an unpaired surrogate or a too-long character. */
+            uprv_transcodeUTF16ToUTF8(&pSrc, pSrcLimit, &pDest, pDestLimit);
+            if(pSrc>=pSrcLimit) {
                 break;
             }
-            do {
-                ch=*pSrc++;
-                if(ch <= 0x7f) {
-                    *pDest++ = (uint8_t)ch;
-                } else if(ch <= 0x7ff) {
-                    *pDest++=(uint8_t)((ch>>6)|0xc0);
-                    *pDest++=(uint8_t)((ch&0x3f)|0x80);
-                } else if(ch <= 0xd7ff || ch >= 0xe000) {
-                    *pDest++=(uint8_t)((ch>>12)|0xe0);
-                    *pDest++=(uint8_t)(((ch>>6)&0x3f)|0x80);
-                    *pDest++=(uint8_t)((ch&0x3f)|0x80);
-                } else /* ch is a surrogate */ {
-                    /*
-                     * We will read two UChars and probably output four bytes,
-                     * which we didn't account for with computing count,
-                     * so we adjust it here.
-                     */
-                    if(--count == 0) {
-                        --pSrc; /* undo ch=*pSrc++ for the lead surrogate */
-                        break;  /* recompute count */
-                    }
-
-                    if(U16_IS_SURROGATE_LEAD(ch) && U16_IS_TRAIL(ch2=*pSrc)) { 
-                        ++pSrc;
-                        ch=U16_GET_SUPPLEMENTARY(ch, ch2);
-
-                        /* writing 4 bytes per 2 UChars is ok */
-                        *pDest++=(uint8_t)((ch>>18)|0xf0);
-                        *pDest++=(uint8_t)(((ch>>12)&0x3f)|0x80);
-                        *pDest++=(uint8_t)(((ch>>6)&0x3f)|0x80);
-                        *pDest++=(uint8_t)((ch&0x3f)|0x80);
-                    } else  {
-                        /* Unicode 3.2 forbids surrogate code points in UTF-8 */
-                        if(subchar>=0) {
-                            ch=subchar;
-                            ++numSubstitutions;
-                        } else {
-                            *pErrorCode = U_INVALID_CHAR_FOUND;
-                            return NULL;
-                        }
-
-                        /* convert and append*/
-                        pDest=_appendUTF8(pDest, ch);
-                    }
-                }
-            } while(--count > 0);
-        }
-
-        while(pSrc<pSrcLimit) {
             ch=*pSrc++;
             if(ch <= 0x7f) {
                 if(pDest<pDestLimit) {
@@ -0,0 +1,455 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// utext_norm.cpp
+// created: 2018oct24
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/normalizer2.h"
+#include "unicode/unistr.h"
+#include "unicode/unorm2.h"
+#include "unicode/ustring.h"
+#include "unicode/utext.h"
+#include "unicode/utf16.h"
+#include "ustr_imp.h"
+#include "uvectr32.h"
+#include "uvectr64.h"
+
+//------------------------------------------------------------------------------
+//
+//     UText implementation for the normalized form of another UText
+//
+//         The native indexes are UTF-16 offsets in the normalized text.
+//         The source text is normalized in chunks that begin and end
+//         at normalization boundaries. The start of each chunk is recorded
+//         (as a pair of source and normalized indexes) when the chunk is first
+//         normalized, so that access to text seen before does not have to
+//         start over at the beginning of the text.
+//
+//         Use of UText data members:
+//            context    pointer to the source UText
+//            p          pointer to the NormalizingText with the state
+//
+//------------------------------------------------------------------------------
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Minimum number of source UChars per chunk.
+const int32_t CHUNK_SOURCE_LENGTH = 128;
+
+class NormalizingText : public UMemory {
+public:
+    NormalizingText(const Normalizer2 &n2, UText *src, UErrorCode &errorCode)
+            : norm2(n2), source(src), ownsSource(FALSE),
+              chunkSourceStarts(errorCode), chunkStarts(errorCode),
+              haveLength(FALSE), length(0),
+              chunkIndex(-1), chunkMap(errorCode), chunkLimitSourceOffset(0),
+              sourceMap(errorCode) {
+        chunkSourceStarts.addElement(0, errorCode);
+        chunkStarts.addElement(0, errorCode);
+    }
+    ~NormalizingText() {
+        if(ownsSource) {
+            utext_close(source);
+        }
+    }
+
+    UBool copyChunkStarts(const NormalizingText &other, UErrorCode &errorCode) {
+        chunkSourceStarts.assign(other.chunkSourceStarts, errorCode);
+        chunkStarts.assign(other.chunkStarts, errorCode);
+        haveLength = other.haveLength;
+        length = other.length;
+        return U_SUCCESS(errorCode);
+    }
+
+    int32_t getNumChunks() const { return chunkStarts.size(); }
+    int64_t getChunkStart(int32_t k) const { return chunkStarts.elementAti(k); }
+    /** @return the native limit of the current chunk */
+    int64_t getChunkLimit() const { return getChunkStart(chunkIndex) + chunk.length(); }
+
+    /** Returns the index of the chunk that contains index, or may contain it if it was not seen yet. */
+    int32_t findChunk(int64_t index) const;
+
+    /**
+     * Normalizes the k-th chunk of the text.
+     * @return FALSE if the chunk is empty, at the end of the text
+     */
+    UBool loadChunk(int32_t k, UErrorCode &errorCode);
+
+    /** Normalizes the rest of the text if necessary, to find its length. */
+    int64_t getLength(UErrorCode &errorCode);
+
+    /** Sets up ut for the current chunk. */
+    void setChunk(UText *ut) const {
+        ut->chunkContents = chunk.getBuffer();
+        ut->chunkLength = chunk.length();
+        ut->chunkNativeStart = getChunkStart(chunkIndex);
+        ut->chunkNativeLimit = ut->chunkNativeStart + ut->chunkLength;
+        ut->nativeIndexingLimit = ut->chunkLength;
+    }
+
+    /** @return source native index corresponding to the offset in the current chunk */
+    int64_t getSourceIndex(int32_t offset) const {
+        return chunkSourceStarts.elementAti(chunkIndex) +
+            (offset < chunk.length() ? chunkMap.elementAti(offset) : chunkLimitSourceOffset);
+    }
+
+    const Normalizer2 &norm2;
+    UText *source;
+    UBool ownsSource;
+
+private:
+    void normalizeRun(int32_t start, UErrorCode &errorCode);
+
+    // Source and normalized native start indexes of the chunks seen so far.
+    UVector64 chunkSourceStarts;
+    UVector64 chunkStarts;
+    // Set once the end of the source text has been seen.
+    UBool haveLength;
+    int64_t length;
+
+    // The current chunk, and for each of its UChars the source native index
+    // relative to the chunk's source start.
+    int32_t chunkIndex;
+    UnicodeString chunk;
+    UVector32 chunkMap;
+    int32_t chunkLimitSourceOffset;
+
+    // Source text of the current chunk, with the relative native index of each UChar.
+    UnicodeString sourceText;
+    UVector32 sourceMap;
+    UnicodeString segment;
+};
+
+int32_t NormalizingText::findChunk(int64_t index) const {
+    // Binary search for the last chunk that starts at or before index.
+    int32_t start = 0;
+    int32_t limit = chunkStarts.size();
+    while((limit - start) > 1) {
+        int32_t mid = (start + limit) / 2;
+        if(index < chunkStarts.elementAti(mid)) {
+            limit = mid;
+        } else {
+            start = mid;
+        }
+    }
+    return start;
+}
+
+UBool NormalizingText::loadChunk(int32_t k, UErrorCode &errorCode) {
+    if(k == chunkIndex) {
+        return !chunk.isEmpty();
+    }
+    chunkIndex = -1;
+    chunk.remove();
+    chunkMap.removeAllElements();
+    sourceText.remove();
+    sourceMap.removeAllElements();
+    if(U_FAILURE(errorCode)) { return FALSE; }
+    int64_t sourceStart = chunkSourceStarts.elementAti(k);
+    UTEXT_SETNATIVEINDEX(source, sourceStart);
+    UBool atEnd = FALSE;
+    // Collect source text up to a normalization boundary,
+    // more until the normalized text is not empty.
+    do {
+        int32_t runStart = sourceText.length();
+        for(;;) {
+            int64_t sourceIndex = UTEXT_GETNATIVEINDEX(source);
+            UChar32 c = UTEXT_CURRENT32(source);
+            if(c < 0) {
+                atEnd = TRUE;
+                chunkLimitSourceOffset = (int32_t)(sourceIndex - sourceStart);
+                break;
+            }
+            if((sourceText.length() - runStart) >= CHUNK_SOURCE_LENGTH && norm2.hasBoundaryBefore(c)) {
+                chunkLimitSourceOffset = (int32_t)(sourceIndex - sourceStart);
+                break;
+            }
+            UTEXT_NEXT32(source);
+            sourceText.append(c);
+            sourceMap.addElement((int32_t)(sourceIndex - sourceStart), errorCode);
+            if(U_IS_SUPPLEMENTARY(c)) {
+                sourceMap.addElement((int32_t)(sourceIndex - sourceStart), errorCode);
+            }
+        }
+        normalizeRun(runStart, errorCode);
+        if(U_FAILURE(errorCode)) {
+            chunk.remove();
+            return FALSE;
+        }
+    } while(chunk.isEmpty() && !atEnd);
+    chunkIndex = k;
+    if(k == (chunkStarts.size() - 1) && !haveLength) {
+        int64_t limit = chunkStarts.elementAti(k) + chunk.length();
+        if(atEnd) {
+            haveLength = TRUE;
+            length = limit;
+        } else {
+            chunkSourceStarts.addElement(sourceStart + chunkLimitSourceOffset, errorCode);
+            chunkStarts.addElement(limit, errorCode);
+        }
+    }
+    return !chunk.isEmpty();
+}
+
+void NormalizingText::normalizeRun(int32_t start, UErrorCode &errorCode) {
+    const UChar *s = sourceText.getBuffer();
+    int32_t limit = sourceText.length();
+    // Copy the normalized prefix, up to a boundary.
+    int32_t i = start + norm2.spanQuickCheckYes(
+        UnicodeString(FALSE, s + start, limit - start), errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    while(i > start && i < limit) {
+        UChar32 c;
+        U16_GET(s, start, i, limit, c);
+        if(norm2.hasBoundaryBefore(c)) { break; }
+        U16_BACK_1(s, start, i);
+    }
+    chunk.append(s, start, i - start);
+    for(int32_t j = start; j < i; ++j) {
+        chunkMap.addElement(sourceMap.elementAti(j), errorCode);
+    }
+    // Normalize the rest one segment at a time.
+    while(i < limit) {
+        int32_t segmentStart = i;
+        UChar32 c;
+        U16_FWD_1(s, i, limit);
+        while(i < limit) {
+            U16_GET(s, start, i, limit, c);
+            if(norm2.hasBoundaryBefore(c)) { break; }
+            U16_FWD_1(s, i, limit);
+        }
+        UnicodeString segmentSource(FALSE, s + segmentStart, i - segmentStart);
+        norm2.normalize(segmentSource, segment, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        chunk.append(segment);
+        if(segment == segmentSource) {
+            for(int32_t j = segmentStart; j < i; ++j) {
+                chunkMap.addElement(sourceMap.elementAti(j), errorCode);
+            }
+        } else {
+            int32_t segmentSourceStart = sourceMap.elementAti(segmentStart);
+            for(int32_t j = 0; j < segment.length(); ++j) {
+                chunkMap.addElement(segmentSourceStart, errorCode);
+            }
+        }
+    }
+}
+
+int64_t NormalizingText::getLength(UErrorCode &errorCode) {
+    while(!haveLength && U_SUCCESS(errorCode)) {
+        loadChunk(chunkStarts.size() - 1, errorCode);
+    }
+    return length;
+}
+
+inline NormalizingText *getNormalizingText(const UText *ut) {
+    return static_cast<NormalizingText *>(const_cast<void *>(ut->p));
+}
+
+}  // namespace
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+normTextAccess(UText *ut, int64_t index, UBool forward) {
+    NormalizingText *nt = getNormalizingText(ut);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    if(index < 0) {
+        index = 0;
+    }
+    // The index of the UChar that must be in the chunk.
+    int64_t target = forward ? index : index - 1;
+    int32_t k = nt->findChunk(target);
+    for(;;) {
+        if(!nt->loadChunk(k, errorCode)) {
+            // Empty chunk at the end of the text, or an empty text.
+            if(k > 0) {
+                nt->loadChunk(--k, errorCode);
+            }
+            break;
+        }
+        if(target < nt->getChunkLimit() || (k + 1) == nt->getNumChunks()) {
+            // Found the chunk, or the last chunk.
+            break;
+        }
+        ++k;
+    }
+    if(U_FAILURE(errorCode)) {
+        // Leave ut with an empty chunk.
+        ut->chunkLength = ut->chunkOffset = ut->nativeIndexingLimit = 0;
+        ut->chunkNativeLimit = ut->chunkNativeStart;
+        return FALSE;
+    }
+    nt->setChunk(ut);
+    if(index > ut->chunkNativeLimit) {
+        index = ut->chunkNativeLimit;
+    } else if(index < ut->chunkNativeStart) {
+        index = ut->chunkNativeStart;
+    }
+    ut->chunkOffset = (int32_t)(index - ut->chunkNativeStart);
+    return forward ? ut->chunkOffset < ut->chunkLength : ut->chunkOffset > 0;
+}
+
+static int64_t U_CALLCONV
+normTextLength(UText *ut) {
+    NormalizingText *nt = getNormalizingText(ut);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int64_t index = UTEXT_GETNATIVEINDEX(ut);
+    int64_t length = nt->getLength(errorCode);
+    // Normalizing to the end replaced the current chunk.
+    normTextAccess(ut, index, TRUE);
+    return length;
+}
+
+static UText * U_CALLCONV
+normTextClone(UText *dest, const UText *src, UBool deep, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    NormalizingText *srcNT = getNormalizingText(src);
+    // The source UText is cloned even for a shallow clone
+    // because its iteration position is part of the state.
+    UText *source = utext_clone(NULL, srcNT->source, deep, TRUE, status);
+    if (U_FAILURE(*status)) {
+        return dest;
+    }
+    dest = utext_openNormalized(dest, source,
+                                reinterpret_cast<const UNormalizer2 *>(&srcNT->norm2), status);
+    if (U_FAILURE(*status)) {
+        utext_close(source);
+        return dest;
+    }
+    NormalizingText *destNT = getNormalizingText(dest);
+    destNT->ownsSource = TRUE;
+    if (destNT->copyChunkStarts(*srcNT, *status)) {
+        utext_setNativeIndex(dest, utext_getNativeIndex(src));
+    }
+    return dest;
+}
+
+static int32_t U_CALLCONV
+normTextExtract(UText *ut,
+                int64_t start, int64_t limit,
+                UChar *dest, int32_t destCapacity,
+                UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return 0;
+    }
+    if(destCapacity<0 || (dest==NULL && destCapacity>0) || start>limit) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t destLength = 0;
+    utext_setNativeIndex(ut, start);  // Moves to the lead of a surrogate pair, if needed.
+    while(UTEXT_GETNATIVEINDEX(ut) < limit) {
+        if(ut->chunkOffset == ut->chunkLength &&
+                !normTextAccess(ut, ut->chunkNativeLimit, TRUE)) {
+            break;
+        }
+        int32_t chunkLimit = ut->chunkLength;
+        if(limit < ut->chunkNativeLimit) {
+            chunkLimit = (int32_t)(limit - ut->chunkNativeStart);
+            // Do not split a surrogate pair.
+            if(chunkLimit > 0 && U16_IS_LEAD(ut->chunkContents[chunkLimit - 1]) &&
+                    U16_IS_TRAIL(ut->chunkContents[chunkLimit])) {
+                ++chunkLimit;
+            }
+        }
+        int32_t n = chunkLimit - ut->chunkOffset;
+        if(destLength < destCapacity) {
+            int32_t copyLength = n <= (destCapacity - destLength) ? n : destCapacity - destLength;
+            u_memcpy(dest + destLength, ut->chunkContents + ut->chunkOffset, copyLength);
+        }
+        destLength += n;
+        ut->chunkOffset = chunkLimit;
+    }
+    u_terminateUChars(dest, destCapacity, destLength, status);
+    return destLength;
+}
+
+static void U_CALLCONV
+normTextClose(UText *ut) {
+    delete getNormalizingText(ut);
+    ut->p = NULL;
+}
+
+static const struct UTextFuncs normTextFuncs =
+{
+    sizeof(UTextFuncs),
+    0, 0, 0,             // Reserved alignment padding
+    normTextClone,
+    normTextLength,
+    normTextAccess,
+    normTextExtract,
+    NULL,                // Replace
+    NULL,                // Copy
+    NULL,                // MapOffsetToNative,
+    NULL,                // MapIndexToUTF16,
+    normTextClose,
+    NULL,                // spare 1
+    NULL,                // spare 2
+    NULL                 // spare 3
+};
+
+U_CDECL_END
+
+U_CAPI UText * U_EXPORT2
+utext_openNormalized(UText *ut, UText *src, const UNormalizer2 *norm2, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return ut;
+    }
+    if (src == NULL || norm2 == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return ut;
+    }
+    NormalizingText *nt = new NormalizingText(
+        *reinterpret_cast<const Normalizer2 *>(norm2), src, *status);
+    if (nt == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return ut;
+    }
+    ut = utext_setup(ut, 0, status);
+    if (U_FAILURE(*status)) {
+        delete nt;
+        return ut;
+    }
+    ut->pFuncs = &normTextFuncs;
+    ut->p = nt;
+    ut->context = src;
+    ut->providerProperties = (int32_t)1 << UTEXT_PROVIDER_LENGTH_IS_EXPENSIVE;
+    // The first access normalizes the first chunk.
+    // The initial chunk start and offset sum to zero so that
+    // utext_getNativeIndex() returns 0 before any access.
+    ut->chunkContents = NULL;
+    ut->chunkNativeStart = -1;
+    ut->chunkOffset = 1;
+    ut->chunkNativeLimit = 0;
+    ut->chunkLength = 0;
+    ut->nativeIndexingLimit = ut->chunkOffset;
+    return ut;
+}
+
+U_CAPI int64_t U_EXPORT2
+utext_getNormalizedSourceIndex(UText *ut, int64_t nativeIndex, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (ut == NULL || ut->pFuncs != &normTextFuncs) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    utext_setNativeIndex(ut, nativeIndex);
+    return getNormalizingText(ut)->getSourceIndex(ut->chunkOffset);
+}
+
+#endif  // !UCONFIG_NO_NORMALIZATION
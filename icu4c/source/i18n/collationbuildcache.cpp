@@ -0,0 +1,322 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* collationbuildcache.cpp
+*
+* created on: 2018oct18
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include <stddef.h>
+#include <stdio.h>
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#   include <process.h>
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+#   include <unistd.h>
+#endif
+
+#include "unicode/icudataver.h"
+#include "unicode/localpointer.h"
+#include "unicode/tblcoll.h"
+#include "unicode/ucol.h"
+#include "unicode/ustring.h"
+#include "unicode/uversion.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "collationbuildcache.h"
+#include "collationdatareader.h"
+#include "collationdatawriter.h"
+#include "collationroot.h"
+#include "collationtailoring.h"
+#include "umutex.h"
+#include "ustr_imp.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/**
+ * Start of a cache file. It is followed by the rule string (UChars),
+ * padding to a multiple of 16 bytes, and the binary tailoring data.
+ * All integers are in platform endianness;
+ * formatVersion[1..2] make sure that a file is only used on a compatible platform.
+ */
+struct CacheFileHeader {
+    uint8_t magic[4];
+    uint8_t formatVersion[4];
+    UVersionInfo icuVersion;
+    UVersionInfo dataVersion;
+    UVersionInfo rootVersion;
+    int32_t rulesLength;
+    int32_t binaryOffset;
+    int32_t binaryLength;
+};
+
+const uint8_t MAGIC[4] = { 0x55, 0x43, 0x62, 0x63 };  // "UCbc"
+const uint8_t FORMAT_VERSION[4] = { 1, U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, 0 };
+
+inline int32_t padTo16(int32_t length) {
+    return (length + 15) & ~15;
+}
+
+void setHeader(const CollationTailoring &root, CacheFileHeader &header) {
+    uprv_memset(&header, 0, sizeof(header));
+    uprv_memcpy(header.magic, MAGIC, 4);
+    uprv_memcpy(header.formatVersion, FORMAT_VERSION, 4);
+    u_getVersion(header.icuVersion);
+    // Without version information in the data, any version change
+    // of the library or the root collator still invalidates the cache.
+    UErrorCode dataErrorCode = U_ZERO_ERROR;
+    u_getDataVersion(header.dataVersion, &dataErrorCode);
+    if(U_FAILURE(dataErrorCode)) {
+        uprv_memset(header.dataVersion, 0, sizeof(UVersionInfo));
+    }
+    uprv_memcpy(header.rootVersion, root.version, sizeof(UVersionInfo));
+}
+
+/** Numbers the temporary files that this process writes. */
+u_atomic_int32_t gTempFileCounter = ATOMIC_INT32_T_INITIALIZER(0);
+
+int32_t getProcessID() {
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    return (int32_t)_getpid();
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+    return (int32_t)getpid();
+#else
+    return 0;
+#endif
+}
+
+}  // namespace
+
+void
+CollationBuildCache::getPath(const char *directory, const UnicodeString &rules,
+                             CharString &path, UErrorCode &errorCode) {
+    char name[32];
+    sprintf(name, "coll%08x.bin", (unsigned int)ustr_hashUCharsN(
+                                      rules.getBuffer(), rules.length()));
+    path.append(directory, errorCode).appendPathPart(name, errorCode);
+}
+
+CollationTailoring *
+CollationBuildCache::load(const char *directory, const CollationTailoring *root,
+                          const UnicodeString &rules, UErrorCode &errorCode) {
+#if UCONFIG_NO_FILE_IO
+    (void)directory;
+    (void)root;
+    (void)rules;
+    (void)errorCode;
+    return NULL;
+#else
+    if(U_FAILURE(errorCode)) { return NULL; }
+    CharString path;
+    getPath(directory, rules, path, errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    FILE *file = fopen(path.data(), "rb");
+    if(file == NULL) { return NULL; }
+    long fileLength = -1;
+    if(fseek(file, 0, SEEK_END) == 0) {
+        fileLength = ftell(file);
+    }
+    LocalMemory<uint8_t> bytes;
+    int32_t length = 0;
+    if((int32_t)sizeof(CacheFileHeader) <= fileLength && fileLength <= INT32_MAX &&
+            fseek(file, 0, SEEK_SET) == 0) {
+        length = (int32_t)fileLength;
+        if(bytes.allocateInsteadAndCopy(length, 0) != NULL &&
+                fread(bytes.getAlias(), 1, length, file) != (size_t)length) {
+            bytes.adoptInstead(NULL);
+        }
+    }
+    fclose(file);
+    if(bytes.isNull()) { return NULL; }
+
+    // Validate the entry against the running ICU and the requested rules.
+    CacheFileHeader expected;
+    setHeader(*root, expected);
+    const CacheFileHeader &header = *reinterpret_cast<const CacheFileHeader *>(bytes.getAlias());
+    int32_t rulesLength = rules.length();
+    if(uprv_memcmp(&header, &expected, offsetof(CacheFileHeader, rulesLength)) != 0 ||
+            header.rulesLength != rulesLength ||
+            header.binaryOffset != padTo16((int32_t)sizeof(CacheFileHeader) + rulesLength * U_SIZEOF_UCHAR) ||
+            header.binaryLength <= 0 ||
+            header.binaryLength > length - header.binaryOffset) {
+        return NULL;
+    }
+    const UChar *cachedRules =
+        reinterpret_cast<const UChar *>(bytes.getAlias() + sizeof(CacheFileHeader));
+    if(rulesLength > 0 && u_memcmp(cachedRules, rules.getBuffer(), rulesLength) != 0) {
+        return NULL;  // hash collision
+    }
+
+    LocalPointer<CollationTailoring> t(new CollationTailoring(root->settings));
+    if(t.isNull() || t->isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    UErrorCode readErrorCode = U_ZERO_ERROR;
+    CollationDataReader::read(root, bytes.getAlias() + header.binaryOffset, header.binaryLength,
+                              *t, readErrorCode);
+    if(U_FAILURE(readErrorCode)) { return NULL; }
+    t->rules = rules;
+    t->rules.getTerminatedBuffer();  // ensure NUL-termination
+    t->ownedBinary = bytes.orphan();
+    return t.orphan();
+#endif
+}
+
+void
+CollationBuildCache::store(const char *directory, const CollationTailoring &t,
+                           UErrorCode &errorCode) {
+#if UCONFIG_NO_FILE_IO
+    (void)directory;
+    (void)t;
+    (void)errorCode;
+#else
+    if(U_FAILURE(errorCode)) { return; }
+    const CollationTailoring *root = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    int32_t indexes[CollationDataReader::IX_TOTAL_SIZE + 1];
+    UErrorCode writeErrorCode = U_ZERO_ERROR;
+    int32_t binaryLength = CollationDataWriter::writeTailoring(
+            t, *t.settings, indexes, NULL, 0, writeErrorCode);
+    if(writeErrorCode != U_BUFFER_OVERFLOW_ERROR) {
+        if(U_FAILURE(writeErrorCode)) { errorCode = writeErrorCode; }
+        return;
+    }
+    int32_t rulesLength = t.rules.length();
+    int32_t binaryOffset = padTo16((int32_t)sizeof(CacheFileHeader) + rulesLength * U_SIZEOF_UCHAR);
+    int32_t length = binaryOffset + binaryLength;
+    LocalMemory<uint8_t> bytes;
+    if(bytes.allocateInsteadAndCopy(length, 0) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(bytes.getAlias(), 0, binaryOffset);
+    CacheFileHeader &header = *reinterpret_cast<CacheFileHeader *>(bytes.getAlias());
+    setHeader(*root, header);
+    header.rulesLength = rulesLength;
+    header.binaryOffset = binaryOffset;
+    header.binaryLength = binaryLength;
+    uprv_memcpy(bytes.getAlias() + sizeof(CacheFileHeader), t.rules.getBuffer(),
+                rulesLength * U_SIZEOF_UCHAR);
+    CollationDataWriter::writeTailoring(
+            t, *t.settings, indexes, bytes.getAlias() + binaryOffset, binaryLength, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+
+    // Write a temporary file and then move it into place,
+    // so that readers never see a partially written entry under the final name.
+    // The process ID and counter give each writer its own temporary file,
+    // even when several processes or threads store the same rules.
+    CharString path, tempPath;
+    getPath(directory, t.rules, path, errorCode);
+    char suffix[32];
+    sprintf(suffix, ".%ld.%ld.tmp",
+            (long)getProcessID(), (long)umtx_atomic_inc(&gTempFileCounter));
+    tempPath.append(path, errorCode).append(suffix, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    FILE *file = fopen(tempPath.data(), "wb");
+    if(file == NULL) { return; }
+    UBool ok = fwrite(bytes.getAlias(), 1, length, file) == (size_t)length;
+    ok = (fclose(file) == 0) && ok;
+    if(ok && rename(tempPath.data(), path.data()) != 0) {
+        // Some platforms do not replace an existing file.
+        remove(path.data());
+        ok = rename(tempPath.data(), path.data()) == 0;
+    }
+    if(!ok) {
+        remove(tempPath.data());
+    }
+#endif
+}
+
+RuleBasedCollator::RuleBasedCollator(const UnicodeString &rules, const char *cacheDirectory,
+                                     UErrorCode &errorCode)
+        : data(NULL),
+          settings(NULL),
+          tailoring(NULL),
+          cacheEntry(NULL),
+          validLocale(""),
+          explicitlySetAttributes(0),
+          actualLocaleIsSameAsValid(FALSE) {
+    internalBuildCachedTailoring(rules, cacheDirectory, UCOL_DEFAULT, UCOL_DEFAULT,
+                                 NULL, NULL, errorCode);
+}
+
+void
+RuleBasedCollator::internalBuildCachedTailoring(const UnicodeString &rules,
+                                                const char *cacheDirectory,
+                                                int32_t strength,
+                                                UColAttributeValue decompositionMode,
+                                                UParseError *outParseError,
+                                                UnicodeString *outReason,
+                                                UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    if(cacheDirectory == NULL || *cacheDirectory == 0) {
+        internalBuildTailoring(rules, strength, decompositionMode,
+                               outParseError, outReason, errorCode);
+        return;
+    }
+    const CollationTailoring *root = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    CollationTailoring *t = CollationBuildCache::load(cacheDirectory, root, rules, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    if(t != NULL) {
+        if(outParseError != NULL) {
+            uprv_memset(outParseError, 0, sizeof(*outParseError));
+        }
+        if(outReason != NULL) { outReason->remove(); }
+        t->actualLocale.setToBogus();
+        adoptTailoring(t, errorCode);
+    } else {
+        // Build with the rule string's own settings, and cache those.
+        internalBuildTailoring(rules, UCOL_DEFAULT, UCOL_DEFAULT,
+                               outParseError, outReason, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        // The collator is usable even if it cannot be cached.
+        UErrorCode storeErrorCode = U_ZERO_ERROR;
+        CollationBuildCache::store(cacheDirectory, *tailoring, storeErrorCode);
+    }
+    if(strength != UCOL_DEFAULT) {
+        setAttribute(UCOL_STRENGTH, (UColAttributeValue)strength, errorCode);
+    }
+    if(decompositionMode != UCOL_DEFAULT) {
+        setAttribute(UCOL_NORMALIZATION_MODE, decompositionMode, errorCode);
+    }
+}
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI UCollator * U_EXPORT2
+ucol_openRulesCached(const UChar *rules, int32_t rulesLength,
+                     UColAttributeValue normalizationMode, UCollationStrength strength,
+                     const char *cacheDirectory,
+                     UParseError *parseError, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) { return NULL; }
+    if(rules == NULL && rulesLength != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    RuleBasedCollator *coll = new RuleBasedCollator();
+    if(coll == NULL) {
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    UnicodeString r((UBool)(rulesLength < 0), rules, rulesLength);
+    coll->internalBuildCachedTailoring(r, cacheDirectory, strength, normalizationMode,
+                                       parseError, NULL, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        delete coll;
+        return NULL;
+    }
+    return coll->toUCollator();
+}
+
+#endif  // !UCONFIG_NO_COLLATION
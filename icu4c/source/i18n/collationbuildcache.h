@@ -0,0 +1,66 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* collationbuildcache.h
+*
+* created on: 2018oct18
+*/
+
+#ifndef __COLLATIONBUILDCACHE_H__
+#define __COLLATIONBUILDCACHE_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+class CharString;
+struct CollationTailoring;
+
+/**
+ * Persistent on-disk cache for tailorings built from rule strings.
+ *
+ * Each entry is one file in a caller-provided directory,
+ * named after a hash of the rule string.
+ * The file contains the rule string itself, the versions of ICU,
+ * of the ICU data and of the root collator that the tailoring was built with,
+ * and the tailoring data as written by CollationDataWriter.
+ * An entry is used only if all of these match the running ICU and the requested rules,
+ * so that a new ICU or ICU data version invalidates it.
+ * A mismatching, truncated or unreadable entry is treated like a missing one
+ * and gets overwritten with a fresh build.
+ *
+ * Settings from the rule string are part of the cached data.
+ * Attributes which are set via API after building are not cached.
+ */
+class CollationBuildCache : public UMemory {
+public:
+    /**
+     * Reads the cached tailoring for the rules, if there is a valid one.
+     * @return the tailoring, with its rules set, or NULL if there is no usable entry
+     */
+    static CollationTailoring *load(const char *directory, const CollationTailoring *root,
+                                    const UnicodeString &rules, UErrorCode &errorCode);
+
+    /**
+     * Writes the tailoring with its rules and default settings into the cache.
+     * Failure to write the file is ignored; the cache is only an optimization.
+     */
+    static void store(const char *directory, const CollationTailoring &t,
+                      UErrorCode &errorCode);
+
+private:
+    CollationBuildCache();  // no instantiation
+
+    static void getPath(const char *directory, const UnicodeString &rules,
+                        CharString &path, UErrorCode &errorCode);
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONBUILDCACHE_H__
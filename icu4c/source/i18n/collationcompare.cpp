@@ -26,7 +26,8 @@
 U_NAMESPACE_BEGIN
 
 UCollationResult
-CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
+CollationCompare::compareUpToQuaternary(CollationIterator &left, int32_t leftStartIndex,
+                                        CollationIterator &right,
                                         const CollationSettings &settings,
                                         UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
@@ -111,7 +112,7 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
     // which is turned on separately.
     if(CollationSettings::getStrength(options) >= UCOL_SECONDARY) {
         if((options & CollationSettings::BACKWARD_SECONDARY) == 0) {
-            int32_t leftIndex = 0;
+            int32_t leftIndex = leftStartIndex;
             int32_t rightIndex = 0;
             for(;;) {
                 uint32_t leftSecondary;
@@ -132,7 +133,7 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
         } else {
             // The backwards secondary level compares secondary weights backwards
             // within segments separated by the merge separator (U+FFFE, weight 02).
-            int32_t leftStart = 0;
+            int32_t leftStart = leftStartIndex;
             int32_t rightStart = 0;
             for(;;) {
                 // Find the merge separator or the NO_CE terminator.
@@ -184,7 +185,7 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
 
     if((options & CollationSettings::CASE_LEVEL) != 0) {
         int32_t strength = CollationSettings::getStrength(options);
-        int32_t leftIndex = 0;
+        int32_t leftIndex = leftStartIndex;
         int32_t rightIndex = 0;
         for(;;) {
             uint32_t leftCase, leftLower32, rightCase;
@@ -251,7 +252,7 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
 
     uint32_t tertiaryMask = CollationSettings::getTertiaryMask(options);
 
-    int32_t leftIndex = 0;
+    int32_t leftIndex = leftStartIndex;
     int32_t rightIndex = 0;
     uint32_t anyQuaternaries = 0;
     for(;;) {
@@ -307,7 +308,7 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
         return UCOL_EQUAL;
     }
 
-    leftIndex = 0;
+    leftIndex = leftStartIndex;
     rightIndex = 0;
     for(;;) {
         uint32_t leftQuaternary;
@@ -27,7 +27,19 @@ struct CollationSettings;
 
 class U_I18N_API CollationCompare /* not : public UObject because all methods are static */ {
 public:
-    static UCollationResult compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
+    static inline UCollationResult compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
+                                                         const CollationSettings &settings,
+                                                         UErrorCode &errorCode) {
+        return compareUpToQuaternary(left, 0, right, settings, errorCode);
+    }
+
+    /**
+     * Compares the left CEs from leftStartIndex on.
+     * The left iterator must be positioned at that index,
+     * and the CEs before it are ignored on all levels.
+     */
+    static UCollationResult compareUpToQuaternary(CollationIterator &left, int32_t leftStartIndex,
+                                                  CollationIterator &right,
                                                   const CollationSettings &settings,
                                                   UErrorCode &errorCode);
 };
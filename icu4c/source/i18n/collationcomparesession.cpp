@@ -0,0 +1,461 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* collationcomparesession.cpp
+*
+* created on: 2018oct19
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/colsession.h"
+#include "unicode/localpointer.h"
+#include "unicode/tblcoll.h"
+#include "unicode/ustring.h"
+#include "unicode/utf8.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "collation.h"
+#include "collationcompare.h"
+#include "collationdata.h"
+#include "collationfastlatin.h"
+#include "collationiterator.h"
+#include "collationsettings.h"
+#include "utf16collationiterator.h"
+#include "utf8collationiterator.h"
+
+U_NAMESPACE_BEGIN
+
+struct CollationCompareSessionData : public UMemory {
+    CollationCompareSessionData(const CollationData *d, const CollationSettings &settings)
+            : data(d), numeric(settings.isNumeric()), checkFCD(!settings.dontCheckFCD()),
+              hasLeft(FALSE), hasLeft16(FALSE) {}
+
+    /**
+     * Creates the UTF-8 iterator on first use,
+     * so that a session used only with UTF-16 strings does not allocate it.
+     */
+    UBool ensureUTF8Iterator() {
+        if(leftIter.isNull()) {
+            if(checkFCD) {
+                leftIter.adoptInstead(new FCDUTF8CollationIterator(data, numeric, NULL, 0, 0));
+            } else {
+                leftIter.adoptInstead(new UTF8CollationIterator(data, numeric, NULL, 0, 0));
+            }
+        }
+        return leftIter.isValid();
+    }
+
+    UBool ensureUTF16Iterator() {
+        if(leftIter16.isNull()) {
+            if(checkFCD) {
+                leftIter16.adoptInstead(new FCDUTF16CollationIterator(data, numeric, NULL, NULL, NULL));
+            } else {
+                leftIter16.adoptInstead(new UTF16CollationIterator(data, numeric, NULL, NULL, NULL));
+            }
+        }
+        return leftIter16.isValid();
+    }
+
+    /**
+     * Sets the left UTF-8 string, unless it is the same as before,
+     * and fetches all of its CEs.
+     */
+    UBool setLeft(const StringPiece &left, UErrorCode &errorCode) {
+        int32_t length = left.length();
+        if(hasLeft && leftText.length() == length &&
+                (length == 0 || uprv_memcmp(leftText.data(), left.data(), length) == 0)) {
+            return TRUE;
+        }
+        hasLeft = FALSE;
+        if(!ensureUTF8Iterator()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        leftText.clear().append(left, errorCode);
+        if(U_FAILURE(errorCode)) { return FALSE; }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(leftText.data());
+        if(checkFCD) {
+            static_cast<FCDUTF8CollationIterator &>(*leftIter).setText(s, length);
+        } else {
+            leftIter->setText(s, length);
+        }
+        hasLeft = fetchLeftCEs(*leftIter, length, leftCEIndexes, errorCode);
+        return hasLeft;
+    }
+
+    UBool setLeft(const UChar *left, int32_t length, UErrorCode &errorCode) {
+        if(hasLeft16 && leftText16.length() == length &&
+                (length == 0 || uprv_memcmp(leftText16.getBuffer(), left, length * U_SIZEOF_UCHAR) == 0)) {
+            return TRUE;
+        }
+        hasLeft16 = FALSE;
+        if(!ensureUTF16Iterator()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        leftText16.setTo(left, length);
+        if(leftText16.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        const UChar *s = leftText16.getBuffer();
+        if(checkFCD) {
+            static_cast<FCDUTF16CollationIterator &>(*leftIter16).setText(s, s + length);
+        } else {
+            leftIter16->setText(s, s + length);
+        }
+        hasLeft16 = fetchLeftCEs(*leftIter16, length, leftCEIndexes16, errorCode);
+        return hasLeft16;
+    }
+
+    /**
+     * Fetches all of the CEs of the left string, and records for each text offset
+     * where the iterator started on a new code point or contraction
+     * the index of the first CE fetched from there.
+     * Other offsets get -1.
+     *
+     * Inside a segment that the FCD iterator normalizes, getOffset() returns
+     * the segment limit, and the fetch from the segment limit overwrites that entry.
+     */
+    UBool fetchLeftCEs(CollationIterator &iter, int32_t length,
+                       MaybeStackArray<int32_t, 40> &ceIndexes, UErrorCode &errorCode) {
+        if(length >= ceIndexes.getCapacity() && ceIndexes.resize(length + 1) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        int32_t *indexes = ceIndexes.getAlias();
+        for(int32_t i = 0; i <= length; ++i) { indexes[i] = -1; }
+        int64_t ce;
+        do {
+            int32_t offset = iter.getOffset();
+            int32_t ceIndex = iter.getCEsLength();
+            ce = iter.nextCE(errorCode);
+            if(iter.getCEsLength() > ceIndex) {
+                indexes[offset] = ceIndex;
+            }
+        } while(ce != Collation::NO_CE && U_SUCCESS(errorCode));
+        return U_SUCCESS(errorCode);
+    }
+
+    /**
+     * Compares the left string's CEs from the text offset on
+     * with the CEs from the right iterator.
+     * @return BAIL_OUT_RESULT if no left CEs start at the offset
+     */
+    int32_t compareLeftCEs(CollationIterator &iter, const int32_t *ceIndexes, int32_t offset,
+                           CollationIterator &rightIter, const CollationSettings &settings,
+                           UErrorCode &errorCode) {
+        int32_t ceIndex = ceIndexes[offset];
+        if(ceIndex < 0) { return CollationFastLatin::BAIL_OUT_RESULT; }
+        iter.rewindCEs(ceIndex);
+        return CollationCompare::compareUpToQuaternary(iter, ceIndex, rightIter, settings, errorCode);
+    }
+
+    const CollationData *data;
+    UBool numeric;
+    UBool checkFCD;
+    UBool hasLeft;
+    /** Copy of the last left string, which leftIter iterated over. */
+    CharString leftText;
+    LocalPointer<UTF8CollationIterator> leftIter;
+    /** For each offset in leftText, the index of its first CE in leftIter, or -1. */
+    MaybeStackArray<int32_t, 40> leftCEIndexes;
+    UBool hasLeft16;
+    /** Copy of the last left UTF-16 string, which leftIter16 iterated over. */
+    UnicodeString leftText16;
+    LocalPointer<UTF16CollationIterator> leftIter16;
+    MaybeStackArray<int32_t, 40> leftCEIndexes16;
+};
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(CollationCompareSession)
+
+CollationCompareSession::CollationCompareSession(const RuleBasedCollator &c, UErrorCode &errorCode)
+        : coll(c), sessionData(NULL) {
+    if(U_FAILURE(errorCode)) { return; }
+    sessionData = new CollationCompareSessionData(coll.data, *coll.settings);
+    if(sessionData == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+CollationCompareSession::~CollationCompareSession() {
+    delete sessionData;
+}
+
+UCollationResult
+CollationCompareSession::compareUTF8(const StringPiece &left, const StringPiece &right,
+                                     UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if(sessionData == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return UCOL_EQUAL;
+    }
+    const CollationSettings &settings = *coll.settings;
+    if(settings.getAlternateHandling() != UCOL_NON_IGNORABLE) {
+        // For variable handling, compareUpToQuaternary() modifies the buffered CEs
+        // depending on the ones before them, which differ when a common prefix is skipped.
+        // The buffered left CEs cannot be reused.
+        return coll.compareUTF8(left, right, errorCode);
+    }
+    const CollationData *data = coll.data;
+    const uint8_t *leftBytes = reinterpret_cast<const uint8_t *>(left.data());
+    const uint8_t *rightBytes = reinterpret_cast<const uint8_t *>(right.data());
+    int32_t leftLength = left.length();
+    int32_t rightLength = right.length();
+
+    // Skip the identical prefix as in RuleBasedCollator::doCompare().
+    int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+    int32_t equalPrefixLength = 0;
+    while(equalPrefixLength < minLength &&
+            leftBytes[equalPrefixLength] == rightBytes[equalPrefixLength]) {
+        ++equalPrefixLength;
+    }
+    if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+        return UCOL_EQUAL;
+    }
+    // Back up to the start of a partially-equal code point.
+    if(equalPrefixLength > 0 &&
+            ((equalPrefixLength != leftLength && U8_IS_TRAIL(leftBytes[equalPrefixLength])) ||
+            (equalPrefixLength != rightLength && U8_IS_TRAIL(rightBytes[equalPrefixLength])))) {
+        while(--equalPrefixLength > 0 && U8_IS_TRAIL(leftBytes[equalPrefixLength])) {}
+    }
+    UBool numeric = settings.isNumeric();
+    if(equalPrefixLength > 0) {
+        UBool unsafe = FALSE;
+        if(equalPrefixLength != leftLength) {
+            int32_t i = equalPrefixLength;
+            UChar32 c;
+            U8_NEXT_OR_FFFD(leftBytes, i, leftLength, c);
+            unsafe = data->isUnsafeBackward(c, numeric);
+        }
+        if(!unsafe && equalPrefixLength != rightLength) {
+            int32_t i = equalPrefixLength;
+            UChar32 c;
+            U8_NEXT_OR_FFFD(rightBytes, i, rightLength, c);
+            unsafe = data->isUnsafeBackward(c, numeric);
+        }
+        if(unsafe) {
+            // Back up to the start of a contraction or reordering sequence.
+            UChar32 c;
+            do {
+                U8_PREV_OR_FFFD(leftBytes, 0, equalPrefixLength, c);
+            } while(equalPrefixLength > 0 && data->isUnsafeBackward(c, numeric));
+        }
+    }
+
+    // Short Latin strings are compared fastest without the CE buffers.
+    int32_t result;
+    int32_t fastLatinOptions = settings.fastLatinOptions;
+    if(fastLatinOptions >= 0 &&
+            (equalPrefixLength == leftLength ||
+                leftBytes[equalPrefixLength] <= CollationFastLatin::LATIN_MAX_UTF8_LEAD) &&
+            (equalPrefixLength == rightLength ||
+                rightBytes[equalPrefixLength] <= CollationFastLatin::LATIN_MAX_UTF8_LEAD)) {
+        result = CollationFastLatin::compareUTF8(data->fastLatinTable,
+                                                 settings.fastLatinPrimaries,
+                                                 fastLatinOptions,
+                                                 leftBytes + equalPrefixLength,
+                                                 leftLength - equalPrefixLength,
+                                                 rightBytes + equalPrefixLength,
+                                                 rightLength - equalPrefixLength);
+    } else {
+        result = CollationFastLatin::BAIL_OUT_RESULT;
+    }
+
+    if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+        // Compare the right string from the prefix limit with the buffered left CEs.
+        // The right iterator starts at the prefix limit but sees the whole string,
+        // so that prefix matches back into the equal prefix work.
+        CollationCompareSessionData &sd = *sessionData;
+        if(!sd.setLeft(left, errorCode)) { return UCOL_EQUAL; }
+        if(settings.dontCheckFCD()) {
+            UTF8CollationIterator rightIter(data, numeric,
+                                            rightBytes, equalPrefixLength, rightLength);
+            result = sd.compareLeftCEs(*sd.leftIter, sd.leftCEIndexes.getAlias(),
+                                       equalPrefixLength, rightIter, settings, errorCode);
+        } else {
+            FCDUTF8CollationIterator rightIter(data, numeric,
+                                               rightBytes, equalPrefixLength, rightLength);
+            result = sd.compareLeftCEs(*sd.leftIter, sd.leftCEIndexes.getAlias(),
+                                       equalPrefixLength, rightIter, settings, errorCode);
+        }
+        if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+            // The prefix limit is not at a boundary of the left CEs.
+            return coll.compareUTF8(left, right, errorCode);
+        }
+    }
+    if(result != UCOL_EQUAL || settings.getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+        return (UCollationResult)result;
+    }
+    // The identical level is rare enough to not be worth optimizing here.
+    return coll.compareUTF8(left, right, errorCode);
+}
+
+UCollationResult
+CollationCompareSession::compare(const UnicodeString &left, const UnicodeString &right,
+                                 UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    return compare(left.getBuffer(), left.length(),
+                   right.getBuffer(), right.length(), errorCode);
+}
+
+UCollationResult
+CollationCompareSession::compare(const char16_t *left, int32_t leftLength,
+                                 const char16_t *right, int32_t rightLength,
+                                 UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if((left == NULL && leftLength != 0) || (right == NULL && rightLength != 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    if(sessionData == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return UCOL_EQUAL;
+    }
+    // Unlike in RuleBasedCollator::compare(), we need the string lengths
+    // for recognizing the same left string.
+    if(leftLength < 0) { leftLength = u_strlen(left); }
+    if(rightLength < 0) { rightLength = u_strlen(right); }
+    const CollationSettings &settings = *coll.settings;
+    if(settings.getAlternateHandling() != UCOL_NON_IGNORABLE) {
+        // See compareUTF8().
+        return coll.compare(left, leftLength, right, rightLength, errorCode);
+    }
+    const CollationData *data = coll.data;
+
+    // See compareUTF8().
+    int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+    int32_t equalPrefixLength = 0;
+    while(equalPrefixLength < minLength && left[equalPrefixLength] == right[equalPrefixLength]) {
+        ++equalPrefixLength;
+    }
+    if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+        return UCOL_EQUAL;
+    }
+    UBool numeric = settings.isNumeric();
+    if(equalPrefixLength > 0) {
+        if((equalPrefixLength != leftLength &&
+                    data->isUnsafeBackward(left[equalPrefixLength], numeric)) ||
+                (equalPrefixLength != rightLength &&
+                    data->isUnsafeBackward(right[equalPrefixLength], numeric))) {
+            while(--equalPrefixLength > 0 &&
+                    data->isUnsafeBackward(left[equalPrefixLength], numeric)) {}
+        }
+    }
+
+    int32_t result;
+    int32_t fastLatinOptions = settings.fastLatinOptions;
+    if(fastLatinOptions >= 0 &&
+            (equalPrefixLength == leftLength ||
+                left[equalPrefixLength] <= CollationFastLatin::LATIN_MAX) &&
+            (equalPrefixLength == rightLength ||
+                right[equalPrefixLength] <= CollationFastLatin::LATIN_MAX)) {
+        result = CollationFastLatin::compareUTF16(data->fastLatinTable,
+                                                  settings.fastLatinPrimaries,
+                                                  fastLatinOptions,
+                                                  left + equalPrefixLength,
+                                                  leftLength - equalPrefixLength,
+                                                  right + equalPrefixLength,
+                                                  rightLength - equalPrefixLength);
+    } else {
+        result = CollationFastLatin::BAIL_OUT_RESULT;
+    }
+
+    if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+        CollationCompareSessionData &sd = *sessionData;
+        if(!sd.setLeft(left, leftLength, errorCode)) { return UCOL_EQUAL; }
+        if(settings.dontCheckFCD()) {
+            UTF16CollationIterator rightIter(data, numeric,
+                                             right, right + equalPrefixLength, right + rightLength);
+            result = sd.compareLeftCEs(*sd.leftIter16, sd.leftCEIndexes16.getAlias(),
+                                       equalPrefixLength, rightIter, settings, errorCode);
+        } else {
+            FCDUTF16CollationIterator rightIter(data, numeric,
+                                                right, right + equalPrefixLength, right + rightLength);
+            result = sd.compareLeftCEs(*sd.leftIter16, sd.leftCEIndexes16.getAlias(),
+                                       equalPrefixLength, rightIter, settings, errorCode);
+        }
+        if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+            return coll.compare(left, leftLength, right, rightLength, errorCode);
+        }
+    }
+    if(result != UCOL_EQUAL || settings.getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+        return (UCollationResult)result;
+    }
+    return coll.compare(left, leftLength, right, rightLength, errorCode);
+}
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+namespace {
+
+/**
+ * Implementation of a UCollationComparand:
+ * A compare session together with its own copy of the source string.
+ */
+class CollationComparand : public UMemory {
+public:
+    CollationComparand(const RuleBasedCollator &coll, UErrorCode &errorCode)
+            : session(coll, errorCode) {}
+
+    CollationCompareSession session;
+    UnicodeString source;
+};
+
+}  // namespace
+
+U_CAPI UCollationComparand * U_EXPORT2
+ucol_openComparand(const UCollator *coll,
+                   const UChar *source, int32_t sourceLength,
+                   UErrorCode *status) {
+    if(U_FAILURE(*status)) { return NULL; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        if(coll == NULL) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+        } else {
+            *status = U_UNSUPPORTED_ERROR;
+        }
+        return NULL;
+    }
+    if((source == NULL && sourceLength != 0) || sourceLength < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    LocalPointer<CollationComparand> comparand(new CollationComparand(*rbc, *status), *status);
+    if(U_FAILURE(*status)) { return NULL; }
+    if(sourceLength < 0) { sourceLength = u_strlen(source); }
+    comparand->source.setTo(source, sourceLength);
+    if(comparand->source.isBogus()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return reinterpret_cast<UCollationComparand *>(comparand.orphan());
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_compareComparand(UCollationComparand *comparand,
+                      const UChar *target, int32_t targetLength,
+                      UErrorCode *status) {
+    if(U_FAILURE(*status)) { return UCOL_EQUAL; }
+    if(comparand == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    CollationComparand *impl = reinterpret_cast<CollationComparand *>(comparand);
+    return impl->session.compare(impl->source.getBuffer(), impl->source.length(),
+                                 target, targetLength, *status);
+}
+
+U_CAPI void U_EXPORT2
+ucol_closeComparand(UCollationComparand *comparand) {
+    delete reinterpret_cast<CollationComparand *>(comparand);
+}
+
+#endif  // !UCONFIG_NO_COLLATION
@@ -128,6 +128,20 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
      */
     uint32_t leftPair = 0, rightPair = 0;
     for(;;) {
+        if((leftPair | rightPair) == 0) {
+            // Skip a run of characters with the same simple primaries on both sides,
+            // without the per-character mini-CE handling below.
+            // NUL has no simple primary, so this also stops at a NUL terminator.
+            while(leftIndex != leftLength && rightIndex != rightLength) {
+                UChar32 c = left[leftIndex];
+                UChar32 d = right[rightIndex];
+                if(c > LATIN_MAX || d > LATIN_MAX) { break; }
+                uint32_t p = primaries[c];
+                if(p == 0 || p != primaries[d]) { break; }
+                ++leftIndex;
+                ++rightIndex;
+            }
+        }
         // We fetch CEs until we get a non-ignorable primary or reach the end.
         while(leftPair == 0) {
             if(leftIndex == leftLength) {
@@ -467,6 +481,20 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
     // We only need to look up the table entry for the character,
     // and nextPair() looks for whether c==0.
     for(;;) {
+        if((leftPair | rightPair) == 0) {
+            // Skip a run of ASCII characters with the same simple primaries on both sides,
+            // without the per-character mini-CE handling below.
+            // NUL has no simple primary, so this also stops at a NUL terminator.
+            while(leftIndex != leftLength && rightIndex != rightLength) {
+                UChar32 c = left[leftIndex];
+                UChar32 d = right[rightIndex];
+                if(c > 0x7f || d > 0x7f) { break; }
+                uint32_t p = primaries[c];
+                if(p == 0 || p != primaries[d]) { break; }
+                ++leftIndex;
+                ++rightIndex;
+            }
+        }
         // We fetch CEs until we get a non-ignorable primary or reach the end.
         while(leftPair == 0) {
             if(leftIndex == leftLength) {
@@ -209,6 +209,17 @@ class U_I18N_API CollationIterator : public UObject {
         if(cesIndex == ceBuffer.length) { clearCEs(); }
     }
 
+    /**
+     * Moves back to the buffered CE at the index, so that nextCE() returns the same CEs again
+     * and then continues with fetching further CEs from the text.
+     * Used for comparing one string's CEs with several other strings.
+     * The CEs must have been fetched from the start of the text without
+     * backward iteration or clearCEs() in between.
+     */
+    void rewindCEs(int32_t index) {
+        cesIndex = index;
+    }
+
     /**
      * Returns the next code point (with post-increment).
      * Public for identical-level comparison and for testing.
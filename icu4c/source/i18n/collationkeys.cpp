@@ -668,6 +668,68 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
     }
 }
 
+void
+CollationKeys::writePrimaryLevelPrefix(CollationIterator &iter,
+                                       const UBool *compressibleBytes,
+                                       const CollationSettings &settings,
+                                       SortKeyByteSink &sink, UErrorCode &errorCode) {
+    // This is a modified copy of the primary-level part of writeSortKeyUpToQuaternary().
+    // Keep them in sync!
+    if(U_FAILURE(errorCode)) { return; }
+
+    uint32_t variableTop;
+    if((settings.options & CollationSettings::ALTERNATE_MASK) == 0) {
+        variableTop = 0;
+    } else {
+        // +1 so that we can use "<" and primary ignorables test out early.
+        variableTop = settings.variableTop + 1;
+    }
+
+    uint32_t prevReorderedPrimary = 0;  // 0==no compression
+    while(sink.GetRemainingCapacity() > 0) {
+        iter.clearCEsIfNoneRemaining();
+        int64_t ce = iter.nextCE(errorCode);
+        uint32_t p = (uint32_t)(ce >> 32);
+        if(p == Collation::NO_CE_PRIMARY) { break; }
+        // Variable CEs are shifted to the quaternary level,
+        // and primary ignorables have no primary weight.
+        if(p == 0 || (p < variableTop && p > Collation::MERGE_SEPARATOR_PRIMARY)) { continue; }
+        // Test the un-reordered primary for compressibility.
+        UBool isCompressible = compressibleBytes[p >> 24];
+        if(settings.hasReordering()) {
+            p = settings.reorder(p);
+        }
+        uint32_t p1 = p >> 24;
+        if(!isCompressible || p1 != (prevReorderedPrimary >> 24)) {
+            if(prevReorderedPrimary != 0) {
+                if(p < prevReorderedPrimary) {
+                    // No primary compression terminator
+                    // at the end of the level or merged segment.
+                    if(p1 > Collation::MERGE_SEPARATOR_BYTE) {
+                        sink.Append(Collation::PRIMARY_COMPRESSION_LOW_BYTE);
+                    }
+                } else {
+                    sink.Append(Collation::PRIMARY_COMPRESSION_HIGH_BYTE);
+                }
+            }
+            sink.Append(p1);
+            if(isCompressible) {
+                prevReorderedPrimary = p;
+            } else {
+                prevReorderedPrimary = 0;
+            }
+        }
+        char p2 = (char)(p >> 16);
+        if(p2 != 0) {
+            char buffer[3] = { p2, (char)(p >> 8), (char)p };
+            sink.Append(buffer, (buffer[1] == 0) ? 1 : (buffer[2] == 0) ? 2 : 3);
+        }
+    }
+    if(U_SUCCESS(errorCode) && !sink.IsOk()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -113,6 +113,17 @@ class U_I18N_API CollationKeys /* not : public UObject because all methods are s
                                            SortKeyByteSink &sink,
                                            Collation::Level minLevel, LevelCallback &callback,
                                            UBool preflight, UErrorCode &errorCode);
+
+    /**
+     * Writes the primary level of the sort key, exactly like
+     * writeSortKeyUpToQuaternary() does, but nothing else,
+     * and stops as soon as the sink has no more capacity.
+     * Does not write a LEVEL_SEPARATOR_BYTE or TERMINATOR_BYTE.
+     */
+    static void writePrimaryLevelPrefix(CollationIterator &iter,
+                                        const UBool *compressibleBytes,
+                                        const CollationSettings &settings,
+                                        SortKeyByteSink &sink, UErrorCode &errorCode);
 private:
     friend struct CollationDataReader;
 
@@ -0,0 +1,249 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* collationsort.cpp
+*
+* created on: 2018oct17
+*
+* RuleBasedCollator::sortStrings() & sortStringsUTF8():
+* Each worker thread computes the sort keys for a contiguous chunk of the input
+* with its own clone of the collator and sorts that chunk by key.
+* The sorted chunks are then merged pairwise, with the merges of each round
+* running in parallel.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/localpointer.h"
+#include "unicode/tblcoll.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uarrsort.h"
+#include "uparallel.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/** Do not bother with threads for fewer strings than this per chunk. */
+const int32_t MIN_CHUNK_LENGTH = 2000;
+
+struct SortItem {
+    const char *key;
+    int32_t index;
+};
+
+/**
+ * Sort keys do not contain zero bytes except for their terminators,
+ * so strcmp() compares them properly.
+ * Ties are broken by the input index, which makes the sort stable
+ * even though the chunks are sorted with an unstable algorithm.
+ */
+int32_t U_CALLCONV
+compareSortItems(const void * /*context*/, const void *left, const void *right) {
+    const SortItem &l = *static_cast<const SortItem *>(left);
+    const SortItem &r = *static_cast<const SortItem *>(right);
+    int32_t diff = uprv_strcmp(l.key, r.key);
+    if(diff != 0) { return diff; }
+    return l.index < r.index ? -1 : (l.index > r.index ? 1 : 0);
+}
+
+inline UBool lessThan(const SortItem &l, const SortItem &r) {
+    return compareSortItems(NULL, &l, &r) < 0;
+}
+
+struct SortChunk : public UMemory {
+    SortChunk() : errorCode(U_ZERO_ERROR) {}
+
+    LocalMemory<uint8_t> keys;
+    LocalMemory<int32_t> offsets;
+    UErrorCode errorCode;
+};
+
+struct ParallelSortContext {
+    const RuleBasedCollator *coll;
+    const UChar *const *strings16;  // either strings16 or strings8 is set
+    const char *const *strings8;
+    const int32_t *lengths;
+    int32_t count;
+    int32_t numChunks;
+    SortChunk *chunks;
+    SortItem *items;
+    SortItem *otherItems;
+    int32_t runWidth;  // number of chunks per run in the current merge round
+
+    int32_t chunkStart(int32_t chunk) const {
+        if(chunk >= numChunks) { return count; }
+        return (int32_t)(((int64_t)count * chunk) / numChunks);
+    }
+};
+
+int32_t getChunkSortKeys(const RuleBasedCollator &coll, const ParallelSortContext &c,
+                         int32_t start, int32_t length,
+                         uint8_t *dest, int32_t capacity, int32_t *offsets,
+                         UErrorCode &errorCode) {
+    const int32_t *lengths = c.lengths != NULL ? c.lengths + start : NULL;
+    if(c.strings16 != NULL) {
+        return coll.getSortKeys(c.strings16 + start, lengths, length,
+                                dest, capacity, offsets, errorCode);
+    } else {
+        return coll.getSortKeysUTF8(c.strings8 + start, lengths, length,
+                                    dest, capacity, offsets, errorCode);
+    }
+}
+
+void U_CALLCONV
+sortChunk(void *context, int32_t chunkIndex) {
+    ParallelSortContext &c = *static_cast<ParallelSortContext *>(context);
+    SortChunk &chunk = c.chunks[chunkIndex];
+    UErrorCode &errorCode = chunk.errorCode;
+    LocalPointer<RuleBasedCollator> coll(
+        static_cast<RuleBasedCollator *>(c.coll->clone()), errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    int32_t start = c.chunkStart(chunkIndex);
+    int32_t length = c.chunkStart(chunkIndex + 1) - start;
+    if(length == INT32_MAX) {
+        // There would be no room for offsets[length].
+        errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+    if(chunk.offsets.allocateInsteadAndCopy(length + 1) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // Guess the key space, and redo the keys in the rare case where that is too small.
+    // The guess is capped at INT32_MAX; getSortKeys() fails with U_INDEX_OUTOFBOUNDS_ERROR
+    // if the keys themselves do not fit.
+    int64_t capacity64 = (int64_t)length * 24 + 1;
+    int32_t capacity = capacity64 <= INT32_MAX ? (int32_t)capacity64 : INT32_MAX;
+    if(chunk.keys.allocateInsteadAndCopy(capacity) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t keysLength = getChunkSortKeys(*coll, c, start, length,
+                                          chunk.keys.getAlias(), capacity,
+                                          chunk.offsets.getAlias(), errorCode);
+    if(errorCode == U_BUFFER_OVERFLOW_ERROR) {
+        errorCode = U_ZERO_ERROR;
+        capacity = keysLength;
+        if(chunk.keys.allocateInsteadAndCopy(capacity) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        getChunkSortKeys(*coll, c, start, length,
+                         chunk.keys.getAlias(), capacity, chunk.offsets.getAlias(), errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    SortItem *items = c.items + start;
+    const char *keys = reinterpret_cast<const char *>(chunk.keys.getAlias());
+    for(int32_t i = 0; i < length; ++i) {
+        items[i].key = keys + chunk.offsets[i];
+        items[i].index = start + i;
+    }
+    uprv_sortArray(items, length, (int32_t)sizeof(SortItem),
+                   compareSortItems, NULL, FALSE, &errorCode);
+}
+
+/** Merges the two adjacent runs for this task from items into otherItems. */
+void U_CALLCONV
+mergeRuns(void *context, int32_t mergeIndex) {
+    ParallelSortContext &c = *static_cast<ParallelSortContext *>(context);
+    int32_t firstChunk = 2 * mergeIndex * c.runWidth;
+    int32_t start = c.chunkStart(firstChunk);
+    int32_t middle = c.chunkStart(firstChunk + c.runWidth);
+    int32_t limit = c.chunkStart(firstChunk + 2 * c.runWidth);
+    const SortItem *src = c.items;
+    SortItem *dest = c.otherItems;
+    int32_t i = start, j = middle, k = start;
+    while(i < middle && j < limit) {
+        // Take from the right run only when it is strictly less, for stability.
+        if(lessThan(src[j], src[i])) {
+            dest[k++] = src[j++];
+        } else {
+            dest[k++] = src[i++];
+        }
+    }
+    while(i < middle) { dest[k++] = src[i++]; }
+    while(j < limit) { dest[k++] = src[j++]; }
+}
+
+}  // namespace
+
+void
+RuleBasedCollator::sortStrings(const UChar *const *strings, const int32_t *lengths, int32_t count,
+                               int32_t *indexes, int32_t numThreads,
+                               UErrorCode &errorCode) const {
+    doSortStrings(strings, NULL, lengths, count, indexes, numThreads, errorCode);
+}
+
+void
+RuleBasedCollator::sortStringsUTF8(const char *const *strings, const int32_t *lengths, int32_t count,
+                                   int32_t *indexes, int32_t numThreads,
+                                   UErrorCode &errorCode) const {
+    doSortStrings(NULL, strings, lengths, count, indexes, numThreads, errorCode);
+}
+
+void
+RuleBasedCollator::doSortStrings(const UChar *const *strings16, const char *const *strings8,
+                                 const int32_t *lengths, int32_t count,
+                                 int32_t *indexes, int32_t numThreads,
+                                 UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (count > 0 && ((strings16 == NULL && strings8 == NULL) || indexes == NULL))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count == 0) { return; }
+    if(numThreads <= 0) {
+        numThreads = uprv_getDefaultThreadCount();
+    }
+    if(numThreads > UPRV_MAX_PARALLEL_THREADS) {
+        numThreads = UPRV_MAX_PARALLEL_THREADS;
+    }
+    int32_t numChunks = (count + MIN_CHUNK_LENGTH - 1) / MIN_CHUNK_LENGTH;
+    if(numChunks > numThreads) {
+        numChunks = numThreads;
+    }
+
+    LocalArray<SortChunk> chunks(new SortChunk[numChunks], errorCode);
+    LocalMemory<SortItem> items;
+    LocalMemory<SortItem> otherItems;
+    if(U_FAILURE(errorCode)) { return; }
+    if(items.allocateInsteadAndCopy(count) == NULL ||
+            (numChunks > 1 && otherItems.allocateInsteadAndCopy(count) == NULL)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    ParallelSortContext context = {
+        this, strings16, strings8, lengths, count, numChunks,
+        chunks.getAlias(), items.getAlias(), otherItems.getAlias(), 1
+    };
+    uprv_parallelRun(numChunks, sortChunk, &context);
+    for(int32_t i = 0; i < numChunks; ++i) {
+        if(U_FAILURE(chunks[i].errorCode)) {
+            errorCode = chunks[i].errorCode;
+            return;
+        }
+    }
+
+    // Merge pairs of sorted runs until only one is left.
+    while(context.runWidth < numChunks) {
+        int32_t numRuns = (numChunks + context.runWidth - 1) / context.runWidth;
+        // An odd run at the end is merged with an empty one, which just copies it.
+        uprv_parallelRun((numRuns + 1) / 2, mergeRuns, &context);
+        SortItem *temp = context.items;
+        context.items = context.otherItems;
+        context.otherItems = temp;
+        context.runWidth *= 2;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        indexes[i] = context.items[i].index;
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
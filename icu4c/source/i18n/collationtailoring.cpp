@@ -36,7 +36,7 @@ CollationTailoring::CollationTailoring(const CollationSettings *baseSettings)
         : data(NULL), settings(baseSettings),
           actualLocale(""),
           ownedData(NULL),
-          builder(NULL), memory(NULL), bundle(NULL),
+          builder(NULL), memory(NULL), bundle(NULL), ownedBinary(NULL),
           trie(NULL), unsafeBackwardSet(NULL),
           maxExpansions(NULL) {
     if(baseSettings != NULL) {
@@ -60,6 +60,7 @@ CollationTailoring::~CollationTailoring() {
     delete builder;
     udata_close(memory);
     ures_close(bundle);
+    uprv_free(ownedBinary);
     utrie2_close(trie);
     delete unsafeBackwardSet;
     uhash_close(maxExpansions);
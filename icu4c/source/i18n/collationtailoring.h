@@ -79,6 +79,7 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     UObject *builder;
     UDataMemory *memory;
     UResourceBundle *bundle;
+    uint8_t *ownedBinary;  // tailoring data read from a CollationBuildCache file
     UTrie2 *trie;
     UnicodeSet *unsafeBackwardSet;
     mutable UHashtable *maxExpansions;
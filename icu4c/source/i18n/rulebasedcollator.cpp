@@ -29,6 +29,7 @@
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
+#include "unicode/ustring.h"
 #include "unicode/utf8.h"
 #include "unicode/uversion.h"
 #include "bocsu.h"
@@ -87,6 +88,29 @@ FixedSortKeyByteSink::Resize(int32_t /*appendCapacity*/, int32_t /*length*/) {
     return FALSE;
 }
 
+/**
+ * Returns the number of leading code units that are the same in left and right,
+ * up to length.
+ * Compares eight bytes at a time while they match, which makes the
+ * identical-prefix test cheap for long shared prefixes.
+ */
+template<typename Unit>
+int32_t
+getEqualPrefixLength(const Unit *left, const Unit *right, int32_t length) {
+    const int32_t unitsPerWord = 8 / (int32_t)sizeof(Unit);
+    int32_t i = 0;
+    while((length - i) >= unitsPerWord) {
+        // memcpy() avoids unaligned access and compiles to a simple load.
+        uint64_t lw, rw;
+        uprv_memcpy(&lw, left + i, 8);
+        uprv_memcpy(&rw, right + i, 8);
+        if(lw != rw) { break; }
+        i += unitsPerWord;
+    }
+    while(i < length && left[i] == right[i]) { ++i; }
+    return i;
+}
+
 }  // namespace
 
 // Not in an anonymous namespace, so that it can be a friend of CollationKey.
@@ -988,15 +1012,10 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     } else {
         leftLimit = left + leftLength;
         rightLimit = right + rightLength;
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+        equalPrefixLength = getEqualPrefixLength(left, right, minLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
 
@@ -1101,15 +1120,10 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
             ++equalPrefixLength;
         }
     } else {
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+        equalPrefixLength = getEqualPrefixLength(left, right, minLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
     // Back up to the start of a partially-equal code point.
@@ -1379,6 +1393,214 @@ RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
     u_writeIdenticalLevelRun(prev, nfd.getBuffer(), nfd.length(), sink);
 }
 
+UBool
+RuleBasedCollator::checkSortKeysArgs(const void *sources, int32_t count,
+                                     const uint8_t *dest, int32_t destCapacity,
+                                     const int32_t *offsets, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return FALSE; }
+    if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+int32_t
+RuleBasedCollator::getSortKeys(const UChar *const *sources, const int32_t *sourceLengths,
+                               int32_t count,
+                               uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                               UErrorCode &errorCode) const {
+    if(!checkSortKeysArgs(sources, count, dest, destCapacity, offsets, errorCode)) {
+        return 0;
+    }
+    // One iterator of each kind, re-pointed at each string,
+    // so that their CE buffers keep any capacity that was allocated.
+    UBool numeric = settings->isNumeric();
+    UTF16CollationIterator iter(data, numeric, NULL, NULL, NULL);
+    FCDUTF16CollationIterator fcdIter(data, numeric, NULL, NULL, NULL);
+    CollationKeys::LevelCallback callback;
+    uint8_t noDest[1] = { 0 };
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = length;
+        const UChar *s = sources[i];
+        int32_t sLength = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(s == NULL && sLength != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        const UChar *limit = (sLength >= 0) ? s + sLength : NULL;
+        FixedSortKeyByteSink sink(
+            reinterpret_cast<char *>(length < destCapacity ? dest + length : noDest),
+            length < destCapacity ? destCapacity - length : 0);
+        if(settings->dontCheckFCD()) {
+            iter.setText(s, limit);
+            CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        } else {
+            fcdIter.setText(s, limit);
+            CollationKeys::writeSortKeyUpToQuaternary(fcdIter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        }
+        if(settings->getStrength() == UCOL_IDENTICAL) {
+            writeIdenticalLevel(s, limit, sink, errorCode);
+        }
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return 0; }
+        int32_t keyLength = sink.NumberOfBytesAppended();
+        if(keyLength > INT32_MAX - length) {
+            // The offsets cannot represent 2GB or more of sort keys.
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        length += keyLength;
+    }
+    offsets[count] = length;
+    if(length > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+int32_t
+RuleBasedCollator::getSortKeysUTF8(const char *const *sources, const int32_t *sourceLengths,
+                                   int32_t count,
+                                   uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                                   UErrorCode &errorCode) const {
+    if(!checkSortKeysArgs(sources, count, dest, destCapacity, offsets, errorCode)) {
+        return 0;
+    }
+    UBool numeric = settings->isNumeric();
+    UTF8CollationIterator iter(data, numeric, NULL, 0, 0);
+    FCDUTF8CollationIterator fcdIter(data, numeric, NULL, 0, 0);
+    CollationKeys::LevelCallback callback;
+    // Only for the identical level, which is computed on UTF-16 text.
+    UnicodeString s16;
+    uint8_t noDest[1] = { 0 };
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = length;
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sources[i]);
+        int32_t sLength = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(s == NULL && sLength != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        FixedSortKeyByteSink sink(
+            reinterpret_cast<char *>(length < destCapacity ? dest + length : noDest),
+            length < destCapacity ? destCapacity - length : 0);
+        if(settings->dontCheckFCD()) {
+            iter.setText(s, sLength);
+            CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        } else {
+            fcdIter.setText(s, sLength);
+            CollationKeys::writeSortKeyUpToQuaternary(fcdIter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        }
+        if(settings->getStrength() == UCOL_IDENTICAL) {
+            if(sLength < 0) {
+                sLength = static_cast<int32_t>(uprv_strlen(sources[i]));
+            }
+            // The UTF-16 string has at most as many units as the UTF-8 string has bytes.
+            UChar *s16Array = s16.getBuffer(sLength);
+            if(s16Array == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return 0;
+            }
+            int32_t s16Length = 0;
+            u_strFromUTF8WithSub(s16Array, s16.getCapacity(), &s16Length,
+                                 sources[i], sLength, 0xfffd, NULL, &errorCode);
+            writeIdenticalLevel(s16Array, s16Array + s16Length, sink, errorCode);
+            s16.releaseBuffer(0);
+        }
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return 0; }
+        int32_t keyLength = sink.NumberOfBytesAppended();
+        if(keyLength > INT32_MAX - length) {
+            // The offsets cannot represent 2GB or more of sort keys.
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        length += keyLength;
+    }
+    offsets[count] = length;
+    if(length > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+int32_t
+RuleBasedCollator::getPrimaryPrefix(const UChar *s, int32_t length,
+                                    uint8_t *dest, int32_t destCapacity,
+                                    UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || dest == NULL || destCapacity <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    const UChar *limit = (length >= 0) ? s + length : NULL;
+    UBool numeric = settings->isNumeric();
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writePrimaryLevelPrefix(iter, data->compressibleBytes, *settings,
+                                               sink, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writePrimaryLevelPrefix(iter, data->compressibleBytes, *settings,
+                                               sink, errorCode);
+    }
+    return padPrimaryPrefix(sink, dest, destCapacity, errorCode);
+}
+
+int32_t
+RuleBasedCollator::getPrimaryPrefixUTF8(const char *s, int32_t length,
+                                        uint8_t *dest, int32_t destCapacity,
+                                        UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || dest == NULL || destCapacity <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    const uint8_t *s8 = reinterpret_cast<const uint8_t *>(s);
+    UBool numeric = settings->isNumeric();
+    if(settings->dontCheckFCD()) {
+        UTF8CollationIterator iter(data, numeric, s8, 0, length);
+        CollationKeys::writePrimaryLevelPrefix(iter, data->compressibleBytes, *settings,
+                                               sink, errorCode);
+    } else {
+        FCDUTF8CollationIterator iter(data, numeric, s8, 0, length);
+        CollationKeys::writePrimaryLevelPrefix(iter, data->compressibleBytes, *settings,
+                                               sink, errorCode);
+    }
+    return padPrimaryPrefix(sink, dest, destCapacity, errorCode);
+}
+
+int32_t
+RuleBasedCollator::padPrimaryPrefix(const SortKeyByteSink &sink,
+                                    uint8_t *dest, int32_t destCapacity,
+                                    UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return 0; }
+    int32_t length = sink.NumberOfBytesAppended();
+    if(length > destCapacity) {
+        length = destCapacity;
+    }
+    // Zero bytes sort below the LEVEL_SEPARATOR_BYTE that follows the primary level
+    // in a full sort key, which keeps the truncated prefixes in order.
+    uprv_memset(dest + length, 0, destCapacity - length);
+    return length;
+}
+
 namespace {
 
 /**
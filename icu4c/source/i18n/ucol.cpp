@@ -209,6 +209,98 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources, const int32_t *sourceLengths, int32_t count,
+                 uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                 UErrorCode *pErrorCode)
+{
+    if(U_FAILURE(*pErrorCode)) { return 0; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *pErrorCode = coll == NULL ? U_ILLEGAL_ARGUMENT_ERROR : U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    return rbc->getSortKeys(sources, sourceLengths, count,
+                            dest, destCapacity, offsets, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources, const int32_t *sourceLengths, int32_t count,
+                     uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                     UErrorCode *pErrorCode)
+{
+    if(U_FAILURE(*pErrorCode)) { return 0; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *pErrorCode = coll == NULL ? U_ILLEGAL_ARGUMENT_ERROR : U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    return rbc->getSortKeysUTF8(sources, sourceLengths, count,
+                                dest, destCapacity, offsets, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getPrimaryPrefix(const UCollator *coll,
+                      const UChar *source, int32_t sourceLength,
+                      uint8_t *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode)
+{
+    if(U_FAILURE(*pErrorCode)) { return 0; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *pErrorCode = coll == NULL ? U_ILLEGAL_ARGUMENT_ERROR : U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    return rbc->getPrimaryPrefix(source, sourceLength, dest, destCapacity, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getPrimaryPrefixUTF8(const UCollator *coll,
+                          const char *source, int32_t sourceLength,
+                          uint8_t *dest, int32_t destCapacity,
+                          UErrorCode *pErrorCode)
+{
+    if(U_FAILURE(*pErrorCode)) { return 0; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *pErrorCode = coll == NULL ? U_ILLEGAL_ARGUMENT_ERROR : U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    return rbc->getPrimaryPrefixUTF8(source, sourceLength, dest, destCapacity, *pErrorCode);
+}
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings, const int32_t *lengths, int32_t count,
+                 int32_t *indexes, int32_t numThreads,
+                 UErrorCode *pErrorCode)
+{
+    if(U_FAILURE(*pErrorCode)) { return; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *pErrorCode = coll == NULL ? U_ILLEGAL_ARGUMENT_ERROR : U_UNSUPPORTED_ERROR;
+        return;
+    }
+    rbc->sortStrings(strings, lengths, count, indexes, numThreads, *pErrorCode);
+}
+
+U_CAPI void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char *const *strings, const int32_t *lengths, int32_t count,
+                     int32_t *indexes, int32_t numThreads,
+                     UErrorCode *pErrorCode)
+{
+    if(U_FAILURE(*pErrorCode)) { return; }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *pErrorCode = coll == NULL ? U_ILLEGAL_ARGUMENT_ERROR : U_UNSUPPORTED_ERROR;
+        return;
+    }
+    rbc->sortStringsUTF8(strings, lengths, count, indexes, numThreads, *pErrorCode);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
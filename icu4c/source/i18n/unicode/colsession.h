@@ -0,0 +1,143 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* colsession.h
+*
+* created on: 2018oct19
+*/
+
+#ifndef COLSESSION_H
+#define COLSESSION_H
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C++ API: Repeated string comparisons against the same string.
+ */
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/stringpiece.h"
+#include "unicode/ucol.h"
+#include "unicode/unistr.h"
+#include "unicode/uobject.h"
+
+U_NAMESPACE_BEGIN
+
+struct CollationCompareSessionData;
+class RuleBasedCollator;
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A CollationCompareSession compares strings with a RuleBasedCollator,
+ * like RuleBasedCollator::compare() and compareUTF8(),
+ * but remembers the collation elements of the last left-hand string.
+ * When the next comparison has the same left string,
+ * then that string is not collated again:
+ * A common prefix of the two strings is skipped as usual,
+ * and the right string's collation elements from there on
+ * are compared with the remembered ones of the left string.
+ *
+ * This can save some work in sequences of comparisons against the same pivot string,
+ * as in a binary search, at the cost of always collating the whole left string once.
+ * The savings are modest and occur only when the strings often need to be compared
+ * beyond the primary level; otherwise a session is about as fast as the collator.
+ * With alternate=shifted, the session just calls the collator.
+ * UTF-16 and UTF-8 comparisons remember their left strings separately.
+ *
+ * A session is not thread-safe; use one per thread.
+ * The collator must not be modified or deleted while a session uses it.
+ * @draft ICU 64
+ */
+class U_I18N_API CollationCompareSession : public UObject {
+public:
+    /**
+     * Constructor.
+     * @param coll the collator; the session keeps a reference to it
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 64
+     */
+    CollationCompareSession(const RuleBasedCollator &coll, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~CollationCompareSession();
+
+    /**
+     * Compares two UTF-8 strings, with the same result as
+     * the collator's compareUTF8(left, right, errorCode).
+     * If left has the same contents as in the previous call,
+     * then its collation elements are reused.
+     * @param left UTF-8 string; its contents are copied if they differ from the previous call
+     * @param right UTF-8 string
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return UCOL_LESS, UCOL_EQUAL or UCOL_GREATER
+     * @draft ICU 64
+     */
+    UCollationResult compareUTF8(const StringPiece &left, const StringPiece &right,
+                                 UErrorCode &errorCode);
+
+    /**
+     * Compares two strings, with the same result as
+     * the collator's compare(left, right, errorCode).
+     * If left has the same contents as in the previous call,
+     * then its collation elements are reused.
+     * @param left string; its contents are copied if they differ from the previous call
+     * @param right string
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return UCOL_LESS, UCOL_EQUAL or UCOL_GREATER
+     * @draft ICU 64
+     */
+    UCollationResult compare(const UnicodeString &left, const UnicodeString &right,
+                             UErrorCode &errorCode);
+
+    /**
+     * Compares two strings, with the same result as
+     * the collator's compare(left, leftLength, right, rightLength, errorCode).
+     * If left has the same contents as in the previous call,
+     * then its collation elements are reused.
+     * @param left string; its contents are copied if they differ from the previous call
+     * @param leftLength length of left, or -1 if NUL-terminated
+     * @param right string
+     * @param rightLength length of right, or -1 if NUL-terminated
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return UCOL_LESS, UCOL_EQUAL or UCOL_GREATER
+     * @draft ICU 64
+     */
+    UCollationResult compare(const char16_t *left, int32_t leftLength,
+                             const char16_t *right, int32_t rightLength,
+                             UErrorCode &errorCode);
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     * @draft ICU 64
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     * @draft ICU 64
+     */
+    virtual UClassID getDynamicClassID() const;
+
+private:
+    CollationCompareSession(const CollationCompareSession &other);  // not implemented
+    CollationCompareSession &operator=(const CollationCompareSession &other);  // not implemented
+
+    const RuleBasedCollator &coll;
+    CollationCompareSessionData *sessionData;
+};
+#endif  // U_HIDE_DRAFT_API
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // COLSESSION_H
@@ -173,6 +173,28 @@ class U_I18N_API RuleBasedCollator : public Collator {
                       UErrorCode &errorCode);
 #endif  /* U_HIDE_INTERNAL_API */
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * RuleBasedCollator constructor, with a persistent on-disk cache of the built data.
+     * Building a collator from rules is relatively slow. This constructor first
+     * looks in cacheDirectory for a file with the data built from the same rules
+     * by the same ICU version with the same ICU data, and loads it if it is valid.
+     * Otherwise it builds the collator from the rules as usual and
+     * writes the result into the cache directory for next time.
+     *
+     * The cache directory must already exist. Failure to write a cache file is ignored.
+     * Settings in the rule string are part of the cached data.
+     * If cacheDirectory is NULL or empty, then no cache is used.
+     *
+     * @param rules the collation rules to build the collation table from.
+     * @param cacheDirectory path of the directory for the cache files, or NULL
+     * @param status reporting a success or an error.
+     * @draft ICU 64
+     */
+    RuleBasedCollator(const UnicodeString &rules, const char *cacheDirectory,
+                      UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Copy constructor.
      * @param other the RuleBasedCollator object to be copied
@@ -649,6 +671,157 @@ class U_I18N_API RuleBasedCollator : public Collator {
     virtual int32_t getSortKey(const char16_t *source, int32_t sourceLength,
                                uint8_t *result, int32_t resultLength) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes the sort keys for an array of UTF-16 strings into one buffer.
+     * The keys are written back to back, each including its terminating zero byte,
+     * and offsets[i] receives the start of the key for sources[i].
+     * This is equivalent to calling getSortKey() for each string
+     * but reuses the collation iterator and its buffers across strings.
+     *
+     * If the buffer is too small, then the function still sets all of the offsets
+     * to the values they would have with a large enough buffer,
+     * and sets U_BUFFER_OVERFLOW_ERROR.
+     * The contents of dest is undefined in that case.
+     * If the total length of the sort keys does not fit into an int32_t,
+     * then the function sets U_INDEX_OUTOFBOUNDS_ERROR.
+     *
+     * @param sources array of count pointers to the strings
+     * @param sourceLengths array of count string lengths, or NULL if all strings are NUL-terminated;
+     *        an individual length can be -1 for a NUL-terminated string
+     * @param count number of strings
+     * @param dest buffer for the sort keys; can be NULL if destCapacity==0 for preflighting
+     * @param destCapacity capacity of dest in bytes
+     * @param offsets array of count+1 offsets; offsets[count] receives the total length
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return total number of bytes needed for all of the sort keys
+     * @draft ICU 64
+     */
+    int32_t getSortKeys(const char16_t *const *sources, const int32_t *sourceLengths,
+                        int32_t count,
+                        uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                        UErrorCode &errorCode) const;
+
+    /**
+     * Writes the sort keys for an array of UTF-8 strings into one buffer.
+     * Same as the UTF-16 getSortKeys() otherwise.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD, as in compareUTF8().
+     *
+     * @param sources array of count pointers to the strings
+     * @param sourceLengths array of count string lengths, or NULL if all strings are NUL-terminated;
+     *        an individual length can be -1 for a NUL-terminated string
+     * @param count number of strings
+     * @param dest buffer for the sort keys; can be NULL if destCapacity==0 for preflighting
+     * @param destCapacity capacity of dest in bytes
+     * @param offsets array of count+1 offsets; offsets[count] receives the total length
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return total number of bytes needed for all of the sort keys
+     * @draft ICU 64
+     */
+    int32_t getSortKeysUTF8(const char *const *sources, const int32_t *sourceLengths,
+                            int32_t count,
+                            uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                            UErrorCode &errorCode) const;
+
+    /**
+     * Writes a fixed-length, order-preserving prefix of the string's sort key
+     * which contains only primary weights.
+     * Exactly destCapacity bytes are written: the start of the primary level
+     * of the sort key, padded with zero bytes.
+     * This is computed without building the rest of the sort key,
+     * and stops reading the string once the prefix is full.
+     *
+     * For two strings a and b, if the prefix of a is less than the prefix of b
+     * in unsigned byte order (memcmp()), then compare(a, b) returns UCOL_LESS.
+     * Equal prefixes do not mean equal strings; such ties must be resolved
+     * with compare() or full sort keys.
+     * This is intended for radix or bucket sorting with typical prefix lengths of 8 or 16 bytes.
+     *
+     * @param source string to be processed
+     * @param sourceLength length of the string, or -1 if it is NUL-terminated
+     * @param dest buffer for the prefix
+     * @param destCapacity length of the prefix, must be greater than 0
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return the number of bytes of primary weights written before the zero padding.
+     *         If this is less than destCapacity, then the prefix contains
+     *         the string's whole primary level.
+     * @draft ICU 64
+     */
+    int32_t getPrimaryPrefix(const char16_t *source, int32_t sourceLength,
+                             uint8_t *dest, int32_t destCapacity,
+                             UErrorCode &errorCode) const;
+
+    /**
+     * Writes a fixed-length, order-preserving prefix of the UTF-8 string's sort key
+     * which contains only primary weights.
+     * Same as the UTF-16 getPrimaryPrefix() otherwise.
+     *
+     * @param source UTF-8 string to be processed
+     * @param sourceLength length of the string, or -1 if it is NUL-terminated
+     * @param dest buffer for the prefix
+     * @param destCapacity length of the prefix, must be greater than 0
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return the number of bytes of primary weights written before the zero padding
+     * @draft ICU 64
+     */
+    int32_t getPrimaryPrefixUTF8(const char *source, int32_t sourceLength,
+                                 uint8_t *dest, int32_t destCapacity,
+                                 UErrorCode &errorCode) const;
+
+    /**
+     * Sorts an array of strings, using several threads for large arrays.
+     * The strings themselves are not moved; instead, indexes receives
+     * the permutation of 0..count-1 which lists the strings in sorted order.
+     * The sort is stable: Strings that compare equal stay in input order.
+     *
+     * The work is split into chunks of the input. For each chunk, one thread
+     * computes the sort keys with its own clone of this collator and sorts them;
+     * then the sorted chunks are merged in parallel rounds.
+     * Small arrays are sorted on the calling thread.
+     * Fails with U_INDEX_OUTOFBOUNDS_ERROR if the sort keys for one chunk
+     * do not fit into 2GB.
+     *
+     * @param strings array of count pointers to the strings
+     * @param lengths array of count string lengths, or NULL if all strings are NUL-terminated;
+     *        an individual length can be -1 for a NUL-terminated string
+     * @param count number of strings
+     * @param indexes receives count indexes into strings, in sorted order
+     * @param numThreads maximum number of threads to use, including the calling thread;
+     *        if 0 or negative, then the number of processors is used;
+     *        very large values are reduced to an internal limit
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 64
+     */
+    void sortStrings(const char16_t *const *strings, const int32_t *lengths, int32_t count,
+                     int32_t *indexes, int32_t numThreads,
+                     UErrorCode &errorCode) const;
+
+    /**
+     * Sorts an array of UTF-8 strings, using several threads for large arrays.
+     * Same as the UTF-16 sortStrings() otherwise.
+     *
+     * @param strings array of count pointers to the strings
+     * @param lengths array of count string lengths, or NULL if all strings are NUL-terminated;
+     *        an individual length can be -1 for a NUL-terminated string
+     * @param count number of strings
+     * @param indexes receives count indexes into strings, in sorted order
+     * @param numThreads maximum number of threads to use, including the calling thread;
+     *        if 0 or negative, then the number of processors is used;
+     *        very large values are reduced to an internal limit
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 64
+     */
+    void sortStringsUTF8(const char *const *strings, const int32_t *lengths, int32_t count,
+                         int32_t *indexes, int32_t numThreads,
+                         UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Retrieves the reordering codes for this collator.
      * @param dest The array to fill with the script ordering.
@@ -776,6 +949,20 @@ class U_I18N_API RuleBasedCollator : public Collator {
             UParseError *outParseError, UnicodeString *outReason,
             UErrorCode &errorCode);
 
+    /**
+     * Implements the cached from-rules constructor, and ucol_openRulesCached().
+     * Like internalBuildTailoring() but first tries to load the tailoring
+     * from the cacheDirectory, and stores a newly built one there.
+     * @internal
+     */
+    void internalBuildCachedTailoring(
+            const UnicodeString &rules,
+            const char *cacheDirectory,
+            int32_t strength,
+            UColAttributeValue decompositionMode,
+            UParseError *outParseError, UnicodeString *outReason,
+            UErrorCode &errorCode);
+
     /** @internal */
     static inline RuleBasedCollator *rbcFromUCollator(UCollator *uc) {
         return dynamic_cast<RuleBasedCollator *>(fromUCollator(uc));
@@ -803,6 +990,7 @@ class U_I18N_API RuleBasedCollator : public Collator {
     virtual void setLocales(const Locale& requestedLocale, const Locale& validLocale, const Locale& actualLocale);
 
 private:
+    friend class CollationCompareSession;
     friend class CollationElementIterator;
     friend class Collator;
 
@@ -834,6 +1022,19 @@ class U_I18N_API RuleBasedCollator : public Collator {
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                              SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
+    void doSortStrings(const char16_t *const *strings16, const char *const *strings8,
+                       const int32_t *lengths, int32_t count,
+                       int32_t *indexes, int32_t numThreads,
+                       UErrorCode &errorCode) const;
+
+    static int32_t padPrimaryPrefix(const SortKeyByteSink &sink,
+                                    uint8_t *dest, int32_t destCapacity,
+                                    UErrorCode &errorCode);
+
+    static UBool checkSortKeysArgs(const void *sources, int32_t count,
+                                   const uint8_t *dest, int32_t destCapacity,
+                                   const int32_t *offsets, UErrorCode &errorCode);
+
     const CollationSettings &getDefaultSettings() const;
 
     void setAttributeDefault(int32_t attribute) {
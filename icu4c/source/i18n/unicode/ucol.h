@@ -57,6 +57,15 @@ struct UCollator;
  */
 typedef struct UCollator UCollator;
 
+#ifndef U_HIDE_DRAFT_API
+struct UCollationComparand;
+/**
+ * A source string prepared for repeated comparisons; see ucol_openComparand().
+ * @draft ICU 64
+ */
+typedef struct UCollationComparand UCollationComparand;
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
  * UCOL_LESS is returned if source string is compared to be less than target
@@ -432,6 +441,43 @@ ucol_openRules( const UChar        *rules,
                 UParseError        *parseError,
                 UErrorCode         *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Same as ucol_openRules(), but with a persistent on-disk cache of the built data.
+ * Building a collator from rules is relatively slow. This function first
+ * looks in cacheDirectory for a file with the data built from the same rules
+ * by the same ICU version with the same ICU data, and loads it if it is valid.
+ * Otherwise it builds the collator from the rules as usual and
+ * writes the result into the cache directory for next time.
+ *
+ * The cache directory must already exist. Failure to write a cache file is ignored.
+ * Settings in the rule string are part of the cached data;
+ * the normalizationMode and strength are applied after loading or building.
+ * When the collator is loaded from the cache, the parseError is not set.
+ *
+ * @param rules A string describing the collation rules.
+ * @param rulesLength The length of rules, or -1 if null-terminated.
+ * @param normalizationMode The normalization mode, as for ucol_openRules().
+ * @param strength The default collation strength, as for ucol_openRules().
+ * @param cacheDirectory Path of the directory for the cache files.
+ *                       If NULL or empty, then no cache is used.
+ * @param parseError A pointer to UParseError to recieve information about errors
+ *                   occurred during parsing.
+ * @param status A pointer to a UErrorCode to receive any errors
+ * @return A pointer to a UCollator, or NULL if an error occurred.
+ * @see ucol_openRules
+ * @draft ICU 64
+ */
+U_DRAFT UCollator* U_EXPORT2
+ucol_openRulesCached(const UChar        *rules,
+                     int32_t            rulesLength,
+                     UColAttributeValue normalizationMode,
+                     UCollationStrength strength,
+                     const char         *cacheDirectory,
+                     UParseError        *parseError,
+                     UErrorCode         *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_DEPRECATED_API
 /** 
  * Open a collator defined by a short form string.
@@ -590,6 +636,82 @@ ucol_strcollUTF8(
         int32_t         targetLength,
         UErrorCode      *status);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Opens a comparand for a source string, for repeated comparisons
+ * of the same source string against different target strings,
+ * as in a binary search for the source string.
+ * The collation elements of the source string are computed once
+ * and reused in ucol_compareComparand() calls, except with alternate=shifted.
+ * This is at most modestly faster than ucol_strcoll(), and mostly when
+ * the strings often need to be compared beyond the primary level.
+ * See icu::CollationCompareSession.
+ *
+ * The comparand copies the source string but keeps a reference to the collator.
+ * The collator must not be modified or closed while the comparand is in use.
+ * A comparand is not thread-safe.
+ *
+ * @param coll The UCollator containing the comparison rules.
+ * @param source The source string.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors
+ * @return The comparand, to be closed with ucol_closeComparand(),
+ *         or NULL if an error occurred.
+ * @see ucol_compareComparand
+ * @draft ICU 64
+ */
+U_DRAFT UCollationComparand * U_EXPORT2
+ucol_openComparand(const UCollator *coll,
+                   const UChar *source, int32_t sourceLength,
+                   UErrorCode *status);
+
+/**
+ * Compares the comparand's source string with a target string.
+ * The result is the same as for ucol_strcoll(coll, source, sourceLength, target, targetLength).
+ * @param comparand The comparand from ucol_openComparand().
+ * @param target The target string.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors
+ * @return The result of comparing the strings; one of UCOL_EQUAL,
+ *         UCOL_GREATER, UCOL_LESS
+ * @see ucol_openComparand
+ * @draft ICU 64
+ */
+U_DRAFT UCollationResult U_EXPORT2
+ucol_compareComparand(UCollationComparand *comparand,
+                      const UChar *target, int32_t targetLength,
+                      UErrorCode *status);
+
+/**
+ * Closes a comparand.
+ * @param comparand The comparand to close; can be NULL.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_closeComparand(UCollationComparand *comparand);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUCollationComparandPointer
+ * "Smart pointer" class, closes a UCollationComparand via ucol_closeComparand().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUCollationComparandPointer, UCollationComparand, ucol_closeComparand);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Determine if one string is greater than another.
  * This function is equivalent to {@link #ucol_strcoll } == UCOL_GREATER
@@ -1020,6 +1142,188 @@ ucol_getSortKey(const    UCollator    *coll,
         int32_t        resultLength);
 
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Gets the sort keys for an array of strings from a UCollator,
+ * written back to back into one buffer.
+ * Each key is the same as from ucol_getSortKey(), including its terminating zero byte,
+ * and offsets[i] receives the start of the key for sources[i].
+ * Faster than calling ucol_getSortKey() for each string
+ * because the collation iterator and its buffers are set up only once.
+ *
+ * If destCapacity is too small, then all of the offsets are still set
+ * to the values they would have with a large enough buffer,
+ * and *pErrorCode is set to U_BUFFER_OVERFLOW_ERROR.
+ * The dest contents is undefined in that case.
+ * If the total length of the sort keys does not fit into an int32_t,
+ * then *pErrorCode is set to U_INDEX_OUTOFBOUNDS_ERROR.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count pointers to the strings.
+ * @param sourceLengths Array of count string lengths, or NULL if all strings are NUL-terminated.
+ *                      An individual length can be -1 for a NUL-terminated string.
+ * @param count Number of strings.
+ * @param dest Buffer for the sort keys. Can be NULL if destCapacity==0 for preflighting.
+ * @param destCapacity Capacity of dest in bytes.
+ * @param offsets Array of count+1 offsets; offsets[count] receives the total length.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @return The total number of bytes needed for all of the sort keys.
+ * @see ucol_getSortKey
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources, const int32_t *sourceLengths, int32_t count,
+                 uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                 UErrorCode *pErrorCode);
+
+/**
+ * Gets the sort keys for an array of UTF-8 strings from a UCollator,
+ * written back to back into one buffer.
+ * Same as ucol_getSortKeys() otherwise.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD, as in ucol_strcollUTF8().
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count pointers to the UTF-8 strings.
+ * @param sourceLengths Array of count string lengths, or NULL if all strings are NUL-terminated.
+ *                      An individual length can be -1 for a NUL-terminated string.
+ * @param count Number of strings.
+ * @param dest Buffer for the sort keys. Can be NULL if destCapacity==0 for preflighting.
+ * @param destCapacity Capacity of dest in bytes.
+ * @param offsets Array of count+1 offsets; offsets[count] receives the total length.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @return The total number of bytes needed for all of the sort keys.
+ * @see ucol_getSortKeys
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources, const int32_t *sourceLengths, int32_t count,
+                     uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                     UErrorCode *pErrorCode);
+
+/**
+ * Gets a fixed-length, order-preserving prefix of a string's sort key
+ * which contains only primary weights.
+ * Exactly destCapacity bytes are written: the start of the primary level
+ * of the sort key, padded with zero bytes.
+ * This is computed without building the rest of the sort key.
+ *
+ * If the prefix of string a is less than the prefix of string b (memcmp()),
+ * then ucol_strcoll(a, b) returns UCOL_LESS.
+ * Equal prefixes must be resolved with ucol_strcoll() or full sort keys.
+ * This is intended for radix or bucket sorting with typical prefix lengths of 8 or 16 bytes.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param dest Buffer for the prefix.
+ * @param destCapacity Length of the prefix, must be greater than 0.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @return The number of bytes of primary weights written before the zero padding.
+ *         If this is less than destCapacity, then the prefix contains
+ *         the string's whole primary level.
+ * @see ucol_getSortKey
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getPrimaryPrefix(const UCollator *coll,
+                      const UChar *source, int32_t sourceLength,
+                      uint8_t *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode);
+
+/**
+ * Gets a fixed-length, order-preserving prefix of a UTF-8 string's sort key
+ * which contains only primary weights.
+ * Same as ucol_getPrimaryPrefix() otherwise.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The UTF-8 string to transform.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param dest Buffer for the prefix.
+ * @param destCapacity Length of the prefix, must be greater than 0.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @return The number of bytes of primary weights written before the zero padding.
+ * @see ucol_getPrimaryPrefix
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getPrimaryPrefixUTF8(const UCollator *coll,
+                          const char *source, int32_t sourceLength,
+                          uint8_t *dest, int32_t destCapacity,
+                          UErrorCode *pErrorCode);
+
+/**
+ * Sorts an array of strings, using several threads for large arrays.
+ * The strings themselves are not moved; instead, indexes receives
+ * the permutation of 0..count-1 which lists the strings in sorted order.
+ * The sort is stable: Strings that compare equal stay in input order.
+ *
+ * Each thread computes sort keys for a chunk of the input with its own
+ * clone of the collator and sorts them; the sorted chunks are then merged.
+ * This is much faster than sorting with ucol_strcoll() as the comparison function.
+ * Fails with U_INDEX_OUTOFBOUNDS_ERROR if the sort keys for one chunk
+ * do not fit into 2GB.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings Array of count pointers to the strings.
+ * @param lengths Array of count string lengths, or NULL if all strings are NUL-terminated.
+ *                An individual length can be -1 for a NUL-terminated string.
+ * @param count Number of strings.
+ * @param indexes Receives count indexes into strings, in sorted order.
+ * @param numThreads Maximum number of threads to use, including the calling thread.
+ *                   If 0 or negative, then the number of processors is used.
+ *                   Very large values are reduced to an internal limit.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings, const int32_t *lengths, int32_t count,
+                 int32_t *indexes, int32_t numThreads,
+                 UErrorCode *pErrorCode);
+
+/**
+ * Sorts an array of UTF-8 strings, using several threads for large arrays.
+ * Same as ucol_sortStrings() otherwise.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings Array of count pointers to the UTF-8 strings.
+ * @param lengths Array of count string lengths, or NULL if all strings are NUL-terminated.
+ *                An individual length can be -1 for a NUL-terminated string.
+ * @param count Number of strings.
+ * @param indexes Receives count indexes into strings, in sorted order.
+ * @param numThreads Maximum number of threads to use, including the calling thread.
+ *                   If 0 or negative, then the number of processors is used.
+ *                   Very large values are reduced to an internal limit.
+ * @param pErrorCode Pointer to a standard ICU error code. Its input value must
+ *                   pass the U_SUCCESS() test, or else the function returns
+ *                   immediately. Check for U_FAILURE() on output or use with
+ *                   function chaining. (See User Guide for details.)
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char *const *strings, const int32_t *lengths, int32_t count,
+                     int32_t *indexes, int32_t numThreads,
+                     UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
  *  the same type of UCharIterator set with the same string.
@@ -0,0 +1,103 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*****************************************************************************************
+* upreload.h
+*
+* created on: 2018oct18
+*****************************************************************************************
+*/
+
+#ifndef UPRELOAD_H
+#define UPRELOAD_H
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C API: Preloading locale data.
+ *
+ * Collators, break iterators, formatters and plural rules load their locale data
+ * lazily, and the first object of a kind created for a locale is much slower
+ * to create than later ones, which are served from ICU's internal caches.
+ * upreload_preload() loads that data up front, for example while an
+ * application starts, so that later requests do not pay for it.
+ *
+ * Preloading only fills caches. It does not change any results,
+ * and the cached data is released by u_cleanup() as usual.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Kinds of locale data for upreload_preload().
+ * The values are bit masks and can be combined.
+ * @draft ICU 64
+ */
+typedef enum UPreloadService {
+    /**
+     * Collation data, as used by ucol_open() and Collator::createInstance().
+     * @draft ICU 64
+     */
+    UPRELOAD_COLLATION = 1,
+    /**
+     * Character, word, line and sentence break rules, and the dictionaries
+     * for the scripts of the locale, as used by ubrk_open() and BreakIterator.
+     * @draft ICU 64
+     */
+    UPRELOAD_BREAK_ITERATION = 2,
+    /**
+     * Number formatting symbols and patterns, as used by unum_open() and NumberFormat.
+     * @draft ICU 64
+     */
+    UPRELOAD_NUMBER_FORMAT = 4,
+    /**
+     * Date formatting symbols, patterns and calendar data,
+     * as used by udat_open() and DateFormat.
+     * @draft ICU 64
+     */
+    UPRELOAD_DATE_FORMAT = 8,
+    /**
+     * Cardinal and ordinal plural rules, as used by uplrules_open() and PluralRules.
+     * @draft ICU 64
+     */
+    UPRELOAD_PLURAL_RULES = 0x10,
+    /**
+     * All of the above.
+     * @draft ICU 64
+     */
+    UPRELOAD_ALL = 0x1f
+} UPreloadService;
+
+/**
+ * Loads the data for the given services and locales into ICU's caches.
+ *
+ * The work for each locale and service is independent; it is distributed
+ * over threadCount threads. Services that are not available in this build
+ * (for example with UCONFIG_NO_COLLATION) are skipped.
+ *
+ * All of the requested data is attempted even if some of it fails to load.
+ * Missing data for a locale is not an error when the service falls back
+ * to a parent locale, as it does when the object is created normally.
+ *
+ * @param locales       array of locale IDs; can be NULL if localesLength==0
+ * @param localesLength number of locale IDs
+ * @param services      bit set of UPreloadService values
+ * @param threadCount   number of threads to use, at least 1;
+ *                      or 0 for the number of available processors.
+ *                      1 does all of the work on the calling thread.
+ *                      Very large values are reduced to an internal limit.
+ * @param pErrorCode    ICU error code in/out parameter.
+ *                      Must fulfill U_SUCCESS before the function call.
+ *                      Set to the first failure of any of the loads, if any;
+ *                      with several threads, the one that occurred first.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+upreload_preload(const char * const *locales, int32_t localesLength,
+                 uint32_t services, int32_t threadCount,
+                 UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // UPRELOAD_H
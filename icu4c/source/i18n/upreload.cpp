@@ -0,0 +1,190 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* upreload.cpp
+*
+* created on: 2018oct18
+*
+* upreload_preload() creates and discards one object of each requested kind
+* per locale. The objects' data stays behind in the caches
+* (UnifiedCache, the resource bundle cache, the udata cache and the
+* break engine factories) where later object creation finds it.
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/localpointer.h"
+#include "unicode/numfmt.h"
+#include "unicode/plurrule.h"
+#include "unicode/udat.h"
+#include "unicode/unistr.h"
+#include "unicode/upreload.h"
+#include "unicode/uscript.h"
+#include "cmemory.h"
+#include "umutex.h"
+#include "uparallel.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+const uint32_t ALL_SERVICES[] = {
+    UPRELOAD_COLLATION,
+    UPRELOAD_BREAK_ITERATION,
+    UPRELOAD_NUMBER_FORMAT,
+    UPRELOAD_DATE_FORMAT,
+    UPRELOAD_PLURAL_RULES
+};
+
+struct PreloadContext {
+    const char *const *locales;
+    uint32_t services[UPRV_LENGTHOF(ALL_SERVICES)];
+    int32_t numServices;
+    int32_t numItems;  // locales x services
+    u_atomic_int32_t nextItem;
+    u_atomic_int32_t numFailures;
+    // The first failure in time, set only by the thread that counted the first failure.
+    u_atomic_int32_t firstErrorCode;
+};
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+/**
+ * Runs the break iterator over a sample of each script of the locale.
+ * Text in scripts like Thai or Han is segmented with dictionaries
+ * which are loaded only when such text is first seen.
+ */
+void iterateScriptSamples(const Locale &locale, BreakIterator &bi) {
+    UScriptCode scripts[8];
+    UErrorCode scriptErrorCode = U_ZERO_ERROR;
+    int32_t numScripts = uscript_getCode(locale.getName(), scripts, UPRV_LENGTHOF(scripts),
+                                         &scriptErrorCode);
+    if(U_FAILURE(scriptErrorCode)) { return; }  // no script-specific data to load
+    UnicodeString text;
+    for(int32_t i = 0; i < numScripts; ++i) {
+        UChar sample[8];
+        int32_t length = uscript_getSampleString(scripts[i], sample, UPRV_LENGTHOF(sample),
+                                                 &scriptErrorCode);
+        if(U_SUCCESS(scriptErrorCode)) {
+            // Repeat the sample so that it forms a run which a dictionary engine handles.
+            text.append(sample, length).append(sample, length).append((UChar)0x20);
+        }
+        scriptErrorCode = U_ZERO_ERROR;
+    }
+    if(text.isEmpty()) { return; }
+    bi.setText(text);
+    while(bi.next() != BreakIterator::DONE) {}
+}
+
+void preloadBreakIteration(const Locale &locale, UErrorCode &errorCode) {
+    LocalPointer<BreakIterator> bi(BreakIterator::createCharacterInstance(locale, errorCode));
+    bi.adoptInstead(BreakIterator::createSentenceInstance(locale, errorCode));
+    bi.adoptInstead(BreakIterator::createWordInstance(locale, errorCode));
+    if(U_SUCCESS(errorCode)) {
+        iterateScriptSamples(locale, *bi);
+    }
+    bi.adoptInstead(BreakIterator::createLineInstance(locale, errorCode));
+    if(U_SUCCESS(errorCode)) {
+        iterateScriptSamples(locale, *bi);
+    }
+}
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
+
+void preloadItem(const char *localeID, uint32_t service, UErrorCode &errorCode) {
+    Locale locale(localeID);
+    if(locale.isBogus()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    switch(service) {
+#if !UCONFIG_NO_COLLATION
+    case UPRELOAD_COLLATION:
+        delete Collator::createInstance(locale, errorCode);
+        break;
+#endif
+#if !UCONFIG_NO_BREAK_ITERATION
+    case UPRELOAD_BREAK_ITERATION:
+        preloadBreakIteration(locale, errorCode);
+        break;
+#endif
+#if !UCONFIG_NO_FORMATTING
+    case UPRELOAD_NUMBER_FORMAT:
+        delete NumberFormat::createInstance(locale, errorCode);
+        break;
+    case UPRELOAD_DATE_FORMAT: {
+        // The C API reports errors that DateFormat::createDateTimeInstance() swallows.
+        UDateFormat *df = udat_open(UDAT_DEFAULT, UDAT_DEFAULT, localeID,
+                                    NULL, 0, NULL, 0, &errorCode);
+        udat_close(df);
+        break;
+    }
+    case UPRELOAD_PLURAL_RULES:
+        delete PluralRules::forLocale(locale, UPLURAL_TYPE_CARDINAL, errorCode);
+        delete PluralRules::forLocale(locale, UPLURAL_TYPE_ORDINAL, errorCode);
+        break;
+#endif
+    default:
+        break;  // not available in this build
+    }
+}
+
+void U_CALLCONV
+preloadWork(void *context, int32_t /*workerIndex*/) {
+    PreloadContext &c = *static_cast<PreloadContext *>(context);
+    int32_t item;
+    while((item = umtx_atomic_inc(&c.nextItem) - 1) < c.numItems) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        preloadItem(c.locales[item / c.numServices], c.services[item % c.numServices], errorCode);
+        // Keep going after a failure; report the first one.
+        if(U_FAILURE(errorCode) && umtx_atomic_inc(&c.numFailures) == 1) {
+            umtx_storeRelease(c.firstErrorCode, errorCode);
+        }
+    }
+}
+
+}  // namespace
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI void U_EXPORT2
+upreload_preload(const char * const *locales, int32_t localesLength,
+                 uint32_t services, int32_t threadCount,
+                 UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) { return; }
+    if(localesLength < 0 || (locales == NULL && localesLength > 0) || threadCount < 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    PreloadContext context;
+    context.locales = locales;
+    context.numServices = 0;
+    for(int32_t i = 0; i < UPRV_LENGTHOF(ALL_SERVICES); ++i) {
+        if((services & ALL_SERVICES[i]) != 0) {
+            context.services[context.numServices++] = ALL_SERVICES[i];
+        }
+    }
+    context.numItems = localesLength * context.numServices;
+    context.nextItem = 0;
+    context.numFailures = 0;
+    context.firstErrorCode = U_ZERO_ERROR;
+    if(context.numItems == 0) { return; }
+    if(threadCount == 0) {
+        threadCount = uprv_getDefaultThreadCount();
+    }
+    if(threadCount > UPRV_MAX_PARALLEL_THREADS) {
+        threadCount = UPRV_MAX_PARALLEL_THREADS;
+    }
+    if(threadCount > context.numItems) {
+        threadCount = context.numItems;
+    }
+    uprv_parallelRun(threadCount, preloadWork, &context);
+    int32_t firstErrorCode = umtx_loadAcquire(context.firstErrorCode);
+    if(firstErrorCode != U_ZERO_ERROR) {
+        *pErrorCode = static_cast<UErrorCode>(firstErrorCode);
+    }
+}
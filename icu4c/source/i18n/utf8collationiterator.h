@@ -44,6 +44,13 @@ class U_I18N_API UTF8CollationIterator : public CollationIterator {
 
     virtual int32_t getOffset() const;
 
+    void setText(const uint8_t *s, int32_t len) {
+        reset();
+        u8 = s;
+        pos = 0;
+        length = len;
+    }
+
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
 
     virtual UChar32 previousCodePoint(UErrorCode &errorCode);
@@ -91,6 +98,12 @@ class U_I18N_API FCDUTF8CollationIterator : public UTF8CollationIterator {
 
     virtual int32_t getOffset() const;
 
+    void setText(const uint8_t *s, int32_t len) {
+        UTF8CollationIterator::setText(s, len);
+        state = CHECK_FWD;
+        start = 0;
+    }
+
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
 
     virtual UChar32 previousCodePoint(UErrorCode &errorCode);
@@ -89,6 +89,7 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestBengaliSortKey, "tscoll/capitst/TestBengaliSortKey");
     addTest(root, &TestGetKeywordValuesForLocale, "tscoll/capitst/TestGetKeywordValuesForLocale");
     addTest(root, &TestStrcollNull, "tscoll/capitst/TestStrcollNull");
+    addTest(root, &TestComparand, "tscoll/capitst/TestComparand");
 }
 
 void TestGetSetAttr(void) {
@@ -2560,4 +2561,71 @@ static void TestStrcollNull(void) {
     ucol_close(coll);
 }
 
+static void TestComparand(void) {
+    static const char *const strings[] = {
+        "", "a", "A", "ab", "ch", "h", "\\u00e4", "a-b", "a1", "a10",
+        "\\u03b1\\u03b2", "\\u0391\\u03b2", "\\u4e00", "\\uac00", "x\\u0301\\u0323",
+        "x\\u0323\\u0301", "\\ud835\\udc00", "\\u0000a"
+    };
+    UChar buffers[UPRV_LENGTHOF(strings)][20];
+    int32_t lengths[UPRV_LENGTHOF(strings)];
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("sk", &status);
+    UCollationComparand *comparand;
+    int32_t i, j;
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(sk) failed - %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        lengths[i] = u_unescape(strings[i], buffers[i], UPRV_LENGTHOF(buffers[i]));
+    }
+    ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, &status);
+    ucol_setAttribute(coll, UCOL_STRENGTH, UCOL_IDENTICAL, &status);
+    for (i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        comparand = ucol_openComparand(coll, buffers[i], lengths[i], &status);
+        if (U_FAILURE(status)) {
+            log_err("ucol_openComparand(%s) failed - %s\n", strings[i], u_errorName(status));
+            break;
+        }
+        for (j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+            UCollationResult expected =
+                ucol_strcoll(coll, buffers[i], lengths[i], buffers[j], lengths[j]);
+            UCollationResult actual =
+                ucol_compareComparand(comparand, buffers[j], lengths[j], &status);
+            if (U_FAILURE(status) || actual != expected) {
+                log_err("ucol_compareComparand(%s, %s)=%d != %d - %s\n",
+                        strings[i], strings[j], (int)actual, (int)expected, u_errorName(status));
+            }
+        }
+        ucol_closeComparand(comparand);
+    }
+
+    /* NUL-terminated target */
+    status = U_ZERO_ERROR;
+    comparand = ucol_openComparand(coll, buffers[1], -1, &status);
+    if (U_FAILURE(status) ||
+            ucol_compareComparand(comparand, buffers[3], -1, &status) != UCOL_LESS ||
+            ucol_compareComparand(comparand, buffers[1], -1, &status) != UCOL_EQUAL ||
+            U_FAILURE(status)) {
+        log_err("ucol_compareComparand(a, ab/a) with NUL-terminated strings failed - %s\n",
+                u_errorName(status));
+    }
+    ucol_closeComparand(comparand);
+
+    status = U_ZERO_ERROR;
+    if (ucol_openComparand(NULL, buffers[1], -1, &status) != NULL ||
+            status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_openComparand(NULL collator) did not fail as expected - %s\n",
+                u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    if (ucol_openComparand(coll, NULL, 3, &status) != NULL ||
+            status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_openComparand(NULL string) did not fail as expected - %s\n",
+                u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -137,6 +137,11 @@
      */
     static void TestStrcollNull(void);
 
+    /**
+     * Test ucol_openComparand() & ucol_compareComparand()
+     */
+    static void TestComparand(void);
+
 #endif /* #if !UCONFIG_NO_COLLATION */
 
 #endif
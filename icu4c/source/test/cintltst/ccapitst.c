@@ -69,6 +69,12 @@ static void TestEBCDICSwapLFNL(void);
 static void TestConvertEx(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
+#if !UCONFIG_NO_LEGACY_CONVERSION
+static void TestConvertExMBCSUTF8(void);
+#endif
+#if !UCONFIG_ONLY_HTML_CONVERSION
+static void TestConvertExUTF32UTF8(void);
+#endif
 static void TestConvertAlgorithmic(void);
        void TestDefaultConverterError(void);    /* defined in cctest.c */
        void TestDefaultConverterSet(void);    /* defined in cctest.c */
@@ -80,6 +86,10 @@ static void TestSubstString(void);
 static void InvalidArguments(void);
 static void TestGetName(void);
 static void TestUTFBOM(void);
+static void TestConverterDescriptor(void);
+static void TestConvertSegments(void);
+static void TestConverterDescriptorParallel(void);
+static void TestConverterMemoryUsage(void);
 
 void addTestConvert(TestNode** root);
 
@@ -104,6 +114,12 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertEx,               "tsconv/ccapitst/TestConvertEx");
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    addTest(root, &TestConvertExMBCSUTF8,       "tsconv/ccapitst/TestConvertExMBCSUTF8");
+#endif
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    addTest(root, &TestConvertExUTF32UTF8,      "tsconv/ccapitst/TestConvertExUTF32UTF8");
+#endif
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
     addTest(root, &TestDefaultConverterError,   "tsconv/ccapitst/TestDefaultConverterError");
     addTest(root, &TestDefaultConverterSet,     "tsconv/ccapitst/TestDefaultConverterSet");
@@ -117,6 +133,10 @@ void addTestConvert(TestNode** root)
     addTest(root, &InvalidArguments,            "tsconv/ccapitst/InvalidArguments");
     addTest(root, &TestGetName,                 "tsconv/ccapitst/TestGetName");
     addTest(root, &TestUTFBOM,                  "tsconv/ccapitst/TestUTFBOM");
+    addTest(root, &TestConverterDescriptor,     "tsconv/ccapitst/TestConverterDescriptor");
+    addTest(root, &TestConvertSegments,         "tsconv/ccapitst/TestConvertSegments");
+    addTest(root, &TestConverterDescriptorParallel, "tsconv/ccapitst/TestConverterDescriptorParallel");
+    addTest(root, &TestConverterMemoryUsage,    "tsconv/ccapitst/TestConverterMemoryUsage");
 }
 
 static void ListNames(void) {
@@ -2636,6 +2656,8 @@ static void TestConvertExFromUTF8() {
 #if !UCONFIG_NO_LEGACY_CONVERSION
         "windows-1252",
         "shift-jis",
+        "gb18030",
+        "euc-jp",
 #endif
         "us-ascii",
         "iso-8859-1",
@@ -2759,6 +2781,214 @@ static void TestConvertExFromUTF8_C5F0() {
     ucnv_close(utf8Cnv);
 }
 
+#if !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * Direct conversion between UTF-8 and MBCS charsets of all table types
+ * must yield the same results as conversion via UTF-16,
+ * including substitutions, extension mappings and SI/SO state changes.
+ */
+static void TestConvertExMBCSUTF8() {
+    static const char *const converterNames[]={
+        "gb18030",      /* MBCS_OUTPUT_4 with GB 18030 four-byte ranges */
+        "big5",
+        "euc-kr",
+        "euc-jp",       /* MBCS_OUTPUT_3_EUC */
+        "ibm-964",      /* MBCS_OUTPUT_4_EUC */
+        "ibm-930",      /* MBCS_OUTPUT_2_SISO */
+        "ibm-1390",     /* SI/SO with extension table */
+        "ibm-37",
+        "ibm-1047,swaplfnl"
+    };
+    /* ASCII runs, CJK, Hangul, Latin-1, Cyrillic, GB 18030 ranges and supplementary code points */
+    static const UChar text[]={
+        0x54, 0x65, 0x78, 0x74, 0x3a, 0x20, 0x4e00, 0x4e8c, 0x3042, 0xac00,
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+        0x71, 0x72, 0x73, 0x74, 0x75, 0xa,
+        0xe9, 0x410, 0x20ac, 0x452, 0xd840, 0xdc00, 0x5c, 0x7e, 0xdbff, 0xdfff, 0x9fa6, 0xff61,
+        0x20, 0x31, 0x32, 0x33, 0x4e09
+    };
+
+    UChar utf16[200];
+    char utf8[400], bytes[400], bytesUTF8[800], testName[80];
+    int32_t utf8Length, bytesLength, utf16Length, bytesUTF8Length;
+
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+    int32_t i;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+    u_strToUTF8(utf8, UPRV_LENGTHOF(utf8), &utf8Length, text, UPRV_LENGTHOF(text), &errorCode);
+
+    for(i=0; i<UPRV_LENGTHOF(converterNames); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(converterNames[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", converterNames[i], u_errorName(errorCode));
+            continue;
+        }
+
+        /* UTF-8 -> charset: expect the same bytes as from UTF-16 */
+        bytes[0]=(char)0x80; /* an illegal or unassigned byte for the other direction */
+        bytesLength=1+ucnv_fromUChars(cnv, bytes+1, UPRV_LENGTHOF(bytes)-1,
+                                      text, UPRV_LENGTHOF(text), &errorCode);
+        strcpy(testName, "UTF-8 to ");
+        strcat(testName, converterNames[i]);
+        convertExMultiStreaming(utf8Cnv, cnv,
+                                utf8, utf8Length,
+                                bytes+1, bytesLength-1,
+                                testName,
+                                U_ZERO_ERROR);
+
+        /* charset -> UTF-8: expect the same UTF-8 as via UTF-16 */
+        utf16Length=ucnv_toUChars(cnv, utf16, UPRV_LENGTHOF(utf16), bytes, bytesLength, &errorCode);
+        u_strToUTF8(bytesUTF8, UPRV_LENGTHOF(bytesUTF8), &bytesUTF8Length, utf16, utf16Length, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to convert the test text with %s - %s\n", converterNames[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+        strcpy(testName, converterNames[i]);
+        strcat(testName, " to UTF-8");
+        convertExMultiStreaming(cnv, utf8Cnv,
+                                bytes, bytesLength,
+                                bytesUTF8, bytesUTF8Length,
+                                testName,
+                                U_ZERO_ERROR);
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+}
+#endif
+
+#if !UCONFIG_ONLY_HTML_CONVERSION
+/*
+ * Direct conversion between UTF-8 and UTF-32 must yield the same results
+ * as pivoting through UTF-16, for aligned and misaligned buffers,
+ * including ill-formed input in either charset.
+ */
+static void TestConvertExUTF32UTF8() {
+    static const char *const converterNames[]={ "UTF-32LE", "UTF-32BE", "UTF-32" };
+    static const UChar text[]={
+        0x54, 0x65, 0x78, 0x74, 0x3a, 0x20, 0x4e00, 0x4e8c, 0x3042, 0xac00,
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+        0x71, 0x72, 0x73, 0x74, 0x75, 0xa,
+        0xe9, 0x410, 0x20ac, 0xd840, 0xdc00, 0, 0xdbff, 0xdfff, 0xffff, 0x7f, 0x80,
+        0x20, 0x31, 0x32, 0x33, 0x4e09
+    };
+    /* ill-formed UTF-8 in the middle of ASCII: C0 80, truncated E4 B8, surrogate ED A0 80 */
+    static const char illFormedUTF8[]=
+        "abcdefgh\xc0\x80ijklmnop\xe4\xb8qrstuvwx\xed\xa0\x80yz0123456789";
+
+    UChar utf16[200];
+    UChar32 units[200];  /* aligned buffers for the direct conversion */
+    UChar32 units2[200];
+    char utf8[400], bytesUTF8[800], testName[80];
+    int32_t utf8Length, bytesLength, utf16Length, bytesUTF8Length;
+
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+    int32_t i, j;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(converterNames); ++i) {
+        for(j=0; j<2; ++j) {
+            const char *source;
+            int32_t sourceLength;
+            char *bytes=(char *)units;
+            char *target;
+            const char *src;
+            UChar pivot[100], *pivotSource, *pivotTarget;
+
+            errorCode=U_ZERO_ERROR;
+            cnv=ucnv_open(converterNames[i], &errorCode);
+            if(U_FAILURE(errorCode)) {
+                log_data_err("unable to open %s converter - %s\n", converterNames[i], u_errorName(errorCode));
+                break;
+            }
+            if(j==0) {
+                u_strToUTF8(utf8, UPRV_LENGTHOF(utf8), &utf8Length, text, UPRV_LENGTHOF(text), &errorCode);
+                source=utf8;
+                sourceLength=utf8Length;
+            } else {
+                source=illFormedUTF8;
+                sourceLength=(int32_t)strlen(illFormedUTF8);
+            }
+
+            /* UTF-8 -> UTF-32: expect the same bytes as via UTF-16 */
+            utf16Length=ucnv_toUChars(utf8Cnv, utf16, UPRV_LENGTHOF(utf16), source, sourceLength, &errorCode);
+            bytesLength=ucnv_fromUChars(cnv, bytes, (int32_t)sizeof(units), utf16, utf16Length, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                log_err("unable to convert the test text with %s - %s\n", converterNames[i], u_errorName(errorCode));
+                ucnv_close(cnv);
+                break;
+            }
+            sprintf(testName, "UTF-8 to %s [%d]", converterNames[i], (int)j);
+            convertExMultiStreaming(utf8Cnv, cnv,
+                                    source, sourceLength,
+                                    bytes, bytesLength,
+                                    testName,
+                                    U_ZERO_ERROR);
+            target=(char *)units2;
+            src=source;
+            pivotSource=pivotTarget=pivot;
+            ucnv_convertEx(cnv, utf8Cnv, &target, (char *)units2+sizeof(units2), &src, source+sourceLength,
+                           pivot, &pivotSource, &pivotTarget, pivot+UPRV_LENGTHOF(pivot),
+                           TRUE, TRUE, &errorCode);
+            if( U_FAILURE(errorCode) || (target-(char *)units2)!=bytesLength ||
+                0!=memcmp(units2, bytes, bytesLength)
+            ) {
+                log_err("ucnv_convertEx(%s) in one piece failed - %s\n", testName, u_errorName(errorCode));
+            }
+
+            /* UTF-32 -> UTF-8, with a unit that is not a code point inserted: expect the same UTF-8 as via UTF-16 */
+            if(j==1) {
+                int32_t position=(i==2) ? 12 : 8;  /* after the UTF-32 BOM */
+                memmove(bytes+position+4, bytes+position, bytesLength-position);
+                memcpy(bytes+position, "\x00\x11\x11\x00", 4);  /* 0x111100 in either byte order */
+                bytesLength+=4;
+            }
+            utf16Length=ucnv_toUChars(cnv, utf16, UPRV_LENGTHOF(utf16), bytes, bytesLength, &errorCode);
+            u_strToUTF8(bytesUTF8, UPRV_LENGTHOF(bytesUTF8), &bytesUTF8Length, utf16, utf16Length, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                log_err("unable to convert the test text with %s - %s\n", converterNames[i], u_errorName(errorCode));
+                ucnv_close(cnv);
+                break;
+            }
+            sprintf(testName, "%s [%d] to UTF-8", converterNames[i], (int)j);
+            convertExMultiStreaming(cnv, utf8Cnv,
+                                    bytes, bytesLength,
+                                    bytesUTF8, bytesUTF8Length,
+                                    testName,
+                                    U_ZERO_ERROR);
+            target=bytesUTF8+bytesUTF8Length;  /* write after the expected output */
+            src=bytes;
+            pivotSource=pivotTarget=pivot;
+            ucnv_convertEx(utf8Cnv, cnv, &target, bytesUTF8+sizeof(bytesUTF8), &src, bytes+bytesLength,
+                           pivot, &pivotSource, &pivotTarget, pivot+UPRV_LENGTHOF(pivot),
+                           TRUE, TRUE, &errorCode);
+            if( U_FAILURE(errorCode) || (target-bytesUTF8)!=2*bytesUTF8Length ||
+                0!=memcmp(bytesUTF8+bytesUTF8Length, bytesUTF8, bytesUTF8Length)
+            ) {
+                log_err("ucnv_convertEx(%s) in one piece failed - %s\n", testName, u_errorName(errorCode));
+            }
+            ucnv_close(cnv);
+        }
+    }
+    ucnv_close(utf8Cnv);
+}
+#endif
+
 static void
 TestConvertAlgorithmic() {
 #if !UCONFIG_NO_LEGACY_CONVERSION
@@ -3738,3 +3968,534 @@ static void TestUTFBOM() {
         ucnv_close(cnv);
     }
 }
+
+static void TestConverterDescriptor() {
+    static const char *const names[] = {
+        "UTF-8",
+        "UTF-16BE",
+        "ISO-8859-1",
+        "US-ASCII",
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "Shift-JIS",
+        "GB18030",
+        "ibm-930",      /* EBCDIC SI/SO */
+        "ibm-1047,swaplfnl",
+        "ISO-2022-JP",  /* cloned for each conversion */
+        "HZ",
+#endif
+        "UTF-7"
+    };
+    /* includes characters that are unmappable in most of the charsets */
+    static const UChar text[] = {
+        0x61, 0x62, 0xe4, 0x20, 0x3042, 0x3044, 0x4e00, 0xa, 0x39a, 0xd83d, 0xde00, 0x7a, 0
+    };
+    int32_t i;
+
+    for(i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverterDescriptor *descriptor;
+        UConverter *cnv;
+        char bytes[100], expBytes[100];
+        UChar uchars[100], expUChars[100];
+        int32_t length, expLength, length2, j;
+
+        descriptor = ucnv_openDescriptor(names[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("ucnv_openDescriptor(%s) failed - %s\n", names[i], u_errorName(errorCode));
+            continue;
+        }
+        cnv = ucnv_open(names[i], &errorCode);
+
+        /* repeated conversions must not interfere with each other */
+        for(j = 0; j < 2; ++j) {
+            expLength = ucnv_fromUChars(cnv, expBytes, UPRV_LENGTHOF(expBytes), text, -1, &errorCode);
+            length = ucnv_descriptorFromUChars(descriptor, bytes, UPRV_LENGTHOF(bytes), text, -1, &errorCode);
+            if(U_FAILURE(errorCode) || length != expLength || 0 != memcmp(bytes, expBytes, length)) {
+                log_err("ucnv_descriptorFromUChars(%s) != ucnv_fromUChars() - %s\n",
+                        names[i], u_errorName(errorCode));
+                break;
+            }
+            expLength = ucnv_toUChars(cnv, expUChars, UPRV_LENGTHOF(expUChars), bytes, length, &errorCode);
+            length2 = ucnv_descriptorToUChars(descriptor, uchars, UPRV_LENGTHOF(uchars), bytes, length, &errorCode);
+            if(U_FAILURE(errorCode) || length2 != expLength || 0 != memcmp(uchars, expUChars, length2 * U_SIZEOF_UCHAR)) {
+                log_err("ucnv_descriptorToUChars(%s) != ucnv_toUChars() - %s\n",
+                        names[i], u_errorName(errorCode));
+                break;
+            }
+        }
+
+        /* preflighting */
+        if(U_SUCCESS(errorCode)) {
+            length2 = ucnv_descriptorFromUChars(descriptor, NULL, 0, text, -1, &errorCode);
+            if(errorCode != U_BUFFER_OVERFLOW_ERROR || length2 != length) {
+                log_err("ucnv_descriptorFromUChars(%s) preflighting = %d != %d - %s\n",
+                        names[i], (int)length2, (int)length, u_errorName(errorCode));
+            }
+            errorCode = U_ZERO_ERROR;
+            length2 = ucnv_descriptorToUChars(descriptor, uchars, 3, bytes, length, &errorCode);
+            if(errorCode != U_BUFFER_OVERFLOW_ERROR || length2 != expLength) {
+                log_err("ucnv_descriptorToUChars(%s) preflighting = %d != %d - %s\n",
+                        names[i], (int)length2, (int)expLength, u_errorName(errorCode));
+            }
+        }
+
+        ucnv_close(cnv);
+        ucnv_closeDescriptor(descriptor);
+    }
+
+    /* argument errors */
+    {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverterDescriptor *descriptor;
+        char bytes[4];
+
+        ucnv_descriptorFromUChars(NULL, bytes, UPRV_LENGTHOF(bytes), text, -1, &errorCode);
+        if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucnv_descriptorFromUChars(NULL) - %s\n", u_errorName(errorCode));
+        }
+        errorCode = U_ZERO_ERROR;
+        descriptor = ucnv_openDescriptor("no-such-charset", &errorCode);
+        if(U_SUCCESS(errorCode) || descriptor != NULL) {
+            log_err("ucnv_openDescriptor(no-such-charset) did not fail\n");
+        }
+        ucnv_closeDescriptor(NULL);
+    }
+}
+
+/*
+ * Splits [start, start+length[ units of unitSize bytes into segments with lengths
+ * from a fixed pattern beginning at phase, with gap unused units after each segment.
+ * The last segment gets all remaining units (and may be longer than the pattern).
+ * Returns the number of segments.
+ */
+static int32_t
+makeSegments(UConverterSegment *segments, int32_t maxCount,
+             char *start, int32_t unitSize, int32_t length, int32_t phase, int32_t gap) {
+    static const int32_t segmentLengths[]={ 1, 0, 2, 3, 5, 1, 7, 4 };
+    int32_t count=0;
+    while(length>0 && count<maxCount) {
+        int32_t segmentLength=segmentLengths[(phase+count)%UPRV_LENGTHOF(segmentLengths)];
+        if(segmentLength>length || count==maxCount-1) {
+            segmentLength=length;
+        }
+        segments[count].start=start;
+        segments[count].length=segmentLength;
+        ++count;
+        start+=(segmentLength+gap)*unitSize;
+        length-=segmentLength+gap;
+    }
+    return count;
+}
+
+/* Appends the contents of the segments up to the position to dest. */
+static int32_t
+gatherSegments(char *dest, const UConverterSegment *segments,
+               int32_t index, int32_t offset, int32_t unitSize) {
+    int32_t length=0, i;
+    for(i=0; i<=index; ++i) {
+        int32_t segmentLength= i<index ? segments[i].length : offset;
+        if(segmentLength>0) {
+            memcpy(dest+length, segments[i].start, segmentLength*unitSize);
+            length+=segmentLength*unitSize;
+        }
+    }
+    return length;
+}
+
+static void TestConvertSegments() {
+    static const char *const names[]={
+        "UTF-8",
+        "UTF-16",       /* BOM */
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "Shift-JIS",
+        "ibm-930",      /* SI/SO */
+        "ISO-2022-JP",  /* escape sequences */
+#endif
+        "US-ASCII"      /* substitutions */
+    };
+    static const UChar text[]={
+        0x61, 0x62, 0x63, 0x3042, 0x3044, 0x4e00, 0x20, 0x41, 0x42, 0xff71, 0xff72,
+        0xd83d, 0xde00, 0x7a, 0x4e8c, 0x4e09, 0xa, 0x30, 0x31, 0x32, 0x33, 0x34, 0x3046
+    };
+    UConverterSegment sources[40], targets[40], targets2[40];
+    char bytes[200], gathered[800], backing[800];
+    UChar uchars[200];
+    int32_t i, phase;
+
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(names[i], &errorCode);
+        int32_t bytesLength, ucharsLength;
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", names[i], u_errorName(errorCode));
+            continue;
+        }
+        bytesLength=ucnv_fromUChars(cnv, bytes, UPRV_LENGTHOF(bytes), text, UPRV_LENGTHOF(text), &errorCode);
+        ucharsLength=ucnv_toUChars(cnv, uchars, UPRV_LENGTHOF(uchars), bytes, bytesLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to convert the test text with %s - %s\n", names[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        for(phase=0; phase<8; ++phase) {
+            int32_t sourceCount, targetCount, targetCount2, split;
+            int32_t sourceIndex, sourceOffset, targetIndex, targetOffset;
+            int32_t length, length2;
+            UBool inFirstChain;
+
+            /*
+             * fromUnicode: The source is split in two chains converted by separate calls.
+             * The first target chain is too short for the whole output.
+             */
+            ucnv_resetFromUnicode(cnv);
+            sourceCount=makeSegments(sources, UPRV_LENGTHOF(sources),
+                                     (char *)text, U_SIZEOF_UCHAR, UPRV_LENGTHOF(text), phase, 0);
+            memset(backing, 0x55, sizeof(backing));
+            targetCount=makeSegments(targets, UPRV_LENGTHOF(targets), backing, 1, bytesLength, phase+3, 1);
+            targetCount2=makeSegments(targets2, UPRV_LENGTHOF(targets2), backing+400, 1, 400, phase+5, 1);
+            split=sourceCount/2;
+            inFirstChain=TRUE;
+            sourceIndex=sourceOffset=targetIndex=targetOffset=0;
+            ucnv_fromUnicodeSegments(cnv, targets, targetCount, &targetIndex, &targetOffset,
+                                     sources, split, &sourceIndex, &sourceOffset,
+                                     FALSE, &errorCode);
+            if(errorCode==U_ZERO_ERROR) {
+                inFirstChain=FALSE;
+                sourceIndex=sourceOffset=0;
+                ucnv_fromUnicodeSegments(cnv, targets, targetCount, &targetIndex, &targetOffset,
+                                         sources+split, sourceCount-split, &sourceIndex, &sourceOffset,
+                                         TRUE, &errorCode);
+            }
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR || targetIndex!=targetCount) {
+                log_err("%s ucnv_fromUnicodeSegments(phase %d) did not fill the target segments - %s\n",
+                        names[i], (int)phase, u_errorName(errorCode));
+                continue;
+            }
+            length=gatherSegments(gathered, targets, targetCount-1, targets[targetCount-1].length, 1);
+            errorCode=U_ZERO_ERROR;
+            targetIndex=targetOffset=0;
+            if(inFirstChain) {
+                ucnv_fromUnicodeSegments(cnv, targets2, targetCount2, &targetIndex, &targetOffset,
+                                         sources, split, &sourceIndex, &sourceOffset,
+                                         FALSE, &errorCode);
+                sourceIndex=sourceOffset=0;
+            }
+            ucnv_fromUnicodeSegments(cnv, targets2, targetCount2, &targetIndex, &targetOffset,
+                                     sources+split, sourceCount-split, &sourceIndex, &sourceOffset,
+                                     TRUE, &errorCode);
+            length+=gatherSegments(gathered+length, targets2, targetIndex, targetOffset, 1);
+            if( U_FAILURE(errorCode) || length!=bytesLength || 0!=memcmp(gathered, bytes, length) ||
+                sourceIndex!=sourceCount-split-1 || sourceOffset!=sources[sourceCount-1].length
+            ) {
+                log_err("%s ucnv_fromUnicodeSegments(phase %d) wrong output length %d!=%d - %s\n",
+                        names[i], (int)phase, (int)length, (int)bytesLength, u_errorName(errorCode));
+            }
+            if(backing[targets[0].length]!=0x55) {
+                log_err("%s ucnv_fromUnicodeSegments(phase %d) wrote outside of the target segments\n",
+                        names[i], (int)phase);
+            }
+
+            /* toUnicode: one call with all segments */
+            ucnv_resetToUnicode(cnv);
+            sourceCount=makeSegments(sources, UPRV_LENGTHOF(sources), bytes, 1, bytesLength, phase, 0);
+            targetCount=makeSegments(targets, UPRV_LENGTHOF(targets), backing, U_SIZEOF_UCHAR, 390, phase+1, 1);
+            sourceIndex=sourceOffset=targetIndex=targetOffset=0;
+            ucnv_toUnicodeSegments(cnv, targets, targetCount, &targetIndex, &targetOffset,
+                                   sources, sourceCount, &sourceIndex, &sourceOffset,
+                                   TRUE, &errorCode);
+            length2=gatherSegments(gathered, targets, targetIndex, targetOffset, U_SIZEOF_UCHAR);
+            if( U_FAILURE(errorCode) || length2!=ucharsLength*U_SIZEOF_UCHAR ||
+                0!=memcmp(gathered, uchars, length2)
+            ) {
+                log_err("%s ucnv_toUnicodeSegments(phase %d) wrong output - %s\n",
+                        names[i], (int)phase, u_errorName(errorCode));
+            }
+        }
+        ucnv_close(cnv);
+    }
+
+    /* argument errors */
+    {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open("UTF-8", &errorCode);
+        int32_t targetIndex=0, targetOffset=2, sourceIndex=0, sourceOffset=0;
+        targets[0].start=backing;
+        targets[0].length=1;
+        sources[0].start=(void *)text;
+        sources[0].length=1;
+        ucnv_fromUnicodeSegments(cnv, targets, 1, &targetIndex, &targetOffset,
+                                 sources, 1, &sourceIndex, &sourceOffset, TRUE, &errorCode);
+        if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucnv_fromUnicodeSegments(offset>length) - %s\n", u_errorName(errorCode));
+        }
+        errorCode=U_ZERO_ERROR;
+        targetOffset=0;
+        sources[0].start=NULL;
+        ucnv_toUnicodeSegments(cnv, targets, 1, &targetIndex, &targetOffset,
+                               sources, 1, &sourceIndex, &sourceOffset, TRUE, &errorCode);
+        if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucnv_toUnicodeSegments(start==NULL) - %s\n", u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+    }
+}
+
+static void TestConverterDescriptorParallel() {
+    static const char *const names[] = {
+        "UTF-8",
+        "UTF-16LE",
+        "UTF-32BE",
+        "ISO-8859-1",
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "Shift-JIS",
+        "GB18030",
+        "EUC-KR",
+        "ibm-37",
+        "ibm-930",      /* EBCDIC SI/SO: not split */
+        "ISO-2022-JP",  /* not split */
+#endif
+        "UTF-16"        /* BOM: not split */
+    };
+    /* large enough to be split into several chunks */
+    enum { TEXT_LENGTH = 300000 };
+    static const UChar pieces[] = {
+        0x61, 0x62, 0xa, 0x20, 0x31, 0xe9, 0x3042, 0x4e00, 0x30a2, 0xff71, 0xac00, 0x20ac
+    };
+    int32_t capacity = TEXT_LENGTH * 4 + 1;
+    UChar *text = (UChar *)malloc(TEXT_LENGTH * U_SIZEOF_UCHAR);
+    char *bytes = (char *)malloc(capacity);
+    char *bytes2 = (char *)malloc(capacity);
+    UChar *uchars = (UChar *)malloc(capacity * U_SIZEOF_UCHAR);
+    UChar *uchars2 = (UChar *)malloc(capacity * U_SIZEOF_UCHAR);
+    int32_t *offsets = (int32_t *)malloc(capacity * 4);
+    int32_t *offsets2 = (int32_t *)malloc(capacity * 4);
+    uint32_t x = 1;
+    int32_t i;
+
+    if (text == NULL || bytes == NULL || bytes2 == NULL || uchars == NULL || uchars2 == NULL ||
+            offsets == NULL || offsets2 == NULL) {
+        log_err("out of memory\n");
+        goto cleanup;
+    }
+    /* pseudo-random text, with unpaired surrogates and some supplementary code points */
+    for (i = 0; i < TEXT_LENGTH;) {
+        x = x * 1103515245 + 12345;
+        if ((x >> 16) % 200 == 0 && i + 1 < TEXT_LENGTH) {
+            text[i++] = 0xd840;
+            text[i++] = 0xdc0b;
+        } else if ((x >> 16) % 997 == 0) {
+            text[i++] = (x & 0x100) ? 0xd800 : 0xdc00;
+        } else {
+            text[i++] = pieces[(x >> 16) % UPRV_LENGTHOF(pieces)];
+        }
+    }
+
+    for (i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(names[i], &errorCode);
+        UConverterDescriptor *descriptor = ucnv_openDescriptor(names[i], &errorCode);
+        char *t;
+        const UChar *s;
+        UChar *ut;
+        const char *bs;
+        int32_t length, length2, j;
+        if (U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", names[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        /* compare with sequential conversion with offsets */
+        t = bytes;
+        s = text;
+        ucnv_fromUnicode(cnv, &t, bytes + capacity, &s, text + TEXT_LENGTH, offsets, TRUE, &errorCode);
+        length = (int32_t)(t - bytes);
+        length2 = ucnv_descriptorFromUCharsParallel(descriptor, bytes2, capacity,
+                                                    text, TEXT_LENGTH, offsets2, 3, &errorCode);
+        if (U_FAILURE(errorCode) || length2 != length ||
+                0 != memcmp(bytes, bytes2, length) || 0 != memcmp(offsets, offsets2, length * 4)) {
+            log_err("%s ucnv_descriptorFromUCharsParallel() != ucnv_fromUnicode() - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+        errorCode = U_ZERO_ERROR;
+        j = ucnv_descriptorFromUCharsParallel(descriptor, bytes2, 1000,
+                                              text, TEXT_LENGTH, NULL, 3, &errorCode);
+        if (errorCode != U_BUFFER_OVERFLOW_ERROR || j != length || 0 != memcmp(bytes, bytes2, 1000)) {
+            log_err("%s ucnv_descriptorFromUCharsParallel(partial output) - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+
+        /* insert some illegal and truncated sequences */
+        for (j = 0; j < length; j += 4099) {
+            bytes[j] = (char)0xff;
+        }
+        for (j = 1000; j < length; j += 6007) {
+            bytes[j] ^= (char)0x81;
+        }
+        errorCode = U_ZERO_ERROR;
+        ucnv_resetToUnicode(cnv);
+        ut = uchars;
+        bs = bytes;
+        ucnv_toUnicode(cnv, &ut, uchars + capacity, &bs, bytes + length, offsets, TRUE, &errorCode);
+        length2 = (int32_t)(ut - uchars);
+        j = ucnv_descriptorToUCharsParallel(descriptor, uchars2, capacity,
+                                            bytes, length, offsets2, 3, &errorCode);
+        if (U_FAILURE(errorCode) || j != length2 ||
+                0 != memcmp(uchars, uchars2, length2 * U_SIZEOF_UCHAR) ||
+                0 != memcmp(offsets, offsets2, length2 * 4)) {
+            log_err("%s ucnv_descriptorToUCharsParallel() != ucnv_toUnicode() - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+        j = ucnv_descriptorToUCharsParallel(descriptor, NULL, 0, bytes, length, NULL, 3, &errorCode);
+        if (errorCode != U_BUFFER_OVERFLOW_ERROR || j != length2) {
+            log_err("%s ucnv_descriptorToUCharsParallel(preflighting) - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+        ucnv_closeDescriptor(descriptor);
+    }
+
+    {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverterDescriptor *descriptor = ucnv_openDescriptor("UTF-8", &errorCode);
+        int32_t length, length2;
+        ucnv_descriptorToUCharsParallel(descriptor, uchars, capacity, "a", 1, NULL, -1, &errorCode);
+        if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucnv_descriptorToUCharsParallel(threadCount<0) - %s\n", u_errorName(errorCode));
+        }
+
+        /* very large thread counts are reduced to an internal limit */
+        errorCode = U_ZERO_ERROR;
+        length = ucnv_descriptorFromUCharsParallel(descriptor, bytes, capacity,
+                                                   text, TEXT_LENGTH, NULL, 1, &errorCode);
+        length2 = ucnv_descriptorFromUCharsParallel(descriptor, bytes2, capacity,
+                                                    text, TEXT_LENGTH, NULL, INT32_MAX, &errorCode);
+        if (U_FAILURE(errorCode) || length2 != length || 0 != memcmp(bytes, bytes2, length)) {
+            log_err("ucnv_descriptorFromUCharsParallel(threadCount=INT32_MAX) - %s\n", u_errorName(errorCode));
+        }
+        length = ucnv_descriptorToUCharsParallel(descriptor, uchars, capacity,
+                                                 bytes2, length2, NULL, 1, &errorCode);
+        length2 = ucnv_descriptorToUCharsParallel(descriptor, uchars2, capacity,
+                                                  bytes2, length2, NULL, INT32_MAX, &errorCode);
+        if (U_FAILURE(errorCode) || length2 != length || 0 != u_memcmp(uchars, uchars2, length)) {
+            log_err("ucnv_descriptorToUCharsParallel(threadCount=INT32_MAX) - %s\n", u_errorName(errorCode));
+        }
+        ucnv_closeDescriptor(descriptor);
+    }
+
+cleanup:
+    free(text);
+    free(bytes);
+    free(bytes2);
+    free(uchars);
+    free(uchars2);
+    free(offsets);
+    free(offsets2);
+}
+
+static void TestConverterMemoryUsage() {
+    UConverterMemoryUsage usage, usage2;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UConverter *cnv;
+
+    /* algorithmic converter: no shared heap or mapped table data */
+    cnv = ucnv_open("UTF-8", &errorCode);
+    ucnv_getMemoryUsage(cnv, &usage, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        log_err("ucnv_getMemoryUsage(UTF-8) failed - %s\n", u_errorName(errorCode));
+    } else if (usage.instanceHeapBytes <= 0 || usage.sharedHeapBytes != 0 || usage.mappedBytes != 0) {
+        log_err("ucnv_getMemoryUsage(UTF-8) = { %d, %d, %d } expected { >0, 0, 0 }\n",
+                usage.instanceHeapBytes, usage.sharedHeapBytes, usage.mappedBytes);
+    }
+
+    /* argument checking */
+    errorCode = U_ZERO_ERROR;
+    ucnv_getMemoryUsage(NULL, &usage, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_getMemoryUsage(NULL) sets %s instead of U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    ucnv_getMemoryUsage(cnv, NULL, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_getMemoryUsage(pUsage=NULL) sets %s instead of U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(errorCode));
+    }
+    ucnv_close(cnv);
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    {
+        static const UChar text[] = { 0x61, 0xa, 0x62, 0x85 };
+        static const char expected[] = { (char)0x81, 0x15, (char)0x82, 0x25 };
+        UChar uchars[8];
+        char bytes[8];
+        int32_t length;
+
+        /* make sure that no swaplfnl tables are cached from earlier tests */
+        ucnv_flushCache();
+
+        errorCode = U_ZERO_ERROR;
+        cnv = ucnv_open("ibm-1047", &errorCode);
+        ucnv_getMemoryUsage(cnv, &usage, &errorCode);
+        ucnv_close(cnv);
+        if (U_FAILURE(errorCode)) {
+            log_data_err("unable to open or query ibm-1047 - %s\n", u_errorName(errorCode));
+            return;
+        }
+        if (usage.mappedBytes <= 0) {
+            log_err("ucnv_getMemoryUsage(ibm-1047).mappedBytes = %d expected >0\n", usage.mappedBytes);
+        }
+
+        /* the swaplfnl tables are built lazily per direction */
+        cnv = ucnv_open("ibm-1047,swaplfnl", &errorCode);
+        ucnv_getMemoryUsage(cnv, &usage, &errorCode);
+        length = ucnv_fromUChars(cnv, bytes, UPRV_LENGTHOF(bytes), text, UPRV_LENGTHOF(text), &errorCode);
+        ucnv_getMemoryUsage(cnv, &usage2, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            log_err("ibm-1047,swaplfnl fromUChars or ucnv_getMemoryUsage failed - %s\n", u_errorName(errorCode));
+        } else {
+            if (length != UPRV_LENGTHOF(expected) || memcmp(bytes, expected, length) != 0) {
+                log_err("ibm-1047,swaplfnl fromUChars did not swap LF and NL\n");
+            }
+            if (usage2.sharedHeapBytes <= usage.sharedHeapBytes) {
+                log_err("ibm-1047,swaplfnl sharedHeapBytes %d did not grow with fromUnicode to %d\n",
+                        usage.sharedHeapBytes, usage2.sharedHeapBytes);
+            }
+            if (usage2.instanceHeapBytes != usage.instanceHeapBytes || usage2.mappedBytes != usage.mappedBytes) {
+                log_err("ibm-1047,swaplfnl instanceHeapBytes or mappedBytes changed with conversion\n");
+            }
+        }
+
+        usage = usage2;
+        length = ucnv_toUChars(cnv, uchars, UPRV_LENGTHOF(uchars), expected, UPRV_LENGTHOF(expected), &errorCode);
+        ucnv_getMemoryUsage(cnv, &usage2, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            log_err("ibm-1047,swaplfnl toUChars or ucnv_getMemoryUsage failed - %s\n", u_errorName(errorCode));
+        } else {
+            if (length != UPRV_LENGTHOF(text) || u_memcmp(uchars, text, length) != 0) {
+                log_err("ibm-1047,swaplfnl toUChars did not swap LF and NL\n");
+            }
+            if (usage2.sharedHeapBytes <= usage.sharedHeapBytes) {
+                log_err("ibm-1047,swaplfnl sharedHeapBytes %d did not grow with toUnicode to %d\n",
+                        usage.sharedHeapBytes, usage2.sharedHeapBytes);
+            }
+        }
+
+        /* converting again, or with another converter, does not build more tables */
+        usage = usage2;
+        {
+            UConverter *cnv2 = ucnv_open("ibm-1047,swaplfnl", &errorCode);
+            ucnv_toUChars(cnv2, uchars, UPRV_LENGTHOF(uchars), expected, UPRV_LENGTHOF(expected), &errorCode);
+            ucnv_fromUChars(cnv2, bytes, UPRV_LENGTHOF(bytes), text, UPRV_LENGTHOF(text), &errorCode);
+            ucnv_getMemoryUsage(cnv2, &usage2, &errorCode);
+            ucnv_close(cnv2);
+        }
+        if (U_FAILURE(errorCode)) {
+            log_err("second ibm-1047,swaplfnl converter failed - %s\n", u_errorName(errorCode));
+        } else if (usage2.sharedHeapBytes != usage.sharedHeapBytes) {
+            log_err("ibm-1047,swaplfnl sharedHeapBytes %d changed to %d with a second converter\n",
+                    usage.sharedHeapBytes, usage2.sharedHeapBytes);
+        }
+        ucnv_close(cnv);
+    }
+#endif
+}
@@ -36,6 +36,7 @@
 #include "unicode/ustring.h"
 #include "unicode/utypes.h"
 #include "unicode/ulocdata.h"
+#include "unicode/upreload.h"
 #include "unicode/uldnames.h"
 #include "unicode/parseerr.h" /* may not be included with some uconfig switches */
 #include "udbgutil.h"
@@ -51,6 +52,7 @@ static void TestUnicodeDefines(void);
 
 static void TestIsRightToLeft(void);
 static void TestBadLocaleIDs(void);
+static void TestPreload(void);
 
 void PrintDataTable();
 
@@ -264,6 +266,7 @@ void addLocaleTest(TestNode** root)
     TESTCASE(TestToUnicodeLocaleType);
     TESTCASE(TestToLegacyType);
     TESTCASE(TestBadLocaleIDs);
+    TESTCASE(TestPreload);
 }
 
 
@@ -6452,3 +6455,75 @@ static void TestBadLocaleIDs() {
         }
     }
 }
+
+static void TestPreload() {
+    static const char* const locales[] = { "en", "th", "ja_JP", "de_DE@collation=phonebook" };
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t threadCount;
+
+    /* once on the calling thread, then again with default threads when all is cached */
+    for (threadCount = 1; threadCount >= 0; --threadCount) {
+        status = U_ZERO_ERROR;
+        upreload_preload(locales, UPRV_LENGTHOF(locales), UPRELOAD_ALL, threadCount, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("upreload_preload(threadCount=%d) failed - %s\n",
+                         (int)threadCount, u_errorName(status));
+            return;
+        }
+    }
+
+    /* a huge thread count is reduced to the internal limit */
+    status = U_ZERO_ERROR;
+    upreload_preload(locales, UPRV_LENGTHOF(locales), UPRELOAD_ALL, INT32_MAX, &status);
+    if (U_FAILURE(status)) {
+        log_err("upreload_preload(threadCount=INT32_MAX) failed - %s\n", u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    upreload_preload(locales, UPRV_LENGTHOF(locales), UPRELOAD_COLLATION | UPRELOAD_PLURAL_RULES, 4, &status);
+    if (U_FAILURE(status)) {
+        log_err("upreload_preload(collation+plurals, 4 threads) failed - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    upreload_preload(locales, UPRV_LENGTHOF(locales), 0, 1, &status);
+    if (U_FAILURE(status)) {
+        log_err("upreload_preload(no services) failed - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    upreload_preload(NULL, 0, UPRELOAD_ALL, 1, &status);
+    if (U_FAILURE(status)) {
+        log_err("upreload_preload(no locales) failed - %s\n", u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    upreload_preload(NULL, 2, UPRELOAD_ALL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("upreload_preload(NULL, 2) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    upreload_preload(locales, UPRV_LENGTHOF(locales), UPRELOAD_ALL, -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("upreload_preload(threadCount=-1) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(status));
+    }
+    {
+        /* An empty keyword name makes a bogus Locale; the other loads still run. */
+        static const char *const withBogus[] = { "en", "fr", "en@=x", "de" };
+        int32_t bogusThreadCount;
+        for (bogusThreadCount = 1; bogusThreadCount <= 4; bogusThreadCount += 3) {
+            status = U_ZERO_ERROR;
+            upreload_preload(withBogus, UPRV_LENGTHOF(withBogus), UPRELOAD_PLURAL_RULES,
+                             bogusThreadCount, &status);
+            if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+                log_err("upreload_preload(bogus locale, threadCount=%d) did not report "
+                        "U_ILLEGAL_ARGUMENT_ERROR - %s\n", (int)bogusThreadCount, u_errorName(status));
+            }
+        }
+    }
+    status = U_ILLEGAL_ESCAPE_SEQUENCE;
+    upreload_preload(locales, UPRV_LENGTHOF(locales), UPRELOAD_ALL, 1, &status);
+    if (status != U_ILLEGAL_ESCAPE_SEQUENCE) {
+        log_err("upreload_preload() overwrote an incoming failure - %s\n", u_errorName(status));
+    }
+}
@@ -44,6 +44,7 @@ static void Test_WCHART_LongString(void);
 static void Test_strToJavaModifiedUTF8(void);
 static void Test_strFromJavaModifiedUTF8(void);
 static void TestNullEmptySource(void);
+static void Test_UTF8Runs(void);
 
 void 
 addUCharTransformTest(TestNode** root)
@@ -63,6 +64,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_strToJavaModifiedUTF8,  "custrtrn/Test_strToJavaModifiedUTF8");
    addTest(root, &Test_strFromJavaModifiedUTF8,  "custrtrn/Test_strFromJavaModifiedUTF8");
    addTest(root, &TestNullEmptySource,  "custrtrn/TestNullEmptySource");
+   addTest(root, &Test_UTF8Runs,  "custrtrn/Test_UTF8Runs");
 }
 
 static const UChar32 src32[]={
@@ -2114,3 +2116,92 @@ static void TestNullEmptySource() {
 
 #endif
 }
+
+/*
+ * UTF-8 <-> UTF-16 with ASCII runs of all lengths before other characters,
+ * for the word-at-a-time code paths,
+ * compared with U8_NEXT() and U8_APPEND_UNSAFE() at each destination capacity.
+ */
+static void Test_UTF8Runs() {
+    static const char *const sequences[]={
+        "\xc3\xa4",           /* U+00E4 */
+        "\xe4\xb8\x80",       /* U+4E00 */
+        "\xf0\x9f\x98\x80",   /* U+1F600 */
+        "\xc0",               /* ill-formed lead byte */
+        "\xe0\x80",           /* non-shortest form */
+        "\xed\xa0\x80",       /* surrogate */
+        "\xf4\x90\x80\x80",   /* above U+10FFFF */
+        "\xf0\x90\x80",       /* truncated */
+        "\x80"                /* stray trail byte */
+    };
+    char utf8[4000], out8[4000];
+    UChar expected[2500], out16[2500];
+    int32_t utf8Length=0, expectedLength=0, numSubstitutions=0;
+    int32_t i, j, capacity, length, count;
+    UErrorCode errorCode;
+
+    for(i=0; i<20; ++i) {
+        for(j=0; j<UPRV_LENGTHOF(sequences); ++j) {
+            memset(utf8+utf8Length, 'a'+j, i);
+            utf8Length+=i;
+            strcpy(utf8+utf8Length, sequences[j]);
+            utf8Length+=(int32_t)strlen(sequences[j]);
+        }
+    }
+    for(i=0; i<utf8Length;) {
+        UChar32 c;
+        U8_NEXT(utf8, i, utf8Length, c);
+        if(c<0) {
+            c=0xfffd;
+            ++numSubstitutions;
+        }
+        U16_APPEND_UNSAFE(expected, expectedLength, c);
+    }
+
+    for(capacity=0; capacity<=expectedLength+1; ++capacity) {
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8WithSub(capacity>0 ? out16 : NULL, capacity, &length,
+                             utf8, utf8Length, 0xfffd, &count, &errorCode);
+        if( length!=expectedLength || count!=numSubstitutions ||
+            (capacity<expectedLength ? errorCode!=U_BUFFER_OVERFLOW_ERROR : U_FAILURE(errorCode)) ||
+            0!=memcmp(out16, expected, 2*(capacity<expectedLength ? capacity : expectedLength))
+        ) {
+            log_err("u_strFromUTF8WithSub(capacity=%d) wrong output or length %d != %d - %s\n",
+                    (int)capacity, (int)length, (int)expectedLength, u_errorName(errorCode));
+            break;
+        }
+    }
+
+    /* back to UTF-8, with unpaired surrogates in the middle of the ASCII runs */
+    for(i=0; i<expectedLength; i+=37) {
+        if(!U16_IS_SURROGATE(expected[i])) {
+            expected[i]=0xdc00;
+        }
+    }
+    utf8Length=0;
+    numSubstitutions=0;
+    for(i=0; i<expectedLength;) {
+        UChar32 c;
+        U16_NEXT(expected, i, expectedLength, c);
+        if(U_IS_SURROGATE(c)) {
+            c=0xfffd;
+            ++numSubstitutions;
+        }
+        U8_APPEND_UNSAFE(utf8, utf8Length, c);
+    }
+    for(capacity=0; capacity<=utf8Length+1; ++capacity) {
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8WithSub(capacity>0 ? out8 : NULL, capacity, &length,
+                           expected, expectedLength, 0xfffd, &count, &errorCode);
+        if( length!=utf8Length || count!=numSubstitutions ||
+            (capacity<utf8Length ? errorCode!=U_BUFFER_OVERFLOW_ERROR : U_FAILURE(errorCode))
+        ) {
+            log_err("u_strToUTF8WithSub(capacity=%d) wrong length %d != %d - %s\n",
+                    (int)capacity, (int)length, (int)utf8Length, u_errorName(errorCode));
+            break;
+        }
+    }
+    if(0!=memcmp(out8, utf8, utf8Length)) {
+        log_err("u_strToUTF8WithSub() wrong output\n");
+    }
+}
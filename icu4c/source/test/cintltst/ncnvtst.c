@@ -78,6 +78,9 @@ static void TestFlushInternalBuffer(void);  /*for improved code coverage in ucnv
 static void TestResetBehaviour(void);
 static void TestTruncated(void);
 static void TestUnicodeSet(void);
+#if !UCONFIG_NO_LEGACY_CONVERSION
+static void TestASCIIRuns(void);
+#endif
 
 static void TestWithBufferSize(int32_t osize, int32_t isize);
 
@@ -136,6 +139,9 @@ void addExtraTests(TestNode** root)
      addTest(root, &TestRegressionUTF32,            "tsconv/ncnvtst/TestRegressionUTF32");
      addTest(root, &TestTruncated,                  "tsconv/ncnvtst/TestTruncated");
      addTest(root, &TestUnicodeSet,                 "tsconv/ncnvtst/TestUnicodeSet");
+#if !UCONFIG_NO_LEGACY_CONVERSION
+     addTest(root, &TestASCIIRuns,                  "tsconv/ncnvtst/TestASCIIRuns");
+#endif
 }
 
 /*test surrogate behaviour*/
@@ -2060,3 +2066,114 @@ TestUnicodeSet() {
 
     uset_close(set);
 }
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * Converts text with ASCII runs of lengths 0..24 between non-ASCII characters
+ * and ASCII characters that do not round-trip in some codepages (5C and 7E in Shift-JIS),
+ * once in one call and once one code unit at a time which bypasses
+ * the multi-unit ASCII fast paths of the MBCS converters.
+ * The outputs and offsets must be the same.
+ */
+static void
+TestASCIIRuns() {
+    static const char *const cnvNames[]={
+        "Shift-JIS", "EUC-JP", "GBK", "windows-949", "windows-1252", "windows-1251", "ibm-850"
+    };
+    static const UChar separators[]={ 0x3042, 0x5c, 0x4e00, 0x7e, 0xe9, 0xac00, 0x416, 0x1a, 0x7f, 0x20ac };
+    UChar text[600], text1[600], text2[600];
+    char bytes1[1500], bytes2[1500];
+    int32_t offsets1[1500], offsets2[1500];
+    int32_t textLength, length1, length2;
+    int32_t i, j, n;
+
+    textLength=0;
+    for(n=0; n<=24; ++n) {
+        for(j=0; j<n; ++j) {
+            text[textLength++]=(UChar)(j==10 ? 0x0a : 0x61+(n+j)%26);
+        }
+        text[textLength++]=separators[n%UPRV_LENGTHOF(separators)];
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(cnvNames); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(cnvNames[i], &errorCode);
+        const UChar *uSrc;
+        const char *src;
+        char *t;
+        UChar *uT;
+        if(U_FAILURE(errorCode)) {
+            log_data_err("error: unable to open converter %s - %s\n",
+                    cnvNames[i], u_errorName(errorCode));
+            continue;
+        }
+
+        /* from Unicode: all at once */
+        uSrc=text;
+        t=bytes1;
+        ucnv_fromUnicode(cnv, &t, bytes1+UPRV_LENGTHOF(bytes1), &uSrc, text+textLength,
+                         offsets1, TRUE, &errorCode);
+        length1=(int32_t)(t-bytes1);
+        /* one UChar at a time */
+        ucnv_resetFromUnicode(cnv);
+        uSrc=text;
+        t=bytes2;
+        for(j=0; U_SUCCESS(errorCode) && j<textLength; ++j) {
+            int32_t *o=offsets2+(t-bytes2);
+            char *prevT=t;
+            ucnv_fromUnicode(cnv, &t, bytes2+UPRV_LENGTHOF(bytes2), &uSrc, text+j+1,
+                             o, j==textLength-1, &errorCode);
+            for(; prevT<t; ++prevT, ++o) {
+                *o+=j;
+            }
+        }
+        length2=(int32_t)(t-bytes2);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s fromUnicode failed - %s\n", cnvNames[i], u_errorName(errorCode));
+        } else if(length1!=length2 || 0!=memcmp(bytes1, bytes2, length1)) {
+            log_err("%s fromUnicode: output differs between one call and per-UChar calls\n",
+                    cnvNames[i]);
+        } else if(0!=memcmp(offsets1, offsets2, length1*4)) {
+            log_err("%s fromUnicode: offsets differ between one call and per-UChar calls\n",
+                    cnvNames[i]);
+        }
+
+        /* to Unicode: all at once */
+        src=bytes1;
+        uT=text1;
+        ucnv_toUnicode(cnv, &uT, text1+UPRV_LENGTHOF(text1), &src, bytes1+length1,
+                       offsets1, TRUE, &errorCode);
+        length2=(int32_t)(uT-text1);
+        /* one byte at a time; characters that started in a previous call get offset -1 */
+        ucnv_resetToUnicode(cnv);
+        src=bytes1;
+        uT=text2;
+        for(j=0; U_SUCCESS(errorCode) && j<length1; ++j) {
+            int32_t *o=offsets2+(uT-text2);
+            UChar *prevT=uT;
+            ucnv_toUnicode(cnv, &uT, text2+UPRV_LENGTHOF(text2), &src, bytes1+j+1,
+                           o, j==length1-1, &errorCode);
+            for(; prevT<uT; ++prevT, ++o) {
+                if(*o>=0) {
+                    *o+=j;
+                }
+            }
+        }
+        if(U_FAILURE(errorCode)) {
+            log_err("%s toUnicode failed - %s\n", cnvNames[i], u_errorName(errorCode));
+        } else if(length2!=(int32_t)(uT-text2) || 0!=u_memcmp(text1, text2, length2)) {
+            log_err("%s toUnicode: output differs between one call and per-byte calls\n",
+                    cnvNames[i]);
+        } else {
+            for(j=0; j<length2; ++j) {
+                if(offsets2[j]>=0 && offsets1[j]!=offsets2[j]) {
+                    log_err("%s toUnicode: offsets[%d]=%d differs from per-byte calls (%d)\n",
+                            cnvNames[i], (int)j, (int)offsets1[j], (int)offsets2[j]);
+                    break;
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+#endif
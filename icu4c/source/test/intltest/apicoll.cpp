@@ -37,6 +37,7 @@
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
 #include "unicode/coleitr.h"
+#include "unicode/colsession.h"
 #include "unicode/sortkey.h"
 #include "apicoll.h"
 #include "unicode/chariter.h"
@@ -46,8 +47,13 @@
 #include "unicode/ucol.h"
 
 #include "sfwdchit.h"
+#include "simplethread.h"
 #include "cmemory.h"
+#include "cstring.h"
+#include "ustr_imp.h"
 #include <stdlib.h>
+#include <string>
+#include <vector>
 
 void
 CollationAPITest::doAssert(UBool condition, const char *message)
@@ -2517,6 +2523,616 @@ void CollationAPITest::TestGapTooSmall() {
     }
 }
 
+void CollationAPITest::TestGetSortKeys() {
+    IcuTestErrorCode errorCode(*this, "TestGetSortKeys");
+    LocalPointer<RuleBasedCollator> coll(dynamic_cast<RuleBasedCollator *>(
+        Collator::createInstance(Locale::getGerman(), errorCode)));
+    if (errorCode.errDataIfFailureAndReset("Collator::createInstance(German) failed")) {
+        return;
+    }
+    // Mix of ASCII, non-FCD text, a contraction-heavy script and the empty string.
+    static const char16_t *const strings[] = {
+        u"abc", u"\u00C4rger", u"A\u0308rger", u"", u"\u0e40\u0e01\u0e21", u"a\u0323\u0302b"
+    };
+    static const char *const strings8[] = {
+        u8"abc", u8"\u00C4rger", u8"A\u0308rger", u8"", u8"\u0e40\u0e01\u0e21", u8"a\u0323\u0302b"
+    };
+    const int32_t count = UPRV_LENGTHOF(strings);
+    int32_t lengths[count];
+    int32_t lengths8[count];
+    for (int32_t i = 0; i < count; ++i) {
+        lengths[i] = u_strlen(strings[i]);
+        lengths8[i] = static_cast<int32_t>(uprv_strlen(strings8[i]));
+    }
+    static const UColAttributeValue strengths[] = { UCOL_TERTIARY, UCOL_IDENTICAL };
+    static const UColAttributeValue normModes[] = { UCOL_OFF, UCOL_ON };
+    for (int32_t si = 0; si < UPRV_LENGTHOF(strengths); ++si) {
+        for (int32_t ni = 0; ni < UPRV_LENGTHOF(normModes); ++ni) {
+            coll->setAttribute(UCOL_STRENGTH, strengths[si], errorCode);
+            coll->setAttribute(UCOL_NORMALIZATION_MODE, normModes[ni], errorCode);
+            uint8_t expected[1000];
+            int32_t expectedOffsets[count + 1];
+            int32_t expectedLength = 0;
+            for (int32_t i = 0; i < count; ++i) {
+                expectedOffsets[i] = expectedLength;
+                expectedLength += coll->getSortKey(strings[i], lengths[i], expected + expectedLength,
+                                                   UPRV_LENGTHOF(expected) - expectedLength);
+            }
+            expectedOffsets[count] = expectedLength;
+
+            // Preflighting, then writing all keys with and without lengths.
+            int32_t offsets[count + 1];
+            int32_t length = coll->getSortKeys(strings, lengths, count, NULL, 0, offsets, errorCode);
+            assertEquals("preflighting error", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+            assertEquals("preflighted length", expectedLength, length);
+            assertEquals("preflighted last offset", expectedLength, offsets[count]);
+            uint8_t keys[1000];
+            for (int32_t withLengths = 0; withLengths <= 1; ++withLengths) {
+                uprv_memset(offsets, 0xff, sizeof(offsets));
+                length = coll->getSortKeys(strings, withLengths ? lengths : NULL, count,
+                                           keys, UPRV_LENGTHOF(keys), offsets, errorCode);
+                errorCode.errIfFailureAndReset("getSortKeys(withLengths=%d)", (int)withLengths);
+                assertEquals("getSortKeys() length", expectedLength, length);
+                assertTrue("getSortKeys() offsets",
+                           0 == uprv_memcmp(offsets, expectedOffsets, sizeof(offsets)));
+                assertTrue("getSortKeys() keys", 0 == uprv_memcmp(keys, expected, length));
+
+                uprv_memset(offsets, 0xff, sizeof(offsets));
+                length = coll->getSortKeysUTF8(strings8, withLengths ? lengths8 : NULL, count,
+                                               keys, UPRV_LENGTHOF(keys), offsets, errorCode);
+                errorCode.errIfFailureAndReset("getSortKeysUTF8(withLengths=%d)", (int)withLengths);
+                assertEquals("getSortKeysUTF8() length", expectedLength, length);
+                assertTrue("getSortKeysUTF8() offsets",
+                           0 == uprv_memcmp(offsets, expectedOffsets, sizeof(offsets)));
+                assertTrue("getSortKeysUTF8() keys", 0 == uprv_memcmp(keys, expected, length));
+            }
+
+            // A buffer that is too short must not be overrun.
+            uprv_memset(keys, 2, UPRV_LENGTHOF(keys));
+            length = coll->getSortKeys(strings, lengths, count,
+                                       keys, expectedLength - 1, offsets, errorCode);
+            assertEquals("overflow error", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+            assertEquals("overflow length", expectedLength, length);
+            assertTrue("overflow offsets", 0 == uprv_memcmp(offsets, expectedOffsets, sizeof(offsets)));
+            assertEquals("no write beyond capacity", 2, keys[expectedLength - 1]);
+        }
+    }
+
+    // C API
+    UCollator *ucoll = coll->toUCollator();
+    int32_t offsets[count + 1];
+    uint8_t keys[1000];
+    int32_t length = ucol_getSortKeys(ucoll, strings, lengths, count,
+                                      keys, UPRV_LENGTHOF(keys), offsets, errorCode);
+    errorCode.errIfFailureAndReset("ucol_getSortKeys()");
+    assertEquals("ucol_getSortKeys() last offset", length, offsets[count]);
+    uint8_t key[100];
+    int32_t keyLength = ucol_getSortKey(ucoll, strings[1], lengths[1], key, UPRV_LENGTHOF(key));
+    assertEquals("ucol_getSortKeys() key length", keyLength, offsets[2] - offsets[1]);
+    assertTrue("ucol_getSortKeys() key", 0 == uprv_memcmp(key, keys + offsets[1], keyLength));
+    ucol_getSortKeys(ucoll, strings, lengths, -1, keys, UPRV_LENGTHOF(keys), offsets, errorCode);
+    assertEquals("count<0", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    ucol_getSortKeysUTF8(ucoll, strings8, lengths8, count, keys, UPRV_LENGTHOF(keys), NULL, errorCode);
+    assertEquals("offsets==NULL", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+void CollationAPITest::TestPrimaryPrefix() {
+    IcuTestErrorCode errorCode(*this, "TestPrimaryPrefix");
+    LocalPointer<RuleBasedCollator> coll(dynamic_cast<RuleBasedCollator *>(
+        Collator::createInstance(Locale::getGerman(), errorCode)));
+    if (errorCode.errDataIfFailureAndReset("Collator::createInstance(German) failed")) {
+        return;
+    }
+    static const char *const strings[] = {
+        "", "a", "ab", "a-b", "abcdefghijklmnopqrstuvwxyz", "\u00C4rger", "A\u0308rger",
+        "\u4E00\u4E8C\u4E09\u56DB\u4E94\u516D", "\u03B1\u03B2\u03B3\u03B4\u03B5\u03B6",
+        "\u0430\u0431\u0432\u0433\u0434\u0435\u0436\u0437", "x\u0301y\u0302z", "!?"
+    };
+    static const UColAttributeValue alternates[] = { UCOL_NON_IGNORABLE, UCOL_SHIFTED };
+    static const int32_t prefixLengths[] = { 1, 5, 8, 16 };
+    for (int32_t ai = 0; ai < UPRV_LENGTHOF(alternates); ++ai) {
+        coll->setAttribute(UCOL_ALTERNATE_HANDLING, alternates[ai], errorCode);
+        for (int32_t pi = 0; pi < UPRV_LENGTHOF(prefixLengths); ++pi) {
+            int32_t prefixLength = prefixLengths[pi];
+            for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+                UnicodeString s = UnicodeString(strings[i], -1, US_INV).unescape();
+                std::string s8;
+                s.toUTF8String(s8);
+                // The primary-strength sort key is the primary level plus a zero byte.
+                coll->setAttribute(UCOL_STRENGTH, UCOL_PRIMARY, errorCode);
+                uint8_t key[100];
+                int32_t keyLength = coll->getSortKey(s, key, UPRV_LENGTHOF(key));
+                coll->setAttribute(UCOL_STRENGTH, UCOL_TERTIARY, errorCode);
+                uint8_t expected[16];
+                uprv_memset(expected, 0, sizeof(expected));
+                int32_t expectedLength = keyLength - 1 < prefixLength ? keyLength - 1 : prefixLength;
+                uprv_memcpy(expected, key, expectedLength);
+
+                uint8_t prefix[17];
+                uprv_memset(prefix, 0xff, sizeof(prefix));
+                int32_t length = coll->getPrimaryPrefix(
+                    s.getBuffer(), s.length(), prefix, prefixLength, errorCode);
+                errorCode.errIfFailureAndReset("getPrimaryPrefix(%s)", strings[i]);
+                assertEquals("getPrimaryPrefix() length", expectedLength, length);
+                assertTrue("getPrimaryPrefix() bytes", 0 == uprv_memcmp(prefix, expected, prefixLength));
+                assertEquals("getPrimaryPrefix() no write beyond capacity", 0xff, prefix[prefixLength]);
+
+                uprv_memset(prefix, 0xff, sizeof(prefix));
+                length = coll->getPrimaryPrefixUTF8(s8.data(), -1, prefix, prefixLength, errorCode);
+                errorCode.errIfFailureAndReset("getPrimaryPrefixUTF8(%s)", strings[i]);
+                assertEquals("getPrimaryPrefixUTF8() length", expectedLength, length);
+                assertTrue("getPrimaryPrefixUTF8() bytes",
+                           0 == uprv_memcmp(prefix, expected, prefixLength));
+            }
+        }
+    }
+
+    // Prefix order must agree with compare().
+    uint8_t p1[8], p2[8];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        UnicodeString s1 = UnicodeString(strings[i], -1, US_INV).unescape();
+        coll->getPrimaryPrefix(s1.getBuffer(), s1.length(), p1, 8, errorCode);
+        for (int32_t j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+            UnicodeString s2 = UnicodeString(strings[j], -1, US_INV).unescape();
+            coll->getPrimaryPrefix(s2.getBuffer(), s2.length(), p2, 8, errorCode);
+            if (uprv_memcmp(p1, p2, 8) < 0 && coll->compare(s1, s2, errorCode) != UCOL_LESS) {
+                errln("primary prefix order of %s < %s disagrees with compare()",
+                      strings[i], strings[j]);
+            }
+        }
+    }
+    errorCode.errIfFailureAndReset("primary prefix order");
+
+    UCollator *ucoll = coll->toUCollator();
+    uint8_t prefix[8];
+    ucol_getPrimaryPrefix(ucoll, u"abc", -1, prefix, 0, errorCode);
+    assertEquals("destCapacity==0", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    int32_t length = ucol_getPrimaryPrefixUTF8(ucoll, "abc", 3, prefix, 8, errorCode);
+    errorCode.errIfFailureAndReset("ucol_getPrimaryPrefixUTF8()");
+    uint8_t prefix16[8];
+    int32_t length16 = ucol_getPrimaryPrefix(ucoll, u"abc", -1, prefix16, 8, errorCode);
+    errorCode.errIfFailureAndReset("ucol_getPrimaryPrefix()");
+    assertEquals("ucol_getPrimaryPrefix[UTF8]() length", length16, length);
+    assertTrue("ucol_getPrimaryPrefix[UTF8]() bytes", 0 == uprv_memcmp(prefix, prefix16, 8));
+}
+
+void CollationAPITest::TestSortStrings() {
+    IcuTestErrorCode errorCode(*this, "TestSortStrings");
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getGerman(), errorCode));
+    if (errorCode.errDataIfFailureAndReset("Collator::createInstance(de)")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if (rbc == NULL) {
+        errln("the German collator is not a RuleBasedCollator");
+        return;
+    }
+    // Enough pseudo-random strings for several chunks, with many duplicates
+    // and strings that differ only in case and accents.
+    static const char16_t units[] = u"aAbBcCoO\u00e4\u00f6\u00df -";
+    UnicodeString pool = UnicodeString(units).unescape();
+    const int32_t count = 5000;
+    std::vector<UnicodeString> strings(count);
+    std::vector<std::string> strings8(count);
+    std::vector<const char16_t *> pointers(count);
+    std::vector<const char *> pointers8(count);
+    std::vector<int32_t> lengths(count);
+    uint32_t seed = 1;
+    for (int32_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        int32_t length = (seed >> 16) % 5;
+        for (int32_t j = 0; j < length; ++j) {
+            seed = seed * 1103515245 + 12345;
+            strings[i].append(pool.charAt((seed >> 16) % pool.length()));
+        }
+        strings[i].toUTF8String(strings8[i]);
+        pointers[i] = strings[i].getBuffer();
+        pointers8[i] = strings8[i].data();
+        lengths[i] = strings[i].length();
+    }
+    std::vector<int32_t> indexes(count);
+    // INT32_MAX is reduced to the internal thread limit.
+    static const int32_t threadCounts[] = { 1, 4, INT32_MAX };
+    for (int32_t t = 0; t < UPRV_LENGTHOF(threadCounts); ++t) {
+        int32_t numThreads = threadCounts[t];
+        for (int32_t utf8 = 0; utf8 <= 1; ++utf8) {
+            if (utf8) {
+                rbc->sortStringsUTF8(pointers8.data(), NULL, count, indexes.data(), numThreads, errorCode);
+            } else {
+                rbc->sortStrings(pointers.data(), lengths.data(), count, indexes.data(), numThreads, errorCode);
+            }
+            if (errorCode.errIfFailureAndReset("sortStrings(utf8=%d, numThreads=%d)",
+                                               (int)utf8, (int)numThreads)) {
+                continue;
+            }
+            for (int32_t i = 1; i < count; ++i) {
+                const UnicodeString &prev = strings[indexes[i - 1]];
+                const UnicodeString &s = strings[indexes[i]];
+                UCollationResult order = rbc->compare(prev, s, errorCode);
+                if (order == UCOL_GREATER ||
+                        (order == UCOL_EQUAL && indexes[i - 1] >= indexes[i])) {
+                    errln("sortStrings(utf8=%d, numThreads=%d) order or stability wrong at %d",
+                          (int)utf8, (int)numThreads, (int)i);
+                    break;
+                }
+            }
+        }
+    }
+
+    UCollator *ucoll = rbc->toUCollator();
+    std::vector<int32_t> indexes2(count);
+    ucol_sortStrings(ucoll, pointers.data(), lengths.data(), count, indexes2.data(), 0, errorCode);
+    errorCode.errIfFailureAndReset("ucol_sortStrings()");
+    assertTrue("ucol_sortStrings() same as sortStrings()", indexes == indexes2);
+    ucol_sortStringsUTF8(ucoll, pointers8.data(), NULL, count, indexes2.data(), 0, errorCode);
+    errorCode.errIfFailureAndReset("ucol_sortStringsUTF8()");
+    assertTrue("ucol_sortStringsUTF8() same as sortStrings()", indexes == indexes2);
+    ucol_sortStrings(ucoll, NULL, NULL, 1, indexes2.data(), 0, errorCode);
+    assertEquals("ucol_sortStrings(NULL strings)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+void CollationAPITest::TestSortKeysTooLong() {
+    // The sort keys for one call, or for one sortStrings() chunk,
+    // are indexed with int32_t offsets and must total less than 2GB.
+    // Writing that many sort key bytes takes a while.
+    if (quick) {
+        logln("TestSortKeysTooLong: skipped, run with -e for the exhaustive test");
+        return;
+    }
+    IcuTestErrorCode errorCode(*this, "TestSortKeysTooLong");
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getRoot(), errorCode));
+    if (errorCode.errDataIfFailureAndReset("Collator::createInstance(root)")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if (rbc == NULL) {
+        errln("the root collator is not a RuleBasedCollator");
+        return;
+    }
+    rbc->setAttribute(UCOL_STRENGTH, UCOL_IDENTICAL, errorCode);
+    // One long string, many times over: Han characters yield long sort keys.
+    UnicodeString s;
+    for (int32_t i = 0; i < 0x100000; ++i) {
+        s.append((char16_t)(0x4e00 + (i & 0xff)));
+    }
+    const char16_t *p = s.getBuffer();
+    int32_t length = s.length();
+    int32_t offsets[2];
+    int32_t keyLength = rbc->getSortKeys(&p, &length, 1, NULL, 0, offsets, errorCode);
+    assertEquals("getSortKeys(one long string) preflighting",
+                 U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+    if (keyLength <= 0) {
+        errln("getSortKeys(one long string) returned %ld", (long)keyLength);
+        return;
+    }
+    int32_t count = INT32_MAX / keyLength + 2;
+    std::vector<const char16_t *> pointers(count, p);
+    std::vector<int32_t> lengths(count, length);
+    std::vector<int32_t> allOffsets(count + 1);
+    int32_t total = rbc->getSortKeys(pointers.data(), lengths.data(), count,
+                                     NULL, 0, allOffsets.data(), errorCode);
+    assertEquals("getSortKeys(more than 2GB of keys)", U_INDEX_OUTOFBOUNDS_ERROR, errorCode.reset());
+    assertEquals("getSortKeys(more than 2GB of keys) length", 0, total);
+    std::vector<int32_t> indexes(count);
+    rbc->sortStrings(pointers.data(), lengths.data(), count, indexes.data(), 1, errorCode);
+    assertEquals("sortStrings(more than 2GB of keys)", U_INDEX_OUTOFBOUNDS_ERROR, errorCode.reset());
+}
+
+namespace {
+
+// Rules that are unlikely to be in the cache directory from another test run.
+const char16_t *const rulesCacheTestRules =
+    u"&b<\u00e4<<<\u00c4 [caseFirst upper] &z<<<TestRulesCache";
+
+void getRulesCacheTestPath(const UnicodeString &rules, char path[64]) {
+    sprintf(path, "./coll%08x.bin", (unsigned int)ustr_hashUCharsN(rules.getBuffer(), rules.length()));
+}
+
+}  // namespace
+
+void CollationAPITest::TestRulesCache() {
+    IcuTestErrorCode errorCode(*this, "TestRulesCache");
+    UnicodeString rules(rulesCacheTestRules);
+    char path[64];
+    getRulesCacheTestPath(rules, path);
+    remove(path);
+
+    RuleBasedCollator expected(rules, errorCode);
+    if (errorCode.errDataIfFailureAndReset("RuleBasedCollator(rules)")) {
+        return;
+    }
+    uint8_t expectedBinary[100000];
+    int32_t expectedLength = expected.cloneBinary(expectedBinary, UPRV_LENGTHOF(expectedBinary), errorCode);
+    errorCode.errIfFailureAndReset("cloneBinary()");
+
+    // The first instance builds the data and writes the cache file,
+    // the second one reads it back.
+    for (int32_t i = 0; i < 2; ++i) {
+        RuleBasedCollator coll(rules, ".", errorCode);
+        if (errorCode.errIfFailureAndReset("RuleBasedCollator(rules, cacheDirectory) #%d", (int)i)) {
+            return;
+        }
+        FILE *file = fopen(path, "rb");
+        assertTrue("cache file exists", file != NULL);
+        if (file != NULL) { fclose(file); }
+        assertEquals("getRules()", rules, coll.getRules());
+        uint8_t binary[100000];
+        int32_t length = coll.cloneBinary(binary, UPRV_LENGTHOF(binary), errorCode);
+        errorCode.errIfFailureAndReset("cloneBinary()");
+        assertTrue("same binary data",
+                   length == expectedLength && 0 == uprv_memcmp(binary, expectedBinary, length));
+        assertEquals("b<a-umlaut", UCOL_LESS,
+                     coll.compare(UnicodeString(u"b"), UnicodeString(u"\u00e4"), errorCode));
+        assertEquals("A-umlaut<a-umlaut with caseFirst upper", UCOL_LESS,
+                     coll.compare(UnicodeString(u"\u00c4"), UnicodeString(u"\u00e4"), errorCode));
+        errorCode.errIfFailureAndReset("compare()");
+    }
+
+    // The C API applies the strength after loading.
+    UParseError parseError;
+    LocalUCollatorPointer ucoll(ucol_openRulesCached(
+        rules.getBuffer(), rules.length(), UCOL_DEFAULT, UCOL_PRIMARY, ".", &parseError, errorCode));
+    if (!errorCode.errIfFailureAndReset("ucol_openRulesCached()")) {
+        assertEquals("primary strength", UCOL_EQUAL,
+                     ucol_strcoll(ucoll.getAlias(), u"\u00c4", -1, u"\u00e4", -1));
+    }
+
+    // A cache file with a damaged header or rule string is ignored and replaced.
+    FILE *damaged = fopen(path, "r+b");
+    if (damaged != NULL) {
+        fseek(damaged, 40, SEEK_SET);
+        fputs("garbage", damaged);
+        fclose(damaged);
+    }
+    RuleBasedCollator rebuilt(rules, ".", errorCode);
+    if (!errorCode.errIfFailureAndReset("RuleBasedCollator(rules, cacheDirectory) after damage")) {
+        assertEquals("b<a-umlaut after rebuilding", UCOL_LESS,
+                     rebuilt.compare(UnicodeString(u"b"), UnicodeString(u"\u00e4"), errorCode));
+    }
+    RuleBasedCollator reloaded(rules, ".", errorCode);
+    if (!errorCode.errIfFailureAndReset("RuleBasedCollator(rules, cacheDirectory) reloaded")) {
+        assertEquals("getRules() after reloading", rules, reloaded.getRules());
+    }
+
+    // Syntax errors are not cached.
+    RuleBasedCollator bad(UnicodeString(u"[bogus option]&a<b"), ".", errorCode);
+    assertTrue("bad rules fail", errorCode.reset() != U_ZERO_ERROR);
+
+    // Concurrent writers of the same entry each use their own temporary file.
+    remove(path);
+    ThreadPool<CollationAPITest> threads(this, 4, &CollationAPITest::rulesCacheThread);
+    threads.start();
+    threads.join();
+    RuleBasedCollator afterThreads(rules, ".", errorCode);
+    if (!errorCode.errIfFailureAndReset("RuleBasedCollator(rules, cacheDirectory) after threads")) {
+        uint8_t binary[100000];
+        int32_t length = afterThreads.cloneBinary(binary, UPRV_LENGTHOF(binary), errorCode);
+        errorCode.errIfFailureAndReset("cloneBinary() after threads");
+        assertTrue("same binary data after threads",
+                   length == expectedLength && 0 == uprv_memcmp(binary, expectedBinary, length));
+    }
+    remove(path);
+}
+
+void CollationAPITest::rulesCacheThread(int32_t threadNumber) {
+    UnicodeString rules(rulesCacheTestRules);
+    char path[64];
+    getRulesCacheTestPath(rules, path);
+    for (int32_t i = 0; i < 10; ++i) {
+        if (threadNumber == 0) {
+            // Force other threads to build and store the data again.
+            remove(path);
+        }
+        UErrorCode errorCode = U_ZERO_ERROR;
+        RuleBasedCollator coll(rules, ".", errorCode);
+        if (U_FAILURE(errorCode)) {
+            errln("thread %d: RuleBasedCollator(rules, cacheDirectory) failed - %s",
+                  (int)threadNumber, u_errorName(errorCode));
+            return;
+        }
+        if (coll.compare(UnicodeString(u"b"), UnicodeString(u"\u00e4"), errorCode) != UCOL_LESS) {
+            errln("thread %d: b<a-umlaut failed", (int)threadNumber);
+            return;
+        }
+    }
+}
+
+void CollationAPITest::TestCompareSession() {
+    IcuTestErrorCode errorCode(*this, "TestCompareSession");
+    LocalPointer<Collator> coll(Collator::createInstance(Locale("sk"), errorCode));
+    if (errorCode.errDataIfFailureAndReset("Collator::createInstance(sk)")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if (rbc == NULL) {
+        errln("the Slovak collator is not a RuleBasedCollator");
+        return;
+    }
+    // Mix of fast-Latin, Latin with contractions, and non-Latin strings,
+    // plus variable characters and digits for the attribute variations.
+    static const char *const strings[] = {
+        "", "a", "A", "ab", "ch", "cH", "Ch", "h", "i", "ca",
+        "\\u00e4", "\\u00c4b", "a-b", "a b", "ab-", "a1", "a10", "a9",
+        "\\u03b1\\u03b2", "\\u0391\\u03b2", "\\u03b1", "\\u03b1-",
+        "\\u4e00", "\\u4e00\\u4e01", "\\uac00", "\\u0915\\u094d\\u0937",
+        "\\u1100\\u1161", "\\uac00a", "x\\u0301\\u0323", "x\\u0323\\u0301",
+        "\\ud835\\udc00", "\\uffff", "\\ufffe", "\\u0000a",
+        // Shared non-Latin prefixes, as in the late probes of a binary search,
+        // where the session continues with the left CEs after the prefix.
+        "\\u03b1\\u03b2c", "\\u03b1\\u03b2ch", "\\u03b1\\u03b2cH", "\\u03b1\\u03b2h",
+        "\\u03b1\\u03b2\\u4e00", "\\u03b1\\u03b21", "\\u03b1\\u03b210", "\\u03b1\\u03b2-9",
+        "\\u03b1\\u0301\\u0323", "\\u03b1\\u0323\\u0301", "\\u03b1\\u0301",
+        "\\u4e00\\u4e01a", "\\u4e00\\u4e01\\u00e4", "\\u4e00\\u4e01\\u0308",
+        "\\u4e00\\ud835\\udc00", "\\u4e00\\ud835\\udc01", "\\u1100\\u1161\\u11a8",
+        // With alternate=shifted, a primary ignorable after a variable character
+        // is ignored when the comparison starts before the variable one,
+        // but not when the common prefix ends right after it.
+        "a \\u0901z", "A z", "a z", "a-\\u0901z", "A-z", "a-z"
+    };
+    int32_t count = UPRV_LENGTHOF(strings);
+    std::vector<UnicodeString> utf16(count);
+    std::vector<std::string> utf8(count);
+    for (int32_t i = 0; i < count; ++i) {
+        utf16[i] = UnicodeString(strings[i], -1, US_INV).unescape();
+        utf16[i].toUTF8String(utf8[i]);
+    }
+    static const struct {
+        UColAttribute attr;
+        UColAttributeValue value;
+    } variations[] = {
+        { UCOL_STRENGTH, UCOL_TERTIARY },
+        { UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED },
+        { UCOL_STRENGTH, UCOL_QUATERNARY },
+        { UCOL_NUMERIC_COLLATION, UCOL_ON },
+        { UCOL_NORMALIZATION_MODE, UCOL_ON },
+        { UCOL_FRENCH_COLLATION, UCOL_ON },
+        { UCOL_STRENGTH, UCOL_IDENTICAL }
+    };
+    // Apply the variations cumulatively.
+    for (int32_t v = 0; v < UPRV_LENGTHOF(variations); ++v) {
+        rbc->setAttribute(variations[v].attr, variations[v].value, errorCode);
+        CollationCompareSession session(*rbc, errorCode);
+        if (errorCode.errIfFailureAndReset("CollationCompareSession(variation %d)", (int)v)) {
+            return;
+        }
+        // Each left string is compared with all right strings in a row,
+        // then the order is reversed to also switch between left strings.
+        for (int32_t pass = 0; pass < 2; ++pass) {
+            for (int32_t i = 0; i < count; ++i) {
+                int32_t leftIndex = pass == 0 ? i : count - 1 - i;
+                const std::string &left = utf8[leftIndex];
+                const UnicodeString &left16 = utf16[leftIndex];
+                for (int32_t j = 0; j < count; ++j) {
+                    const std::string &right = utf8[j];
+                    UCollationResult expected = rbc->compareUTF8(left, right, errorCode);
+                    UCollationResult actual = session.compareUTF8(left, right, errorCode);
+                    if (errorCode.errIfFailureAndReset("compareUTF8()")) { return; }
+                    if (actual != expected) {
+                        errln("CollationCompareSession variation %d: compareUTF8(%s, %s)=%d != %d",
+                              (int)v, left.c_str(), right.c_str(), (int)actual, (int)expected);
+                    }
+                    expected = rbc->compare(left16, utf16[j], errorCode);
+                    actual = session.compare(left16, utf16[j], errorCode);
+                    if (errorCode.errIfFailureAndReset("compare()")) { return; }
+                    if (actual != expected) {
+                        errln("CollationCompareSession variation %d: compare(%s, %s)=%d != %d",
+                              (int)v, left.c_str(), right.c_str(), (int)actual, (int)expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+namespace {
+
+UCollationResult compareSortKeys(const Collator &coll, const UnicodeString &s, const UnicodeString &t,
+                                 UErrorCode &errorCode) {
+    CollationKey sKey, tKey;
+    coll.getCollationKey(s, sKey, errorCode);
+    coll.getCollationKey(t, tKey, errorCode);
+    return sKey.compareTo(tKey, errorCode);
+}
+
+}  // namespace
+
+void CollationAPITest::checkEqualPrefixCompare(const char *name, const Collator &coll,
+                                               const UnicodeString &s, const UnicodeString &t) {
+    IcuTestErrorCode errorCode(*this, "checkEqualPrefixCompare");
+    // The sort keys do not use the identical-prefix shortcut.
+    UCollationResult expected = compareSortKeys(coll, s, t, errorCode);
+    UnicodeString sCopy(s), tCopy(t);  // NUL-terminated buffers
+    const char16_t *sBuffer = sCopy.getTerminatedBuffer();
+    const char16_t *tBuffer = tCopy.getTerminatedBuffer();
+    UCollationResult results[4] = {
+        coll.compare(s, t, errorCode),
+        (UCollationResult)-coll.compare(t, s, errorCode),
+        coll.compare(sBuffer, s.length(), tBuffer, t.length(), errorCode),
+        coll.compare(sBuffer, -1, tBuffer, -1, errorCode)
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(results); ++i) {
+        if (results[i] != expected) {
+            errln(UnicodeString(name, -1, US_INV) + ": compare variant " + i +
+                  "(" + IntlTest::prettify(s) + ", " + IntlTest::prettify(t) + ")=" + results[i] +
+                  " but the sort keys compare " + expected);
+        }
+    }
+    // Unpaired surrogates become U+FFFD in UTF-8.
+    std::string s8, t8;
+    s.toUTF8String(s8);
+    t.toUTF8String(t8);
+    UCollationResult expected8 = compareSortKeys(
+        coll, UnicodeString::fromUTF8(s8), UnicodeString::fromUTF8(t8), errorCode);
+    UCollationResult results8[3] = {
+        coll.compareUTF8(s8, t8, errorCode),
+        (UCollationResult)-coll.compareUTF8(t8, s8, errorCode),
+        ucol_strcollUTF8(coll.toUCollator(), s8.c_str(), -1, t8.c_str(), -1, errorCode)
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(results8); ++i) {
+        if (results8[i] != expected8) {
+            errln(UnicodeString(name, -1, US_INV) + ": compareUTF8 variant " + i +
+                  "(" + IntlTest::prettify(s) + ", " + IntlTest::prettify(t) + ")=" + results8[i] +
+                  " but the sort keys compare " + expected8);
+        }
+    }
+}
+
+void CollationAPITest::TestEqualPrefixes() {
+    IcuTestErrorCode errorCode(*this, "TestEqualPrefixes");
+    // compare() skips the identical prefix of the two strings eight bytes at a time,
+    // and the fast Latin code skips characters with equal primaries.
+    // Both must back up or stop where the equal part ends inside a contraction,
+    // before a prefix-context match, inside a surrogate pair,
+    // or before a combining mark.
+    LocalPointer<Collator> root(Collator::createInstance(Locale::getRoot(), errorCode));
+    if (errorCode.errDataIfFailureAndReset("Collator::createInstance(root)")) {
+        return;
+    }
+    LocalPointer<Collator> shifted(root->clone());
+    shifted->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, errorCode);
+    // ch is a contraction, and c after b sorts like a separate letter.
+    RuleBasedCollator tailored(UNICODE_STRING_SIMPLE("&c<ch<<<cH &z<b|c"), errorCode);
+    if (errorCode.errIfFailureAndReset("RuleBasedCollator(contraction & prefix rules)")) {
+        return;
+    }
+    const struct {
+        const char *name;
+        const Collator *coll;
+    } collators[] = {
+        { "root", root.getAlias() },
+        { "shifted", shifted.getAlias() },
+        { "tailored", &tailored }
+    };
+    static const char *const tails[][2] = {
+        { "ch", "ci" }, { "c", "ch" }, { "ch", "cH" }, { "cha", "c" },
+        { "bc", "bd" }, { "b", "bc" }, { "bc", "b" }, { "bca", "ba" },
+        { "\\ud800", "\\ud800x" }, { "\\ud800\\udc00", "\\ud800\\udc01" },
+        { "\\ud800a", "\\ud800\\udc00" }, { "\\udc00a", "\\udc00b" },
+        { "\\ud835\\udc00", "\\ud835" },
+        { "e\\u0301", "e\\u0302" }, { "e\\u0301", "\\u00e9" }, { "e", "e\\u0323\\u0301" },
+        { "a", "A" }, { "a-b", "a b" }, { "x", "" }, { "", "" }
+    };
+    static const char16_t letters[] = u"abdefgijklmnopqrstuvwxyz";
+    for (int32_t c = 0; c < UPRV_LENGTHOF(collators); ++c) {
+        for (int32_t t = 0; t < UPRV_LENGTHOF(tails); ++t) {
+            UnicodeString tail0 = UnicodeString(tails[t][0], -1, US_INV).unescape();
+            UnicodeString tail1 = UnicodeString(tails[t][1], -1, US_INV).unescape();
+            // Common prefixes of up to 20 UTF-16 units / bytes cross
+            // the word boundaries at 4, 8 and 16 units and 8 and 16 bytes.
+            for (int32_t n = 0; n <= 20; ++n) {
+                UnicodeString prefix(letters, n);
+                checkEqualPrefixCompare(collators[c].name, *collators[c].coll,
+                                        prefix + tail0, prefix + tail1);
+                // Strings that differ in case at the start have no identical prefix,
+                // but the fast Latin code sees the same primaries.
+                checkEqualPrefixCompare(collators[c].name, *collators[c].coll,
+                                        UNICODE_STRING_SIMPLE("A") + prefix + tail0,
+                                        UNICODE_STRING_SIMPLE("a") + prefix + tail1);
+            }
+        }
+    }
+}
+
  void CollationAPITest::dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status) {
     const char* bigone = "One";
     const char* littleone = "one";
@@ -2560,6 +3176,13 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO(TestGapTooSmall);
+    TESTCASE_AUTO(TestGetSortKeys);
+    TESTCASE_AUTO(TestPrimaryPrefix);
+    TESTCASE_AUTO(TestSortStrings);
+    TESTCASE_AUTO(TestSortKeysTooLong);
+    TESTCASE_AUTO(TestRulesCache);
+    TESTCASE_AUTO(TestCompareSession);
+    TESTCASE_AUTO(TestEqualPrefixes);
     TESTCASE_AUTO_END;
 }
 
@@ -174,6 +174,13 @@ class CollationAPITest: public IntlTestCollator {
     void TestIterNumeric();
     void TestBadKeywords();
     void TestGapTooSmall();
+    void TestGetSortKeys();
+    void TestPrimaryPrefix();
+    void TestSortStrings();
+    void TestSortKeysTooLong();
+    void TestRulesCache();
+    void TestCompareSession();
+    void TestEqualPrefixes();
 
 private:
     // If this is too small for the test data, just increase it.
@@ -181,6 +188,9 @@ class CollationAPITest: public IntlTestCollator {
     enum EToken_Len { MAX_TOKEN_LEN = 16 };
 
     void dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status);
+    void checkEqualPrefixCompare(const char *name, const Collator &coll,
+                                 const UnicodeString &s, const UnicodeString &t);
+    void rulesCacheThread(int32_t threadNumber);
 
 };
 
@@ -24,6 +24,7 @@
 #include "intltest.h"
 #include "tsmthred.h"
 #include "unicode/ushape.h"
+#include "unicode/ucnv.h"
 #include "unicode/translit.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
@@ -86,6 +87,9 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+#if !UCONFIG_NO_CONVERSION
+    TESTCASE_AUTO(TestConverterDescriptor);
+#endif
     TESTCASE_AUTO_END
 }
 
@@ -1585,3 +1589,72 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+#if !UCONFIG_NO_CONVERSION
+//-----------------------------------------------------------------------------------
+//
+//   TestConverterDescriptor -- several threads convert strings concurrently
+//                              with one shared UConverterDescriptor.
+//
+//-----------------------------------------------------------------------------------
+
+static UConverterDescriptor *gSharedDescriptor = nullptr;
+static const UChar *gDescriptorText = nullptr;
+static int32_t gDescriptorTextLength = 0;
+
+class ConverterDescriptorThread : public SimpleThread {
+public:
+    ConverterDescriptorThread() : fErrors(0) {}
+    virtual void run();
+    int32_t fErrors;
+};
+
+void ConverterDescriptorThread::run() {
+    char bytes[200];
+    UChar uchars[200];
+    for (int32_t i = 0; i < 2000; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t length = ucnv_descriptorFromUChars(gSharedDescriptor, bytes, UPRV_LENGTHOF(bytes),
+                                                   gDescriptorText, gDescriptorTextLength, &status);
+        length = ucnv_descriptorToUChars(gSharedDescriptor, uchars, UPRV_LENGTHOF(uchars),
+                                         bytes, length, &status);
+        if (U_FAILURE(status) || length != gDescriptorTextLength ||
+                u_memcmp(uchars, gDescriptorText, length) != 0) {
+            ++fErrors;
+        }
+    }
+}
+
+void MultithreadTest::TestConverterDescriptor() {
+    static const char *const names[] = {
+        "UTF-8",
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "GB18030",
+        "ISO-2022-JP",
+#endif
+    };
+    UnicodeString text(u"Zeichen \u3042\u3044\u3046 \u65E5\u672C\u8A9E abc\n");
+    gDescriptorText = text.getBuffer();
+    gDescriptorTextLength = text.length();
+    for (const char *name : names) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalUConverterDescriptorPointer descriptor(ucnv_openDescriptor(name, &status));
+        if (!assertSuccess(name, status, TRUE)) {
+            continue;
+        }
+        gSharedDescriptor = descriptor.getAlias();
+
+        static constexpr int NUM_THREADS = 4;
+        ConverterDescriptorThread threads[NUM_THREADS];
+        for (auto &thread:threads) {
+            thread.start();
+        }
+        for (auto &thread:threads) {
+            thread.join();
+            assertEquals(name, 0, thread.fErrors);
+        }
+        gSharedDescriptor = nullptr;
+    }
+    gDescriptorText = nullptr;
+}
+#endif /* !UCONFIG_NO_CONVERSION */
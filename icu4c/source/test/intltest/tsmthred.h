@@ -54,6 +54,7 @@ class MultithreadTest : public IntlTest
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
+    void TestConverterDescriptor();
 };
 
 #endif
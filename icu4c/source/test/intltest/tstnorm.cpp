@@ -13,13 +13,16 @@
 #include "unicode/uchar.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
+#include "unicode/normstream.h"
 #include "unicode/stringoptions.h"
+#include "unicode/udata.h"
 #include "unicode/uniset.h"
 #include "unicode/usetiter.h"
 #include "unicode/schriter.h"
 #include "unicode/utf16.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "norm2allmodes.h"
 #include "normalizer2impl.h"
 #include "testutil.h"
 #include "tstnorm.h"
@@ -60,6 +63,14 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestFastPathBlocks);
+    TESTCASE_AUTO(TestNormalizeInPlace);
+    TESTCASE_AUTO(TestStreamingNormalizer);
+    TESTCASE_AUTO(TestNormalizeUTF8Parallel);
+    TESTCASE_AUTO(TestHardcodedNFKC_CF);
+    TESTCASE_AUTO(TestInlineComposer);
+    TESTCASE_AUTO(TestPrecomputedCanonIterData);
+    TESTCASE_AUTO(TestFCDUTF8);
     TESTCASE_AUTO_END;
 }
 
@@ -1805,4 +1816,461 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
     assertFalse("U+FB2C boundary-after", nfkc->hasBoundaryAfter(0xFB2C));
 }
 
+void
+BasicNormalizerTest::TestFastPathBlocks() {
+    // The fast paths skip low code units several at a time.
+    // Put a character that needs attention at each position relative to
+    // those blocks, and check that it is still found.
+    IcuTestErrorCode errorCode(*this, "TestFastPathBlocks");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkcCF = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() etc. call failed")) {
+        return;
+    }
+    for (int32_t before = 0; before <= 20; ++before) {
+        for (int32_t after = 0; after <= 9; ++after) {
+            UnicodeString prefix(before, u'a', before);
+            UnicodeString suffix(after, u'\u00e9', after);  // Latin-1, below U+0300
+            UnicodeString composed = UnicodeString(prefix).append(u'\u00e9').append(suffix);
+            UnicodeString decomposed = UnicodeString(prefix).append(u"e\u0301").append(suffix);
+            char msg[40];
+            sprintf(msg, "before=%d after=%d", (int)before, (int)after);
+
+            assertEquals(UnicodeString("nfc ") + msg, composed, nfc->normalize(decomposed, errorCode));
+            assertFalse(UnicodeString("nfc isNormalized ") + msg,
+                        nfc->isNormalized(decomposed, errorCode));
+            assertTrue(UnicodeString("nfc isNormalized(composed) ") + msg,
+                       nfc->isNormalized(composed, errorCode));
+            assertEquals(UnicodeString("nfc span ") + msg,
+                         before, nfc->spanQuickCheckYes(decomposed, errorCode));
+
+            std::string decomposed8, composed8, result8;
+            decomposed.toUTF8String(decomposed8);
+            composed.toUTF8String(composed8);
+            StringByteSink<std::string> sink(&result8);
+            nfc->normalizeUTF8(0, decomposed8, sink, nullptr, errorCode);
+            assertEquals(UnicodeString("nfc UTF-8 ") + msg, composed8.c_str(), result8.c_str());
+            assertFalse(UnicodeString("nfc isNormalizedUTF8 ") + msg,
+                        nfc->isNormalizedUTF8(decomposed8, errorCode));
+            assertTrue(UnicodeString("nfc isNormalizedUTF8(composed) ") + msg,
+                       nfc->isNormalizedUTF8(composed8, errorCode));
+
+            UnicodeString nfdExpected = UnicodeString(prefix).append(u"e\u0301");
+            for (int32_t i = 0; i < after; ++i) {
+                nfdExpected.append(u"e\u0301");
+            }
+            assertEquals(UnicodeString("nfd ") + msg, nfdExpected, nfd->normalize(composed, errorCode));
+
+            // NFKC_Casefold does not skip upper case ASCII letters.
+            UnicodeString upper = UnicodeString(prefix).append(u'A').append(UnicodeString(after, u'b', after));
+            UnicodeString folded = UnicodeString(prefix).append(u'a').append(UnicodeString(after, u'b', after));
+            assertEquals(UnicodeString("nfkc_cf ") + msg, folded, nfkcCF->normalize(upper, errorCode));
+        }
+    }
+}
+
+void
+BasicNormalizerTest::TestNormalizeInPlace() {
+    IcuTestErrorCode errorCode(*this, "TestNormalizeInPlace");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc = Normalizer2::getNFKCInstance(errorCode);
+    const Normalizer2 *nfkcCF = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() etc. call failed")) {
+        return;
+    }
+    const Normalizer2 *norms[] = { nfc, nfd, nfkc, nfkcCF, fcd };
+    const char *normNames[] = { "nfc", "nfd", "nfkc", "nfkc_cf", "fcd" };
+    static const char16_t *const strings[] = {
+        u"",
+        u"abc",
+        u"\u00e9t\u00e9",
+        u"e\u0301te\u0301 de\u0301ja\u0300 vu",
+        u"a\u0323\u0302 \u1ea0\u0302x",  // reordering
+        u"\uFB03 \u2460 \u00BD Stra\u00DFe",  // compatibility mappings
+        u"\u1100\u1161\u11A8 \uAC00\u11A8",  // Hangul
+        u"\U0001D15E\U0001D165 \U0001D15F",  // supplementary, composition exclusions
+        u"\u00AD\u0041\u034F\u0301",  // default ignorables for nfkc_cf
+        u"\u0F73\u0F75\u0F81 abc \u0344",  // grow under all forms
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(norms); ++i) {
+        for (int32_t j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+            UnicodeString src(strings[j]);
+            UnicodeString expected = norms[i]->normalize(src, errorCode);
+            UnicodeString s(src);
+            norms[i]->normalizeInPlace(s, errorCode);
+            char msg[40];
+            sprintf(msg, "%s strings[%d]", normNames[i], (int)j);
+            assertSuccess(msg, errorCode.get());
+            assertEquals(msg, expected, s);
+
+            // Prefix so that the first change is not at the start.
+            UnicodeString longSrc = UnicodeString(u"normalized text ").append(src).append(src);
+            expected = norms[i]->normalize(longSrc, errorCode);
+            s = longSrc;
+            norms[i]->normalizeInPlace(s, errorCode);
+            assertEquals(UnicodeString("long ") + msg, expected, s);
+        }
+    }
+
+    // Normalized text is left alone, even a read-only alias.
+    static const char16_t text[] = u"d\u00e9j\u00e0 vu";
+    UnicodeString alias(TRUE, text, -1);
+    nfc->normalizeInPlace(alias, errorCode);
+    assertTrue("read-only alias not copied", alias.getBuffer() == text);
+    UnicodeString s(text);
+    const char16_t *buffer = s.getBuffer();
+    nfc->normalizeInPlace(s, errorCode);
+    assertTrue("normalized string not reallocated", s.getBuffer() == buffer);
+
+    // Shorter results are written into the existing buffer.
+    s = u"e\u0301te\u0301 e\u0301te\u0301 e\u0301te\u0301 e\u0301te\u0301 e\u0301te\u0301";
+    buffer = s.getBuffer();
+    nfc->normalizeInPlace(s, errorCode);
+    assertEquals("nfc shorter", u"\u00e9t\u00e9 \u00e9t\u00e9 \u00e9t\u00e9 \u00e9t\u00e9 \u00e9t\u00e9", s);
+    assertTrue("shorter result in the same buffer", s.getBuffer() == buffer);
+
+    UnicodeString bogus;
+    bogus.setToBogus();
+    nfc->normalizeInPlace(bogus, errorCode);
+    assertEquals("bogus string", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+void
+BasicNormalizerTest::TestStreamingNormalizer() {
+    IcuTestErrorCode errorCode(*this, "TestStreamingNormalizer");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkcCF = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() etc. call failed")) {
+        return;
+    }
+    const Normalizer2 *norms[] = { nfc, nfd, nfkcCF, fcd };
+    const char *normNames[] = { "nfc", "nfd", "nfkc_cf", "fcd" };
+    // Chunks split combining sequences, surrogate pairs and UTF-8 sequences.
+    UnicodeString text(
+        u"e\u0301te\u0301 de\u0301ja\u0300 vu "
+        u"a\u0323\u0302 \u1ea0\u0302x "
+        u"\uFB03 \u2460 Stra\u00DFe "
+        u"\u1100\u1161\u11A8 \uAC00\u11A8 "
+        u"\U0001D15E\U0001D165 \U0001D15F "
+        u"\u00AD\u0041\u034F\u0301 "
+        u"\u0F73\u0F75\u0F81 \u0344\u0344");
+    std::string text8;
+    text.toUTF8String(text8);
+    static const int32_t chunkLengths[] = { 1, 2, 3, 5, 8, 1000 };
+    for(int32_t i = 0; i < UPRV_LENGTHOF(norms); ++i) {
+        UnicodeString expected = norms[i]->normalize(text, errorCode);
+        std::string expected8;
+        expected.toUTF8String(expected8);
+        StreamingNormalizer sn(*norms[i]);
+        for(int32_t j = 0; j < UPRV_LENGTHOF(chunkLengths); ++j) {
+            char msg[40];
+            sprintf(msg, "%s chunks of %d", normNames[i], (int)chunkLengths[j]);
+            UnicodeString result;
+            for(int32_t start = 0; start < text.length(); start += chunkLengths[j]) {
+                sn.normalizeChunk(text.tempSubString(start, chunkLengths[j]), result, errorCode);
+            }
+            sn.finish(result, errorCode);
+            assertSuccess(msg, errorCode.get());
+            assertEquals(msg, expected, result);
+            assertEquals(UnicodeString("pending after finish ") + msg, 0, sn.getPendingLength());
+
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            for(int32_t start = 0; start < (int32_t)text8.length(); start += chunkLengths[j]) {
+                sn.normalizeChunkUTF8(
+                    StringPiece(text8).substr(start, chunkLengths[j]), sink, errorCode);
+            }
+            sn.finishUTF8(sink, errorCode);
+            assertSuccess(UnicodeString("UTF-8 ") + msg, errorCode.get());
+            assertEquals(UnicodeString("UTF-8 ") + msg, expected8.c_str(), result8.c_str());
+        }
+    }
+
+    // Without boundaries, the pending text is limited.
+    UnicodeString marks(u"a");
+    for(int32_t i = 0; i < 200; ++i) { marks.append((UChar)0x301); }
+    StreamingNormalizer sn(*nfc, 40);
+    UnicodeString result;
+    for(int32_t start = 0; start < marks.length(); start += 7) {
+        sn.normalizeChunk(marks.tempSubString(start, 7), result, errorCode);
+        assertTrue("pending text limited", sn.getPendingLength() <= 40);
+    }
+    sn.finish(result, errorCode);
+    assertEquals("canonically equivalent", marks, nfd->normalize(result, errorCode));
+
+    // One stream is either UTF-16 or UTF-8.
+    std::string result8;
+    StringByteSink<std::string> sink(&result8);
+    sn.normalizeChunk(UnicodeString(u"abc"), result, errorCode);
+    sn.normalizeChunkUTF8("def", sink, errorCode);
+    assertEquals("mixed UTF-16 & UTF-8", U_INVALID_STATE_ERROR, errorCode.reset());
+    sn.reset();
+    sn.normalizeChunkUTF8("def", sink, errorCode);
+    sn.finishUTF8(sink, errorCode);
+    assertEquals("UTF-8 after reset", "def", result8.c_str());
+}
+
+void
+BasicNormalizerTest::TestNormalizeUTF8Parallel() {
+    IcuTestErrorCode errorCode(*this, "TestNormalizeUTF8Parallel");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkcCF = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() etc. call failed")) {
+        return;
+    }
+    const Normalizer2 *norms[] = { nfc, nfd, nfkcCF, fcd };
+    const char *normNames[] = { "nfc", "nfd", "nfkc_cf", "fcd" };
+    // Long enough to be split into several segments.
+    // Varying piece lengths move combining sequences and multi-byte characters
+    // across all positions relative to the segment boundaries.
+    static const char *const pieces[] = {
+        "e\xcc\x81te\xcc\x81 de\xcc\x81ja\xcc\x80 vu ",  // e + U+0301
+        "a\xcc\xa3\xcc\x82 \xe1\xba\xa0\xcc\x82x ",  // reordering
+        "\xef\xac\x83 Stra\xc3\x9f" "e ",  // compatibility mapping, sharp s
+        "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8 ",  // conjoining jamo
+        "\xf0\x9d\x85\x9e\xf0\x9d\x85\xa5 ",  // supplementary
+        "\xcc\x81\xcc\x81\xcc\x81",  // combining marks without a starter
+        "\xc3 \x80\xe0\x80 ",  // ill-formed
+        "abcdefghij"
+    };
+    std::string src;
+    for(int32_t i = 0; src.length() < 600000; ++i) {
+        src.append(pieces[i % UPRV_LENGTHOF(pieces)]);
+        src.append(i % 13, 'x');
+    }
+    static const int32_t threadCounts[] = { 0, 1, 2, 3, 8, INT32_MAX };
+    for(int32_t i = 0; i < UPRV_LENGTHOF(norms); ++i) {
+        std::string expected;
+        StringByteSink<std::string> expectedSink(&expected);
+        norms[i]->normalizeUTF8(0, src, expectedSink, nullptr, errorCode);
+        for(int32_t j = 0; j < UPRV_LENGTHOF(threadCounts); ++j) {
+            char msg[40];
+            sprintf(msg, "%s threads=%d", normNames[i], (int)threadCounts[j]);
+            std::string result;
+            StringByteSink<std::string> sink(&result);
+            norms[i]->normalizeUTF8Parallel(src, sink, threadCounts[j], errorCode);
+            assertSuccess(msg, errorCode.get());
+            assertTrue(msg, result == expected);
+        }
+    }
+
+    // Short text is normalized on the calling thread.
+    std::string result;
+    StringByteSink<std::string> sink(&result);
+    nfc->normalizeUTF8Parallel("e\xcc\x81", sink, 4, errorCode);
+    assertEquals("short", "\xc3\xa9", result.c_str());
+
+    nfc->normalizeUTF8Parallel("abc", sink, -1, errorCode);
+    assertEquals("negative threadCount", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+void
+BasicNormalizerTest::TestHardcodedNFKC_CF() {
+    // The NFKC_Casefold data is compiled into the common library.
+    // It must match the nfkc_cf.nrm data file that is still in the data package.
+    IcuTestErrorCode errorCode(*this, "TestHardcodedNFKC_CF");
+    const Normalizer2 *hardcoded = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    const Normalizer2 *loaded =
+        Normalizer2::getInstance(U_ICUDATA_ALIAS, "nfkc_cf", UNORM2_COMPOSE, errorCode);
+    if(errorCode.errDataIfFailureAndReset("unable to load nfkc_cf.nrm")) {
+        return;
+    }
+    assertTrue("different instances", hardcoded != loaded);
+    UnicodeString hd, ld;
+    for(UChar32 c = 0; c <= 0x10ffff; ++c) {
+        UBool hasHD = hardcoded->getRawDecomposition(c, hd);
+        UBool hasLD = loaded->getRawDecomposition(c, ld);
+        if(hasHD != hasLD || (hasHD && hd != ld) ||
+                hardcoded->getCombiningClass(c) != loaded->getCombiningClass(c) ||
+                hardcoded->hasBoundaryBefore(c) != loaded->hasBoundaryBefore(c) ||
+                hardcoded->hasBoundaryAfter(c) != loaded->hasBoundaryAfter(c) ||
+                hardcoded->isInert(c) != loaded->isInert(c)) {
+            errln("hardcoded NFKC_CF data differs from nfkc_cf.nrm for U+%04lX", (long)c);
+            break;
+        }
+    }
+    UnicodeString s = UnicodeString("A\\u00C5\\u1E0B\\u0323\\uFB01\\u2460\\u00DF\\uAC00\\u11A8", -1, US_INV).unescape();
+    assertEquals("normalize", loaded->normalize(s, errorCode), hardcoded->normalize(s, errorCode));
+}
+
+void
+BasicNormalizerTest::TestInlineComposer() {
+    IcuTestErrorCode errorCode(*this, "TestInlineComposer");
+    InlineComposer nfcInline = InlineComposer::forNFC(errorCode);
+    InlineComposer kcfInline = InlineComposer::forNFKC_CF(errorCode);
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errIfFailureAndReset("unable to get instances")) {
+        return;
+    }
+    static const char *const strings[] = {
+        "", "abc", "A\\u0308\\u0304", "\\u1E0B\\u0323", "\\uFB01 \\u2460 \\u00DF",
+        "\\u1100\\u1161\\u11A8", "\\u0300\\u0301a\\u0327", "\\uD834\\uDD5E\\uD834\\uDD65"
+    };
+    for(int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        UnicodeString s = UnicodeString(strings[i], -1, US_INV).unescape();
+        UnicodeString expected, actual;
+        nfc->normalize(s, expected, errorCode);
+        nfcInline.normalize(s, actual, errorCode);
+        assertEquals("NFC normalize", expected, actual);
+        assertEquals("NFC isNormalized",
+                     nfc->isNormalized(s, errorCode), nfcInline.isNormalized(s, errorCode));
+        nfkc_cf->normalize(s, expected, errorCode);
+        kcfInline.normalize(s, actual, errorCode);
+        assertEquals("NFKC_CF normalize", expected, actual);
+        assertEquals("NFKC_CF isNormalized",
+                     nfkc_cf->isNormalized(s, errorCode), kcfInline.isNormalized(s, errorCode));
+
+        std::string s8, expected8, actual8;
+        s.toUTF8String(s8);
+        StringByteSink<std::string> expectedSink(&expected8), actualSink(&actual8);
+        nfkc_cf->normalizeUTF8(0, s8, expectedSink, nullptr, errorCode);
+        kcfInline.normalizeUTF8(s8, actualSink, errorCode);
+        assertTrue("NFKC_CF normalizeUTF8", expected8 == actual8);
+        assertEquals("NFKC_CF isNormalizedUTF8",
+                     nfkc_cf->isNormalizedUTF8(s8, errorCode),
+                     kcfInline.isNormalizedUTF8(s8, errorCode));
+        const UChar *p = s.getBuffer();
+        assertEquals("NFC spanQuickCheckYes",
+                     nfc->spanQuickCheckYes(s, errorCode),
+                     (int32_t)(nfcInline.spanQuickCheckYes(p, p + s.length()) - p));
+    }
+    for(UChar32 c = 0; c < 0x3400; ++c) {
+        if(nfc->hasBoundaryBefore(c) != nfcInline.hasBoundaryBefore(c) ||
+                nfc->hasBoundaryAfter(c) != nfcInline.hasBoundaryAfter(c) ||
+                nfkc_cf->quickCheck(UnicodeString(c), errorCode) != kcfInline.getQuickCheck(c)) {
+            errln("InlineComposer property differs from Normalizer2 for U+%04lX", (long)c);
+            break;
+        }
+    }
+}
+
+void
+BasicNormalizerTest::TestPrecomputedCanonIterData() {
+    IcuTestErrorCode errorCode(*this, "TestPrecomputedCanonIterData");
+    // The hardcoded NFC data includes the CanonicalIterator data.
+    const Normalizer2Impl *nfcImpl = Normalizer2Factory::getNFCImpl(errorCode);
+    if(!errorCode.errIfFailureAndReset("Normalizer2Factory::getNFCImpl()")) {
+        checkPrecomputedCanonIterData("nfc", *nfcImpl);
+    }
+    // testnorm.nrm is built with gennorm2 --canoniterdata.
+    const Normalizer2 *n2 = Normalizer2::getInstance(
+        loadTestData(errorCode), "testnorm", UNORM2_COMPOSE, errorCode);
+    if(!errorCode.errDataIfFailureAndReset("unable to load testdata/testnorm.nrm")) {
+        checkPrecomputedCanonIterData("testnorm", *Normalizer2Factory::getImpl(n2));
+    }
+}
+
+void
+BasicNormalizerTest::checkPrecomputedCanonIterData(const char *name, const Normalizer2Impl &impl) {
+    IcuTestErrorCode errorCode(*this, name);
+    if(!impl.ensureCanonIterData(errorCode)) {
+        return;
+    }
+    // Build the data at runtime, and compare with the data that the instance uses.
+    UnicodeString startSets;
+    LocalUCPTriePointer trie(impl.buildCanonIterData(startSets, errorCode));
+    if(errorCode.errIfFailureAndReset("buildCanonIterData()")) {
+        return;
+    }
+    const uint16_t *sets = reinterpret_cast<const uint16_t *>(startSets.getBuffer());
+    UnicodeSet actual;
+    for(UChar32 c = 0; c <= 0x10ffff; ++c) {
+        uint32_t value = ucptrie_get(trie.getAlias(), c);
+        if(impl.isCanonSegmentStarter(c) != ((value & CANON_NOT_SEGMENT_STARTER) == 0)) {
+            errln("%s isCanonSegmentStarter(U+%04lX) differs from built data", name, (long)c);
+            break;
+        }
+        UnicodeSet expected;
+        int32_t v = (int32_t)(value & CANON_VALUE_MASK);
+        if((value & CANON_HAS_SET) != 0) {
+            expected.addAll(UnicodeSet(sets + v, startSets.length() - v,
+                                       UnicodeSet::kSerialized, errorCode));
+        } else if(v != 0) {
+            expected.add(v);
+        }
+        UBool hasSet = impl.getCanonStartSet(c, actual);
+        if(hasSet != ((value & ~CANON_NOT_SEGMENT_STARTER) != 0)) {
+            errln("%s getCanonStartSet(U+%04lX) return value differs from built data",
+                  name, (long)c);
+            break;
+        }
+        // With compositions, the actual set also contains composites
+        // that are added at runtime.
+        if(hasSet && ((value & CANON_HAS_COMPOSITIONS) != 0 ?
+                !actual.containsAll(expected) : actual != expected)) {
+            errln("%s getCanonStartSet(U+%04lX) differs from built data", name, (long)c);
+            break;
+        }
+    }
+}
+
+void
+BasicNormalizerTest::TestFCDUTF8() {
+    IcuTestErrorCode errorCode(*this, "TestFCDUTF8");
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    const Normalizer2Impl *nfcImpl = Normalizer2Factory::getNFCImpl(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getInstance(FCD) call failed")) {
+        return;
+    }
+    static const struct {
+        const char *s;
+        UBool isFCD;
+    } cases[] = {
+        { "", TRUE },
+        { "abc", TRUE },
+        { "a\xCC\xA7\xCC\x81", TRUE },  // a + U+0327 cedilla (ccc 202) + U+0301 acute (230)
+        { "a\xCC\x81\xCC\xA7", FALSE },  // acute before cedilla
+        { "\xC3\xA9\xCC\x81", TRUE },  // U+00E9 (tccc 230) + acute
+        { "\xC3\xA9\xCC\xA7", FALSE },  // U+00E9 (tccc 230) + cedilla
+        { "\xE1\xB8\x8B\xCC\xA3", FALSE },  // U+1E0B (tccc 230) + U+0323 dot below (220)
+        { "\xCC\xA7", TRUE },  // leading combining mark
+        { "\xE0\xBD\xB3", TRUE },  // U+0F73 Tibetan composite vowel is FCD on its own
+        { "\xF0\x9D\x85\x9E\xCC\xA7", FALSE },  // U+1D15E (tccc 216) + cedilla
+        { "\xCC", TRUE },  // truncated sequence
+        { "\xC3\xA9\x80\xCC\xA7", TRUE },  // stray trail byte between U+00E9 and cedilla
+        { "\xE0\x80\xCC\xA7", TRUE },  // ill-formed sequence before cedilla
+        { "\xC3\xA9\xE0\x80\xCC\xA7", TRUE },
+        { "\xC3\xCC\xA3", TRUE },  // lone lead byte (U+FFFD, not U+00C3) before dot below
+        { "a\xCB\xCC\xA3", TRUE }
+    };
+    for(int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        std::string s8(cases[i].s);
+        UnicodeString s16 = UnicodeString::fromUTF8(s8);
+        char msg[40];
+        sprintf(msg, "cases[%d]", (int)i);
+        assertEquals(UnicodeString("isNormalizedUTF8 ") + msg,
+                     cases[i].isFCD, fcd->isNormalizedUTF8(s8, errorCode));
+        assertEquals(UnicodeString("isNormalized ") + msg,
+                     cases[i].isFCD, fcd->isNormalized(s16, errorCode));
+    }
+
+    // The check skips low bytes several at a time and only then
+    // looks up the combining class of the last one.
+    for(int32_t before = 0; before <= 20; ++before) {
+        std::string prefix(before, 'a');
+        char msg[40];
+        sprintf(msg, "before=%d", (int)before);
+        std::string s8 = prefix + "\xC3\xA9\xCC\xA7";
+        assertFalse(UnicodeString("e-acute+cedilla ") + msg, fcd->isNormalizedUTF8(s8, errorCode));
+        const uint8_t *p = reinterpret_cast<const uint8_t *>(s8.data());
+        assertEquals(UnicodeString("span e-acute+cedilla ") + msg, (int64_t)before,
+                     (int64_t)(nfcImpl->spanFCDUTF8(p, p + s8.length()) - p));
+        s8 = prefix + "\xC3\xA9\xCC\x81" + prefix;
+        assertTrue(UnicodeString("e-acute+acute ") + msg, fcd->isNormalizedUTF8(s8, errorCode));
+        // The span ends before U+1E0B which needs to be decomposed together with the U+0323.
+        s8 = prefix + "\xE1\xB8\x8B\xCC\xA3" + prefix;
+        p = reinterpret_cast<const uint8_t *>(s8.data());
+        assertEquals(UnicodeString("span U+1E0B+U+0323 ") + msg, (int64_t)before,
+                     (int64_t)(nfcImpl->spanFCDUTF8(p, p + s8.length()) - p));
+    }
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -20,6 +20,10 @@
 #include "unicode/normlzr.h"
 #include "intltest.h"
 
+U_NAMESPACE_BEGIN
+class Normalizer2Impl;
+U_NAMESPACE_END
+
 class BasicNormalizerTest : public IntlTest {
 public:
     BasicNormalizerTest();
@@ -53,6 +57,14 @@ class BasicNormalizerTest : public IntlTest {
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestFastPathBlocks();
+    void TestNormalizeInPlace();
+    void TestStreamingNormalizer();
+    void TestNormalizeUTF8Parallel();
+    void TestHardcodedNFKC_CF();
+    void TestInlineComposer();
+    void TestPrecomputedCanonIterData();
+    void TestFCDUTF8();
 
 private:
     UnicodeString canonTests[24][3];
@@ -70,6 +82,8 @@ class BasicNormalizerTest : public IntlTest {
 
     int32_t countFoldFCDExceptions(uint32_t foldingOptions);
 
+    void checkPrecomputedCanonIterData(const char *name, const Normalizer2Impl &impl);
+
     //------------------------------------------------------------------------
     // Internal utilities
     //
@@ -10,10 +10,17 @@
 *
 ********************************************************************************
 */
+#include <chrono>
+#include <thread>
+
 #include "cstring.h"
 #include "intltest.h"
+#include "simplethread.h"
 #include "unifiedcache.h"
+#include "unicode/cachestats.h"
 #include "unicode/datefmt.h"
+#include "unicode/localpointer.h"
+#include "unicode/ucache.h"
 
 class UCTItem : public SharedObject {
   public:
@@ -29,6 +36,9 @@ class UCTItem : public SharedObject {
 class UCTItem2 : public SharedObject {
 };
 
+class UCTSlowItem : public SharedObject {
+};
+
 U_NAMESPACE_BEGIN
 
 template<> U_EXPORT
@@ -62,12 +72,26 @@ const UCTItem2 *LocaleCacheKey<UCTItem2>::createObject(
     return NULL;
 }
 
+// Slow to create, so that other threads wait for the value.
+template<> U_EXPORT
+const UCTSlowItem *LocaleCacheKey<UCTSlowItem>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    UCTSlowItem *result = new UCTSlowItem();
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    result->addRef();
+    return result;
+}
+
 U_NAMESPACE_END
 
 
 class UnifiedCacheTest : public IntlTest {
 public:
-    UnifiedCacheTest() {
+    UnifiedCacheTest() : fCache(NULL) {
     }
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=0);
 private:
@@ -77,6 +101,12 @@ class UnifiedCacheTest : public IntlTest {
     void TestError();
     void TestHashEquals();
     void TestEvictionUnderStress();
+    void TestStatistics();
+    void TestStatisticsWaits();
+    void TestStatisticsAPI();
+
+    void statisticsWaitsThread(int32_t threadNumber);
+    const UnifiedCache *fCache;
 };
 
 void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
@@ -87,6 +117,9 @@ void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &na
   TESTCASE_AUTO(TestError);
   TESTCASE_AUTO(TestHashEquals);
   TESTCASE_AUTO(TestEvictionUnderStress);
+  TESTCASE_AUTO(TestStatistics);
+  TESTCASE_AUTO(TestStatisticsWaits);
+  TESTCASE_AUTO(TestStatisticsAPI);
   TESTCASE_AUTO_END;
 }
 
@@ -396,6 +429,147 @@ void UnifiedCacheTest::TestHashEquals() {
     assertTrue("", diffKey1 != diffKey2);
 }
 
+void UnifiedCacheTest::TestStatistics() {
+    UErrorCode status = U_ZERO_ERROR;
+
+    // See TestEvictionPolicy: use a local cache so that the counts are known.
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("", status);
+
+    const UCTItem *en = NULL;
+    const UCTItem *enUS = NULL;
+    const UCTItem *zh = NULL;
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);     // miss
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);     // hit
+    // miss for en_US, which gets en (hit) while being created
+    cache.get(LocaleCacheKey<UCTItem>("en_US"), &cache, enUS, status);
+    assertSuccess("get", status);
+    cache.get(LocaleCacheKey<UCTItem>("zh"), &cache, zh, status);     // miss, error
+    status = U_ZERO_ERROR;
+    cache.get(LocaleCacheKey<UCTItem>("zh"), &cache, zh, status);     // hit, error
+    assertEquals("zh error", U_MISSING_RESOURCE_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    // Preflight.
+    assertEquals("preflight", 1, cache.getStatistics(NULL, 0, status));
+    assertEquals("preflight status", U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    UCacheTypeStatistics stats[2];
+    assertEquals("types", 1, cache.getStatistics(stats, UPRV_LENGTHOF(stats), status));
+    assertSuccess("getStatistics", status);
+    assertEquals("typeName", typeid(UCTItem).name(), stats[0].typeName);
+    assertEquals("hits", (int64_t)3, stats[0].hits);
+    assertEquals("misses", (int64_t)3, stats[0].misses);
+    assertEquals("inProgressWaits", (int64_t)0, stats[0].inProgressWaits);
+    assertEquals("evictions", (int64_t)0, stats[0].evictions);
+    assertTrue("creationMillis", stats[0].creationMillis >= 0.0);
+
+    // Evict everything once it is unused.
+    cache.setEvictionPolicy(0, 0, status);
+    en->removeRef();
+    enUS->removeRef();
+    assertEquals("keyCount", 0, cache.keyCount());
+    assertEquals("types after eviction", 1, cache.getStatistics(stats, UPRV_LENGTHOF(stats), status));
+    assertEquals("evictions after eviction", (int64_t)3, stats[0].evictions);
+    assertEquals("autoEvictedCount", (int64_t)3, cache.autoEvictedCount());
+
+    cache.resetStatistics();
+    assertEquals("types after reset", 1, cache.getStatistics(stats, UPRV_LENGTHOF(stats), status));
+    assertEquals("hits after reset", (int64_t)0, stats[0].hits);
+    assertEquals("misses after reset", (int64_t)0, stats[0].misses);
+    assertEquals("evictions after reset", (int64_t)0, stats[0].evictions);
+    assertSuccess("end", status);
+}
+
+static const char *const gWaitLocales[] = {
+    "aa", "ab", "ae", "af", "ak", "am", "an", "ar", "as", "av"
+};
+static const int32_t WAIT_THREADS = 8;
+static const int32_t WAIT_ROUNDS = 3;
+
+void UnifiedCacheTest::statisticsWaitsThread(int32_t /*threadNumber*/) {
+    for (int32_t round = 0; round < WAIT_ROUNDS; ++round) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(gWaitLocales); ++i) {
+            UErrorCode status = U_ZERO_ERROR;
+            const UCTSlowItem *item = NULL;
+            fCache->get(LocaleCacheKey<UCTSlowItem>(gWaitLocales[i]), item, status);
+            if (U_FAILURE(status)) {
+                dataerrln("get(%s) failed - %s", gWaitLocales[i], u_errorName(status));
+            }
+            SharedObject::clearPtr(item);
+        }
+    }
+}
+
+void UnifiedCacheTest::TestStatisticsWaits() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("", status);
+    // All threads get the same slow-to-create values in the same order,
+    // so that some of them wait while another one creates a value.
+    fCache = &cache;
+    ThreadPool<UnifiedCacheTest> threads(this, WAIT_THREADS, &UnifiedCacheTest::statisticsWaitsThread);
+    threads.start();
+    threads.join();
+    fCache = NULL;
+
+    // A get() that waited for another thread to create the value is counted
+    // only as a wait, not also as a hit.
+    UCacheTypeStatistics stats[2];
+    assertEquals("types", 1, cache.getStatistics(stats, UPRV_LENGTHOF(stats), status));
+    assertSuccess("getStatistics", status);
+    int64_t numLocales = UPRV_LENGTHOF(gWaitLocales);
+    assertEquals("misses", numLocales, stats[0].misses);
+    assertEquals("hits + inProgressWaits + misses",
+                 numLocales * WAIT_THREADS * WAIT_ROUNDS,
+                 stats[0].hits + stats[0].inProgressWaits + stats[0].misses);
+    logln("inProgressWaits: %ld", (long)stats[0].inProgressWaits);
+}
+
+void UnifiedCacheTest::TestStatisticsAPI() {
+    UErrorCode status = U_ZERO_ERROR;
+    CacheStatistics::reset(status);
+    const UCTItem *item = NULL;
+    UnifiedCache::getByLocale("fr", item, status);
+    UnifiedCache::getByLocale("fr", item, status);
+    SharedObject::clearPtr(item);
+    if (!assertSuccess("getByLocale", status)) {
+        return;
+    }
+
+    int32_t length = CacheStatistics::getStatistics(NULL, 0, status);
+    assertEquals("preflight status", U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+    LocalArray<UCacheTypeStatistics> stats(new UCacheTypeStatistics[length]);
+    LocalArray<UCacheTypeStatistics> cStats(new UCacheTypeStatistics[length]);
+    assertEquals("getStatistics()", length,
+                 CacheStatistics::getStatistics(stats.getAlias(), length, status));
+    assertEquals("ucache_getStatistics()", length,
+                 ucache_getStatistics(cStats.getAlias(), length, &status));
+    assertSuccess("getStatistics", status);
+    UBool found = FALSE;
+    for (int32_t i = 0; i < length; ++i) {
+        if (uprv_strcmp(stats[i].typeName, typeid(UCTItem).name()) == 0) {
+            found = TRUE;
+            assertEquals("UCTItem hits + misses", (int64_t)2, stats[i].hits + stats[i].misses);
+        }
+    }
+    assertTrue("UCTItem statistics", found);
+
+    ucache_resetStatistics(&status);
+    assertSuccess("ucache_resetStatistics", status);
+    length = CacheStatistics::getStatistics(stats.getAlias(), length, status);
+    assertSuccess("getStatistics after reset", status);
+    for (int32_t i = 0; i < length; ++i) {
+        if (stats[i].hits != 0 || stats[i].misses != 0) {
+            errln("%s has nonzero counts after reset", stats[i].typeName);
+        }
+    }
+}
+
 extern IntlTest *createUnifiedCacheTest() {
     return new UnifiedCacheTest();
 }
@@ -19,6 +19,8 @@
 #include "unicode/utf16.h"
 #include "unicode/ustring.h"
 #include "unicode/uchriter.h"
+#include "unicode/normalizer2.h"
+#include "unicode/regex.h"
 #include "cmemory.h"
 #include "cstr.h"
 #include "utxttest.h"
@@ -61,6 +63,7 @@ UTextTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(Ticket10983);
     TESTCASE_AUTO(Ticket12130);
     TESTCASE_AUTO(Ticket13344);
+    TESTCASE_AUTO(NormalizedTextTest);
     TESTCASE_AUTO_END;
 }
 
@@ -278,7 +281,40 @@ void UTextTest::TestString(const UnicodeString &s) {
     TestAccess(sa, ut, cpCount, u8Map);
     utext_close(ut);
 
+#if !UCONFIG_NO_NORMALIZATION
+    //
+    // Normalized text test.
+    //   The native indexes are UTF-16 indexes in the normalized text.
+    //
+    status = U_ZERO_ERROR;
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(status);
+    if (U_SUCCESS(status)) {
+        UnicodeString nfdString = nfd->normalize(sa, status);
+        m *nfdMap = new m[nfdString.length() + 1];
+        int32_t nfdCpCount = 0;
+        for (i=0; i<nfdString.length(); i=nfdString.moveIndex32(i, 1)) {
+            nfdMap[nfdCpCount].nativeIdx = i;
+            nfdMap[nfdCpCount].cp = nfdString.char32At(i);
+            nfdCpCount++;
+        }
+        nfdMap[nfdCpCount].nativeIdx = i;
 
+        UText *src = utext_openUnicodeString(NULL, &sa, &status);
+        ut = utext_openNormalized(NULL, src, reinterpret_cast<const UNormalizer2 *>(nfd), &status);
+        TEST_SUCCESS(status);
+        TestAccess(nfdString, ut, nfdCpCount, nfdMap);
+        utext_close(ut);
+        utext_close(src);
+
+        src = utext_openUTF8(NULL, u8String, -1, &status);
+        ut = utext_openNormalized(NULL, src, reinterpret_cast<const UNormalizer2 *>(nfd), &status);
+        TEST_SUCCESS(status);
+        TestAccess(nfdString, ut, nfdCpCount, nfdMap);
+        utext_close(ut);
+        utext_close(src);
+        delete []nfdMap;
+    }
+#endif
 
     delete []cpMap;
     delete []u8Map;
@@ -1605,3 +1641,58 @@ void UTextTest::Ticket13344() {
     assertEquals("UTextTest::Ticket13344-bmp-2", (int64_t)5, utext_getNativeIndex(ut.getAlias()));
 }
 
+// Normalized UText over UTF-8 source text: index mapping, and regular expressions
+// matching the normalized form.
+void UTextTest::NormalizedTextTest() {
+#if !UCONFIG_NO_NORMALIZATION
+    IcuTestErrorCode errorCode(*this, "NormalizedTextTest");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkcCF = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if (errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() etc. call failed")) {
+        return;
+    }
+    // "re\u0301sume\u0301 \uFB01LE"
+    const char *s8 = "re\xcc\x81sume\xcc\x81 \xef\xac\x81LE";
+    LocalUTextPointer src(utext_openUTF8(NULL, s8, -1, errorCode));
+    LocalUTextPointer ut(utext_openNormalized(
+        NULL, src.getAlias(), reinterpret_cast<const UNormalizer2 *>(nfc), errorCode));
+    errorCode.assertSuccess();
+    assertTrue("length is expensive", utext_isLengthExpensive(ut.getAlias()));
+    assertEquals("NFC length", (int64_t)10, utext_nativeLength(ut.getAlias()));
+    UChar buffer[20];
+    int32_t length = utext_extract(ut.getAlias(), 0, 10, buffer, UPRV_LENGTHOF(buffer), errorCode);
+    assertEquals("NFC text", u"r\u00e9sum\u00e9 \uFB01LE", UnicodeString(buffer, length));
+    // NFC index -> UTF-8 source index
+    static const int32_t sourceIndexes[] = { 0, 1, 4, 5, 6, 7, 10, 11, 14, 15, 16 };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(sourceIndexes); ++i) {
+        assertEquals("source index", (int64_t)sourceIndexes[i],
+                     utext_getNormalizedSourceIndex(ut.getAlias(), i, errorCode));
+    }
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+    // The decomposed "sume\u0301" source text matches the precomposed pattern.
+    RegexMatcher matcher(u"sum\u00e9", 0, errorCode);
+    matcher.reset(ut.getAlias());
+    assertTrue("find", matcher.find(errorCode));
+    int64_t start = matcher.start64(errorCode);
+    int64_t end = matcher.end64(errorCode);
+    assertEquals("match start in source", (int64_t)4,
+                 utext_getNormalizedSourceIndex(ut.getAlias(), start, errorCode));
+    assertEquals("match end in source", (int64_t)10,
+                 utext_getNormalizedSourceIndex(ut.getAlias(), end, errorCode));
+
+    // Case-insensitive matching of the NFKC_Casefold form.
+    utext_openNormalized(ut.getAlias(), src.getAlias(),
+                         reinterpret_cast<const UNormalizer2 *>(nfkcCF), errorCode);
+    RegexMatcher matcher2(u"filE", UREGEX_CASE_INSENSITIVE, errorCode);
+    matcher2.reset(ut.getAlias());
+    assertTrue("find NFKC_CF", matcher2.find(errorCode));
+    assertEquals("NFKC_CF match start in source", (int64_t)11,
+                 utext_getNormalizedSourceIndex(ut.getAlias(), matcher2.start64(errorCode), errorCode));
+#endif
+
+    // Not a normalized UText.
+    utext_getNormalizedSourceIndex(src.getAlias(), 0, errorCode);
+    assertEquals("not normalized", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+#endif
+}
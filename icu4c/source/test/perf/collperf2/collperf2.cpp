@@ -14,6 +14,9 @@
 #include "unicode/uperf.h"
 #include "unicode/ucol.h"
 #include "unicode/coll.h"
+#include "unicode/colsession.h"
+#include "unicode/normalizer2.h"
+#include "unicode/tblcoll.h"
 #include "unicode/uiter.h"
 #include "unicode/ustring.h"
 #include "unicode/sortkey.h"
@@ -328,6 +331,145 @@ long GetSortKey::getOperationsPerIteration()
     return source->count;
 }
 
+//
+// Test case taking a single test data array, calling ucol_getSortKeys once
+// for all of the strings, for comparison with the GetSortKey loop
+//
+class GetSortKeys : public UPerfFunction
+{
+public:
+    GetSortKeys(const UCollator* coll, const CA_uchar* source, UErrorCode &status);
+    ~GetSortKeys();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    const UCollator *coll;
+    const CA_uchar *source;
+    const UChar **strings;
+    int32_t *lengths;
+    int32_t *offsets;
+    uint8_t *keys;
+    int32_t keysCapacity;
+};
+
+GetSortKeys::GetSortKeys(const UCollator* coll, const CA_uchar* source, UErrorCode &status)
+    :   coll(coll),
+        source(source),
+        strings(NULL),
+        lengths(NULL),
+        offsets(NULL),
+        keys(NULL),
+        keysCapacity(0)
+{
+    if (U_FAILURE(status)) return;
+    strings = new const UChar *[source->count];
+    lengths = new int32_t[source->count];
+    offsets = new int32_t[source->count + 1];
+    for (int32_t i = 0; i < source->count; i++) {
+        strings[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+    // Preflight once so that the timed calls do not overflow.
+    UErrorCode preflightStatus = U_ZERO_ERROR;
+    keysCapacity = ucol_getSortKeys(coll, strings, lengths, source->count,
+                                    NULL, 0, offsets, &preflightStatus);
+    if (preflightStatus != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(preflightStatus)) {
+        status = preflightStatus;
+        return;
+    }
+    keys = new uint8_t[keysCapacity > 0 ? keysCapacity : 1];
+}
+
+GetSortKeys::~GetSortKeys()
+{
+    delete[] strings;
+    delete[] lengths;
+    delete[] offsets;
+    delete[] keys;
+}
+
+void GetSortKeys::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_getSortKeys(coll, strings, lengths, source->count, keys, keysCapacity, offsets, status);
+}
+
+long GetSortKeys::getOperationsPerIteration()
+{
+    return source->count;
+}
+
+//
+// Test case taking a single test data array in UTF-8, calling ucol_getSortKeysUTF8 once
+// for all of the strings
+//
+class GetSortKeysUTF8 : public UPerfFunction
+{
+public:
+    GetSortKeysUTF8(const UCollator* coll, const CA_char* source, UErrorCode &status);
+    ~GetSortKeysUTF8();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    const UCollator *coll;
+    const CA_char *source;
+    const char **strings;
+    int32_t *lengths;
+    int32_t *offsets;
+    uint8_t *keys;
+    int32_t keysCapacity;
+};
+
+GetSortKeysUTF8::GetSortKeysUTF8(const UCollator* coll, const CA_char* source, UErrorCode &status)
+    :   coll(coll),
+        source(source),
+        strings(NULL),
+        lengths(NULL),
+        offsets(NULL),
+        keys(NULL),
+        keysCapacity(0)
+{
+    if (U_FAILURE(status)) return;
+    strings = new const char *[source->count];
+    lengths = new int32_t[source->count];
+    offsets = new int32_t[source->count + 1];
+    for (int32_t i = 0; i < source->count; i++) {
+        strings[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+    UErrorCode preflightStatus = U_ZERO_ERROR;
+    keysCapacity = ucol_getSortKeysUTF8(coll, strings, lengths, source->count,
+                                        NULL, 0, offsets, &preflightStatus);
+    if (preflightStatus != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(preflightStatus)) {
+        status = preflightStatus;
+        return;
+    }
+    keys = new uint8_t[keysCapacity > 0 ? keysCapacity : 1];
+}
+
+GetSortKeysUTF8::~GetSortKeysUTF8()
+{
+    delete[] strings;
+    delete[] lengths;
+    delete[] offsets;
+    delete[] keys;
+}
+
+void GetSortKeysUTF8::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_getSortKeysUTF8(coll, strings, lengths, source->count, keys, keysCapacity, offsets, status);
+}
+
+long GetSortKeysUTF8::getOperationsPerIteration()
+{
+    return source->count;
+}
+
 //
 // Test case taking a single test data array in UTF-16, calling ucol_nextSortKeyPart for each for the
 // given buffer size
@@ -841,6 +983,50 @@ void UniStrSort::call(UErrorCode* status) {
     ops = cc.counter;
 }
 
+//
+// Test case sorting a whole array of strings via ucol_sortStrings(),
+// which sorts by sort keys, on numThreads threads (0=one per processor).
+//
+class SortStrings : public CollPerfFunction {
+public:
+    SortStrings(const Collator& coll, const UCollator *ucoll, const CA_uchar* data16,
+                int32_t numThreads);
+    virtual ~SortStrings();
+    virtual void call(UErrorCode* status);
+
+private:
+    const CA_uchar* d16;
+    int32_t numThreads;
+    const UChar **strings;
+    int32_t *lengths;
+    int32_t *indexes;
+};
+
+SortStrings::SortStrings(const Collator& coll, const UCollator *ucoll, const CA_uchar* data16,
+                         int32_t numThreads)
+        : CollPerfFunction(coll, ucoll), d16(data16), numThreads(numThreads),
+          strings(new const UChar *[d16->count]),
+          lengths(new int32_t[d16->count]),
+          indexes(new int32_t[d16->count]) {
+    for (int32_t i = 0; i < d16->count; ++i) {
+        strings[i] = d16->dataOf(i);
+        lengths[i] = d16->lengthOf(i);
+    }
+}
+
+SortStrings::~SortStrings() {
+    delete[] strings;
+    delete[] lengths;
+    delete[] indexes;
+}
+
+void SortStrings::call(UErrorCode* status) {
+    if (U_FAILURE(*status)) return;
+
+    ucol_sortStrings(ucoll, strings, lengths, d16->count, indexes, numThreads, status);
+    ops = d16->count;
+}
+
 namespace {
 
 int32_t U_CALLCONV
@@ -950,6 +1136,54 @@ void StringPieceSortC::call(UErrorCode* status) {
     ops = cc.counter;
 }
 
+//
+// Test case sorting an array of UTF-8 StringPiece's with Collator::compareUTF8()
+// and a collator that checks for FCD:
+// If all of the strings pass a one-time FCD check,
+// then they are sorted with a clone that has normalization turned off.
+// (This assumes that the text contains no Tibetan composite vowels
+// which the collator decomposes even in FCD text.)
+//
+class StringPieceSortCppFCDChecked : public StringPieceSort {
+public:
+    StringPieceSortCppFCDChecked(const Collator& coll, const UCollator *ucoll, const CA_char* data8,
+                                 UErrorCode &status)
+            : StringPieceSort(coll, ucoll, data8),
+              fcd(Normalizer2::getInstance(NULL, "nfc", UNORM2_FCD, status)),
+              noNormColl(coll.clone()) {
+        if (U_SUCCESS(status)) {
+            if (noNormColl.isNull()) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            } else {
+                noNormColl->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_OFF, status);
+            }
+        }
+    }
+    virtual ~StringPieceSortCppFCDChecked();
+    virtual void call(UErrorCode* status);
+
+private:
+    const Normalizer2 *fcd;
+    LocalPointer<Collator> noNormColl;
+};
+
+StringPieceSortCppFCDChecked::~StringPieceSortCppFCDChecked() {}
+
+void StringPieceSortCppFCDChecked::call(UErrorCode* status) {
+    if (U_FAILURE(*status)) return;
+
+    int32_t count = d8->count;
+    UBool allFCD = TRUE;
+    for (int32_t i = 0; allFCD && i < count; ++i) {
+        allFCD = fcd->isNormalizedUTF8(source[i], *status);
+    }
+    CollatorAndCounter cc(allFCD ? *noNormColl : coll);
+    memcpy(dest, source, count * sizeof(StringPiece));
+    uprv_sortArray(dest, count, (int32_t)sizeof(StringPiece),
+                   StringPieceCollatorComparator, &cc, TRUE, status);
+    ops = cc.counter;
+}
+
 //
 // Test case performing binary searches in a sorted array of UnicodeString pointers.
 //
@@ -976,6 +1210,46 @@ void UniStrBinSearch::call(UErrorCode* status) {
     ops = cc.counter;
 }
 
+//
+// Test case performing binary searches in a sorted array of UnicodeString pointers
+// with a UCollationComparand, which collates each search key only once.
+//
+class UniStrBinSearchComparand : public UniStrCollPerfFunction {
+public:
+    UniStrBinSearchComparand(const Collator& coll, const UCollator *ucoll, const CA_uchar* data16)
+            : UniStrCollPerfFunction(coll, ucoll, data16) {}
+    virtual ~UniStrBinSearchComparand();
+    virtual void call(UErrorCode* status);
+};
+
+UniStrBinSearchComparand::~UniStrBinSearchComparand() {}
+
+void UniStrBinSearchComparand::call(UErrorCode* status) {
+    if (U_FAILURE(*status)) return;
+
+    int32_t counter = 0;
+    int32_t count = d16->count;
+    for (int32_t i = 0; i < count; ++i) {
+        LocalUCollationComparandPointer comparand(
+            ucol_openComparand(ucoll, source[i]->getBuffer(), source[i]->length(), status));
+        if (U_FAILURE(*status)) return;
+        // Upper-bound binary search; the search key is always the left string.
+        int32_t start = 0, limit = count;
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+            const UnicodeString &s = *source[mid];
+            ++counter;
+            if (ucol_compareComparand(comparand.getAlias(),
+                                      s.getBuffer(), s.length(), status) < 0) {
+                limit = mid;
+            } else {
+                start = mid + 1;
+            }
+        }
+    }
+    ops = counter;
+}
+
 class StringPieceBinSearch : public StringPieceCollPerfFunction {
 public:
     StringPieceBinSearch(const Collator& coll, const UCollator *ucoll, const CA_char* data8)
@@ -1039,6 +1313,59 @@ void StringPieceBinSearchC::call(UErrorCode* status) {
     ops = cc.counter;
 }
 
+namespace {
+
+struct SessionAndCounter {
+    SessionAndCounter(CollationCompareSession &session) : session(session), counter(0) {}
+    CollationCompareSession &session;
+    int32_t counter;
+};
+
+int32_t U_CALLCONV
+StringPieceSessionComparator(const void* context, const void* left, const void* right) {
+    SessionAndCounter& sc = *(SessionAndCounter*)context;
+    const StringPiece& leftString = *(const StringPiece*)left;
+    const StringPiece& rightString = *(const StringPiece*)right;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    ++sc.counter;
+    return sc.session.compareUTF8(leftString, rightString, errorCode);
+}
+
+}  // namespace
+
+//
+// Test case performing binary searches in a sorted array of UTF-8 StringPiece's
+// with a CollationCompareSession, which collates each search key only once.
+//
+class StringPieceBinSearchSession : public StringPieceBinSearch {
+public:
+    StringPieceBinSearchSession(const Collator& coll, const UCollator *ucoll, const CA_char* data8)
+            : StringPieceBinSearch(coll, ucoll, data8) {}
+    virtual ~StringPieceBinSearchSession();
+    virtual void call(UErrorCode* status);
+};
+
+StringPieceBinSearchSession::~StringPieceBinSearchSession() {}
+
+void StringPieceBinSearchSession::call(UErrorCode* status) {
+    if (U_FAILURE(*status)) return;
+
+    const RuleBasedCollator *rbc = dynamic_cast<const RuleBasedCollator *>(&coll);
+    if (rbc == NULL) {
+        *status = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    CollationCompareSession session(*rbc, *status);
+    SessionAndCounter sc(session);
+    int32_t count = d8->count;
+    for (int32_t i = 0; i < count; ++i) {
+        (void)uprv_stableBinarySearch((char *)source, count,
+                                      source + i, (int32_t)sizeof(StringPiece),
+                                      StringPieceSessionComparator, &sc);
+    }
+    ops = sc.counter;
+}
+
 
 class CollPerf2Test : public UPerfTest
 {
@@ -1051,6 +1378,8 @@ class CollPerf2Test : public UPerfTest
 private:
     UCollator* coll;
     Collator* collObj;
+    // Same as collObj but with normalization (FCD checking) turned on.
+    Collator* normCollObj;
 
     int32_t count;
     CA_uchar* data16;
@@ -1094,6 +1423,9 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestGetSortKey();
     UPerfFunction* TestGetSortKeyNull();
 
+    UPerfFunction* TestGetSortKeys();
+    UPerfFunction* TestGetSortKeysUTF8();
+
     UPerfFunction* TestNextSortKeyPart_4All();
     UPerfFunction* TestNextSortKeyPart_4x2();
     UPerfFunction* TestNextSortKeyPart_4x4();
@@ -1120,18 +1452,25 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestCppGetCollationKeyNull();
 
     UPerfFunction* TestUniStrSort();
+    UPerfFunction* TestSortStrings();
+    UPerfFunction* TestSortStringsSerial();
     UPerfFunction* TestStringPieceSortCpp();
     UPerfFunction* TestStringPieceSortC();
+    UPerfFunction* TestStringPieceSortCppNorm();
+    UPerfFunction* TestStringPieceSortCppFCDChecked();
 
     UPerfFunction* TestUniStrBinSearch();
+    UPerfFunction* TestUniStrBinSearchComparand();
     UPerfFunction* TestStringPieceBinSearchCpp();
     UPerfFunction* TestStringPieceBinSearchC();
+    UPerfFunction* TestStringPieceBinSearchSession();
 };
 
 CollPerf2Test::CollPerf2Test(int32_t argc, const char *argv[], UErrorCode &status) :
     UPerfTest(argc, argv, status),
     coll(NULL),
     collObj(NULL),
+    normCollObj(NULL),
     count(0),
     data16(NULL),
     data8(NULL),
@@ -1154,12 +1493,17 @@ CollPerf2Test::CollPerf2Test(int32_t argc, const char *argv[], UErrorCode &statu
     // Starting with ICU 54 (ticket #8260), this supports standard collation locale keywords.
     coll = ucol_open(locale, &status);
     collObj = Collator::createInstance(locale, status);
+    if (U_SUCCESS(status)) {
+        normCollObj = collObj->clone();
+        normCollObj->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, status);
+    }
 }
 
 CollPerf2Test::~CollPerf2Test()
 {
     ucol_close(coll);
     delete collObj;
+    delete normCollObj;
 
     delete data16;
     delete data8;
@@ -1403,6 +1747,9 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestGetSortKey);
     TESTCASE_AUTO(TestGetSortKeyNull);
 
+    TESTCASE_AUTO(TestGetSortKeys);
+    TESTCASE_AUTO(TestGetSortKeysUTF8);
+
     TESTCASE_AUTO(TestNextSortKeyPart_4All);
     TESTCASE_AUTO(TestNextSortKeyPart_4x4);
     TESTCASE_AUTO(TestNextSortKeyPart_4x8);
@@ -1427,12 +1774,18 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestCppGetCollationKeyNull);
 
     TESTCASE_AUTO(TestUniStrSort);
+    TESTCASE_AUTO(TestSortStrings);
+    TESTCASE_AUTO(TestSortStringsSerial);
     TESTCASE_AUTO(TestStringPieceSortCpp);
     TESTCASE_AUTO(TestStringPieceSortC);
+    TESTCASE_AUTO(TestStringPieceSortCppNorm);
+    TESTCASE_AUTO(TestStringPieceSortCppFCDChecked);
 
     TESTCASE_AUTO(TestUniStrBinSearch);
+    TESTCASE_AUTO(TestUniStrBinSearchComparand);
     TESTCASE_AUTO(TestStringPieceBinSearchCpp);
     TESTCASE_AUTO(TestStringPieceBinSearchC);
+    TESTCASE_AUTO(TestStringPieceBinSearchSession);
 
     TESTCASE_AUTO_END;
     return NULL;
@@ -1528,6 +1881,28 @@ UPerfFunction* CollPerf2Test::TestGetSortKeyNull()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestGetSortKeys()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    GetSortKeys *testCase = new GetSortKeys(coll, getData16(status), status);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeysUTF8()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    GetSortKeysUTF8 *testCase = new GetSortKeysUTF8(coll, getData8(status), status);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPart_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -1736,6 +2111,26 @@ UPerfFunction* CollPerf2Test::TestUniStrSort() {
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestSortStrings() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new SortStrings(*collObj, coll, getRandomData16(status), 0);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestSortStringsSerial() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new SortStrings(*collObj, coll, getRandomData16(status), 1);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestStringPieceSortCpp() {
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction *testCase = new StringPieceSortCpp(*collObj, coll, getRandomData8(status));
@@ -1756,6 +2151,30 @@ UPerfFunction* CollPerf2Test::TestStringPieceSortC() {
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestStringPieceSortCppNorm() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new StringPieceSortCpp(*normCollObj, coll, getRandomData8(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestStringPieceSortCppFCDChecked() {
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *data8 = getRandomData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    UPerfFunction *testCase = new StringPieceSortCppFCDChecked(*normCollObj, coll, data8, status);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestUniStrBinSearch() {
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction *testCase = new UniStrBinSearch(*collObj, coll, getSortedData16(status));
@@ -1766,6 +2185,16 @@ UPerfFunction* CollPerf2Test::TestUniStrBinSearch() {
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestUniStrBinSearchComparand() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new UniStrBinSearchComparand(*collObj, coll, getSortedData16(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestStringPieceBinSearchCpp() {
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction *testCase = new StringPieceBinSearchCpp(*collObj, coll, getSortedData8(status));
@@ -1786,6 +2215,16 @@ UPerfFunction* CollPerf2Test::TestStringPieceBinSearchC() {
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestStringPieceBinSearchSession() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new StringPieceBinSearchSession(*collObj, coll, getSortedData8(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 
 int main(int argc, const char *argv[])
 {
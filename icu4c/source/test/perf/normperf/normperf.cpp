@@ -66,6 +66,12 @@ UPerfFunction* NormalizerPerformanceTest::runIndexedTest(int32_t index, UBool ex
         TESTCASE(31,TestIsNormalized_FCD_NFC_Text);
         TESTCASE(32,TestIsNormalized_FCD_Orig_Text);
 
+        TESTCASE(33,TestUTF8_NFC_NFC_Text);
+        TESTCASE(34,TestUTF8_NFC_Orig_Text);
+        TESTCASE(35,TestIsNormalizedUTF8_NFC_NFC_Text);
+        TESTCASE(36,TestIsNormalizedUTF8_NFC_Orig_Text);
+        TESTCASE(37,TestUTF8Parallel_NFC_Orig_Text);
+
         default: 
             name = ""; 
             return NULL;
@@ -494,6 +500,74 @@ UPerfFunction* NormalizerPerformanceTest::TestIsNormalized_FCD_Orig_Text(){
     }
 }
 
+// Test Normalizer2 UTF-8 performance
+static const icu::Normalizer2* getNFC(){
+    UErrorCode status = U_ZERO_ERROR;
+    const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(status);
+    if(U_FAILURE(status)){
+        fprintf(stderr, "FAILED to get the NFC instance. Error: %s\n", u_errorName(status));
+        return NULL;
+    }
+    return nfc;
+}
+
+UPerfFunction* NormalizerPerformanceTest::TestUTF8_NFC_NFC_Text(){
+    const icu::Normalizer2* nfc = getNFC();
+    if(nfc == NULL){
+        return NULL;
+    }
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, FALSE, NFCFileLines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, FALSE, NFCBuffer, NFCBufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestUTF8_NFC_Orig_Text(){
+    const icu::Normalizer2* nfc = getNFC();
+    if(nfc == NULL){
+        return NULL;
+    }
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, FALSE, lines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, FALSE, buffer, bufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestIsNormalizedUTF8_NFC_NFC_Text(){
+    const icu::Normalizer2* nfc = getNFC();
+    if(nfc == NULL){
+        return NULL;
+    }
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, TRUE, NFCFileLines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, TRUE, NFCBuffer, NFCBufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestIsNormalizedUTF8_NFC_Orig_Text(){
+    const icu::Normalizer2* nfc = getNFC();
+    if(nfc == NULL){
+        return NULL;
+    }
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, TRUE, lines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, TRUE, buffer, bufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestUTF8Parallel_NFC_Orig_Text(){
+    const icu::Normalizer2* nfc = getNFC();
+    if(nfc == NULL){
+        return NULL;
+    }
+    if(line_mode){
+        fprintf(stderr, "TestUTF8Parallel_NFC_Orig_Text needs the whole file: use -b\n");
+        return NULL;
+    }
+    // Default number of threads.
+    return new UTF8NormPerfFunction(nfc, FALSE, buffer, bufferLen, 0);
+}
+
 int main(int argc, const char* argv[]){
     UErrorCode status = U_ZERO_ERROR;
     NormalizerPerformanceTest test(argc, argv, status);
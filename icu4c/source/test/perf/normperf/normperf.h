@@ -13,6 +13,9 @@
 #define _NORMPERF_H
 
 #include "unicode/unorm.h"
+#include "unicode/normalizer2.h"
+#include "unicode/bytestream.h"
+#include "unicode/stringpiece.h"
 #include "unicode/ustring.h"
 
 #include "unicode/uperf.h"
@@ -175,7 +178,88 @@ class NormPerfFunction : public UPerfFunction{
         }
     }
 };
+/**
+ * Normalizer2 UTF-8 functions: normalizeUTF8() or isNormalizedUTF8(),
+ * or normalizeUTF8Parallel() if a thread count is given.
+ * The input is converted to UTF-8 when the function is created, not while it is timed.
+ */
+class UTF8NormPerfFunction : public UPerfFunction{
+private:
+    const icu::Normalizer2* norm2;
+    UBool checkOnly;
+    int32_t threadCount;  // -1: serial normalizeUTF8()
+    char** src8;
+    int32_t* src8Lengths;
+    int32_t numStrings;
+    int32_t numChars;  // UTF-16 length of the input
+    char* dest;
+    int32_t destCapacity;
+    UBool retVal;
+
+    void addString(int32_t i, const UChar* s, int32_t length) {
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t length8 = 0;
+        u_strToUTF8(NULL, 0, &length8, s, length, &status);
+        src8[i] = (char*) malloc(length8 + 1);
+        status = U_ZERO_ERROR;
+        u_strToUTF8(src8[i], length8 + 1, &length8, s, length, &status);
+        src8Lengths[i] = length8;
+        numChars += length;
+        if(length8 * 3 > destCapacity) {
+            destCapacity = length8 * 3;
+        }
+    }
+    void allocate(int32_t count) {
+        numStrings = count;
+        src8 = (char**) malloc(count * sizeof(char*));
+        src8Lengths = (int32_t*) malloc(count * sizeof(int32_t));
+        numChars = 0;
+        destCapacity = 0;
+        retVal = FALSE;
+    }
 
+public:
+    virtual void call(UErrorCode* status){
+        for(int32_t i = 0; i < numStrings; i++){
+            icu::StringPiece s(src8[i], src8Lengths[i]);
+            if(checkOnly){
+                retVal = norm2->isNormalizedUTF8(s, *status);
+            }else if(threadCount >= 0){
+                icu::CheckedArrayByteSink sink(dest, destCapacity);
+                norm2->normalizeUTF8Parallel(s, sink, threadCount, *status);
+            }else{
+                icu::CheckedArrayByteSink sink(dest, destCapacity);
+                norm2->normalizeUTF8(0, s, sink, NULL, *status);
+            }
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return numChars;
+    }
+    UTF8NormPerfFunction(const icu::Normalizer2* n2, UBool _checkOnly, ULine* srcLines, int32_t srcNumLines)
+            : norm2(n2), checkOnly(_checkOnly), threadCount(-1) {
+        allocate(srcNumLines);
+        for(int32_t i = 0; i < srcNumLines; i++){
+            addString(i, srcLines[i].name, srcLines[i].len);
+        }
+        dest = (char*) malloc(destCapacity + 1);
+    }
+    UTF8NormPerfFunction(const icu::Normalizer2* n2, UBool _checkOnly, const UChar* source, int32_t sourceLen,
+                         int32_t _threadCount = -1)
+            : norm2(n2), checkOnly(_checkOnly), threadCount(_threadCount) {
+        allocate(1);
+        addString(0, source, sourceLen);
+        dest = (char*) malloc(destCapacity + 1);
+    }
+    ~UTF8NormPerfFunction(){
+        for(int32_t i = 0; i < numStrings; i++){
+            free(src8[i]);
+        }
+        free(src8);
+        free(src8Lengths);
+        free(dest);
+    }
+};
 
 
 class  NormalizerPerformanceTest : public UPerfTest{
@@ -249,6 +333,13 @@ class  NormalizerPerformanceTest : public UPerfTest{
     UPerfFunction* TestIsNormalized_FCD_NFC_Text();
     UPerfFunction* TestIsNormalized_FCD_Orig_Text();
 
+    /* UTF-8 performance, mostly the fast path for already-normalized text */
+    UPerfFunction* TestUTF8_NFC_NFC_Text();
+    UPerfFunction* TestUTF8_NFC_Orig_Text();
+    UPerfFunction* TestIsNormalizedUTF8_NFC_NFC_Text();
+    UPerfFunction* TestIsNormalizedUTF8_NFC_Orig_Text();
+    UPerfFunction* TestUTF8Parallel_NFC_Orig_Text();
+
 };
 
 //---------------------------------------------------------------------------------------
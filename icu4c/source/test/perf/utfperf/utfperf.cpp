@@ -38,6 +38,7 @@ static UChar pivot[INTERMEDIATE_CAPACITY];
 
 static UChar output[OUTPUT_CAPACITY];
 static char intermediate[OUTPUT_CAPACITY];
+static char encoded[OUTPUT_CAPACITY];
 
 static int32_t utf8Length, encodedLength, outputLength, countInputCodePoints;
 
@@ -119,7 +120,7 @@ fromUCallback(const void *context,
 }
 U_CDECL_END
 
-// Base class for Roundtrip, FromUnicode and FromUTF8 with common setup.
+// Base class for Roundtrip, FromUnicode, ToUnicode and FromUTF8 with common setup.
 class Command : public UPerfFunction {
 protected:
     Command(const UtfPerformanceTest &testcase)
@@ -262,6 +263,59 @@ class FromUnicode : public Command {
     }
 };
 
+// Test one-way conversion encoding->UTF-16,
+// with the encoded input passed in chunks of --chunk bytes.
+class ToUnicode : public Command {
+protected:
+    ToUnicode(const UtfPerformanceTest &testcase) : Command(testcase), encodedInputLength(0) {
+        if (U_SUCCESS(errorCode)) {
+            encodedInputLength=ucnv_fromUChars(cnv, encoded, (int32_t)sizeof(encoded),
+                                               input, inputLength, &errorCode);
+        }
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        ToUnicode * t = new ToUnicode(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        const char *pIn, *pInLimit, *pChunkLimit;
+        UChar *pOut, *pOutLimit;
+        UBool flush;
+
+        ucnv_resetToUnicode(cnv);
+
+        pIn=encoded;
+        pInLimit=encoded+encodedInputLength;
+
+        pOut=output;
+        pOutLimit=output+OUTPUT_CAPACITY;
+
+        do {
+            if((pInLimit-pIn)>testcase.chunkLength) {
+                pChunkLimit=pIn+testcase.chunkLength;
+                flush=FALSE;
+            } else {
+                pChunkLimit=pInLimit;
+                flush=TRUE;
+            }
+            ucnv_toUnicode(cnv, &pOut, pOutLimit, &pIn, pChunkLimit, NULL, flush, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                return;
+            }
+        } while(!flush);
+
+        outputLength=(int32_t)(pOut-output);
+    }
+protected:
+    int32_t encodedInputLength;
+};
+
 // Test one-way conversion UTF-8->encoding.
 class FromUTF8 : public Command {
 protected:
@@ -328,11 +382,74 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test one-way conversion encoding->UTF-8,
+// with the encoded input converted into chunks of --chunk bytes.
+class ToUTF8 : public ToUnicode {
+protected:
+    ToUTF8(const UtfPerformanceTest &testcase) : ToUnicode(testcase), utf8Cnv(NULL) {
+        utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        ToUTF8 * t = new ToUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    ~ToUTF8() {
+        ucnv_close(utf8Cnv);
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        const char *pIn, *pInLimit;
+        char *pInter, *pInterLimit;
+        UChar *pivotSource, *pivotTarget, *pivotLimit;
+
+        ucnv_resetToUnicode(cnv);
+        ucnv_resetFromUnicode(utf8Cnv);
+
+        pIn=encoded;
+        pInLimit=encoded+encodedInputLength;
+
+        pInterLimit=intermediate+testcase.chunkLength;
+
+        pivotSource=pivotTarget=pivot;
+        pivotLimit=pivot+testcase.pivotLength;
+
+        outputLength=0;
+
+        for(;;) {
+            pInter=intermediate;
+            ucnv_convertEx(utf8Cnv, cnv,
+                           &pInter, pInterLimit,
+                           &pIn, pInLimit,
+                           pivot, &pivotSource, &pivotTarget, pivotLimit,
+                           FALSE, TRUE, pErrorCode);
+            outputLength+=(int32_t)(pInter-intermediate);
+
+            if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+                /* make sure that we convert once more to really flush */
+                *pErrorCode=U_ZERO_ERROR;
+            } else if(U_FAILURE(*pErrorCode)) {
+                return;
+            } else {
+                break;  // all done
+            }
+        }
+    }
+protected:
+    UConverter *utf8Cnv;
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "ToUnicode";     if (exec) return ToUnicode::get(*this); break;
+        case 4: name = "ToUTF8";        if (exec) return ToUTF8::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
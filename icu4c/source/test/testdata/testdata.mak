@@ -164,4 +164,4 @@ $(TEST_RES_FILES:.res =.res
 # Target for test normalization data
 "$(TESTDATABLD)\testnorm.nrm": "$(TESTDATA)\testnorm.txt"
 	@echo Building $@
-	@"$(ICUTOOLS)\gennorm2\$(CFG)\gennorm2" -s "$(TESTDATA)" testnorm.txt -o $@
+	@"$(ICUTOOLS)\gennorm2\$(CFG)\gennorm2" -s "$(TESTDATA)" testnorm.txt -o $@ --canoniterdata
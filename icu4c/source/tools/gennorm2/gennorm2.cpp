@@ -62,7 +62,8 @@ enum {
     UNICODE_VERSION,
     WRITE_C_SOURCE,
     WRITE_COMBINED_DATA,
-    OPT_FAST
+    OPT_FAST,
+    CANON_ITER_DATA
 };
 
 static UOption options[]={
@@ -75,7 +76,8 @@ static UOption options[]={
     UOPTION_DEF("unicode", 'u', UOPT_REQUIRES_ARG),
     UOPTION_DEF("csource", '\1', UOPT_NO_ARG),
     UOPTION_DEF("combined", '\1', UOPT_NO_ARG),
-    UOPTION_DEF("fast", '\1', UOPT_NO_ARG)
+    UOPTION_DEF("fast", '\1', UOPT_NO_ARG),
+    UOPTION_DEF("canoniterdata", '\1', UOPT_NO_ARG)
 };
 
 extern "C" int
@@ -132,6 +134,9 @@ main(int argc, char* argv[]) {
             "\t                    regular mappings instead of delta mappings.\n"
             "\t                    You should measure the runtime speed to make sure that\n"
             "\t                    this is a good trade-off.)\n");
+        fprintf(stderr,
+            "\t      --canoniterdata  also write precomputed CanonicalIterator data\n"
+            "\t                    (for NFC) so that it need not be built at runtime\n");
         return argc<0 ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
 
@@ -167,6 +172,10 @@ main(int argc, char* argv[]) {
         builder->setOptimization(Normalizer2DataBuilder::OPTIMIZE_FAST);
     }
 
+    if(options[CANON_ITER_DATA].doesOccur) {
+        builder->setWriteCanonIterData(TRUE);
+    }
+
     // prepare the filename beginning with the source dir
     CharString filename(options[SOURCEDIR].value, errorCode);
     int32_t pathLength=filename.length();
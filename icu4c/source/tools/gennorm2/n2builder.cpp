@@ -95,7 +95,9 @@ const HangulIterator::Range HangulIterator::ranges[4]={
 Normalizer2DataBuilder::Normalizer2DataBuilder(UErrorCode &errorCode) :
         norms(errorCode),
         phase(0), overrideHandling(OVERRIDE_PREVIOUS), optimization(OPTIMIZE_NORMAL),
-        norm16TrieBytes(nullptr), norm16TrieLength(0) {
+        writeCanonIterData(FALSE),
+        norm16TrieBytes(nullptr), norm16TrieLength(0),
+        canonTrieBytes(nullptr), canonTrieLength(0) {
     memset(unicodeVersion, 0, sizeof(unicodeVersion));
     memset(indexes, 0, sizeof(indexes));
     memset(smallFCD, 0, sizeof(smallFCD));
@@ -103,6 +105,7 @@ Normalizer2DataBuilder::Normalizer2DataBuilder(UErrorCode &errorCode) :
 
 Normalizer2DataBuilder::~Normalizer2DataBuilder() {
     delete[] norm16TrieBytes;
+    delete[] canonTrieBytes;
 }
 
 void
@@ -736,6 +739,30 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
     ucptrie_toBinary(builtTrie.getAlias(), norm16TrieBytes, norm16TrieLength, errorCode);
     errorCode.assertSuccess();
 
+    if(writeCanonIterData) {
+        // Build the CanonicalIterator data with the runtime code,
+        // from the normalization data that we just built.
+        Normalizer2Impl impl;
+        impl.init(indexes, builtTrie.getAlias(),
+                  reinterpret_cast<const uint16_t *>(extraData.getBuffer()), smallFCD);
+        canonTrie.adoptInstead(impl.buildCanonIterData(canonStartSets, errorCode));
+        if(errorCode.isFailure()) {
+            fprintf(stderr, "gennorm2 error: unable to build the CanonicalIterator data - %s\n",
+                    errorCode.errorName());
+            exit(errorCode.reset());
+        }
+        canonTrieLength=ucptrie_toBinary(canonTrie.getAlias(), nullptr, 0, errorCode);
+        if(errorCode.get()!=U_BUFFER_OVERFLOW_ERROR) {
+            fprintf(stderr, "gennorm2 error: unable to serialize the CanonicalIterator trie - %s\n",
+                    errorCode.errorName());
+            exit(errorCode.reset());
+        }
+        errorCode.reset();
+        canonTrieBytes=new uint8_t[canonTrieLength];
+        ucptrie_toBinary(canonTrie.getAlias(), canonTrieBytes, canonTrieLength, errorCode);
+        errorCode.assertSuccess();
+    }
+
     int32_t offset=(int32_t)sizeof(indexes);
     indexes[Normalizer2Impl::IX_NORM_TRIE_OFFSET]=offset;
     offset+=norm16TrieLength;
@@ -743,8 +770,15 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
     offset+=extraData.length()*2;
     indexes[Normalizer2Impl::IX_SMALL_FCD_OFFSET]=offset;
     offset+=sizeof(smallFCD);
+    if(canonTrieLength>0) {
+        offset=(offset+3)&~3;  // The canonTrie must be 4-aligned.
+    }
+    indexes[Normalizer2Impl::IX_CANON_TRIE_OFFSET]=offset;
+    offset+=canonTrieLength;
+    indexes[Normalizer2Impl::IX_CANON_START_SETS_OFFSET]=offset;
+    offset+=canonStartSets.length()*2;
     int32_t totalSize=offset;
-    for(int32_t i=Normalizer2Impl::IX_RESERVED3_OFFSET; i<=Normalizer2Impl::IX_TOTAL_SIZE; ++i) {
+    for(int32_t i=Normalizer2Impl::IX_RESERVED5_OFFSET; i<=Normalizer2Impl::IX_TOTAL_SIZE; ++i) {
         indexes[i]=totalSize;
     }
 
@@ -752,6 +786,8 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
         printf("size of normalization trie:         %5ld bytes\n", (long)norm16TrieLength);
         printf("size of 16-bit extra data:          %5ld uint16_t\n", (long)extraData.length());
         printf("size of small-FCD data:             %5ld bytes\n", (long)sizeof(smallFCD));
+        printf("size of CanonicalIterator trie:     %5ld bytes\n", (long)canonTrieLength);
+        printf("size of canonical start sets:       %5ld uint16_t\n", (long)canonStartSets.length());
         printf("size of binary data file contents:  %5ld bytes\n", (long)totalSize);
         printf("minDecompNoCodePoint:              U+%04lX\n", (long)indexes[Normalizer2Impl::IX_MIN_DECOMP_NO_CP]);
         printf("minCompNoMaybeCodePoint:           U+%04lX\n", (long)indexes[Normalizer2Impl::IX_MIN_COMP_NO_MAYBE_CP]);
@@ -791,6 +827,13 @@ void Normalizer2DataBuilder::writeBinaryFile(const char *filename) {
     udata_writeBlock(pData, norm16TrieBytes, norm16TrieLength);
     udata_writeUString(pData, toUCharPtr(extraData.getBuffer()), extraData.length());
     udata_writeBlock(pData, smallFCD, sizeof(smallFCD));
+    if(canonTrieLength>0) {
+        udata_writePadding(pData,
+            indexes[Normalizer2Impl::IX_CANON_TRIE_OFFSET]-
+            (indexes[Normalizer2Impl::IX_SMALL_FCD_OFFSET]+(int32_t)sizeof(smallFCD)));
+        udata_writeBlock(pData, canonTrieBytes, canonTrieLength);
+        udata_writeUString(pData, toUCharPtr(canonStartSets.getBuffer()), canonStartSets.length());
+    }
     int32_t writtenSize=udata_finish(pData, errorCode);
     if(errorCode.isFailure()) {
         fprintf(stderr, "gennorm2: error %s writing the output file\n", errorCode.errorName());
@@ -842,6 +885,16 @@ Normalizer2DataBuilder::writeCSourceFile(const char *filename) {
     sprintf(line, "static const uint8_t %s_smallFCD[%%ld]={\n", name);
     usrc_writeArray(f, line, smallFCD, 8, sizeof(smallFCD), "\n};\n\n");
 
+    if(canonTrie.isValid()) {
+        CharString canonName(name, errorCode);
+        canonName.append("_canonIter", errorCode);
+        errorCode.assertSuccess();
+        usrc_writeUCPTrie(f, canonName.data(), canonTrie.getAlias());
+        sprintf(line, "static const uint16_t %s_canonStartSets[%%ld]={\n", name);
+        usrc_writeArray(f, line, canonStartSets.getBuffer(), 16, canonStartSets.length(),
+                        "\n};\n\n");
+    }
+
     fputs("#endif  // INCLUDED_FROM_NORMALIZER2_CPP\n", f);
     fclose(f);
 }
@@ -54,6 +54,12 @@ class Normalizer2DataBuilder {
 
     void setOptimization(Optimization opt) { optimization=opt; }
 
+    /**
+     * Also precompute the CanonicalIterator data and write it into
+     * the binary or C source file.
+     */
+    void setWriteCanonIterData(UBool w) { writeCanonIterData=w; }
+
     void setCC(UChar32 c, uint8_t cc);
     void setOneWayMapping(UChar32 c, const UnicodeString &m);
     void setRoundTripMapping(UChar32 c, const UnicodeString &m);
@@ -105,6 +111,7 @@ class Normalizer2DataBuilder {
     OverrideHandling overrideHandling;
 
     Optimization optimization;
+    UBool writeCanonIterData;
 
     int32_t indexes[Normalizer2Impl::IX_COUNT];
     uint8_t *norm16TrieBytes;
@@ -112,6 +119,11 @@ class Normalizer2DataBuilder {
     UnicodeString extraData;
     uint8_t smallFCD[0x100];
 
+    LocalUCPTriePointer canonTrie;
+    uint8_t *canonTrieBytes;
+    int32_t canonTrieLength;
+    UnicodeString canonStartSets;
+
     UVersionInfo unicodeVersion;
 };
 